@@ -0,0 +1,202 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Measures the throughput of the hash functions provided by `Zycore/Hash.h`.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <Zycore/Defines.h>
+#include <Zycore/Hash.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `BenchmarkFunction` function prototype.
+ *
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  The hash value.
+ */
+typedef ZyanU64 (*BenchmarkFunction)(const void* data, ZyanUSize size);
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * Hashes the given data using `ZyanHash64`.
+ *
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  The hash value.
+ */
+static ZyanU64 HashOneShot(const void* data, ZyanUSize size)
+{
+    return ZyanHash64(data, size, 0);
+}
+
+/**
+ * Hashes the given data using the incremental `ZyanHash64` interface and chunks of `64` bytes.
+ *
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  The hash value.
+ */
+static ZyanU64 HashStreaming(const void* data, ZyanUSize size)
+{
+    const ZyanU8* p = (const ZyanU8*)data;
+
+    ZyanHashState state;
+    ZyanHash64Init(&state, 0);
+    while (size)
+    {
+        const ZyanUSize n = ZYAN_MIN(size, 64);
+        ZyanHash64Update(&state, p, n);
+        p += n;
+        size -= n;
+    }
+
+    ZyanU64 hash;
+    ZyanHash64Final(&state, &hash);
+    return hash;
+}
+
+/**
+ * Calculates the CRC-32C checksum of the given data.
+ *
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  The checksum.
+ */
+static ZyanU64 HashCrc32c(const void* data, ZyanUSize size)
+{
+    return ZyanCrc32c(0, data, size);
+}
+
+/**
+ * Hashes the given data using the 64-bit FNV-1a hash function as a baseline.
+ *
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  The hash value.
+ */
+static ZyanU64 HashFNV1a(const void* data, ZyanUSize size)
+{
+    const ZyanU8* p = (const ZyanU8*)data;
+
+    ZyanU64 hash = 0xCBF29CE484222325ULL;
+    for (ZyanUSize i = 0; i < size; ++i)
+    {
+        hash ^= p[i];
+        hash *= 0x00000100000001B3ULL;
+    }
+    return hash;
+}
+
+/* ============================================================================================== */
+/* Benchmarks                                                                                     */
+/* ============================================================================================== */
+
+/**
+ * Measures the throughput of the given hash function.
+ *
+ * @param   name        The name of the hash function.
+ * @param   function    The hash function.
+ * @param   data        A pointer to the input data.
+ * @param   size        The size of a single input in bytes.
+ * @param   total       The total number of bytes to hash.
+ */
+static void Benchmark(const char* name, BenchmarkFunction function, const ZyanU8* data,
+    ZyanUSize size, ZyanUSize total)
+{
+    const ZyanUSize iterations = total / size;
+
+    // Accumulate the results to prevent the compiler from eliminating the calls
+    ZyanU64 sink = 0;
+    const clock_t start = clock();
+    for (ZyanUSize i = 0; i < iterations; ++i)
+    {
+        sink += function(data + (i & 63), size);
+    }
+    const clock_t end = clock();
+
+    const double seconds = (double)(end - start) / CLOCKS_PER_SEC;
+    const double mbps = seconds > 0 ? ((double)(iterations * size) / (1024 * 1024)) / seconds : 0;
+    printf("  %-10s %8" PRIuPTR " bytes: %10.1f MiB/s (%016" PRIX64 ")\n", name, size, mbps,
+        sink);
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main()
+{
+    static const ZyanUSize sizes[] = { 4, 16, 64, 256, 4096, 1024 * 1024 };
+    static const ZyanUSize total = 256 * 1024 * 1024;
+    static const ZyanUSize max_size = 1024 * 1024 + 64;
+
+    ZyanU8* data = (ZyanU8*)malloc(max_size);
+    if (!data)
+    {
+        return EXIT_FAILURE;
+    }
+
+    time_t t;
+    srand((unsigned)time(&t));
+    for (ZyanUSize i = 0; i < max_size; ++i)
+    {
+        data[i] = (ZyanU8)rand();
+    }
+
+    for (ZyanUSize i = 0; i < ZYAN_ARRAY_LENGTH(sizes); ++i)
+    {
+        puts("");
+        Benchmark("Hash64", &HashOneShot, data, sizes[i], total);
+        Benchmark("Streaming", &HashStreaming, data, sizes[i], total);
+        Benchmark("CRC-32C", &HashCrc32c, data, sizes[i], total);
+        Benchmark("FNV-1a", &HashFNV1a, data, sizes[i], total);
+    }
+
+    free(data);
+
+    return EXIT_SUCCESS;
+}
+
+/* ============================================================================================== */
@@ -55,6 +55,12 @@ extern "C" {
 
 typedef pthread_mutex_t ZyanCriticalSection;
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Reader-writer lock                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+typedef pthread_rwlock_t ZyanReadWriteLock;
+
 /* ---------------------------------------------------------------------------------------------- */
 
 #elif defined(ZYAN_WINDOWS)
@@ -67,6 +73,12 @@ typedef pthread_mutex_t ZyanCriticalSection;
 
 typedef CRITICAL_SECTION ZyanCriticalSection;
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Reader-writer lock                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+typedef SRWLOCK ZyanReadWriteLock;
+
 /* ---------------------------------------------------------------------------------------------- */
 
 #else
@@ -119,6 +131,56 @@ ZYCORE_EXPORT ZyanStatus ZyanCriticalSectionLeave(ZyanCriticalSection* critical_
  */
 ZYCORE_EXPORT ZyanStatus ZyanCriticalSectionDelete(ZyanCriticalSection* critical_section);
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Reader-writer lock                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes a reader-writer lock.
+ *
+ * @param   lock    A pointer to the `ZyanReadWriteLock` struct.
+ *
+ * In contrast to `ZyanCriticalSection`, the lock is not recursive.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanReadWriteLockInitialize(ZyanReadWriteLock* lock);
+
+/**
+ * Acquires a reader-writer lock in shared mode.
+ *
+ * @param   lock    A pointer to the `ZyanReadWriteLock` struct.
+ *
+ * Any number of threads can hold the lock in shared mode at the same time.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanReadWriteLockAcquireShared(ZyanReadWriteLock* lock);
+
+/**
+ * Releases a reader-writer lock that was acquired in shared mode.
+ *
+ * @param   lock    A pointer to the `ZyanReadWriteLock` struct.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanReadWriteLockReleaseShared(ZyanReadWriteLock* lock);
+
+/**
+ * Acquires a reader-writer lock in exclusive mode.
+ *
+ * @param   lock    A pointer to the `ZyanReadWriteLock` struct.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanReadWriteLockAcquireExclusive(ZyanReadWriteLock* lock);
+
+/**
+ * Releases a reader-writer lock that was acquired in exclusive mode.
+ *
+ * @param   lock    A pointer to the `ZyanReadWriteLock` struct.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanReadWriteLockReleaseExclusive(ZyanReadWriteLock* lock);
+
+/**
+ * Deletes a reader-writer lock.
+ *
+ * @param   lock    A pointer to the `ZyanReadWriteLock` struct.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanReadWriteLockDelete(ZyanReadWriteLock* lock);
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
@@ -115,6 +115,18 @@ typedef struct ZyanAtomicPointer_
 #define ZYAN_ATOMIC_DECREMENT32(destination) \
     ZyanAtomicDecrement32((ZyanAtomic32*)&(destination));
 
+/**
+ * @copydoc ZyanAtomicFetchOr32
+ */
+#define ZYAN_ATOMIC_FETCH_OR32(destination, value) \
+    ZyanAtomicFetchOr32((ZyanAtomic32*)&(destination), (value))
+
+/**
+ * @copydoc ZyanAtomicFetchAnd32
+ */
+#define ZYAN_ATOMIC_FETCH_AND32(destination, value) \
+    ZyanAtomicFetchAnd32((ZyanAtomic32*)&(destination), (value))
+
 /* ---------------------------------------------------------------------------------------------- */
 /* 64-bit                                                                                         */
 /* ---------------------------------------------------------------------------------------------- */
@@ -137,6 +149,18 @@ typedef struct ZyanAtomicPointer_
 #define ZYAN_ATOMIC_DECREMENT64(destination) \
     ZyanAtomicDecrement64((ZyanAtomic64*)&(destination));
 
+/**
+ * @copydoc ZyanAtomicFetchOr64
+ */
+#define ZYAN_ATOMIC_FETCH_OR64(destination, value) \
+    ZyanAtomicFetchOr64((ZyanAtomic64*)&(destination), (value))
+
+/**
+ * @copydoc ZyanAtomicFetchAnd64
+ */
+#define ZYAN_ATOMIC_FETCH_AND64(destination, value) \
+    ZyanAtomicFetchAnd64((ZyanAtomic64*)&(destination), (value))
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
@@ -197,6 +221,28 @@ static ZyanU32 ZyanAtomicIncrement32(ZyanAtomic32* destination);
  */
 static ZyanU32 ZyanAtomicDecrement32(ZyanAtomic32* destination);
 
+/**
+ * Performs a bitwise OR of the given value and `value` and stores the result, as an atomic
+ * operation.
+ *
+ * @param   destination A pointer to the destination value.
+ * @param   value       The value to combine with.
+ *
+ * @return  The original value.
+ */
+static ZyanU32 ZyanAtomicFetchOr32(ZyanAtomic32* destination, ZyanU32 value);
+
+/**
+ * Performs a bitwise AND of the given value and `value` and stores the result, as an atomic
+ * operation.
+ *
+ * @param   destination A pointer to the destination value.
+ * @param   value       The value to combine with.
+ *
+ * @return  The original value.
+ */
+static ZyanU32 ZyanAtomicFetchAnd32(ZyanAtomic32* destination, ZyanU32 value);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* 64-bit                                                                                         */
 /* ---------------------------------------------------------------------------------------------- */
@@ -217,6 +263,28 @@ static ZyanU64 ZyanAtomicIncrement64(ZyanAtomic64* destination);
  */
 static ZyanU64 ZyanAtomicDecrement64(ZyanAtomic64* destination);
 
+/**
+ * Performs a bitwise OR of the given 64-bit value and `value` and stores the result, as an atomic
+ * operation.
+ *
+ * @param   destination A pointer to the destination value.
+ * @param   value       The 64-bit value to combine with.
+ *
+ * @return  The original 64-bit value.
+ */
+static ZyanU64 ZyanAtomicFetchOr64(ZyanAtomic64* destination, ZyanU64 value);
+
+/**
+ * Performs a bitwise AND of the given 64-bit value and `value` and stores the result, as an atomic
+ * operation.
+ *
+ * @param   destination A pointer to the destination value.
+ * @param   value       The 64-bit value to combine with.
+ *
+ * @return  The original 64-bit value.
+ */
+static ZyanU64 ZyanAtomicFetchAnd64(ZyanAtomic64* destination, ZyanU64 value);
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
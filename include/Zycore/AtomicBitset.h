@@ -0,0 +1,270 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a fixed-size bitset with lock-free atomic bit operations.
+ */
+
+#ifndef ZYCORE_ATOMICBITSET_H
+#define ZYCORE_ATOMICBITSET_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Atomic.h>
+#include <Zycore/Bitset.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanAtomicBitset` struct.
+ *
+ * The atomic bitset stores a fixed number of bits in 64-bit words. Bit `i` is bit `i % 64` of word
+ * `i / 64`. All single-bit and word operations are performed with atomic read-modify-write
+ * instructions, so any number of threads may set and clear bits concurrently without additional
+ * locking. Whole-bitset queries (`ZyanAtomicBitsetCount`, `ZyanAtomicBitsetSnapshot`) read the
+ * words one by one and are therefore only consistent, if no concurrent writers are active.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanAtomicBitset_
+{
+    /**
+     * The `ZyanAllocator` instance.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The number of bits.
+     */
+    ZyanUSize size;
+    /**
+     * The number of words.
+     */
+    ZyanUSize word_count;
+    /**
+     * The words.
+     */
+    ZyanAtomic64* words;
+} ZyanAtomicBitset;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanAtomicBitset` instance.
+ *
+ * @param   bitset  A pointer to the `ZyanAtomicBitset` instance.
+ * @param   count   The number of bits. All bits are initially cleared.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the bitset is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanAtomicBitsetDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanAtomicBitsetInit(ZyanAtomicBitset* bitset,
+    ZyanUSize count);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanAtomicBitset` instance and sets a custom `allocator`.
+ *
+ * @param   bitset      A pointer to the `ZyanAtomicBitset` instance.
+ * @param   count       The number of bits. All bits are initially cleared.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanAtomicBitsetDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAtomicBitsetInitEx(ZyanAtomicBitset* bitset, ZyanUSize count,
+    ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanAtomicBitset` instance.
+ *
+ * @param   bitset  A pointer to the `ZyanAtomicBitset` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * No other thread may access the bitset while (or after) it is destroyed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAtomicBitsetDestroy(ZyanAtomicBitset* bitset);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Atomic bit access                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Atomically sets the bit at `index` to `1` and returns its previous value.
+ *
+ * @param   bitset  A pointer to the `ZyanAtomicBitset` instance.
+ * @param   index   The bit index.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the bit was already set, `ZYAN_STATUS_FALSE`, if this call set
+ *          it. Another zyan status code, if an error occurred.
+ *
+ * If several threads race to set the same bit, exactly one of them observes
+ * `ZYAN_STATUS_FALSE`, which makes this function suitable for claiming work items.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAtomicBitsetTestAndSet(ZyanAtomicBitset* bitset, ZyanUSize index);
+
+/**
+ * Atomically sets the bit at `index` to `0` and returns its previous value.
+ *
+ * @param   bitset  A pointer to the `ZyanAtomicBitset` instance.
+ * @param   index   The bit index.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the bit was set, `ZYAN_STATUS_FALSE`, if not. Another zyan
+ *          status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAtomicBitsetTestAndReset(ZyanAtomicBitset* bitset, ZyanUSize index);
+
+/**
+ * Returns the current value of the bit at `index`.
+ *
+ * @param   bitset  A pointer to the `ZyanAtomicBitset` instance.
+ * @param   index   The bit index.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the bit is set, `ZYAN_STATUS_FALSE`, if not. Another zyan
+ *          status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAtomicBitsetTest(const ZyanAtomicBitset* bitset, ZyanUSize index);
+
+/**
+ * Atomically performs a bitwise OR of the word at `word_index` and `mask`.
+ *
+ * @param   bitset      A pointer to the `ZyanAtomicBitset` instance.
+ * @param   word_index  The word index (bit index divided by `64`).
+ * @param   mask        The bits to set.
+ * @param   previous    Receives the previous value of the word. This argument is optional and
+ *                      may be `ZYAN_NULL`.
+ *
+ * @return  A zyan status code.
+ *
+ * Bits of the last word beyond the size of the bitset are ignored.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAtomicBitsetFetchOrWord(ZyanAtomicBitset* bitset,
+    ZyanUSize word_index, ZyanU64 mask, ZyanU64* previous);
+
+/**
+ * Atomically performs a bitwise AND of the word at `word_index` and `mask`.
+ *
+ * @param   bitset      A pointer to the `ZyanAtomicBitset` instance.
+ * @param   word_index  The word index (bit index divided by `64`).
+ * @param   mask        The bits to keep.
+ * @param   previous    Receives the previous value of the word. This argument is optional and
+ *                      may be `ZYAN_NULL`.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAtomicBitsetFetchAndWord(ZyanAtomicBitset* bitset,
+    ZyanUSize word_index, ZyanU64 mask, ZyanU64* previous);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Non-atomic access                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Clears all bits.
+ *
+ * @param   bitset  A pointer to the `ZyanAtomicBitset` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Each word is cleared individually. Bits set concurrently may or may not survive.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAtomicBitsetResetAll(ZyanAtomicBitset* bitset);
+
+/**
+ * Returns the number of set bits.
+ *
+ * @param   bitset  A pointer to the `ZyanAtomicBitset` instance.
+ * @param   count   Receives the number of set bits.
+ *
+ * @return  A zyan status code.
+ *
+ * The words are read one by one without synchronization. The result is exact, if no other thread
+ * modifies the bitset at the same time.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAtomicBitsetCount(const ZyanAtomicBitset* bitset, ZyanUSize* count);
+
+/**
+ * Copies the current state of the bitset into a regular `ZyanBitset`.
+ *
+ * @param   bitset      A pointer to the `ZyanAtomicBitset` instance.
+ * @param   destination A pointer to an initialized `ZyanBitset` instance that receives the bits.
+ *                      It is resized to the size of the atomic bitset.
+ *
+ * @return  A zyan status code.
+ *
+ * The words are read one by one without synchronization. The snapshot is exact, if no other
+ * thread modifies the bitset at the same time.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAtomicBitsetSnapshot(const ZyanAtomicBitset* bitset,
+    ZyanBitset* destination);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the number of bits.
+ *
+ * @param   bitset  A pointer to the `ZyanAtomicBitset` instance.
+ * @param   size    Receives the number of bits.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAtomicBitsetGetSize(const ZyanAtomicBitset* bitset, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_ATOMICBITSET_H */
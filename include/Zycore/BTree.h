@@ -0,0 +1,430 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements an ordered map based on a B+ tree.
+ */
+
+#ifndef ZYCORE_BTREE_H
+#define ZYCORE_BTREE_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Comparison.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The default size of a single tree node in bytes.
+ */
+#define ZYAN_BTREE_DEFAULT_NODE_SIZE    512
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanBTree` struct.
+ *
+ * The tree stores all entries in its leaf nodes, which are linked to each other in key order.
+ * Inner nodes only contain separator keys and child pointers. All nodes have the same fixed size
+ * (a multiple of the cache line or page size is recommended), so that a single node holds many
+ * keys and a lookup touches only a few nodes.
+ *
+ * A tree with a `value_size` of `0` acts as an ordered set.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanBTree_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The size of a single key in bytes.
+     */
+    ZyanUSize key_size;
+    /**
+     * The size of a single value in bytes.
+     */
+    ZyanUSize value_size;
+    /**
+     * The key comparison function.
+     */
+    ZyanComparison compare;
+    /**
+     * The size of a single node in bytes.
+     */
+    ZyanUSize node_size;
+    /**
+     * The maximum number of entries in a leaf node.
+     */
+    ZyanU32 leaf_capacity;
+    /**
+     * The maximum number of keys in an inner node.
+     */
+    ZyanU32 inner_capacity;
+    /**
+     * The offset of the keys relative to the start of a leaf node.
+     */
+    ZyanUSize leaf_keys_offset;
+    /**
+     * The offset of the values relative to the start of a leaf node.
+     */
+    ZyanUSize leaf_values_offset;
+    /**
+     * The offset of the keys relative to the start of an inner node.
+     */
+    ZyanUSize inner_keys_offset;
+    /**
+     * The number of entries.
+     */
+    ZyanUSize size;
+    /**
+     * The number of levels (`0` for an empty tree).
+     */
+    ZyanUSize height;
+    /**
+     * The root node.
+     */
+    void* root;
+    /**
+     * The first leaf node.
+     */
+    void* first;
+    /**
+     * The last leaf node.
+     */
+    void* last;
+} ZyanBTree;
+
+/**
+ * Defines the `ZyanBTreeCursor` struct.
+ *
+ * Points to a single entry of a `ZyanBTree` or past the range of entries. A cursor is invalidated
+ * by any modification of the tree.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanBTreeCursor_
+{
+    /**
+     * The tree.
+     */
+    const ZyanBTree* tree;
+    /**
+     * The leaf node or `ZYAN_NULL`, if the cursor does not point to an entry.
+     */
+    void* leaf;
+    /**
+     * The index of the entry inside the leaf node.
+     */
+    ZyanUSize index;
+} ZyanBTreeCursor;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanBTree` instance.
+ *
+ * @param   tree        A pointer to the `ZyanBTree` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes or `0`, if the tree should act as a
+ *                      set.
+ * @param   compare     The key comparison function.
+ *
+ * @return  A zyan status code.
+ *
+ * The nodes are dynamically allocated by the default allocator using the default node size.
+ *
+ * Finalization with `ZyanBTreeDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanBTreeInit(ZyanBTree* tree, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanComparison compare);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanBTree` instance and sets a custom `allocator` and node size.
+ *
+ * @param   tree        A pointer to the `ZyanBTree` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes or `0`, if the tree should act as a
+ *                      set.
+ * @param   compare     The key comparison function.
+ * @param   node_size   The size of a single node in bytes or `0` to use the default size. Raised
+ *                      to the minimum size required to hold four entries.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanBTreeDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeInitEx(ZyanBTree* tree, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanComparison compare, ZyanUSize node_size, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanBTree` instance.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeDestroy(ZyanBTree* tree);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Inserts a new entry or replaces the value of an existing entry with the same key.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   A pointer to the value. Ignored for sets.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if a new entry was inserted, `ZYAN_STATUS_FALSE` if the value of an
+ *          existing entry was replaced or another zyan status code if an error occurred.
+ *
+ * Appending keys in ascending order fills the leaf nodes completely.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeInsert(ZyanBTree* tree, const void* key, const void* value);
+
+/**
+ * Builds the tree from the given sorted keys and values.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance. The tree must be empty.
+ * @param   keys    A pointer to a `ZyanVector` of keys in strictly ascending order.
+ * @param   values  A pointer to a `ZyanVector` of values with the same size as `keys`. Ignored
+ *                  for sets.
+ *
+ * @return  A zyan status code.
+ *
+ * The tree is built bottom-up in linear time, which is a lot faster than inserting the entries
+ * one by one.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeBulkLoad(ZyanBTree* tree, const ZyanVector* keys,
+    const ZyanVector* values);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Removes the entry with the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   key     A pointer to the key.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was removed, `ZYAN_STATUS_FALSE` if no entry with the
+ *          given key exists or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeRemove(ZyanBTree* tree, const void* key);
+
+/**
+ * Erases all entries of the given tree.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeClear(ZyanBTree* tree);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a constant pointer to the value associated with the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a constant pointer to the value or `ZYAN_NULL`, if no entry with the
+ *                  given key exists. Optional.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ *
+ * Note that the returned pointer might get invalid when the tree is modified.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeGet(const ZyanBTree* tree, const void* key, const void** value);
+
+/**
+ * Returns a mutable pointer to the value associated with the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a mutable pointer to the value or `ZYAN_NULL`, if no entry with the
+ *                  given key exists. Optional.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ *
+ * Note that the returned pointer might get invalid when the tree is modified.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeGetMutable(ZyanBTree* tree, const void* key, void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Cursors                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Positions the given cursor at the first entry of the tree.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   cursor  A pointer to the `ZyanBTreeCursor` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the cursor points to an entry, `ZYAN_STATUS_FALSE` if the tree
+ *          is empty or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeBegin(const ZyanBTree* tree, ZyanBTreeCursor* cursor);
+
+/**
+ * Positions the given cursor at the last entry of the tree.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   cursor  A pointer to the `ZyanBTreeCursor` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the cursor points to an entry, `ZYAN_STATUS_FALSE` if the tree
+ *          is empty or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeLast(const ZyanBTree* tree, ZyanBTreeCursor* cursor);
+
+/**
+ * Positions the given cursor at the first entry whose key is not less than the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   cursor  A pointer to the `ZyanBTreeCursor` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the cursor points to an entry, `ZYAN_STATUS_FALSE` if all keys
+ *          are less than the given `key` or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeLowerBound(const ZyanBTree* tree, const void* key,
+    ZyanBTreeCursor* cursor);
+
+/**
+ * Positions the given cursor at the first entry whose key is greater than the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   cursor  A pointer to the `ZyanBTreeCursor` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the cursor points to an entry, `ZYAN_STATUS_FALSE` if no key is
+ *          greater than the given `key` or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeUpperBound(const ZyanBTree* tree, const void* key,
+    ZyanBTreeCursor* cursor);
+
+/**
+ * Moves the given cursor to the next entry.
+ *
+ * @param   cursor  A pointer to the `ZyanBTreeCursor` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the cursor points to an entry, `ZYAN_STATUS_FALSE` if it moved
+ *          past the last entry or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeCursorNext(ZyanBTreeCursor* cursor);
+
+/**
+ * Moves the given cursor to the previous entry.
+ *
+ * @param   cursor  A pointer to the `ZyanBTreeCursor` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the cursor points to an entry, `ZYAN_STATUS_FALSE` if it moved
+ *          before the first entry or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeCursorPrev(ZyanBTreeCursor* cursor);
+
+/**
+ * Returns the entry the given cursor points to.
+ *
+ * @param   cursor  A pointer to the `ZyanBTreeCursor` instance.
+ * @param   key     Receives a constant pointer to the key. Optional.
+ * @param   value   Receives a constant pointer to the value. Optional.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeCursorGet(const ZyanBTreeCursor* cursor, const void** key,
+    const void** value);
+
+/**
+ * Returns the entry the given cursor points to with a mutable pointer to the value.
+ *
+ * @param   cursor  A pointer to the `ZyanBTreeCursor` instance.
+ * @param   key     Receives a constant pointer to the key. Optional.
+ * @param   value   Receives a mutable pointer to the value. Optional.
+ *
+ * @return  A zyan status code.
+ *
+ * The key must not be modified, as this would break the ordering of the tree.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeCursorGetMutable(const ZyanBTreeCursor* cursor,
+    const void** key, void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current number of entries in the tree.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   size    Receives the number of entries.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBTreeGetSize(const ZyanBTree* tree, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_BTREE_H */
@@ -46,7 +46,31 @@ extern "C" {
 /* ============================================================================================== */
 
 /**
- * Defines the `ZyanVector` struct.
+ * Defines the `ZyanBitsetLayout` enum.
+ *
+ * The layout determines how bit indices are mapped to the bits of the underlying bytes.
+ */
+typedef enum ZyanBitsetLayout_
+{
+    /**
+     * Bit `i` is stored in bit `7 - (i % 8)` of byte `i / 8`, i.e. the most significant bit of
+     * every byte comes first.
+     *
+     * This is the default layout.
+     */
+    ZYAN_BITSET_LAYOUT_MSB_FIRST,
+    /**
+     * Bit `i` is stored in bit `i % 8` of byte `i / 8`, i.e. the least significant bit of every
+     * byte comes first.
+     *
+     * This is equivalent to bit `i % 64` of the little-endian 64-bit word `i / 64`, which is the
+     * layout used by most other bitset and bitmap implementations.
+     */
+    ZYAN_BITSET_LAYOUT_LSB_FIRST
+} ZyanBitsetLayout;
+
+/**
+ * Defines the `ZyanBitset` struct.
  *
  * All fields in this struct should be considered as "private". Any changes may lead to unexpected
  * behavior.
@@ -61,6 +85,14 @@ typedef struct ZyanBitset_
      * The bitset data.
      */
     ZyanVector bits;
+    /**
+     * The bit layout.
+     */
+    ZyanBitsetLayout layout;
+    /**
+     * Signals, if the bitset is a read-only view of an external buffer.
+     */
+    ZyanBool read_only;
 } ZyanBitset;
 
 /**
@@ -76,6 +108,68 @@ typedef struct ZyanBitset_
  */
 typedef ZyanStatus (*ZyanBitsetByteOperation)(ZyanU8* v1, const ZyanU8* v2);
 
+/**
+ * Defines the `ZyanBitsetCallback` function prototype.
+ *
+ * @param   index       The index of the current set bit.
+ * @param   user_data   The user data pointer passed to the iteration function.
+ *
+ * @return  `ZYAN_STATUS_TRUE` to continue the iteration, `ZYAN_STATUS_FALSE` to stop it or
+ *          another zyan status code to abort it with an error.
+ */
+typedef ZyanStatus (*ZyanBitsetCallback)(ZyanUSize index, void* user_data);
+
+/**
+ * Defines the `ZyanBitsetRankSelect` struct.
+ *
+ * A rank/select directory is an auxiliary index over a bitset that answers "how many bits are
+ * set before index `i`" (rank) in constant time and "where is the `k`-th set bit" (select) in
+ * near-constant time. It stores the number of set bits before every superblock of 65536 bits
+ * (64-bit), before every block of 512 bits relative to its superblock (16-bit) and the block of
+ * every 8192nd set bit, which adds roughly 3.2% to the size of the bitset.
+ *
+ * The directory refers to the bitset it was built for, which must neither be modified nor
+ * destroyed while the directory is in use.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanBitsetRankSelect_
+{
+    /**
+     * The `ZyanAllocator` instance.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The indexed bitset.
+     */
+    const ZyanBitset* bitset;
+    /**
+     * The total number of set bits.
+     */
+    ZyanUSize count;
+    /**
+     * The number of blocks.
+     */
+    ZyanUSize block_count;
+    /**
+     * The number of select samples.
+     */
+    ZyanUSize sample_count;
+    /**
+     * The number of set bits before each superblock.
+     */
+    ZyanU64* superblocks;
+    /**
+     * The number of set bits before each block, relative to its superblock.
+     */
+    ZyanU16* blocks;
+    /**
+     * The block that contains every 8192nd set bit.
+     */
+    ZyanUSize* samples;
+} ZyanBitsetRankSelect;
+
 /* ============================================================================================== */
 /* Exported functions                                                                             */
 /* ============================================================================================== */
@@ -133,6 +227,47 @@ ZYCORE_EXPORT ZyanStatus ZyanBitsetInitEx(ZyanBitset* bitset, ZyanUSize count,
 ZYCORE_EXPORT ZyanStatus ZyanBitsetInitBuffer(ZyanBitset* bitset, ZyanUSize count, void* buffer,
     ZyanUSize capacity);
 
+/**
+ * Initializes the given `ZyanBitset` instance on top of an existing, user defined buffer without
+ * copying it.
+ *
+ * @param   bitset      A pointer to the `ZyanBitset` instance.
+ * @param   count       The amount of bits.
+ * @param   layout      The layout of the bits in the buffer.
+ * @param   buffer      A pointer to the buffer that contains the bits.
+ * @param   capacity    The maximum capacity (number of bytes) of the buffer.
+ *
+ * @return  A zyan status code.
+ *
+ * The first `count` bits of the buffer become the content of the bitset. The bitset can grow up
+ * to `capacity` bytes.
+ *
+ * Note that this function writes to the buffer: if `count` is not a multiple of `8`, the bits of
+ * the last byte that lie past `count` are cleared, as all whole-bitset operations rely on them
+ * being zero. Pass a multiple of `8` as `count`, if these bits must be preserved.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetInitExternal(ZyanBitset* bitset, ZyanUSize count,
+    ZyanBitsetLayout layout, void* buffer, ZyanUSize capacity);
+
+/**
+ * Initializes the given `ZyanBitset` instance as a read-only view of an existing, user defined
+ * buffer.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   count   The amount of bits.
+ * @param   layout  The layout of the bits in the buffer.
+ * @param   buffer  A pointer to the buffer that contains the bits. Must be valid for at least
+ *                  `(count + 7) / 8` bytes.
+ *
+ * @return  A zyan status code.
+ *
+ * The buffer is neither copied nor modified. The unused bits of the last byte must be cleared.
+ *
+ * All functions that would modify the bitset fail with `ZYAN_STATUS_INVALID_OPERATION`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetInitReadOnly(ZyanBitset* bitset, ZyanUSize count,
+    ZyanBitsetLayout layout, const void* buffer);
+
 /**
  * Destroys the given `ZyanBitset` instance.
  *
@@ -142,6 +277,32 @@ ZYCORE_EXPORT ZyanStatus ZyanBitsetInitBuffer(ZyanBitset* bitset, ZyanUSize coun
  */
 ZYCORE_EXPORT ZyanStatus ZyanBitsetDestroy(ZyanBitset* bitset);
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Layout                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Changes the layout of the given bitset, converting its content in place.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   layout  The new layout.
+ *
+ * @return  A zyan status code.
+ *
+ * The value of every bit index is preserved.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetSetLayout(ZyanBitset* bitset, ZyanBitsetLayout layout);
+
+/**
+ * Returns the layout of the given bitset.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   layout  Receives the layout.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetGetLayout(const ZyanBitset* bitset, ZyanBitsetLayout* layout);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Logical operations                                                                             */
 /* ---------------------------------------------------------------------------------------------- */
@@ -157,7 +318,7 @@ ZYCORE_EXPORT ZyanStatus ZyanBitsetDestroy(ZyanBitset* bitset);
  * @return  A zyan status code.
  *
  * The `operation` callback is invoked once for every byte in the smallest of the `ZyanBitset`
- * instances.
+ * instances. Both instances must use the same layout.
  */
 ZYCORE_EXPORT ZyanStatus ZyanBitsetPerformByteOperation(ZyanBitset* destination,
     const ZyanBitset* source, ZyanBitsetByteOperation operation);
@@ -204,6 +365,95 @@ ZYCORE_EXPORT ZyanStatus ZyanBitsetOR (ZyanBitset* destination, const ZyanBitset
  */
 ZYCORE_EXPORT ZyanStatus ZyanBitsetXOR(ZyanBitset* destination, const ZyanBitset* source);
 
+/**
+ * Performs a logical `AND NOT` operation on the given `ZyanBitset` instances.
+ *
+ * @param   destination A pointer to the `ZyanBitset` instance that is used as the first input and
+ *                      as the destination.
+ * @param   source      A pointer to the `ZyanBitset` instance whose bits are cleared in the
+ *                      destination.
+ *
+ * @return  A zyan status code.
+ *
+ * If the destination bitmask contains more bits than the source one, the remaining bits are not
+ * modified.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetANDNOT(ZyanBitset* destination, const ZyanBitset* source);
+
+/**
+ * Stores the result of `a AND b` in the `destination` bitset.
+ *
+ * @param   destination A pointer to the `ZyanBitset` instance that receives the result.
+ * @param   a           A pointer to the first input `ZyanBitset` instance.
+ * @param   b           A pointer to the second input `ZyanBitset` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All bitsets must have the same size. The destination may be identical to any of the inputs.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetAssignAND(ZyanBitset* destination, const ZyanBitset* a,
+    const ZyanBitset* b);
+
+/**
+ * Stores the result of `a OR b` in the `destination` bitset.
+ *
+ * @param   destination A pointer to the `ZyanBitset` instance that receives the result.
+ * @param   a           A pointer to the first input `ZyanBitset` instance.
+ * @param   b           A pointer to the second input `ZyanBitset` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All bitsets must have the same size. The destination may be identical to any of the inputs.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetAssignOR(ZyanBitset* destination, const ZyanBitset* a,
+    const ZyanBitset* b);
+
+/**
+ * Stores the result of `a XOR b` in the `destination` bitset.
+ *
+ * @param   destination A pointer to the `ZyanBitset` instance that receives the result.
+ * @param   a           A pointer to the first input `ZyanBitset` instance.
+ * @param   b           A pointer to the second input `ZyanBitset` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All bitsets must have the same size. The destination may be identical to any of the inputs.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetAssignXOR(ZyanBitset* destination, const ZyanBitset* a,
+    const ZyanBitset* b);
+
+/**
+ * Stores the result of `a AND NOT b` in the `destination` bitset.
+ *
+ * @param   destination A pointer to the `ZyanBitset` instance that receives the result.
+ * @param   a           A pointer to the first input `ZyanBitset` instance.
+ * @param   b           A pointer to the second input `ZyanBitset` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All bitsets must have the same size. The destination may be identical to any of the inputs.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetAssignANDNOT(ZyanBitset* destination, const ZyanBitset* a,
+    const ZyanBitset* b);
+
+/**
+ * Stores the result of `a OR (b AND NOT c)` in the `destination` bitset.
+ *
+ * @param   destination A pointer to the `ZyanBitset` instance that receives the result.
+ * @param   a           A pointer to the first input `ZyanBitset` instance.
+ * @param   b           A pointer to the second input `ZyanBitset` instance.
+ * @param   c           A pointer to the third input `ZyanBitset` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * This is the transfer function `out = gen | (in & ~kill)` of the classic bit-vector dataflow
+ * problems, evaluated in a single pass over the inputs.
+ *
+ * All bitsets must have the same size. The destination may be identical to any of the inputs.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetAssignORANDNOT(ZyanBitset* destination, const ZyanBitset* a,
+    const ZyanBitset* b, const ZyanBitset* c);
+
 /**
  * Flips all bits of the given `ZyanBitset` instance.
  *
@@ -213,6 +463,138 @@ ZYCORE_EXPORT ZyanStatus ZyanBitsetXOR(ZyanBitset* destination, const ZyanBitset
  */
 ZYCORE_EXPORT ZyanStatus ZyanBitsetFlip(ZyanBitset* bitset);
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Shift and arithmetic operations                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Shifts all bits of the given bitset by `count` positions towards higher indices.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   count   The number of positions.
+ *
+ * @return  A zyan status code.
+ *
+ * Bits shifted past the end are discarded and the first `count` bits are cleared. Viewing the
+ * bitset as a number with bit `i` having the value `2^i`, this is the equivalent of a left
+ * shift.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetShiftLeft(ZyanBitset* bitset, ZyanUSize count);
+
+/**
+ * Shifts all bits of the given bitset by `count` positions towards lower indices.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   count   The number of positions.
+ *
+ * @return  A zyan status code.
+ *
+ * Bits shifted past index `0` are discarded and the last `count` bits are cleared.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetShiftRight(ZyanBitset* bitset, ZyanUSize count);
+
+/**
+ * Shifts all bits of `source` by `count` positions towards higher indices and stores the result
+ * in `destination`.
+ *
+ * @param   destination A pointer to the `ZyanBitset` instance that receives the result.
+ * @param   source      A pointer to the input `ZyanBitset` instance.
+ * @param   count       The number of positions.
+ *
+ * @return  A zyan status code.
+ *
+ * Both bitsets must have the same size and layout. `destination` may be identical to `source`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetAssignShiftLeft(ZyanBitset* destination,
+    const ZyanBitset* source, ZyanUSize count);
+
+/**
+ * Shifts all bits of `source` by `count` positions towards lower indices and stores the result
+ * in `destination`.
+ *
+ * @param   destination A pointer to the `ZyanBitset` instance that receives the result.
+ * @param   source      A pointer to the input `ZyanBitset` instance.
+ * @param   count       The number of positions.
+ *
+ * @return  A zyan status code.
+ *
+ * Both bitsets must have the same size and layout. `destination` may be identical to `source`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetAssignShiftRight(ZyanBitset* destination,
+    const ZyanBitset* source, ZyanUSize count);
+
+/**
+ * Rotates all bits of the given bitset by `count` positions towards higher indices.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   count   The number of positions.
+ *
+ * @return  A zyan status code.
+ *
+ * Bits shifted past the end reappear at the beginning.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetRotateLeft(ZyanBitset* bitset, ZyanUSize count);
+
+/**
+ * Rotates all bits of the given bitset by `count` positions towards lower indices.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   count   The number of positions.
+ *
+ * @return  A zyan status code.
+ *
+ * Bits shifted past index `0` reappear at the end.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetRotateRight(ZyanBitset* bitset, ZyanUSize count);
+
+/**
+ * Rotates all bits of `source` by `count` positions towards higher indices and stores the result
+ * in `destination`.
+ *
+ * @param   destination A pointer to the `ZyanBitset` instance that receives the result.
+ * @param   source      A pointer to the input `ZyanBitset` instance.
+ * @param   count       The number of positions.
+ *
+ * @return  A zyan status code.
+ *
+ * Both bitsets must have the same size and layout. `destination` may be identical to `source`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetAssignRotateLeft(ZyanBitset* destination,
+    const ZyanBitset* source, ZyanUSize count);
+
+/**
+ * Rotates all bits of `source` by `count` positions towards lower indices and stores the result
+ * in `destination`.
+ *
+ * @param   destination A pointer to the `ZyanBitset` instance that receives the result.
+ * @param   source      A pointer to the input `ZyanBitset` instance.
+ * @param   count       The number of positions.
+ *
+ * @return  A zyan status code.
+ *
+ * Both bitsets must have the same size and layout. `destination` may be identical to `source`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetAssignRotateRight(ZyanBitset* destination,
+    const ZyanBitset* source, ZyanUSize count);
+
+/**
+ * Adds `source` to `destination`, treating both bitsets as unsigned numbers with bit `i` having
+ * the value `2^i`.
+ *
+ * @param   destination A pointer to the `ZyanBitset` instance that is used as the first input and
+ *                      as the destination.
+ * @param   source      A pointer to the `ZyanBitset` instance that is used as the second input.
+ * @param   carry       A pointer to the carry flag. Its value is added as the initial carry and
+ *                      receives the carry out of the last bit. Pass `ZYAN_NULL` for no carry.
+ *
+ * @return  A zyan status code.
+ *
+ * Both bitsets must have the same size and layout. The carry propagates from lower to higher
+ * indices, as required by bit-parallel algorithms like Shift-And or Myers' edit distance.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetAdd(ZyanBitset* destination, const ZyanBitset* source,
+    ZyanBool* carry);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Bit access                                                                                     */
 /* ---------------------------------------------------------------------------------------------- */
@@ -289,6 +671,34 @@ ZYCORE_EXPORT ZyanStatus ZyanBitsetTestMSB(ZyanBitset* bitset);
  */
 ZYCORE_EXPORT ZyanStatus ZyanBitsetTestLSB(ZyanBitset* bitset);
 
+/**
+ * Returns the bits `[index, index + count)` of the given bitset as a single word.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   index   The index of the first bit. Does not have to be aligned.
+ * @param   count   The number of bits (`0` to `64`).
+ * @param   value   Receives the bits. Bit `index` is stored in bit `0`, the remaining bits are
+ *                  cleared.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetGetWord(const ZyanBitset* bitset, ZyanUSize index,
+    ZyanU8 count, ZyanU64* value);
+
+/**
+ * Replaces the bits `[index, index + count)` of the given bitset with the `count` least
+ * significant bits of `value`.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   index   The index of the first bit. Does not have to be aligned.
+ * @param   value   The new bits. Bit `0` is stored at `index`.
+ * @param   count   The number of bits (`0` to `64`).
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetSetWord(ZyanBitset* bitset, ZyanUSize index, ZyanU64 value,
+    ZyanU8 count);
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /**
@@ -309,6 +719,150 @@ ZYCORE_EXPORT ZyanStatus ZyanBitsetSetAll(ZyanBitset* bitset);
  */
 ZYCORE_EXPORT ZyanStatus ZyanBitsetResetAll(ZyanBitset* bitset);
 
+/**
+ * Sets the bits `[begin, end)` to `1`.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   begin   The index of the first bit.
+ * @param   end     The index past the last bit.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetSetRange(ZyanBitset* bitset, ZyanUSize begin, ZyanUSize end);
+
+/**
+ * Sets the bits `[begin, end)` to `0`.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   begin   The index of the first bit.
+ * @param   end     The index past the last bit.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetResetRange(ZyanBitset* bitset, ZyanUSize begin, ZyanUSize end);
+
+/**
+ * Toggles the bits `[begin, end)`.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   begin   The index of the first bit.
+ * @param   end     The index past the last bit.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetFlipRange(ZyanBitset* bitset, ZyanUSize begin, ZyanUSize end);
+
+/**
+ * Checks, if at least one of the bits `[begin, end)` is set.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   begin   The index of the first bit.
+ * @param   end     The index past the last bit.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if at least one bit is set, `ZYAN_STATUS_FALSE`, if not (or if
+ *          the range is empty). Another zyan status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetAnyRange(const ZyanBitset* bitset, ZyanUSize begin,
+    ZyanUSize end);
+
+/**
+ * Checks, if all of the bits `[begin, end)` are set.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   begin   The index of the first bit.
+ * @param   end     The index past the last bit.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if all bits are set (or if the range is empty),
+ *          `ZYAN_STATUS_FALSE`, if not. Another zyan status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetAllRange(const ZyanBitset* bitset, ZyanUSize begin,
+    ZyanUSize end);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the index of the first set bit.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   found   Receives the index of the first set bit.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if a set bit was found, `ZYAN_STATUS_FALSE`, if not. Another zyan
+ *          status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetFindFirstSet(const ZyanBitset* bitset, ZyanUSize* found);
+
+/**
+ * Returns the index of the first set bit at or after the given `index`.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   index   The index to start the search at. May be equal to the size of the bitset.
+ * @param   found   Receives the index of the set bit.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if a set bit was found, `ZYAN_STATUS_FALSE`, if not. Another zyan
+ *          status code, if an error occurred.
+ *
+ * The search skips 64 bits at a time, so iterating a bitset by passing the previous result plus
+ * one only costs time for words that actually contain set bits.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetFindNextSet(const ZyanBitset* bitset, ZyanUSize index,
+    ZyanUSize* found);
+
+/**
+ * Returns the index of the first cleared bit at or after the given `index`.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   index   The index to start the search at. May be equal to the size of the bitset.
+ * @param   found   Receives the index of the cleared bit.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if a cleared bit was found, `ZYAN_STATUS_FALSE`, if not. Another
+ *          zyan status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetFindNextClear(const ZyanBitset* bitset, ZyanUSize index,
+    ZyanUSize* found);
+
+/**
+ * Returns the index of the last set bit.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   found   Receives the index of the last set bit.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if a set bit was found, `ZYAN_STATUS_FALSE`, if not. Another zyan
+ *          status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetFindLastSet(const ZyanBitset* bitset, ZyanUSize* found);
+
+/**
+ * Invokes the given `callback` for every set bit in ascending order.
+ *
+ * @param   bitset      A pointer to the `ZyanBitset` instance.
+ * @param   callback    The callback function.
+ * @param   user_data   A user defined pointer that is passed to the callback function.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if all set bits were visited, `ZYAN_STATUS_FALSE` if the
+ *          callback stopped the iteration or the error code returned by the callback.
+ *
+ * The bitset must not be modified by the callback.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetForEachSet(const ZyanBitset* bitset,
+    ZyanBitsetCallback callback, void* user_data);
+
+/**
+ * Appends the indices of all set bits in ascending order to the given vector.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   indices A pointer to a `ZyanVector` instance with `ZyanU32` elements that receives
+ *                  the indices.
+ *
+ * @return  A zyan status code.
+ *
+ * The indices are decoded a byte at a time with vector instructions where available. Returns
+ * `ZYAN_STATUS_INVALID_OPERATION`, if the bitset holds more bits than can be indexed by a
+ * `ZyanU32`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetExportIndices(const ZyanBitset* bitset, ZyanVector* indices);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Size management                                                                                */
 /* ---------------------------------------------------------------------------------------------- */
@@ -332,6 +886,40 @@ ZYCORE_EXPORT ZyanStatus ZyanBitsetPush(ZyanBitset* bitset, ZyanBool value);
  */
 ZYCORE_EXPORT ZyanStatus ZyanBitsetPop(ZyanBitset* bitset);
 
+/**
+ * Adds `count` bits with the given value at the end of the bitset.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   count   The number of bits to add.
+ * @param   value   The value of the new bits.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetAppend(ZyanBitset* bitset, ZyanUSize count, ZyanBool value);
+
+/**
+ * Adds the `count` least significant bits of `value` at the end of the bitset.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   value   The bits to add. Bit `0` is added first.
+ * @param   count   The number of bits to add (`0` to `64`).
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetAppendWord(ZyanBitset* bitset, ZyanU64 value, ZyanU8 count);
+
+/**
+ * Changes the size of the bitset to `count` bits.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   count   The new size in bits.
+ *
+ * @return  A zyan status code.
+ *
+ * New bits are set to `0`. Growing the bitset performs at most a single allocation.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetResize(ZyanBitset* bitset, ZyanUSize count);
+
 /**
  * Deletes all bits of the given `ZyanBitset` instance.
  *
@@ -420,6 +1008,64 @@ ZYCORE_EXPORT ZyanStatus ZyanBitsetGetCapacityBytes(const ZyanBitset* bitset, Zy
  */
 ZYCORE_EXPORT ZyanStatus ZyanBitsetCount(const ZyanBitset* bitset, ZyanUSize* count);
 
+/**
+ * Returns the amount of bits set in `a & b` without materializing the result.
+ *
+ * @param   a       A pointer to the first `ZyanBitset` instance.
+ * @param   b       A pointer to the second `ZyanBitset` instance.
+ * @param   count   Receives the amount of bits set in `a & b`.
+ *
+ * @return  A zyan status code.
+ *
+ * Both bitsets must have the same size. Together with `ZyanBitsetCountOR` this yields the
+ * Jaccard index `|a & b| / |a | b|` in a single pass over each bitset.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetCountAND(const ZyanBitset* a, const ZyanBitset* b,
+    ZyanUSize* count);
+
+/**
+ * Returns the amount of bits set in `a | b` without materializing the result.
+ *
+ * @param   a       A pointer to the first `ZyanBitset` instance.
+ * @param   b       A pointer to the second `ZyanBitset` instance.
+ * @param   count   Receives the amount of bits set in `a | b`.
+ *
+ * @return  A zyan status code.
+ *
+ * Both bitsets must have the same size.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetCountOR(const ZyanBitset* a, const ZyanBitset* b,
+    ZyanUSize* count);
+
+/**
+ * Returns the amount of bits set in `a ^ b` (the Hamming distance) without materializing the
+ * result.
+ *
+ * @param   a       A pointer to the first `ZyanBitset` instance.
+ * @param   b       A pointer to the second `ZyanBitset` instance.
+ * @param   count   Receives the amount of bits set in `a ^ b`.
+ *
+ * @return  A zyan status code.
+ *
+ * Both bitsets must have the same size.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetCountXOR(const ZyanBitset* a, const ZyanBitset* b,
+    ZyanUSize* count);
+
+/**
+ * Returns the amount of bits set in `a & ~b` without materializing the result.
+ *
+ * @param   a       A pointer to the first `ZyanBitset` instance.
+ * @param   b       A pointer to the second `ZyanBitset` instance.
+ * @param   count   Receives the amount of bits set in `a & ~b`.
+ *
+ * @return  A zyan status code.
+ *
+ * Both bitsets must have the same size.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetCountANDNOT(const ZyanBitset* a, const ZyanBitset* b,
+    ZyanUSize* count);
+
 /**
  * Checks, if all bits of the given bitset are set.
  *
@@ -472,6 +1118,80 @@ ZYCORE_EXPORT ZyanStatus ZyanBitsetNone(const ZyanBitset* bitset);
 // */
 //ZYCORE_EXPORT ZyanStatus ZyanBitsetToU64(const ZyanBitset* bitset, ZyanU64* value);
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Rank and select                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Builds a rank/select directory for the given bitset.
+ *
+ * @param   directory   A pointer to the `ZyanBitsetRankSelect` instance.
+ * @param   bitset      A pointer to the `ZyanBitset` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the directory is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanBitsetRankSelectDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanBitsetRankSelectInit(
+    ZyanBitsetRankSelect* directory, const ZyanBitset* bitset);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Builds a rank/select directory for the given bitset and sets a custom `allocator`.
+ *
+ * @param   directory   A pointer to the `ZyanBitsetRankSelect` instance.
+ * @param   bitset      A pointer to the `ZyanBitset` instance.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanBitsetRankSelectDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetRankSelectInitEx(ZyanBitsetRankSelect* directory,
+    const ZyanBitset* bitset, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanBitsetRankSelect` instance.
+ *
+ * @param   directory   A pointer to the `ZyanBitsetRankSelect` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetRankSelectDestroy(ZyanBitsetRankSelect* directory);
+
+/**
+ * Returns the number of set bits before the given index.
+ *
+ * @param   directory   A pointer to the `ZyanBitsetRankSelect` instance.
+ * @param   index       The bit index. Passing the size of the bitset returns the total number of
+ *                      set bits.
+ * @param   rank        Receives the number of set bits in `[0, index)`.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetRank(const ZyanBitsetRankSelect* directory, ZyanUSize index,
+    ZyanUSize* rank);
+
+/**
+ * Returns the index of the `k`-th set bit.
+ *
+ * @param   directory   A pointer to the `ZyanBitsetRankSelect` instance.
+ * @param   k           The zero-based number of the set bit.
+ * @param   index       Receives the index of the set bit.
+ *
+ * @return  A zyan status code. `ZYAN_STATUS_OUT_OF_RANGE` is returned, if the bitset contains
+ *          `k` or less set bits.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBitsetSelect(const ZyanBitsetRankSelect* directory, ZyanUSize k,
+    ZyanUSize* index);
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
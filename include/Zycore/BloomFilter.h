@@ -0,0 +1,317 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements Bloom filters backed by a `ZyanBitset`.
+ */
+
+#ifndef ZYCORE_BLOOM_FILTER_H
+#define ZYCORE_BLOOM_FILTER_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Bitset.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The size of a single block of a blocked Bloom filter in bits (one 64-byte cache line).
+ */
+#define ZYAN_BLOOM_FILTER_BLOCK_BITS    512
+
+/**
+ * The maximum number of hash functions (probes) per element.
+ */
+#define ZYAN_BLOOM_FILTER_MAX_HASHES    32
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanBloomFilterType` enum.
+ */
+typedef enum ZyanBloomFilterType_
+{
+    /**
+     * A classic Bloom filter that distributes the probes of an element over the whole bitset.
+     */
+    ZYAN_BLOOM_FILTER_STANDARD,
+    /**
+     * A blocked Bloom filter that places all probes of an element in the same 64-byte block.
+     *
+     * Queries touch a single cache line, at the cost of a slightly higher false positive rate for
+     * the same amount of memory.
+     */
+    ZYAN_BLOOM_FILTER_BLOCKED
+} ZyanBloomFilterType;
+
+/**
+ * Defines the `ZyanBloomFilter` struct.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanBloomFilter_
+{
+    /**
+     * The filter type.
+     */
+    ZyanBloomFilterType type;
+    /**
+     * The number of probes per element.
+     */
+    ZyanU8 hash_count;
+    /**
+     * The number of bits.
+     */
+    ZyanUSize bit_count;
+    /**
+     * The allocator used for the bit array.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The allocated memory block that holds the (64-byte aligned) bit array.
+     */
+    void* memory;
+    /**
+     * The bitset view of the aligned bit array.
+     */
+    ZyanBitset bits;
+} ZyanBloomFilter;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Sizing                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Calculates the filter parameters for the given number of elements and false positive rate.
+ *
+ * @param   type                The filter type.
+ * @param   expected_items      The number of elements expected to be added to the filter.
+ * @param   false_positive_rate The desired false positive rate (`0 < rate < 1`).
+ * @param   bit_count           Receives the number of bits.
+ * @param   hash_count          Receives the number of probes per element.
+ *
+ * @return  A zyan status code.
+ *
+ * The parameters are calculated using the usual formulas `m = -n * ln(p) / ln(2)^2` and
+ * `k = m / n * ln(2)`. For blocked filters, the number of bits is rounded up to a multiple of
+ * `ZYAN_BLOOM_FILTER_BLOCK_BITS`. Blocked filters do not reach the target rate exactly, since the
+ * load of the individual blocks varies; the difference grows with smaller target rates.
+ *
+ * The calculation uses floating point arithmetic (but not the math library), which is why this
+ * function is not available in `ZYAN_NO_LIBC` builds. Freestanding users (e.g. kernel mode code)
+ * have to determine the parameters ahead of time.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanBloomFilterCalculateSize(
+    ZyanBloomFilterType type, ZyanUSize expected_items, double false_positive_rate,
+    ZyanUSize* bit_count, ZyanU8* hash_count);
+
+#endif // ZYAN_NO_LIBC
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanBloomFilter` instance.
+ *
+ * @param   filter      A pointer to the `ZyanBloomFilter` instance.
+ * @param   type        The filter type.
+ * @param   bit_count   The number of bits. Rounded up to a multiple of
+ *                      `ZYAN_BLOOM_FILTER_BLOCK_BITS` for blocked filters.
+ * @param   hash_count  The number of probes per element (`1` to `ZYAN_BLOOM_FILTER_MAX_HASHES`).
+ *
+ * @return  A zyan status code.
+ *
+ * The bitset is dynamically allocated by the default allocator.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanBloomFilterInit(ZyanBloomFilter* filter,
+    ZyanBloomFilterType type, ZyanUSize bit_count, ZyanU8 hash_count);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanBloomFilter` instance and sets a custom `allocator`.
+ *
+ * @param   filter      A pointer to the `ZyanBloomFilter` instance.
+ * @param   type        The filter type.
+ * @param   bit_count   The number of bits. Rounded up to a multiple of
+ *                      `ZYAN_BLOOM_FILTER_BLOCK_BITS` for blocked filters.
+ * @param   hash_count  The number of probes per element (`1` to `ZYAN_BLOOM_FILTER_MAX_HASHES`).
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The bit array is aligned to 64 bytes, so every block of a blocked filter occupies exactly one
+ * cache line.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterInitEx(ZyanBloomFilter* filter, ZyanBloomFilterType type,
+    ZyanUSize bit_count, ZyanU8 hash_count, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanBloomFilter` instance.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterDestroy(ZyanBloomFilter* filter);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Adds the given data to the filter.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  A zyan status code.
+ *
+ * The data is hashed using `ZyanHash64` with a seed of `0`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterAdd(ZyanBloomFilter* filter, const void* data,
+    ZyanUSize size);
+
+/**
+ * Adds an element with the given precomputed 64-bit hash to the filter.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   hash    The 64-bit hash of the element.
+ *
+ * @return  A zyan status code.
+ *
+ * All probe positions are derived from the single hash value, so it should be of good quality.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterAddHash(ZyanBloomFilter* filter, ZyanU64 hash);
+
+/**
+ * Merges the elements of the `source` filter into the `destination` filter.
+ *
+ * @param   destination A pointer to the `ZyanBloomFilter` instance that receives the union.
+ * @param   source      A pointer to the source `ZyanBloomFilter` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Both filters must have been created with the same type, number of bits and number of probes.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterUnion(ZyanBloomFilter* destination,
+    const ZyanBloomFilter* source);
+
+/**
+ * Removes all elements from the filter.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterClear(ZyanBloomFilter* filter);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Checks, if the given data might have been added to the filter.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the data might be contained in the filter, `ZYAN_STATUS_FALSE`,
+ *          if it definitely is not, or another zyan status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterContains(const ZyanBloomFilter* filter, const void* data,
+    ZyanUSize size);
+
+/**
+ * Checks, if an element with the given precomputed 64-bit hash might have been added to the
+ * filter.
+ *
+ * @param   filter  A pointer to the `ZyanBloomFilter` instance.
+ * @param   hash    The 64-bit hash of the element.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the element might be contained in the filter,
+ *          `ZYAN_STATUS_FALSE`, if it definitely is not, or another zyan status code, if an error
+ *          occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterContainsHash(const ZyanBloomFilter* filter, ZyanU64 hash);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the number of bits of the given filter.
+ *
+ * @param   filter      A pointer to the `ZyanBloomFilter` instance.
+ * @param   bit_count   Receives the number of bits.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterGetBitCount(const ZyanBloomFilter* filter,
+    ZyanUSize* bit_count);
+
+/**
+ * Returns the number of probes per element of the given filter.
+ *
+ * @param   filter      A pointer to the `ZyanBloomFilter` instance.
+ * @param   hash_count  Receives the number of probes.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanBloomFilterGetHashCount(const ZyanBloomFilter* filter,
+    ZyanU8* hash_count);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_BLOOM_FILTER_H */
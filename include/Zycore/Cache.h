@@ -0,0 +1,388 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a bounded cache with LRU or CLOCK eviction.
+ */
+
+#ifndef ZYCORE_CACHE_H
+#define ZYCORE_CACHE_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Comparison.h>
+#include <Zycore/HashMap.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanCachePolicy` enum.
+ */
+typedef enum ZyanCachePolicy_
+{
+    /**
+     * Evicts the least recently used entry.
+     *
+     * Every hit moves the entry to the front of the recency list.
+     */
+    ZYAN_CACHE_POLICY_LRU,
+    /**
+     * Approximates LRU using the CLOCK (second chance) algorithm.
+     *
+     * A hit only sets the reference bit of the entry, which makes hits cheaper than with the LRU
+     * policy. Entries are evicted by advancing a clock hand over all entries, clearing the
+     * reference bits until an unreferenced entry is found.
+     */
+    ZYAN_CACHE_POLICY_CLOCK
+} ZyanCachePolicy;
+
+/**
+ * Defines the `ZyanCacheEvictionCallback` function prototype.
+ *
+ * @param   key         A pointer to the key of the entry.
+ * @param   value       A pointer to the value of the entry.
+ * @param   weight      The weight of the entry.
+ * @param   user_data   The user data pointer passed to `ZyanCacheSetEvictionCallback`.
+ */
+typedef void (*ZyanCacheEvictionCallback)(const void* key, void* value, ZyanUSize weight,
+    void* user_data);
+
+/**
+ * Defines the `ZyanCache` struct.
+ *
+ * The cache stores a bounded number of entries in a single preallocated pool. Entries are found
+ * through an open addressing index of pool slots and additionally kept in an intrusive recency
+ * list (LRU policy) or visited by a clock hand (CLOCK policy). Lookups, insertions and
+ * evictions are `O(1)` and never allocate memory after initialization.
+ *
+ * Every entry has a user defined weight (e.g. its size in bytes). Entries are evicted when the
+ * maximum number of entries or the maximum total weight would be exceeded.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanCache_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The eviction policy.
+     */
+    ZyanCachePolicy policy;
+    /**
+     * The size of a single key in bytes.
+     */
+    ZyanUSize key_size;
+    /**
+     * The size of a single value in bytes.
+     */
+    ZyanUSize value_size;
+    /**
+     * The offset of the key relative to the start of an entry.
+     */
+    ZyanUSize key_offset;
+    /**
+     * The offset of the value relative to the start of an entry.
+     */
+    ZyanUSize value_offset;
+    /**
+     * The size of a single entry in bytes.
+     */
+    ZyanUSize entry_size;
+    /**
+     * The key hash function or `ZYAN_NULL` to hash the raw key bytes.
+     */
+    ZyanHashFunction hash;
+    /**
+     * The key equality comparison function or `ZYAN_NULL` to compare the raw key bytes.
+     */
+    ZyanEqualityComparison equals;
+    /**
+     * The eviction callback or `ZYAN_NULL`.
+     */
+    ZyanCacheEvictionCallback callback;
+    /**
+     * The user data pointer passed to the eviction callback.
+     */
+    void* user_data;
+    /**
+     * The maximum number of entries.
+     */
+    ZyanU32 max_entries;
+    /**
+     * The current number of entries.
+     */
+    ZyanU32 size;
+    /**
+     * The maximum total weight or `0`, if the weight is not limited.
+     */
+    ZyanUSize max_weight;
+    /**
+     * The current total weight.
+     */
+    ZyanUSize weight;
+    /**
+     * The entry pool.
+     */
+    void* entries;
+    /**
+     * The index table (entry indices).
+     */
+    ZyanU32* index;
+    /**
+     * The number of slots in the index table minus one.
+     */
+    ZyanU32 index_mask;
+    /**
+     * The most recently used entry (LRU policy).
+     */
+    ZyanU32 head;
+    /**
+     * The least recently used entry (LRU policy).
+     */
+    ZyanU32 tail;
+    /**
+     * The first unused entry.
+     */
+    ZyanU32 free;
+    /**
+     * The position of the clock hand (CLOCK policy).
+     */
+    ZyanU32 hand;
+} ZyanCache;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanCache` instance.
+ *
+ * @param   cache       A pointer to the `ZyanCache` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes.
+ * @param   policy      The eviction policy.
+ * @param   max_entries The maximum number of entries.
+ * @param   max_weight  The maximum total weight of all entries or `0`, if only the number of
+ *                      entries should be limited.
+ * @param   hash        The key hash function or `ZYAN_NULL` to hash the raw key bytes.
+ * @param   equals      The key equality comparison function or `ZYAN_NULL` to compare the raw key
+ *                      bytes.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for all entries is allocated upfront by the default allocator.
+ *
+ * Finalization with `ZyanCacheDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanCacheInit(ZyanCache* cache, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanCachePolicy policy, ZyanU32 max_entries, ZyanUSize max_weight,
+    ZyanHashFunction hash, ZyanEqualityComparison equals);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanCache` instance and sets a custom `allocator`.
+ *
+ * @param   cache       A pointer to the `ZyanCache` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes.
+ * @param   policy      The eviction policy.
+ * @param   max_entries The maximum number of entries.
+ * @param   max_weight  The maximum total weight of all entries or `0`, if only the number of
+ *                      entries should be limited.
+ * @param   hash        The key hash function or `ZYAN_NULL` to hash the raw key bytes.
+ * @param   equals      The key equality comparison function or `ZYAN_NULL` to compare the raw key
+ *                      bytes.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanCacheDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheInitEx(ZyanCache* cache, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanCachePolicy policy, ZyanU32 max_entries, ZyanUSize max_weight,
+    ZyanHashFunction hash, ZyanEqualityComparison equals, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanCache` instance.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The eviction callback is invoked for all remaining entries.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheDestroy(ZyanCache* cache);
+
+/**
+ * Sets the eviction callback.
+ *
+ * @param   cache       A pointer to the `ZyanCache` instance.
+ * @param   callback    The eviction callback or `ZYAN_NULL`.
+ * @param   user_data   A user defined pointer that is passed to the callback.
+ *
+ * @return  A zyan status code.
+ *
+ * The callback is invoked for every entry that leaves the cache (evicted to make room, removed,
+ * cleared or destroyed) and for the old value (and weight) when `ZyanCachePut` replaces the value
+ * of an existing entry. It must not modify the cache.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheSetEvictionCallback(ZyanCache* cache,
+    ZyanCacheEvictionCallback callback, void* user_data);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Inserts a new entry or replaces the value of an existing entry with the same key.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   A pointer to the value.
+ * @param   weight  The weight of the entry. Must not exceed the maximum total weight.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if a new entry was inserted, `ZYAN_STATUS_FALSE` if the value of an
+ *          existing entry was replaced or another zyan status code if an error occurred.
+ *
+ * Other entries are evicted as required to stay within the limits. The entry counts as used.
+ *
+ * If the value of an existing entry is replaced, the eviction callback is invoked for the old
+ * value first.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCachePut(ZyanCache* cache, const void* key, const void* value,
+    ZyanUSize weight);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Removes the entry with the given `key`.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   key     A pointer to the key.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was removed, `ZYAN_STATUS_FALSE` if no entry with the
+ *          given key exists or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheRemove(ZyanCache* cache, const void* key);
+
+/**
+ * Removes all entries from the given cache.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheClear(ZyanCache* cache);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a constant pointer to the value associated with the given `key` and marks the entry
+ * as used.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a constant pointer to the value or `ZYAN_NULL`, if no entry with the
+ *                  given key exists.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ *
+ * The returned pointer stays valid until the entry is evicted or removed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheGet(ZyanCache* cache, const void* key, const void** value);
+
+/**
+ * Returns a mutable pointer to the value associated with the given `key` and marks the entry
+ * as used.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a mutable pointer to the value or `ZYAN_NULL`, if no entry with the
+ *                  given key exists.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ *
+ * The returned pointer stays valid until the entry is evicted or removed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheGetMutable(ZyanCache* cache, const void* key, void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current number of entries in the cache.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   size    Receives the number of entries.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheGetSize(const ZyanCache* cache, ZyanUSize* size);
+
+/**
+ * Returns the current total weight of all entries in the cache.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   weight  Receives the total weight.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCacheGetWeight(const ZyanCache* cache, ZyanUSize* weight);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_CACHE_H */
@@ -0,0 +1,328 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a sharded hash map that can be shared between multiple threads.
+ */
+
+#ifndef ZYCORE_CONCURRENTHASHMAP_H
+#define ZYCORE_CONCURRENTHASHMAP_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/HashMap.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/API/Synchronization.h>
+
+#ifndef ZYAN_NO_LIBC
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The default number of shards.
+ */
+#define ZYAN_CONCURRENT_HASHMAP_DEFAULT_SHARD_COUNT 64
+
+/**
+ * The maximum number of shards.
+ */
+#define ZYAN_CONCURRENT_HASHMAP_MAX_SHARD_COUNT     4096
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanConcurrentHashMapShard` struct.
+ *
+ * A single independently locked segment of a `ZyanConcurrentHashMap`.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanConcurrentHashMapShard_
+{
+    /**
+     * The lock that protects the `map`.
+     */
+    ZyanReadWriteLock lock;
+    /**
+     * The hash map that stores the entries of this shard.
+     */
+    ZyanHashMap map;
+} ZyanConcurrentHashMapShard;
+
+/**
+ * Defines the `ZyanConcurrentHashMap` struct.
+ *
+ * The entries are distributed across a fixed number of shards by the upper bits of the mixed key
+ * hash.
+ * Every shard is a `ZyanHashMap` protected by its own reader-writer lock: lookups only acquire
+ * the lock of a single shard in shared mode, modifications acquire it in exclusive mode. Growing
+ * a shard only blocks the threads that access the same shard.
+ *
+ * Values are copied in and out of the map, as pointers into a shard would be invalidated by
+ * concurrent modifications.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanConcurrentHashMap_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The size of a single key in bytes.
+     */
+    ZyanUSize key_size;
+    /**
+     * The size of a single value in bytes.
+     */
+    ZyanUSize value_size;
+    /**
+     * The key hash function or `ZYAN_NULL` to hash the raw key bytes.
+     */
+    ZyanHashFunction hash;
+    /**
+     * The number of shards. Always a power of two.
+     */
+    ZyanUSize shard_count;
+    /**
+     * The binary logarithm of the number of shards.
+     */
+    ZyanU8 shard_bits;
+    /**
+     * The distance between two shards in bytes (rounded up to a multiple of the cache line size).
+     */
+    ZyanUSize shard_stride;
+    /**
+     * The memory block that contains the shards.
+     */
+    void* memory;
+    /**
+     * The shards, aligned to the cache line size.
+     */
+    ZyanU8* shards;
+} ZyanConcurrentHashMap;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes the given `ZyanConcurrentHashMap` instance.
+ *
+ * @param   map         A pointer to the `ZyanConcurrentHashMap` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes or `0`, if the map should act as a set.
+ * @param   shard_count The number of shards or `0` to use the default number. Rounded up to the
+ *                      next power of two.
+ * @param   hash        The key hash function or `ZYAN_NULL` to hash the raw key bytes.
+ * @param   equals      The key equality comparison function or `ZYAN_NULL` to compare the raw key
+ *                      bytes.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the entries is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanConcurrentHashMapDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentHashMapInit(ZyanConcurrentHashMap* map,
+    ZyanUSize key_size, ZyanUSize value_size, ZyanUSize shard_count, ZyanHashFunction hash,
+    ZyanEqualityComparison equals);
+
+/**
+ * Initializes the given `ZyanConcurrentHashMap` instance and sets a custom `allocator`.
+ *
+ * @param   map         A pointer to the `ZyanConcurrentHashMap` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes or `0`, if the map should act as a set.
+ * @param   shard_count The number of shards or `0` to use the default number. Rounded up to the
+ *                      next power of two.
+ * @param   hash        The key hash function or `ZYAN_NULL` to hash the raw key bytes.
+ * @param   equals      The key equality comparison function or `ZYAN_NULL` to compare the raw key
+ *                      bytes.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance. Must be thread-safe.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanConcurrentHashMapDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentHashMapInitEx(ZyanConcurrentHashMap* map,
+    ZyanUSize key_size, ZyanUSize value_size, ZyanUSize shard_count, ZyanHashFunction hash,
+    ZyanEqualityComparison equals, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanConcurrentHashMap` instance.
+ *
+ * @param   map A pointer to the `ZyanConcurrentHashMap` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The map must not be accessed by any other thread during this call.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentHashMapDestroy(ZyanConcurrentHashMap* map);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Inserts a new entry or replaces the value of an existing entry with the same key.
+ *
+ * @param   map     A pointer to the `ZyanConcurrentHashMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   A pointer to the value. Ignored for sets.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if a new entry was inserted, `ZYAN_STATUS_FALSE` if the value of an
+ *          existing entry was replaced or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentHashMapInsert(ZyanConcurrentHashMap* map, const void* key,
+    const void* value);
+
+/**
+ * Inserts a new entry, if no entry with the same key exists.
+ *
+ * @param   map     A pointer to the `ZyanConcurrentHashMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   A pointer to the value. Ignored for sets.
+ * @param   current Receives a copy of the value of the existing entry, if the key was already
+ *                  present. Optional.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if a new entry was inserted, `ZYAN_STATUS_FALSE` if an entry with
+ *          the given key already exists or another zyan status code if an error occurred.
+ *
+ * The check and the insertion are performed atomically.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentHashMapTryInsert(ZyanConcurrentHashMap* map,
+    const void* key, const void* value, void* current);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Removes the entry with the given `key`.
+ *
+ * @param   map A pointer to the `ZyanConcurrentHashMap` instance.
+ * @param   key A pointer to the key.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was removed, `ZYAN_STATUS_FALSE` if no entry with the
+ *          given key exists or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentHashMapRemove(ZyanConcurrentHashMap* map, const void* key);
+
+/**
+ * Erases all entries of the given map.
+ *
+ * @param   map A pointer to the `ZyanConcurrentHashMap` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The shards are cleared one after another, so concurrent readers may observe a partially
+ * cleared map.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentHashMapClear(ZyanConcurrentHashMap* map);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Copies the value associated with the given `key`.
+ *
+ * @param   map     A pointer to the `ZyanConcurrentHashMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a copy of the value. Optional.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentHashMapGet(ZyanConcurrentHashMap* map, const void* key,
+    void* value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Makes sure the given map is able to hold at least `count` evenly distributed entries without
+ * rehashing.
+ *
+ * @param   map     A pointer to the `ZyanConcurrentHashMap` instance.
+ * @param   count   The number of entries.
+ *
+ * @return  A zyan status code.
+ *
+ * The shards are resized one after another.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentHashMapReserve(ZyanConcurrentHashMap* map,
+    ZyanUSize count);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current number of entries in the map.
+ *
+ * @param   map     A pointer to the `ZyanConcurrentHashMap` instance.
+ * @param   size    Receives the number of entries.
+ *
+ * @return  A zyan status code.
+ *
+ * The shards are counted one after another, so the result is only exact if the map is not
+ * modified concurrently.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConcurrentHashMapGetSize(ZyanConcurrentHashMap* map,
+    ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYAN_NO_LIBC */
+
+#endif /* ZYCORE_CONCURRENTHASHMAP_H */
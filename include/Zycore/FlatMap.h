@@ -0,0 +1,398 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a sorted flat map (and set) container class.
+ */
+
+#ifndef ZYCORE_FLATMAP_H
+#define ZYCORE_FLATMAP_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Comparison.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanFlatMap` struct.
+ *
+ * The flat map stores its entries (key followed by value) in a single contiguous buffer that is
+ * kept sorted by key. Lookups use binary search and iteration visits the keys in ascending order.
+ *
+ * A flat map with a `value_size` of `0` acts as a sorted set.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanFlatMap_
+{
+    /**
+     * The size of a single key in bytes.
+     */
+    ZyanUSize key_size;
+    /**
+     * The size of a single value in bytes.
+     */
+    ZyanUSize value_size;
+    /**
+     * The offset of the value relative to the start of an entry.
+     */
+    ZyanUSize value_offset;
+    /**
+     * The key comparison function.
+     */
+    ZyanComparison compare;
+    /**
+     * The vector that contains the sorted entries.
+     */
+    ZyanVector entries;
+} ZyanFlatMap;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanFlatMap` instance.
+ *
+ * @param   map         A pointer to the `ZyanFlatMap` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes or `0`, if the map should act as a set.
+ * @param   compare     The key comparison function.
+ * @param   capacity    The initial capacity (number of entries).
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the entries is dynamically allocated by the default allocator using the default
+ * growth factor and the default shrink threshold.
+ *
+ * Finalization with `ZyanFlatMapDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanFlatMapInit(ZyanFlatMap* map, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanComparison compare, ZyanUSize capacity);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanFlatMap` instance and sets a custom `allocator` and memory
+ * allocation/deallocation parameters.
+ *
+ * @param   map                 A pointer to the `ZyanFlatMap` instance.
+ * @param   key_size            The size of a single key in bytes.
+ * @param   value_size          The size of a single value in bytes or `0`, if the map should act
+ *                              as a set.
+ * @param   compare             The key comparison function.
+ * @param   capacity            The initial capacity (number of entries).
+ * @param   allocator           A pointer to a `ZyanAllocator` instance.
+ * @param   growth_factor       The growth factor.
+ * @param   shrink_threshold    The shrink threshold.
+ *
+ * @return  A zyan status code.
+ *
+ * A growth factor of `1` disables overallocation and a shrink threshold of `0` disables
+ * dynamic shrinking.
+ *
+ * Finalization with `ZyanFlatMapDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapInitEx(ZyanFlatMap* map, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanComparison compare, ZyanUSize capacity, ZyanAllocator* allocator,
+    ZyanU8 growth_factor, ZyanU8 shrink_threshold);
+
+/**
+ * Destroys the given `ZyanFlatMap` instance.
+ *
+ * @param   map A pointer to the `ZyanFlatMap` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapDestroy(ZyanFlatMap* map);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Inserts a new entry or replaces the value of an existing entry with the same key.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   A pointer to the value. Ignored for sets.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if a new entry was inserted, `ZYAN_STATUS_FALSE` if the value of an
+ *          existing entry was replaced or another zyan status code if an error occurred.
+ *
+ * Every single insertion has to shift all subsequent entries. Use `ZyanFlatMapInsertBulk` to
+ * insert larger amounts of entries at once.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapInsert(ZyanFlatMap* map, const void* key, const void* value);
+
+/**
+ * Inserts multiple entries at once.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   keys    A pointer to the first element of an array of `count` keys.
+ * @param   values  A pointer to the first element of an array of `count` values. Ignored for
+ *                  sets.
+ * @param   count   The number of entries to insert.
+ *
+ * @return  A zyan status code.
+ *
+ * The batch does not need to be sorted. It is sorted into a scratch area at the end of the entry
+ * buffer and then merged with the existing entries in a single linear pass, which makes this
+ * function a lot faster than repeated calls to `ZyanFlatMapInsert`.
+ *
+ * Entries with keys that are already present in the map replace the existing values. If the batch
+ * contains the same key multiple times, the last occurrence wins.
+ *
+ * This function temporarily requires a capacity of `size + 2 * count` entries.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapInsertBulk(ZyanFlatMap* map, const void* keys,
+    const void* values, ZyanUSize count);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Removes the entry with the given `key`.
+ *
+ * @param   map A pointer to the `ZyanFlatMap` instance.
+ * @param   key A pointer to the key.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was removed, `ZYAN_STATUS_FALSE` if no entry with the
+ *          given key exists or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapRemove(ZyanFlatMap* map, const void* key);
+
+/**
+ * Removes multiple entries, starting at `index`.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   index   The index of the first entry to remove.
+ * @param   count   The number of entries to remove.
+ *
+ * @return  A zyan status code.
+ *
+ * In combination with `ZyanFlatMapLowerBound` and `ZyanFlatMapUpperBound` this function can be
+ * used to remove all entries within a given key range.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapRemoveRange(ZyanFlatMap* map, ZyanUSize index,
+    ZyanUSize count);
+
+/**
+ * Erases all entries of the given map.
+ *
+ * @param   map A pointer to the `ZyanFlatMap` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapClear(ZyanFlatMap* map);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Searches for the entry with the given `key`.
+ *
+ * @param   map         A pointer to the `ZyanFlatMap` instance.
+ * @param   key         A pointer to the key.
+ * @param   found_index Receives the index of the found entry or the index at which an entry with
+ *                      the given key would have to be inserted, if no such entry exists.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapFind(const ZyanFlatMap* map, const void* key,
+    ZyanUSize* found_index);
+
+/**
+ * Returns a constant pointer to the value associated with the given `key`.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a constant pointer to the value or `ZYAN_NULL`, if no entry with the
+ *                  given key exists.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ *
+ * Note that the returned pointer might get invalid when the map is modified.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapGet(const ZyanFlatMap* map, const void* key,
+    const void** value);
+
+/**
+ * Returns a mutable pointer to the value associated with the given `key`.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a mutable pointer to the value or `ZYAN_NULL`, if no entry with the
+ *                  given key exists.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ *
+ * Note that the returned pointer might get invalid when the map is modified.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapGetMutable(ZyanFlatMap* map, const void* key, void** value);
+
+/**
+ * Returns the index of the first entry with a key not less than the given `key`.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   index   Receives the index of the entry or the size of the map, if there is no such
+ *                  entry.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapLowerBound(const ZyanFlatMap* map, const void* key,
+    ZyanUSize* index);
+
+/**
+ * Returns the index of the first entry with a key greater than the given `key`.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   index   Receives the index of the entry or the size of the map, if there is no such
+ *                  entry.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapUpperBound(const ZyanFlatMap* map, const void* key,
+    ZyanUSize* index);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns constant pointers to the key and value of the entry at the given `index`.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   index   The entry index.
+ * @param   key     Receives a constant pointer to the key. Optional.
+ * @param   value   Receives a constant pointer to the value. Optional.
+ *
+ * @return  A zyan status code.
+ *
+ * Entries are ordered by key, so iterating over all indices visits the entries in ascending key
+ * order.
+ *
+ * Note that the returned pointers might get invalid when the map is modified.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapGetEntry(const ZyanFlatMap* map, ZyanUSize index,
+    const void** key, const void** value);
+
+/**
+ * Returns a constant pointer to the key and a mutable pointer to the value of the entry at the
+ * given `index`.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   index   The entry index.
+ * @param   key     Receives a constant pointer to the key. Optional.
+ * @param   value   Receives a mutable pointer to the value. Optional.
+ *
+ * @return  A zyan status code.
+ *
+ * Note that the returned pointers might get invalid when the map is modified.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapGetEntryMutable(ZyanFlatMap* map, ZyanUSize index,
+    const void** key, void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Changes the capacity of the given `ZyanFlatMap` instance.
+ *
+ * @param   map         A pointer to the `ZyanFlatMap` instance.
+ * @param   capacity    The new minimum capacity (number of entries).
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapReserve(ZyanFlatMap* map, ZyanUSize capacity);
+
+/**
+ * Shrinks the capacity of the given map to match it's size.
+ *
+ * @param   map A pointer to the `ZyanFlatMap` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapShrinkToFit(ZyanFlatMap* map);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current number of entries in the map.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   size    Receives the number of entries.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapGetSize(const ZyanFlatMap* map, ZyanUSize* size);
+
+/**
+ * Returns the current capacity of the map.
+ *
+ * @param   map         A pointer to the `ZyanFlatMap` instance.
+ * @param   capacity    Receives the capacity (number of entries).
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanFlatMapGetCapacity(const ZyanFlatMap* map, ZyanUSize* capacity);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_FLATMAP_H */
@@ -0,0 +1,241 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Provides fast non-cryptographic hash functions and checksums.
+ */
+
+#ifndef ZYCORE_HASH_H
+#define ZYCORE_HASH_H
+
+#include <Zycore/Defines.h>
+#include <Zycore/Status.h>
+#include <Zycore/String.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The number of bytes consumed by a single step of the `ZyanHash64` family of functions.
+ */
+#define ZYAN_HASH_STRIPE_SIZE   32
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanHashState` struct.
+ *
+ * Represents the state of an incremental `ZyanHash64` computation.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanHashState_
+{
+    /**
+     * The seed (after initial mixing).
+     */
+    ZyanU64 seed;
+    /**
+     * The accumulators.
+     */
+    ZyanU64 acc[2];
+    /**
+     * The total number of bytes processed so far (including buffered bytes).
+     */
+    ZyanU64 total;
+    /**
+     * Buffers the bytes that do not yet form a complete stripe.
+     */
+    ZyanU8 buffer[ZYAN_HASH_STRIPE_SIZE];
+    /**
+     * The number of bytes in the `buffer`.
+     */
+    ZyanU8 buffer_size;
+} ZyanHashState;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Integer mixing                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Mixes the bits of the given 32-bit integer.
+ *
+ * @param   value   The value.
+ *
+ * @return  The mixed value.
+ *
+ * This function is a bijection and is suitable to hash integer keys.
+ */
+ZYAN_INLINE ZyanU32 ZyanHashMix32(ZyanU32 value)
+{
+    value ^= value >> 16;
+    value *= 0x7FEB352DU;
+    value ^= value >> 15;
+    value *= 0x846CA68BU;
+    value ^= value >> 16;
+    return value;
+}
+
+/**
+ * Mixes the bits of the given 64-bit integer.
+ *
+ * @param   value   The value.
+ *
+ * @return  The mixed value.
+ *
+ * This function is a bijection and is suitable to hash integer keys.
+ */
+ZYAN_INLINE ZyanU64 ZyanHashMix64(ZyanU64 value)
+{
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+/**
+ * Combines two hash values.
+ *
+ * @param   hash    The current hash value.
+ * @param   value   The hash value to combine with.
+ *
+ * @return  The combined hash value.
+ *
+ * The result depends on the order of the arguments.
+ */
+ZYAN_INLINE ZyanU64 ZyanHashCombine64(ZyanU64 hash, ZyanU64 value)
+{
+    return ZyanHashMix64(hash ^ (value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2)));
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Hashing                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Calculates the 64-bit hash of the given data.
+ *
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ * @param   seed    The seed.
+ *
+ * @return  The 64-bit hash value.
+ *
+ * The result does not depend on the alignment of `data` or the endianness of the host.
+ */
+ZYCORE_EXPORT ZyanU64 ZyanHash64(const void* data, ZyanUSize size, ZyanU64 seed);
+
+/**
+ * Calculates the 64-bit hash of the given string-view.
+ *
+ * @param   view    A pointer to the `ZyanStringView` instance.
+ * @param   seed    The seed.
+ *
+ * @return  The 64-bit hash value of the characters of the string-view (excluding the
+ *          terminating `\0` character).
+ */
+ZYCORE_EXPORT ZyanU64 ZyanHashStringView(const ZyanStringView* view, ZyanU64 seed);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Incremental hashing                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes the given `ZyanHashState` instance.
+ *
+ * @param   state   A pointer to the `ZyanHashState` instance.
+ * @param   seed    The seed.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHash64Init(ZyanHashState* state, ZyanU64 seed);
+
+/**
+ * Feeds more data into the given `ZyanHashState` instance.
+ *
+ * @param   state   A pointer to the `ZyanHashState` instance.
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHash64Update(ZyanHashState* state, const void* data, ZyanUSize size);
+
+/**
+ * Calculates the hash value of all data fed into the given `ZyanHashState` instance so far.
+ *
+ * @param   state   A pointer to the `ZyanHashState` instance.
+ * @param   hash    Receives the 64-bit hash value.
+ *
+ * @return  A zyan status code.
+ *
+ * The result is identical to a single call to `ZyanHash64` with the concatenated data. The state
+ * is not modified and may receive more data afterwards.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHash64Final(const ZyanHashState* state, ZyanU64* hash);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Checksums                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Calculates the CRC-32C (Castagnoli) checksum of the given data.
+ *
+ * @param   crc     The checksum of the preceding data or `0` to start a new calculation.
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  The updated checksum.
+ *
+ * Uses the SSE4.2 or ARMv8 `CRC32C` instructions when available.
+ */
+ZYCORE_EXPORT ZyanU32 ZyanCrc32c(ZyanU32 crc, const void* data, ZyanUSize size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_HASH_H */
@@ -0,0 +1,396 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements an open-addressing hash map container class.
+ */
+
+#ifndef ZYCORE_HASHMAP_H
+#define ZYCORE_HASHMAP_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Comparison.h>
+#include <Zycore/Status.h>
+#include <Zycore/String.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The minimum capacity (number of slots) of a hash map that contains at least one entry.
+ */
+#define ZYAN_HASHMAP_MIN_CAPACITY   16
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanHashFunction` function prototype.
+ *
+ * @param   key A pointer to the key.
+ *
+ * @return  The 64-bit hash of the key. All bits of the hash are used, so the function should
+ *          distribute its input evenly across the whole value range.
+ */
+typedef ZyanU64 (*ZyanHashFunction)(const void* key);
+
+/**
+ * Defines the `ZyanHashMap` struct.
+ *
+ * The hash map stores its entries in a single table of slots (open addressing). Every slot has an
+ * additional control byte that marks it as empty, deleted or full. Full slots store the lower 7
+ * bits of the key hash in the control byte, which allows to check a whole group of slots for
+ * candidates at once (using SIMD instructions where available) before any key is compared.
+ *
+ * A hash map with a `value_size` of `0` acts as a hash set.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanHashMap_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The size of a single key in bytes.
+     */
+    ZyanUSize key_size;
+    /**
+     * The size of a single value in bytes.
+     */
+    ZyanUSize value_size;
+    /**
+     * The offset of the value relative to the start of a slot.
+     */
+    ZyanUSize value_offset;
+    /**
+     * The size of a single slot in bytes.
+     */
+    ZyanUSize slot_size;
+    /**
+     * The key hash function or `ZYAN_NULL` to hash the raw key bytes.
+     */
+    ZyanHashFunction hash;
+    /**
+     * The key equality comparison function or `ZYAN_NULL` to compare the raw key bytes.
+     */
+    ZyanEqualityComparison equals;
+    /**
+     * The number of entries.
+     */
+    ZyanUSize size;
+    /**
+     * The number of slots. Always `0` or a power of two.
+     */
+    ZyanUSize capacity;
+    /**
+     * The number of entries that can be inserted before the table has to be rehashed.
+     */
+    ZyanUSize growth_left;
+    /**
+     * The control bytes.
+     */
+    ZyanU8* control;
+    /**
+     * The slots.
+     */
+    ZyanU8* slots;
+} ZyanHashMap;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanHashMap` instance.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes or `0`, if the map should act as a set.
+ * @param   capacity    The number of entries to reserve space for.
+ * @param   hash        The key hash function or `ZYAN_NULL` to hash the raw key bytes.
+ * @param   equals      The key equality comparison function or `ZYAN_NULL` to compare the raw key
+ *                      bytes.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the entries is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanHashMapDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanHashMapInit(ZyanHashMap* map, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanUSize capacity, ZyanHashFunction hash,
+    ZyanEqualityComparison equals);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanHashMap` instance and sets a custom `allocator`.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes or `0`, if the map should act as a set.
+ * @param   capacity    The number of entries to reserve space for.
+ * @param   hash        The key hash function or `ZYAN_NULL` to hash the raw key bytes.
+ * @param   equals      The key equality comparison function or `ZYAN_NULL` to compare the raw key
+ *                      bytes.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanHashMapDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapInitEx(ZyanHashMap* map, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanUSize capacity, ZyanHashFunction hash,
+    ZyanEqualityComparison equals, ZyanAllocator* allocator);
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanHashMap` instance for `ZyanStringView` keys.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   value_size  The size of a single value in bytes or `0`, if the map should act as a set.
+ * @param   capacity    The number of entries to reserve space for.
+ *
+ * @return  A zyan status code.
+ *
+ * Keys are passed as pointers to `ZyanStringView` (or `ZyanString`) instances and are hashed and
+ * compared by their content. The map only stores the view, so the referenced string data must
+ * outlive the entry.
+ *
+ * The memory for the entries is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanHashMapDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanHashMapInitStringView(ZyanHashMap* map,
+    ZyanUSize value_size, ZyanUSize capacity);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanHashMap` instance for `ZyanStringView` keys and sets a custom
+ * `allocator`.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   value_size  The size of a single value in bytes or `0`, if the map should act as a set.
+ * @param   capacity    The number of entries to reserve space for.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanHashMapDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapInitStringViewEx(ZyanHashMap* map, ZyanUSize value_size,
+    ZyanUSize capacity, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanHashMap` instance.
+ *
+ * @param   map A pointer to the `ZyanHashMap` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapDestroy(ZyanHashMap* map);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Inserts a new entry or replaces the value of an existing entry with the same key.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   A pointer to the value. Ignored for sets.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if a new entry was inserted, `ZYAN_STATUS_FALSE` if the value of an
+ *          existing entry was replaced or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapInsert(ZyanHashMap* map, const void* key, const void* value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Removes the entry with the given `key`.
+ *
+ * @param   map A pointer to the `ZyanHashMap` instance.
+ * @param   key A pointer to the key.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was removed, `ZYAN_STATUS_FALSE` if no entry with the
+ *          given key exists or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapRemove(ZyanHashMap* map, const void* key);
+
+/**
+ * Erases all entries of the given map.
+ *
+ * @param   map A pointer to the `ZyanHashMap` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The capacity of the map is not changed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapClear(ZyanHashMap* map);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a constant pointer to the value associated with the given `key`.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a constant pointer to the value or `ZYAN_NULL`, if no entry with the
+ *                  given key exists. Optional.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ *
+ * Note that the returned pointer might get invalid when the map is modified.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapGet(const ZyanHashMap* map, const void* key,
+    const void** value);
+
+/**
+ * Returns a mutable pointer to the value associated with the given `key`.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a mutable pointer to the value or `ZYAN_NULL`, if no entry with the
+ *                  given key exists. Optional.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ *
+ * Note that the returned pointer might get invalid when the map is modified.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapGetMutable(ZyanHashMap* map, const void* key, void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the next entry of the given map.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   iterator    A pointer to the iterator state. Must be initialized to `0` before the
+ *                      first call.
+ * @param   key         Receives a constant pointer to the key. Optional.
+ * @param   value       Receives a constant pointer to the value. Optional.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if an entry was returned, `ZYAN_STATUS_FALSE` if there are no more
+ *          entries or another zyan status code if an error occurred.
+ *
+ * The entries are returned in an unspecified order. The map must not be modified during the
+ * iteration.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapIterate(const ZyanHashMap* map, ZyanUSize* iterator,
+    const void** key, const void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Makes sure the given map is able to hold at least `count` entries without rehashing.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   count   The number of entries.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapReserve(ZyanHashMap* map, ZyanUSize count);
+
+/**
+ * Rebuilds the table of the given map with enough space for at least `count` entries.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   count   The number of entries. Values smaller than the current size are raised to the
+ *                  current size.
+ *
+ * @return  A zyan status code.
+ *
+ * In contrast to `ZyanHashMapReserve`, this function may also shrink the table. Rehashing drops
+ * all markers left behind by removed entries, which speeds up lookups after many removals.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapRehash(ZyanHashMap* map, ZyanUSize count);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current number of entries in the map.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   size    Receives the number of entries.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapGetSize(const ZyanHashMap* map, ZyanUSize* size);
+
+/**
+ * Returns the current capacity of the map.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   capacity    Receives the number of slots.
+ *
+ * @return  A zyan status code.
+ *
+ * At most 7/8 of the slots are used before the table grows.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapGetCapacity(const ZyanHashMap* map, ZyanUSize* capacity);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_HASHMAP_H */
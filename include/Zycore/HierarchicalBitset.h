@@ -0,0 +1,300 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a fixed-size bitset with a hierarchy of summary levels for fast searching.
+ */
+
+#ifndef ZYCORE_HIERARCHICALBITSET_H
+#define ZYCORE_HIERARCHICALBITSET_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The maximum number of levels of a `ZyanHierarchicalBitset`.
+ *
+ * Each level reduces the number of words by a factor of `64`, so `11` levels are enough for any
+ * bitset that fits into the address space.
+ */
+#define ZYAN_HIERARCHICAL_BITSET_MAX_LEVELS 11
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanHierarchicalBitset` struct.
+ *
+ * The bits are stored in 64-bit words on level `0` (bit `i` is bit `i % 64` of word `i / 64`).
+ * Every bit of the next level summarizes one word of the level below and is set, if that word
+ * is non-zero. Levels are added until a level consists of a single word.
+ *
+ * Setting or clearing a bit updates the summary levels (usually only the first one), while
+ * searches skip empty regions by descending from the top level, which takes `O(log64(n))` word
+ * accesses regardless of how many cleared bits lie in between. This makes the structure well
+ * suited for large, mostly empty bitsets, e.g. to track free slots or dirty pages.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanHierarchicalBitset_
+{
+    /**
+     * The `ZyanAllocator` instance.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The number of bits.
+     */
+    ZyanUSize size;
+    /**
+     * The number of set bits.
+     */
+    ZyanUSize count;
+    /**
+     * The number of levels.
+     */
+    ZyanU8 level_count;
+    /**
+     * The index of the first word of each level. The entry following the last level contains the
+     * total number of words.
+     */
+    ZyanUSize level_offsets[ZYAN_HIERARCHICAL_BITSET_MAX_LEVELS + 1];
+    /**
+     * The words of all levels, starting with level `0`.
+     */
+    ZyanU64* words;
+} ZyanHierarchicalBitset;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanHierarchicalBitset` instance.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ * @param   count   The number of bits. All bits are initially cleared.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the bitset is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanHierarchicalBitsetDestroy` is required for all instances created by
+ * this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanHierarchicalBitsetInit(
+    ZyanHierarchicalBitset* bitset, ZyanUSize count);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanHierarchicalBitset` instance and sets a custom `allocator`.
+ *
+ * @param   bitset      A pointer to the `ZyanHierarchicalBitset` instance.
+ * @param   count       The number of bits. All bits are initially cleared.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanHierarchicalBitsetDestroy` is required for all instances created by
+ * this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHierarchicalBitsetInitEx(ZyanHierarchicalBitset* bitset,
+    ZyanUSize count, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanHierarchicalBitset` instance.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHierarchicalBitsetDestroy(ZyanHierarchicalBitset* bitset);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Bit access                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Sets the bit at `index`.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ * @param   index   The bit index.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHierarchicalBitsetSet(ZyanHierarchicalBitset* bitset,
+    ZyanUSize index);
+
+/**
+ * Clears the bit at `index`.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ * @param   index   The bit index.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHierarchicalBitsetReset(ZyanHierarchicalBitset* bitset,
+    ZyanUSize index);
+
+/**
+ * Sets the bit at `index` to the given value.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ * @param   index   The bit index.
+ * @param   value   The new value.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHierarchicalBitsetAssign(ZyanHierarchicalBitset* bitset,
+    ZyanUSize index, ZyanBool value);
+
+/**
+ * Returns the value of the bit at `index`.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ * @param   index   The bit index.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the bit is set, `ZYAN_STATUS_FALSE`, if not. Another zyan
+ *          status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHierarchicalBitsetTest(const ZyanHierarchicalBitset* bitset,
+    ZyanUSize index);
+
+/**
+ * Clears all bits of the given bitset.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHierarchicalBitsetResetAll(ZyanHierarchicalBitset* bitset);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Searching                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the index of the first set bit.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ * @param   found   Receives the index of the first set bit.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if a set bit was found, `ZYAN_STATUS_FALSE`, if not. Another zyan
+ *          status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHierarchicalBitsetFindFirstSet(const ZyanHierarchicalBitset* bitset,
+    ZyanUSize* found);
+
+/**
+ * Returns the index of the first set bit at or after the given `index`.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ * @param   index   The index to start the search at. May be equal to the size of the bitset.
+ * @param   found   Receives the index of the set bit.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if a set bit was found, `ZYAN_STATUS_FALSE`, if not. Another zyan
+ *          status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHierarchicalBitsetFindNextSet(const ZyanHierarchicalBitset* bitset,
+    ZyanUSize index, ZyanUSize* found);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the number of bits of the given bitset.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ * @param   size    Receives the number of bits.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHierarchicalBitsetGetSize(const ZyanHierarchicalBitset* bitset,
+    ZyanUSize* size);
+
+/**
+ * Returns the number of set bits of the given bitset.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ * @param   count   Receives the number of set bits.
+ *
+ * @return  A zyan status code.
+ *
+ * The number of set bits is maintained by all modifying functions, so this function does not
+ * scan the bitset.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHierarchicalBitsetCount(const ZyanHierarchicalBitset* bitset,
+    ZyanUSize* count);
+
+/**
+ * Checks, if at least one bit of the given bitset is set.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if at least one bit is set, `ZYAN_STATUS_FALSE`, if not. Another
+ *          zyan status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHierarchicalBitsetAny(const ZyanHierarchicalBitset* bitset);
+
+/**
+ * Checks, if none bits of the given bitset are set.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if none bits are set, `ZYAN_STATUS_FALSE`, if not. Another zyan
+ *          status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHierarchicalBitsetNone(const ZyanHierarchicalBitset* bitset);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_HIERARCHICALBITSET_H */
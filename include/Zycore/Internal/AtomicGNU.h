@@ -83,6 +83,16 @@ ZYAN_INLINE ZyanU32 ZyanAtomicDecrement32(ZyanAtomic32* destination)
     return (ZyanU32)(__sync_sub_and_fetch(&destination->value, 1, &destination->value));
 }
 
+ZYAN_INLINE ZyanU32 ZyanAtomicFetchOr32(ZyanAtomic32* destination, ZyanU32 value)
+{
+    return (ZyanU32)(__sync_fetch_and_or(&destination->value, value, &destination->value));
+}
+
+ZYAN_INLINE ZyanU32 ZyanAtomicFetchAnd32(ZyanAtomic32* destination, ZyanU32 value)
+{
+    return (ZyanU32)(__sync_fetch_and_and(&destination->value, value, &destination->value));
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* 64-bit                                                                                         */
 /* ---------------------------------------------------------------------------------------------- */
@@ -104,6 +114,16 @@ ZYAN_INLINE ZyanU64 ZyanAtomicDecrement64(ZyanAtomic64* destination)
     return (ZyanU64)(__sync_sub_and_fetch(&destination->value, 1, &destination->value));
 }
 
+ZYAN_INLINE ZyanU64 ZyanAtomicFetchOr64(ZyanAtomic64* destination, ZyanU64 value)
+{
+    return (ZyanU64)(__sync_fetch_and_or(&destination->value, value, &destination->value));
+}
+
+ZYAN_INLINE ZyanU64 ZyanAtomicFetchAnd64(ZyanAtomic64* destination, ZyanU64 value)
+{
+    return (ZyanU64)(__sync_fetch_and_and(&destination->value, value, &destination->value));
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 
 #endif
@@ -107,6 +107,16 @@ static ZYAN_INLINE ZyanU32 ZyanAtomicDecrement32(ZyanAtomic32* destination)
     return (ZyanU32)(_InterlockedDecrement((volatile LONG*)&(destination->value)));
 }
 
+static ZYAN_INLINE ZyanU32 ZyanAtomicFetchOr32(ZyanAtomic32* destination, ZyanU32 value)
+{
+    return (ZyanU32)(_InterlockedOr((volatile LONG*)&(destination->value), (LONG)value));
+}
+
+static ZYAN_INLINE ZyanU32 ZyanAtomicFetchAnd32(ZyanAtomic32* destination, ZyanU32 value)
+{
+    return (ZyanU32)(_InterlockedAnd((volatile LONG*)&(destination->value), (LONG)value));
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* 64-bit                                                                                         */
 /* ---------------------------------------------------------------------------------------------- */
@@ -128,6 +138,16 @@ static ZYAN_INLINE ZyanU64 ZyanAtomicDecrement64(ZyanAtomic64* destination)
     return (ZyanU64)(_InterlockedDecrement64((volatile LONG64*)&(destination->value)));
 }
 
+static ZYAN_INLINE ZyanU64 ZyanAtomicFetchOr64(ZyanAtomic64* destination, ZyanU64 value)
+{
+    return (ZyanU64)(_InterlockedOr64((volatile LONG64*)&(destination->value), (LONG64)value));
+}
+
+static ZYAN_INLINE ZyanU64 ZyanAtomicFetchAnd64(ZyanAtomic64* destination, ZyanU64 value)
+{
+    return (ZyanU64)(_InterlockedAnd64((volatile LONG64*)&(destination->value), (LONG64)value));
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 
 #endif
@@ -0,0 +1,365 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Cross compiler bit manipulation helpers for internal use.
+ */
+
+#ifndef ZYCORE_INTERNAL_BITS_H
+#define ZYCORE_INTERNAL_BITS_H
+
+#include <Zycore/Defines.h>
+#include <Zycore/Types.h>
+
+#if defined(ZYAN_MSVC)
+#   include <intrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Functions                                                                                      */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Bit scanning                                                                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the number of trailing zero bits in the given 32-bit value.
+ *
+ * @param   value   The value. Must not be `0`.
+ *
+ * @return  The index of the least significant set bit.
+ */
+ZYAN_INLINE ZyanU8 ZyanBitCountTrailingZeros32(ZyanU32 value)
+{
+    ZYAN_ASSERT(value);
+
+#if defined(ZYAN_GNUC) || defined(ZYAN_ICC)
+    return (ZyanU8)__builtin_ctz(value);
+#elif defined(ZYAN_MSVC)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return (ZyanU8)index;
+#else
+    static const ZyanU8 table[32] =
+    {
+         0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+        31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+    };
+    return table[((ZyanU32)((value & (~value + 1)) * 0x077CB531U)) >> 27];
+#endif
+}
+
+/**
+ * Returns the number of trailing zero bits in the given 64-bit value.
+ *
+ * @param   value   The value. Must not be `0`.
+ *
+ * @return  The index of the least significant set bit.
+ */
+ZYAN_INLINE ZyanU8 ZyanBitCountTrailingZeros64(ZyanU64 value)
+{
+    ZYAN_ASSERT(value);
+
+#if defined(ZYAN_GNUC) || defined(ZYAN_ICC)
+    return (ZyanU8)__builtin_ctzll(value);
+#elif defined(ZYAN_MSVC) && (defined(ZYAN_X64) || defined(ZYAN_AARCH64))
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return (ZyanU8)index;
+#else
+    const ZyanU32 low = (ZyanU32)value;
+    return low ? ZyanBitCountTrailingZeros32(low) :
+        (ZyanU8)(32 + ZyanBitCountTrailingZeros32((ZyanU32)(value >> 32)));
+#endif
+}
+
+/**
+ * Returns the number of leading zero bits in the given 64-bit value.
+ *
+ * @param   value   The value. Must not be `0`.
+ *
+ * @return  `63` minus the index of the most significant set bit.
+ */
+ZYAN_INLINE ZyanU8 ZyanBitCountLeadingZeros64(ZyanU64 value)
+{
+    ZYAN_ASSERT(value);
+
+#if defined(ZYAN_GNUC) || defined(ZYAN_ICC)
+    return (ZyanU8)__builtin_clzll(value);
+#elif defined(ZYAN_MSVC) && (defined(ZYAN_X64) || defined(ZYAN_AARCH64))
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return (ZyanU8)(63 - index);
+#else
+    ZyanU8 count = 0;
+    while (!(value & 0x8000000000000000ULL))
+    {
+        value <<= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Population count                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the number of set bits in the given 64-bit value.
+ *
+ * @param   value   The value.
+ *
+ * @return  The number of set bits.
+ *
+ * The builtin is only used when the target is known to have a population count instruction;
+ * otherwise it would compile into a library call that is slower than the bit-parallel fallback.
+ */
+ZYAN_INLINE ZyanU8 ZyanBitPopCount64(ZyanU64 value)
+{
+#if (defined(ZYAN_GNUC) || defined(ZYAN_ICC)) && (defined(__POPCNT__) || defined(ZYAN_AARCH64))
+    return (ZyanU8)__builtin_popcountll(value);
+#else
+    value = value - ((value >> 1) & 0x5555555555555555ULL);
+    value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+    value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (ZyanU8)((value * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Byte order                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Reverses the byte order of the given 32-bit value.
+ *
+ * @param   value   The value.
+ *
+ * @return  The value with reversed byte order.
+ */
+ZYAN_INLINE ZyanU32 ZyanByteSwap32(ZyanU32 value)
+{
+#if defined(ZYAN_GNUC) || defined(ZYAN_ICC)
+    return __builtin_bswap32(value);
+#elif defined(ZYAN_MSVC)
+    return _byteswap_ulong(value);
+#else
+    value = ((value & 0xFF00FF00U) >> 8) | ((value & 0x00FF00FFU) << 8);
+    return (value >> 16) | (value << 16);
+#endif
+}
+
+/**
+ * Reverses the byte order of the given 64-bit value.
+ *
+ * @param   value   The value.
+ *
+ * @return  The value with reversed byte order.
+ */
+ZYAN_INLINE ZyanU64 ZyanByteSwap64(ZyanU64 value)
+{
+#if defined(ZYAN_GNUC) || defined(ZYAN_ICC)
+    return __builtin_bswap64(value);
+#elif defined(ZYAN_MSVC)
+    return _byteswap_uint64(value);
+#else
+    return ((ZyanU64)ZyanByteSwap32((ZyanU32)value) << 32) |
+        ZyanByteSwap32((ZyanU32)(value >> 32));
+#endif
+}
+
+/**
+ * Reverses the bit order within each byte of the given 64-bit value.
+ *
+ * @param   value   The value.
+ *
+ * @return  The value with bit `i` moved to bit `(i & ~7) + 7 - (i % 8)`.
+ */
+ZYAN_INLINE ZyanU64 ZyanBitReverseBytes64(ZyanU64 value)
+{
+    value = ((value >> 1) & 0x5555555555555555ULL) | ((value & 0x5555555555555555ULL) << 1);
+    value = ((value >> 2) & 0x3333333333333333ULL) | ((value & 0x3333333333333333ULL) << 2);
+    value = ((value >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((value & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    return value;
+}
+
+/**
+ * Reverses the bit order of the given 64-bit value.
+ *
+ * @param   value   The value.
+ *
+ * @return  The value with bit `i` moved to bit `63 - i`.
+ */
+ZYAN_INLINE ZyanU64 ZyanBitReverse64(ZyanU64 value)
+{
+    return ZyanByteSwap64(ZyanBitReverseBytes64(value));
+}
+
+/**
+ * Loads a 64-bit value in host byte order from a potentially unaligned address.
+ *
+ * @param   p   A pointer to the data.
+ *
+ * @return  The loaded value.
+ */
+ZYAN_INLINE ZyanU64 ZyanLoadU64(const void* p)
+{
+    ZyanU64 value;
+#if defined(ZYAN_GNUC)
+    __builtin_memcpy(&value, p, sizeof(value));
+#else
+    const ZyanU8* const s = (const ZyanU8*)p;
+    ZyanU8* const d = (ZyanU8*)&value;
+    for (ZyanUSize i = 0; i < sizeof(value); ++i)
+    {
+        d[i] = s[i];
+    }
+#endif
+    return value;
+}
+
+/**
+ * Stores a 64-bit value in host byte order to a potentially unaligned address.
+ *
+ * @param   p       A pointer to the destination.
+ * @param   value   The value.
+ */
+ZYAN_INLINE void ZyanStoreU64(void* p, ZyanU64 value)
+{
+#if defined(ZYAN_GNUC)
+    __builtin_memcpy(p, &value, sizeof(value));
+#else
+    const ZyanU8* const s = (const ZyanU8*)&value;
+    ZyanU8* const d = (ZyanU8*)p;
+    for (ZyanUSize i = 0; i < sizeof(value); ++i)
+    {
+        d[i] = s[i];
+    }
+#endif
+}
+
+/**
+ * Loads a little-endian 32-bit value from a potentially unaligned address.
+ *
+ * @param   p   A pointer to the data.
+ *
+ * @return  The loaded value.
+ */
+ZYAN_INLINE ZyanU32 ZyanLoadU32LE(const void* p)
+{
+#if defined(ZYAN_GNUC)
+    ZyanU32 value;
+    __builtin_memcpy(&value, p, sizeof(value));
+#   if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    value = ZyanByteSwap32(value);
+#   endif
+    return value;
+#else
+    const ZyanU8* const b = (const ZyanU8*)p;
+    return (ZyanU32)b[0] | ((ZyanU32)b[1] << 8) | ((ZyanU32)b[2] << 16) | ((ZyanU32)b[3] << 24);
+#endif
+}
+
+/**
+ * Loads a little-endian 64-bit value from a potentially unaligned address.
+ *
+ * @param   p   A pointer to the data.
+ *
+ * @return  The loaded value.
+ */
+ZYAN_INLINE ZyanU64 ZyanLoadU64LE(const void* p)
+{
+#if defined(ZYAN_GNUC)
+    ZyanU64 value;
+    __builtin_memcpy(&value, p, sizeof(value));
+#   if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    value = ZyanByteSwap64(value);
+#   endif
+    return value;
+#else
+    return (ZyanU64)ZyanLoadU32LE(p) | ((ZyanU64)ZyanLoadU32LE((const ZyanU8*)p + 4) << 32);
+#endif
+}
+
+/**
+ * Loads a big-endian 64-bit value from a potentially unaligned address.
+ *
+ * @param   p   A pointer to the data.
+ *
+ * @return  The loaded value.
+ */
+ZYAN_INLINE ZyanU64 ZyanLoadU64BE(const void* p)
+{
+#if defined(ZYAN_GNUC)
+    ZyanU64 value;
+    __builtin_memcpy(&value, p, sizeof(value));
+#   if !defined(__BYTE_ORDER__) || (__BYTE_ORDER__ != __ORDER_BIG_ENDIAN__)
+    value = ZyanByteSwap64(value);
+#   endif
+    return value;
+#else
+    return ZyanByteSwap64(ZyanLoadU64LE(p));
+#endif
+}
+
+/**
+ * Stores a 64-bit value in little-endian byte order to a potentially unaligned address.
+ *
+ * @param   p       A pointer to the destination.
+ * @param   value   The value.
+ */
+ZYAN_INLINE void ZyanStoreU64LE(void* p, ZyanU64 value)
+{
+#if defined(ZYAN_GNUC)
+#   if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    value = ZyanByteSwap64(value);
+#   endif
+    __builtin_memcpy(p, &value, sizeof(value));
+#else
+    ZyanU8* const d = (ZyanU8*)p;
+    for (ZyanUSize i = 0; i < sizeof(value); ++i)
+    {
+        d[i] = (ZyanU8)(value >> (8 * i));
+    }
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_INTERNAL_BITS_H */
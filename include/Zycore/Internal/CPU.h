@@ -0,0 +1,81 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Runtime detection of optional CPU features for internal use.
+ */
+
+#ifndef ZYCORE_INTERNAL_CPU_H
+#define ZYCORE_INTERNAL_CPU_H
+
+#include <Zycore/Defines.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The CPU supports the SSE4.2 instruction set (including `CRC32`).
+ */
+#define ZYAN_CPU_FEATURE_SSE42      0x00000001
+
+/**
+ * The CPU supports the `POPCNT` instruction.
+ */
+#define ZYAN_CPU_FEATURE_POPCNT     0x00000002
+
+/**
+ * The CPU and the operating system support the AVX2 instruction set.
+ */
+#define ZYAN_CPU_FEATURE_AVX2       0x00000004
+
+/* ============================================================================================== */
+/* Functions                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * Returns the optional features supported by the current CPU.
+ *
+ * @return  A combination of `ZYAN_CPU_FEATURE_*` flags.
+ *
+ * The features are detected on the first call and cached afterwards. Always returns `0` on
+ * platforms without runtime detection and in kernel mode.
+ */
+ZYCORE_NO_EXPORT ZyanU32 ZyanCPUGetFeatures(void);
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_INTERNAL_CPU_H */
@@ -0,0 +1,331 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a map of non-overlapping `[start, end)` ranges.
+ */
+
+#ifndef ZYCORE_INTERVALMAP_H
+#define ZYCORE_INTERVALMAP_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Comparison.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanIntervalMap` struct.
+ *
+ * The interval map associates non-overlapping half-open `[start, end)` ranges of 64-bit
+ * addresses with a value. The ranges are kept sorted and the start addresses, end addresses and
+ * values are stored in separate arrays, so that lookups only touch the densely packed start
+ * addresses.
+ *
+ * Inserting a range overwrites (and if required splits) all overlapping ranges. Adjacent ranges
+ * with equal values are coalesced into a single range.
+ *
+ * An interval map with a `value_size` of `0` acts as a set of addresses.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanIntervalMap_
+{
+    /**
+     * The size of a single value in bytes.
+     */
+    ZyanUSize value_size;
+    /**
+     * The value equality comparison function or `ZYAN_NULL` to compare values bytewise.
+     */
+    ZyanEqualityComparison equals;
+    /**
+     * The vector that contains the sorted start addresses.
+     */
+    ZyanVector starts;
+    /**
+     * The vector that contains the end addresses.
+     */
+    ZyanVector ends;
+    /**
+     * The vector that contains the values. Unused for sets.
+     */
+    ZyanVector values;
+} ZyanIntervalMap;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanIntervalMap` instance.
+ *
+ * @param   map         A pointer to the `ZyanIntervalMap` instance.
+ * @param   value_size  The size of a single value in bytes or `0`, if the map should act as a set.
+ * @param   equals      The value equality comparison function or `ZYAN_NULL` to compare values
+ *                      bytewise.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the ranges is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanIntervalMapDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanIntervalMapInit(ZyanIntervalMap* map,
+    ZyanUSize value_size, ZyanEqualityComparison equals);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanIntervalMap` instance and sets a custom `allocator`.
+ *
+ * @param   map         A pointer to the `ZyanIntervalMap` instance.
+ * @param   value_size  The size of a single value in bytes or `0`, if the map should act as a set.
+ * @param   equals      The value equality comparison function or `ZYAN_NULL` to compare values
+ *                      bytewise.
+ * @param   capacity    The initial capacity (number of ranges).
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanIntervalMapDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanIntervalMapInitEx(ZyanIntervalMap* map, ZyanUSize value_size,
+    ZyanEqualityComparison equals, ZyanUSize capacity, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanIntervalMap` instance.
+ *
+ * @param   map A pointer to the `ZyanIntervalMap` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanIntervalMapDestroy(ZyanIntervalMap* map);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Associates the range `[start, end)` with the given `value`.
+ *
+ * @param   map     A pointer to the `ZyanIntervalMap` instance.
+ * @param   start   The start address (inclusive).
+ * @param   end     The end address (exclusive). Must be greater than `start`.
+ * @param   value   A pointer to the value. Ignored for sets.
+ *
+ * @return  A zyan status code.
+ *
+ * Existing ranges that are completely covered by the new range are removed, ranges that are
+ * partially covered are truncated or split. The new range is merged with directly adjacent
+ * (or truncated) ranges that have an equal value.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanIntervalMapInsert(ZyanIntervalMap* map, ZyanU64 start, ZyanU64 end,
+    const void* value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Removes the range `[start, end)` from the map.
+ *
+ * @param   map     A pointer to the `ZyanIntervalMap` instance.
+ * @param   start   The start address (inclusive).
+ * @param   end     The end address (exclusive). Must be greater than `start`.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if at least one address was removed, `ZYAN_STATUS_FALSE` if the
+ *          range did not overlap any existing range or another zyan status code if an error
+ *          occurred.
+ *
+ * Ranges that are partially covered are truncated or split.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanIntervalMapRemove(ZyanIntervalMap* map, ZyanU64 start, ZyanU64 end);
+
+/**
+ * Erases all ranges of the given map.
+ *
+ * @param   map A pointer to the `ZyanIntervalMap` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanIntervalMapClear(ZyanIntervalMap* map);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Searches for the range that contains the given `address`.
+ *
+ * @param   map         A pointer to the `ZyanIntervalMap` instance.
+ * @param   address     The address.
+ * @param   found_index Receives the index of the range that contains the address.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the range was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanIntervalMapFind(const ZyanIntervalMap* map, ZyanU64 address,
+    ZyanUSize* found_index);
+
+/**
+ * Returns a constant pointer to the value of the range that contains the given `address`.
+ *
+ * @param   map         A pointer to the `ZyanIntervalMap` instance.
+ * @param   address     The address.
+ * @param   value       Receives a constant pointer to the value or `ZYAN_NULL`, if no range
+ *                      contains the address.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the range was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ *
+ * Note that the returned pointer might get invalid when the map is modified.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanIntervalMapGet(const ZyanIntervalMap* map, ZyanU64 address,
+    const void** value);
+
+/**
+ * Searches for all ranges that overlap the range `[start, end)`.
+ *
+ * @param   map     A pointer to the `ZyanIntervalMap` instance.
+ * @param   start   The start address (inclusive).
+ * @param   end     The end address (exclusive).
+ * @param   index   Receives the index of the first overlapping range.
+ * @param   count   Receives the number of overlapping ranges.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if at least one overlapping range was found, `ZYAN_STATUS_FALSE` if
+ *          not or another zyan status code if an error occurred.
+ *
+ * The overlapping ranges are always stored at consecutive indices.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanIntervalMapFindOverlapping(const ZyanIntervalMap* map,
+    ZyanU64 start, ZyanU64 end, ZyanUSize* index, ZyanUSize* count);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the range and a constant pointer to the value at the given `index`.
+ *
+ * @param   map     A pointer to the `ZyanIntervalMap` instance.
+ * @param   index   The range index.
+ * @param   start   Receives the start address. Optional.
+ * @param   end     Receives the end address. Optional.
+ * @param   value   Receives a constant pointer to the value. Optional.
+ *
+ * @return  A zyan status code.
+ *
+ * Ranges are ordered by address, so iterating over all indices visits the ranges in ascending
+ * order.
+ *
+ * Note that the returned pointer might get invalid when the map is modified.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanIntervalMapGetEntry(const ZyanIntervalMap* map, ZyanUSize index,
+    ZyanU64* start, ZyanU64* end, const void** value);
+
+/**
+ * Returns the range and a mutable pointer to the value at the given `index`.
+ *
+ * @param   map     A pointer to the `ZyanIntervalMap` instance.
+ * @param   index   The range index.
+ * @param   start   Receives the start address. Optional.
+ * @param   end     Receives the end address. Optional.
+ * @param   value   Receives a mutable pointer to the value. Optional.
+ *
+ * @return  A zyan status code.
+ *
+ * Modifying the value does not coalesce the range with its neighbors.
+ *
+ * Note that the returned pointer might get invalid when the map is modified.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanIntervalMapGetEntryMutable(ZyanIntervalMap* map, ZyanUSize index,
+    ZyanU64* start, ZyanU64* end, void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Changes the capacity of the given `ZyanIntervalMap` instance.
+ *
+ * @param   map         A pointer to the `ZyanIntervalMap` instance.
+ * @param   capacity    The new minimum capacity (number of ranges).
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanIntervalMapReserve(ZyanIntervalMap* map, ZyanUSize capacity);
+
+/**
+ * Shrinks the capacity of the given map to match it's size.
+ *
+ * @param   map A pointer to the `ZyanIntervalMap` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanIntervalMapShrinkToFit(ZyanIntervalMap* map);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current number of ranges in the map.
+ *
+ * @param   map     A pointer to the `ZyanIntervalMap` instance.
+ * @param   size    Receives the number of ranges.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanIntervalMapGetSize(const ZyanIntervalMap* map, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_INTERVALMAP_H */
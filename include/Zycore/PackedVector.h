@@ -0,0 +1,292 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a vector of bit-packed fixed-width unsigned integers.
+ */
+
+#ifndef ZYCORE_PACKEDVECTOR_H
+#define ZYCORE_PACKEDVECTOR_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanPackedVector` struct.
+ *
+ * The packed vector stores unsigned integers using a fixed number of `1` to `64` bits per element.
+ * The elements are stored back to back in 64-bit words, starting with the least significant bit,
+ * so a single element may span two adjacent words.
+ *
+ * Storing a value that does not fit the current width automatically widens all elements.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanPackedVector_
+{
+    /**
+     * The number of bits per element.
+     */
+    ZyanU8 width;
+    /**
+     * The number of elements.
+     */
+    ZyanUSize size;
+    /**
+     * The vector that contains the 64-bit words (including one trailing padding word).
+     */
+    ZyanVector words;
+} ZyanPackedVector;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanPackedVector` instance.
+ *
+ * @param   vector  A pointer to the `ZyanPackedVector` instance.
+ * @param   width   The initial number of bits per element (`1` to `64`).
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the elements is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanPackedVectorDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanPackedVectorInit(ZyanPackedVector* vector,
+    ZyanU8 width);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanPackedVector` instance and sets a custom `allocator`.
+ *
+ * @param   vector      A pointer to the `ZyanPackedVector` instance.
+ * @param   width       The initial number of bits per element (`1` to `64`).
+ * @param   capacity    The initial capacity (number of elements).
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanPackedVectorDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPackedVectorInitEx(ZyanPackedVector* vector, ZyanU8 width,
+    ZyanUSize capacity, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanPackedVector` instance.
+ *
+ * @param   vector  A pointer to the `ZyanPackedVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPackedVectorDestroy(ZyanPackedVector* vector);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Element access                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the value of the element at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanPackedVector` instance.
+ * @param   index   The element index.
+ * @param   value   Receives the value.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPackedVectorGet(const ZyanPackedVector* vector, ZyanUSize index,
+    ZyanU64* value);
+
+/**
+ * Assigns a new value to the element at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanPackedVector` instance.
+ * @param   index   The element index.
+ * @param   value   The new value.
+ *
+ * @return  A zyan status code.
+ *
+ * The vector is widened, if the value does not fit the current width.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPackedVectorSet(ZyanPackedVector* vector, ZyanUSize index,
+    ZyanU64 value);
+
+/**
+ * Copies a range of elements into the given buffer of 64-bit integers.
+ *
+ * @param   vector  A pointer to the `ZyanPackedVector` instance.
+ * @param   index   The index of the first element.
+ * @param   count   The number of elements.
+ * @param   buffer  A pointer to the destination buffer (must be able to hold `count` values).
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPackedVectorUnpack(const ZyanPackedVector* vector, ZyanUSize index,
+    ZyanUSize count, ZyanU64* buffer);
+
+/**
+ * Copies a range of elements into the given buffer of 32-bit integers.
+ *
+ * @param   vector  A pointer to the `ZyanPackedVector` instance.
+ * @param   index   The index of the first element.
+ * @param   count   The number of elements.
+ * @param   buffer  A pointer to the destination buffer (must be able to hold `count` values).
+ *
+ * @return  A zyan status code.
+ *
+ * The width of the vector must not exceed `32` bits. Byte-aligned widths are widened using SIMD
+ * instructions, if available.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPackedVectorUnpack32(const ZyanPackedVector* vector,
+    ZyanUSize index, ZyanUSize count, ZyanU32* buffer);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion and deletion                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Appends a value to the end of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanPackedVector` instance.
+ * @param   value   The value.
+ *
+ * @return  A zyan status code.
+ *
+ * The vector is widened, if the value does not fit the current width.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPackedVectorPushBack(ZyanPackedVector* vector, ZyanU64 value);
+
+/**
+ * Removes the last element of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanPackedVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPackedVectorPopBack(ZyanPackedVector* vector);
+
+/**
+ * Removes all elements of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanPackedVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPackedVectorClear(ZyanPackedVector* vector);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Resizes the given `ZyanPackedVector` instance.
+ *
+ * @param   vector  A pointer to the `ZyanPackedVector` instance.
+ * @param   size    The new number of elements. New elements are initialized with `0`.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPackedVectorResize(ZyanPackedVector* vector, ZyanUSize size);
+
+/**
+ * Changes the capacity of the given `ZyanPackedVector` instance.
+ *
+ * @param   vector      A pointer to the `ZyanPackedVector` instance.
+ * @param   capacity    The new minimum capacity (number of elements at the current width).
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPackedVectorReserve(ZyanPackedVector* vector, ZyanUSize capacity);
+
+/**
+ * Increases the number of bits per element.
+ *
+ * @param   vector  A pointer to the `ZyanPackedVector` instance.
+ * @param   width   The new number of bits per element (`1` to `64`).
+ *
+ * @return  A zyan status code.
+ *
+ * All elements are repacked. Nothing happens, if `width` does not exceed the current width.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPackedVectorWiden(ZyanPackedVector* vector, ZyanU8 width);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current number of elements in the vector.
+ *
+ * @param   vector  A pointer to the `ZyanPackedVector` instance.
+ * @param   size    Receives the number of elements.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPackedVectorGetSize(const ZyanPackedVector* vector,
+    ZyanUSize* size);
+
+/**
+ * Returns the current number of bits per element.
+ *
+ * @param   vector  A pointer to the `ZyanPackedVector` instance.
+ * @param   width   Receives the number of bits per element.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPackedVectorGetWidth(const ZyanPackedVector* vector,
+    ZyanU8* width);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_PACKEDVECTOR_H */
@@ -0,0 +1,240 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a builder for minimal perfect hash tables over static string sets.
+ */
+
+#ifndef ZYCORE_PERFECTHASH_H
+#define ZYCORE_PERFECTHASH_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/String.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The average number of keys per bucket.
+ */
+#define ZYAN_PERFECT_HASH_BUCKET_SIZE   4
+
+/**
+ * The maximum number of global seeds that are tried before the construction fails.
+ */
+#define ZYAN_PERFECT_HASH_MAX_ATTEMPTS  16
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanPerfectHashSlot` struct.
+ *
+ * Describes the key stored in a single slot of a `ZyanPerfectHash` table.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanPerfectHashSlot_
+{
+    /**
+     * The offset of the key string inside the string buffer.
+     */
+    ZyanU32 offset;
+    /**
+     * The length of the key string.
+     */
+    ZyanU32 length;
+    /**
+     * The index of the key in the input key set.
+     */
+    ZyanU32 index;
+} ZyanPerfectHashSlot;
+
+/**
+ * Defines the `ZyanPerfectHash` struct.
+ *
+ * A frozen minimal perfect hash table that maps every key of a static string set to its index in
+ * the input set.
+ *
+ * The keys are hashed with `ZyanHash64` and distributed to buckets of about
+ * `ZYAN_PERFECT_HASH_BUCKET_SIZE` keys. Every bucket has a pilot value that displaces its keys to
+ * distinct slots, so that every slot holds exactly one key. A lookup computes one hash, reads one
+ * pilot and compares the key of exactly one slot.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanPerfectHash_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The global hash seed.
+     */
+    ZyanU64 seed;
+    /**
+     * The number of keys (and slots).
+     */
+    ZyanU32 key_count;
+    /**
+     * The number of buckets.
+     */
+    ZyanU32 bucket_count;
+    /**
+     * The pilot values of the buckets.
+     */
+    ZyanU32* pilots;
+    /**
+     * The slots.
+     */
+    ZyanPerfectHashSlot* slots;
+    /**
+     * Stores the null-terminated key strings.
+     */
+    char* strings;
+    /**
+     * The total size of the memory block starting at `pilots` in bytes.
+     */
+    ZyanUSize memory_size;
+} ZyanPerfectHash;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Builds a minimal perfect hash table for the given key set.
+ *
+ * @param   table   A pointer to the `ZyanPerfectHash` instance.
+ * @param   keys    A pointer to an array of `ZyanStringView` keys. The keys must be unique.
+ * @param   count   The number of keys.
+ *
+ * @return  A zyan status code.
+ *
+ * The key strings are copied into the table. The memory is dynamically allocated by the default
+ * allocator.
+ *
+ * Finalization with `ZyanPerfectHashDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanPerfectHashInit(ZyanPerfectHash* table,
+    const ZyanStringView* keys, ZyanUSize count);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Builds a minimal perfect hash table for the given key set and sets a custom `allocator`.
+ *
+ * @param   table       A pointer to the `ZyanPerfectHash` instance.
+ * @param   keys        A pointer to an array of `ZyanStringView` keys. The keys must be unique.
+ * @param   count       The number of keys.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Returns `ZYAN_STATUS_INVALID_ARGUMENT` if the key set contains duplicates.
+ *
+ * Finalization with `ZyanPerfectHashDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPerfectHashInitEx(ZyanPerfectHash* table,
+    const ZyanStringView* keys, ZyanUSize count, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanPerfectHash` instance.
+ *
+ * @param   table   A pointer to the `ZyanPerfectHash` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPerfectHashDestroy(ZyanPerfectHash* table);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Looks up the given key.
+ *
+ * @param   table   A pointer to the `ZyanPerfectHash` instance.
+ * @param   key     A pointer to the `ZyanStringView` instance.
+ * @param   index   Receives the index of the key in the input key set. Optional.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the key is part of the key set, `ZYAN_STATUS_FALSE` if not or
+ *          another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPerfectHashLookup(const ZyanPerfectHash* table,
+    const ZyanStringView* key, ZyanUSize* index);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Code generation                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Appends C source code for a static copy of the given table to a string.
+ *
+ * @param   table   A pointer to the `ZyanPerfectHash` instance.
+ * @param   output  A pointer to the `ZyanString` instance that receives the code.
+ * @param   name    The name of the generated lookup function. Also used as a prefix for the
+ *                  generated tables.
+ *
+ * @return  A zyan status code.
+ *
+ * The generated function has the signature
+ * `static ZyanBool name(const char* string, ZyanUSize length, ZyanU32* index)` and behaves like
+ * `ZyanPerfectHashLookup`. It depends on `Zycore/Hash.h` and `Zycore/LibC.h`, but does not
+ * require any initialization at runtime.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPerfectHashEmit(const ZyanPerfectHash* table, ZyanString* output,
+    const char* name);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_PERFECTHASH_H */
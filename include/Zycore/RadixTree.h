@@ -0,0 +1,293 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements an adaptive radix tree (ART) for string keys.
+ */
+
+#ifndef ZYCORE_RADIXTREE_H
+#define ZYCORE_RADIXTREE_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/String.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanRadixTreeCallback` function prototype.
+ *
+ * @param   key         A pointer to the key data. The key is not null-terminated.
+ * @param   length      The length of the key in bytes.
+ * @param   value       A pointer to the value.
+ * @param   user_data   The user data pointer passed to the iteration function.
+ *
+ * @return  `ZYAN_STATUS_TRUE` to continue the iteration, `ZYAN_STATUS_FALSE` to stop it or
+ *          another zyan status code to abort it with an error.
+ */
+typedef ZyanStatus (*ZyanRadixTreeCallback)(const char* key, ZyanUSize length, void* value,
+    void* user_data);
+
+/**
+ * Defines the `ZyanRadixTree` struct.
+ *
+ * The radix tree maps byte strings to values. Inner nodes branch on a single key byte and grow
+ * through four node types (4, 16, 48 and 256 children) as their fanout increases. Runs of bytes
+ * without branches are compressed into the node prefixes, so the number of inner nodes is bounded
+ * by the number of unique prefixes rather than by the total key length.
+ *
+ * Every key is stored exactly once in a leaf, together with its value. Keys may be prefixes of
+ * other keys.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanRadixTree_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The size of a single value in bytes.
+     */
+    ZyanUSize value_size;
+    /**
+     * The offset of the value relative to the start of a leaf.
+     */
+    ZyanUSize value_offset;
+    /**
+     * The offset of the key relative to the start of a leaf.
+     */
+    ZyanUSize key_offset;
+    /**
+     * The number of keys.
+     */
+    ZyanUSize size;
+    /**
+     * The root node or `ZYAN_NULL`, if the tree is empty.
+     */
+    void* root;
+} ZyanRadixTree;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanRadixTree` instance.
+ *
+ * @param   tree        A pointer to the `ZyanRadixTree` instance.
+ * @param   value_size  The size of a single value in bytes or `0`, if the tree should act as a
+ *                      set.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the nodes is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanRadixTreeDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanRadixTreeInit(ZyanRadixTree* tree,
+    ZyanUSize value_size);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanRadixTree` instance and sets a custom `allocator`.
+ *
+ * @param   tree        A pointer to the `ZyanRadixTree` instance.
+ * @param   value_size  The size of a single value in bytes or `0`, if the tree should act as a
+ *                      set.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanRadixTreeDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeInitEx(ZyanRadixTree* tree, ZyanUSize value_size,
+    ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanRadixTree` instance.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeDestroy(ZyanRadixTree* tree);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Inserts a new key or replaces the value of an existing key.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   A pointer to the value. Ignored for sets.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if a new key was inserted, `ZYAN_STATUS_FALSE` if the value of an
+ *          existing key was replaced or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeInsert(ZyanRadixTree* tree, const ZyanStringView* key,
+    const void* value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Removes the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   key     A pointer to the key.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the key was removed, `ZYAN_STATUS_FALSE` if the key does not
+ *          exist or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeRemove(ZyanRadixTree* tree, const ZyanStringView* key);
+
+/**
+ * Erases all keys of the given tree.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeClear(ZyanRadixTree* tree);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a constant pointer to the value associated with the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a constant pointer to the value or `ZYAN_NULL`, if the key does not
+ *                  exist.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the key was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ *
+ * The returned pointer stays valid until the key is removed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeGet(const ZyanRadixTree* tree, const ZyanStringView* key,
+    const void** value);
+
+/**
+ * Returns a mutable pointer to the value associated with the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a mutable pointer to the value or `ZYAN_NULL`, if the key does not
+ *                  exist.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the key was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ *
+ * The returned pointer stays valid until the key is removed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeGetMutable(ZyanRadixTree* tree, const ZyanStringView* key,
+    void** value);
+
+/**
+ * Searches for the longest key that is a prefix of the given `string`.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   string  A pointer to the string.
+ * @param   length  Receives the length of the matching key. Optional.
+ * @param   value   Receives a constant pointer to the value of the matching key or `ZYAN_NULL`,
+ *                  if no key matches. Optional.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if a matching key was found, `ZYAN_STATUS_FALSE` if not or another
+ *          zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeFindLongestPrefix(const ZyanRadixTree* tree,
+    const ZyanStringView* string, ZyanUSize* length, const void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Invokes the given `callback` for every key that starts with the given `prefix`.
+ *
+ * @param   tree        A pointer to the `ZyanRadixTree` instance.
+ * @param   prefix      A pointer to the prefix. Pass an empty string to visit all keys.
+ * @param   callback    The callback function.
+ * @param   user_data   A user defined pointer that is passed to the callback function.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if all matching keys were visited, `ZYAN_STATUS_FALSE` if the
+ *          callback stopped the iteration or the error code returned by the callback.
+ *
+ * Keys are visited in lexicographical (bytewise) order. The tree must not be modified by the
+ * callback.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeForEachPrefix(const ZyanRadixTree* tree,
+    const ZyanStringView* prefix, ZyanRadixTreeCallback callback, void* user_data);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current number of keys in the tree.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   size    Receives the number of keys.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRadixTreeGetSize(const ZyanRadixTree* tree, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_RADIXTREE_H */
@@ -0,0 +1,387 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a compressed bitmap of 32-bit integers (Roaring bitmap).
+ */
+
+#ifndef ZYCORE_ROARINGBITMAP_H
+#define ZYCORE_ROARINGBITMAP_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanRoaringBitmapCallback` function prototype.
+ *
+ * @param   value       The current value.
+ * @param   user_data   The user data pointer passed to the iteration function.
+ *
+ * @return  `ZYAN_STATUS_TRUE` to continue the iteration, `ZYAN_STATUS_FALSE` to stop it or
+ *          another zyan status code to abort it with an error.
+ */
+typedef ZyanStatus (*ZyanRoaringBitmapCallback)(ZyanU32 value, void* user_data);
+
+/**
+ * Defines the `ZyanRoaringBitmap` struct.
+ *
+ * The bitmap stores a set of 32-bit integers. The value space is partitioned into chunks of 2^16
+ * values that share the same upper 16 bits. Each non-empty chunk is stored in a container that is
+ * chosen based on its content:
+ *
+ * - a sorted array of 16-bit values, for up to 4096 values
+ * - a dense bitmap of 2^16 bits (8 KiB), for more than 4096 values
+ * - a sorted list of runs (`ZyanRoaringBitmapRunOptimize`, `ZyanRoaringBitmapAddRange`), if that
+ *   is the smallest representation
+ *
+ * This keeps the memory usage proportional to the number of values (or runs), while set
+ * operations work on whole containers at once.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanRoaringBitmap_
+{
+    /**
+     * The `ZyanAllocator` instance.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The containers, sorted by their key.
+     */
+    ZyanVector containers;
+} ZyanRoaringBitmap;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanRoaringBitmap` instance.
+ *
+ * @param   bitmap  A pointer to the `ZyanRoaringBitmap` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the bitmap is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanRoaringBitmapDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanRoaringBitmapInit(ZyanRoaringBitmap* bitmap);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanRoaringBitmap` instance and sets a custom `allocator`.
+ *
+ * @param   bitmap      A pointer to the `ZyanRoaringBitmap` instance.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanRoaringBitmapDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapInitEx(ZyanRoaringBitmap* bitmap,
+    ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanRoaringBitmap` instance.
+ *
+ * @param   bitmap  A pointer to the `ZyanRoaringBitmap` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapDestroy(ZyanRoaringBitmap* bitmap);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion and deletion                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Adds the given value to the bitmap.
+ *
+ * @param   bitmap  A pointer to the `ZyanRoaringBitmap` instance.
+ * @param   value   The value.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the value was added, `ZYAN_STATUS_FALSE`, if it was already
+ *          present. Another zyan status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapAdd(ZyanRoaringBitmap* bitmap, ZyanU32 value);
+
+/**
+ * Adds all values of the inclusive range `[first, last]` to the bitmap.
+ *
+ * @param   bitmap  A pointer to the `ZyanRoaringBitmap` instance.
+ * @param   first   The first value.
+ * @param   last    The last value.
+ *
+ * @return  A zyan status code.
+ *
+ * Affected containers are converted to the smallest representation, which usually is a run
+ * container.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapAddRange(ZyanRoaringBitmap* bitmap, ZyanU32 first,
+    ZyanU32 last);
+
+/**
+ * Removes the given value from the bitmap.
+ *
+ * @param   bitmap  A pointer to the `ZyanRoaringBitmap` instance.
+ * @param   value   The value.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the value was removed, `ZYAN_STATUS_FALSE`, if it was not
+ *          present. Another zyan status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapRemove(ZyanRoaringBitmap* bitmap, ZyanU32 value);
+
+/**
+ * Removes all values from the bitmap.
+ *
+ * @param   bitmap  A pointer to the `ZyanRoaringBitmap` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapClear(ZyanRoaringBitmap* bitmap);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Checks, if the given value is present in the bitmap.
+ *
+ * @param   bitmap  A pointer to the `ZyanRoaringBitmap` instance.
+ * @param   value   The value.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the value is present, `ZYAN_STATUS_FALSE`, if not. Another
+ *          zyan status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapContains(const ZyanRoaringBitmap* bitmap,
+    ZyanU32 value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Set operations                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Performs a set intersection of the given bitmaps and stores the result in `destination`.
+ *
+ * @param   destination A pointer to the `ZyanRoaringBitmap` instance that is used as the first
+ *                      input and as the destination.
+ * @param   source      A pointer to the `ZyanRoaringBitmap` instance that is used as the second
+ *                      input.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapAND(ZyanRoaringBitmap* destination,
+    const ZyanRoaringBitmap* source);
+
+/**
+ * Performs a set union of the given bitmaps and stores the result in `destination`.
+ *
+ * @param   destination A pointer to the `ZyanRoaringBitmap` instance that is used as the first
+ *                      input and as the destination.
+ * @param   source      A pointer to the `ZyanRoaringBitmap` instance that is used as the second
+ *                      input.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapOR(ZyanRoaringBitmap* destination,
+    const ZyanRoaringBitmap* source);
+
+/**
+ * Performs a symmetric set difference of the given bitmaps and stores the result in
+ * `destination`.
+ *
+ * @param   destination A pointer to the `ZyanRoaringBitmap` instance that is used as the first
+ *                      input and as the destination.
+ * @param   source      A pointer to the `ZyanRoaringBitmap` instance that is used as the second
+ *                      input.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapXOR(ZyanRoaringBitmap* destination,
+    const ZyanRoaringBitmap* source);
+
+/**
+ * Removes all values of `source` from `destination`.
+ *
+ * @param   destination A pointer to the `ZyanRoaringBitmap` instance that is used as the first
+ *                      input and as the destination.
+ * @param   source      A pointer to the `ZyanRoaringBitmap` instance that is used as the second
+ *                      input.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapANDNOT(ZyanRoaringBitmap* destination,
+    const ZyanRoaringBitmap* source);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Invokes the given `callback` for every value in ascending order.
+ *
+ * @param   bitmap      A pointer to the `ZyanRoaringBitmap` instance.
+ * @param   callback    The callback function.
+ * @param   user_data   A user defined pointer that is passed to the callback function.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if all values were visited, `ZYAN_STATUS_FALSE` if the callback
+ *          stopped the iteration or the error code returned by the callback.
+ *
+ * The bitmap must not be modified by the callback.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapForEach(const ZyanRoaringBitmap* bitmap,
+    ZyanRoaringBitmapCallback callback, void* user_data);
+
+/**
+ * Appends all values in ascending order to the given vector.
+ *
+ * @param   bitmap  A pointer to the `ZyanRoaringBitmap` instance.
+ * @param   values  A pointer to a `ZyanVector` instance with `ZyanU32` elements that receives
+ *                  the values.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapExportValues(const ZyanRoaringBitmap* bitmap,
+    ZyanVector* values);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Serialization                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the number of bytes required to serialize the bitmap.
+ *
+ * @param   bitmap  A pointer to the `ZyanRoaringBitmap` instance.
+ * @param   size    Receives the number of bytes.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapGetSerializedSize(const ZyanRoaringBitmap* bitmap,
+    ZyanUSize* size);
+
+/**
+ * Serializes the bitmap into the given buffer.
+ *
+ * @param   bitmap      A pointer to the `ZyanRoaringBitmap` instance.
+ * @param   buffer      A pointer to the destination buffer.
+ * @param   capacity    The size of the destination buffer in bytes.
+ * @param   size        Receives the number of bytes written.
+ *
+ * @return  A zyan status code.
+ *
+ * The data is written in the portable Roaring bitmap format (little-endian), which is understood
+ * by other Roaring implementations.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapSerialize(const ZyanRoaringBitmap* bitmap, void* buffer,
+    ZyanUSize capacity, ZyanUSize* size);
+
+/**
+ * Replaces the content of the bitmap with the serialized bitmap in the given buffer.
+ *
+ * @param   bitmap  A pointer to the `ZyanRoaringBitmap` instance.
+ * @param   buffer  A pointer to the serialized data (portable Roaring bitmap format).
+ * @param   size    The size of the serialized data in bytes.
+ * @param   read    Receives the number of bytes consumed. This argument is optional and may be
+ *                  `ZYAN_NULL`.
+ *
+ * @return  A zyan status code. `ZYAN_STATUS_INVALID_ARGUMENT` is returned for truncated or
+ *          malformed data, in which case the bitmap is left empty.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapDeserialize(ZyanRoaringBitmap* bitmap,
+    const void* buffer, ZyanUSize size, ZyanUSize* read);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Converts every container to run encoding, if that is its smallest representation (and back,
+ * if not).
+ *
+ * @param   bitmap  A pointer to the `ZyanRoaringBitmap` instance.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the bitmap contains run containers afterwards,
+ *          `ZYAN_STATUS_FALSE`, if not. Another zyan status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapRunOptimize(ZyanRoaringBitmap* bitmap);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the number of values in the bitmap.
+ *
+ * @param   bitmap      A pointer to the `ZyanRoaringBitmap` instance.
+ * @param   cardinality Receives the number of values.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapGetCardinality(const ZyanRoaringBitmap* bitmap,
+    ZyanU64* cardinality);
+
+/**
+ * Returns the number of bytes allocated for the containers of the bitmap.
+ *
+ * @param   bitmap  A pointer to the `ZyanRoaringBitmap` instance.
+ * @param   size    Receives the number of bytes.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRoaringBitmapGetSizeBytes(const ZyanRoaringBitmap* bitmap,
+    ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_ROARINGBITMAP_H */
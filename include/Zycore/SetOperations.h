@@ -0,0 +1,128 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements set operations on sorted vectors of integers.
+ *
+ * The functions in this file operate on vectors of 32- or 64-bit integers (an `element_size` of
+ * `4` or `8`) that are sorted in ascending order, when interpreted as unsigned integers. All
+ * involved vectors must have the same element size and the `result` vector must not be one of
+ * the input vectors.
+ *
+ * The `result` vector is cleared before the result is written. The vector grows as needed, but a
+ * vector initialized with a custom buffer must provide enough capacity for the largest possible
+ * result.
+ *
+ * Comparisons are performed in blocks using SIMD instructions where available. If one of the
+ * inputs is a lot smaller than the other, the larger one is searched using galloping (exponential)
+ * search instead of being scanned linearly.
+ */
+
+#ifndef ZYCORE_SETOPERATIONS_H
+#define ZYCORE_SETOPERATIONS_H
+
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/**
+ * Calculates the intersection of two sorted sets.
+ *
+ * @param   first   A pointer to the first `ZyanVector` instance.
+ * @param   second  A pointer to the second `ZyanVector` instance.
+ * @param   result  A pointer to the `ZyanVector` instance that receives all elements present in
+ *                  both input vectors.
+ *
+ * @return  A zyan status code.
+ *
+ * The input vectors must not contain duplicate elements.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSetIntersection(const ZyanVector* first, const ZyanVector* second,
+    ZyanVector* result);
+
+/**
+ * Calculates the union of two sorted sets.
+ *
+ * @param   first   A pointer to the first `ZyanVector` instance.
+ * @param   second  A pointer to the second `ZyanVector` instance.
+ * @param   result  A pointer to the `ZyanVector` instance that receives all elements present in
+ *                  at least one of the input vectors.
+ *
+ * @return  A zyan status code.
+ *
+ * The input vectors must not contain duplicate elements. Elements present in both vectors are
+ * only written once.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSetUnion(const ZyanVector* first, const ZyanVector* second,
+    ZyanVector* result);
+
+/**
+ * Calculates the difference of two sorted sets.
+ *
+ * @param   first   A pointer to the first `ZyanVector` instance.
+ * @param   second  A pointer to the second `ZyanVector` instance.
+ * @param   result  A pointer to the `ZyanVector` instance that receives all elements of the
+ *                  `first` vector that are not present in the `second` vector.
+ *
+ * @return  A zyan status code.
+ *
+ * The input vectors must not contain duplicate elements.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSetDifference(const ZyanVector* first, const ZyanVector* second,
+    ZyanVector* result);
+
+/**
+ * Merges two sorted vectors.
+ *
+ * @param   first   A pointer to the first `ZyanVector` instance.
+ * @param   second  A pointer to the second `ZyanVector` instance.
+ * @param   result  A pointer to the `ZyanVector` instance that receives all elements of both
+ *                  input vectors.
+ *
+ * @return  A zyan status code.
+ *
+ * In contrast to `ZyanSetUnion`, the input vectors may contain duplicates and all of them are
+ * kept in the result.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSetMerge(const ZyanVector* first, const ZyanVector* second,
+    ZyanVector* result);
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_SETOPERATIONS_H */
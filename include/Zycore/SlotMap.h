@@ -0,0 +1,347 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a slot map with generational handles.
+ */
+
+#ifndef ZYCORE_SLOTMAP_H
+#define ZYCORE_SLOTMAP_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Object.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanSlotMapHandle` struct.
+ *
+ * A handle identifies a single element of a `ZyanSlotMap`. Handles stay valid until the element is
+ * erased, regardless of other insertions and erasures. Accessing an erased element through a stale
+ * handle is detected by comparing the generation of the handle with the generation of the slot.
+ *
+ * A zero-initialized handle never refers to an element.
+ */
+typedef struct ZyanSlotMapHandle_
+{
+    /**
+     * The slot index.
+     */
+    ZyanU32 index;
+    /**
+     * The generation of the slot at the time the handle was created.
+     */
+    ZyanU32 generation;
+} ZyanSlotMapHandle;
+
+/**
+ * Defines the `ZyanSlotMap` struct.
+ *
+ * The elements are kept in a densely packed array, so that iterating them is as cheap as iterating
+ * a `ZyanVector`. Erasing an element moves the last element into the resulting gap. A separate
+ * array of slots maps the stable handles to the current positions of the elements.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanSlotMap_
+{
+    /**
+     * The size of a single element in bytes.
+     */
+    ZyanUSize element_size;
+    /**
+     * The element destructor callback.
+     */
+    ZyanMemberProcedure destructor;
+    /**
+     * The vector that contains the densely packed elements.
+     */
+    ZyanVector elements;
+    /**
+     * The vector that contains the slot index of each element.
+     */
+    ZyanVector owners;
+    /**
+     * The vector that contains the slots.
+     */
+    ZyanVector slots;
+    /**
+     * The index of the first free slot.
+     */
+    ZyanU32 free;
+} ZyanSlotMap;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanSlotMap` instance.
+ *
+ * @param   map             A pointer to the `ZyanSlotMap` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   destructor      A destructor callback that is invoked every time an element is erased
+ *                          from the map. This parameter is optional and can be set to `ZYAN_NULL`.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the elements is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanSlotMapDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanSlotMapInit(ZyanSlotMap* map,
+    ZyanUSize element_size, ZyanMemberProcedure destructor);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanSlotMap` instance and sets a custom `allocator`.
+ *
+ * @param   map             A pointer to the `ZyanSlotMap` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   capacity        The initial capacity (number of elements).
+ * @param   destructor      A destructor callback that is invoked every time an element is erased
+ *                          from the map. This parameter is optional and can be set to `ZYAN_NULL`.
+ * @param   allocator       A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanSlotMapDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSlotMapInitEx(ZyanSlotMap* map, ZyanUSize element_size,
+    ZyanUSize capacity, ZyanMemberProcedure destructor, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanSlotMap` instance.
+ *
+ * @param   map A pointer to the `ZyanSlotMap` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSlotMapDestroy(ZyanSlotMap* map);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Inserts a copy of the given element into the map.
+ *
+ * @param   map     A pointer to the `ZyanSlotMap` instance.
+ * @param   element A pointer to the element to insert.
+ * @param   handle  Receives the handle of the new element.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSlotMapInsert(ZyanSlotMap* map, const void* element,
+    ZyanSlotMapHandle* handle);
+
+/**
+ * Inserts a new, uninitialized element into the map.
+ *
+ * @param   map     A pointer to the `ZyanSlotMap` instance.
+ * @param   element Receives a pointer to the new element.
+ * @param   handle  Receives the handle of the new element.
+ *
+ * @return  A zyan status code.
+ *
+ * The returned pointer is only valid until the next insertion or erasure.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSlotMapEmplace(ZyanSlotMap* map, void** element,
+    ZyanSlotMapHandle* handle);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Erases the element referred to by the given handle.
+ *
+ * @param   map     A pointer to the `ZyanSlotMap` instance.
+ * @param   handle  The handle of the element.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the element was erased, `ZYAN_STATUS_FALSE` if the handle is stale
+ *          or another zyan status code if an error occurred.
+ *
+ * The last element of the dense array is moved into the position of the erased element, which
+ * invalidates pointers to it, but not its handle.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSlotMapErase(ZyanSlotMap* map, ZyanSlotMapHandle handle);
+
+/**
+ * Erases all elements of the map.
+ *
+ * @param   map A pointer to the `ZyanSlotMap` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All handles handed out so far become stale.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSlotMapClear(ZyanSlotMap* map);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Checks, if the given handle refers to an element of the map.
+ *
+ * @param   map     A pointer to the `ZyanSlotMap` instance.
+ * @param   handle  The handle.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the handle is valid, `ZYAN_STATUS_FALSE` if it is stale or
+ *          another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSlotMapContains(const ZyanSlotMap* map, ZyanSlotMapHandle handle);
+
+/**
+ * Returns a constant pointer to the element referred to by the given handle.
+ *
+ * @param   map     A pointer to the `ZyanSlotMap` instance.
+ * @param   handle  The handle of the element.
+ * @param   element Receives a constant pointer to the element or `ZYAN_NULL`, if the handle is
+ *                  stale.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the element was found, `ZYAN_STATUS_FALSE` if the handle is stale
+ *          or another zyan status code if an error occurred.
+ *
+ * The returned pointer is only valid until the next insertion or erasure.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSlotMapGet(const ZyanSlotMap* map, ZyanSlotMapHandle handle,
+    const void** element);
+
+/**
+ * Returns a mutable pointer to the element referred to by the given handle.
+ *
+ * @param   map     A pointer to the `ZyanSlotMap` instance.
+ * @param   handle  The handle of the element.
+ * @param   element Receives a mutable pointer to the element or `ZYAN_NULL`, if the handle is
+ *                  stale.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the element was found, `ZYAN_STATUS_FALSE` if the handle is stale
+ *          or another zyan status code if an error occurred.
+ *
+ * The returned pointer is only valid until the next insertion or erasure.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSlotMapGetMutable(ZyanSlotMap* map, ZyanSlotMapHandle handle,
+    void** element);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a constant pointer to the densely packed elements.
+ *
+ * @param   map         A pointer to the `ZyanSlotMap` instance.
+ * @param   elements    Receives a constant pointer to the first element or `ZYAN_NULL`, if the
+ *                      map is empty.
+ *
+ * @return  A zyan status code.
+ *
+ * The elements are stored contiguously in no particular order. Use `ZyanSlotMapGetSize` to
+ * obtain their number and `ZyanSlotMapGetHandle` to obtain the handle of an element at a given
+ * position.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSlotMapGetElements(const ZyanSlotMap* map, const void** elements);
+
+/**
+ * Returns a mutable pointer to the densely packed elements.
+ *
+ * @param   map         A pointer to the `ZyanSlotMap` instance.
+ * @param   elements    Receives a mutable pointer to the first element or `ZYAN_NULL`, if the map
+ *                      is empty.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSlotMapGetElementsMutable(ZyanSlotMap* map, void** elements);
+
+/**
+ * Returns the handle of the element at the given position of the dense array.
+ *
+ * @param   map     A pointer to the `ZyanSlotMap` instance.
+ * @param   index   The position of the element.
+ * @param   handle  Receives the handle of the element.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSlotMapGetHandle(const ZyanSlotMap* map, ZyanUSize index,
+    ZyanSlotMapHandle* handle);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Changes the capacity of the given `ZyanSlotMap` instance.
+ *
+ * @param   map         A pointer to the `ZyanSlotMap` instance.
+ * @param   capacity    The new minimum capacity of the map.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSlotMapReserve(ZyanSlotMap* map, ZyanUSize capacity);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current number of elements in the map.
+ *
+ * @param   map     A pointer to the `ZyanSlotMap` instance.
+ * @param   size    Receives the number of elements.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSlotMapGetSize(const ZyanSlotMap* map, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_SLOTMAP_H */
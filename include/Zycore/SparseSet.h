@@ -0,0 +1,246 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a sparse set of integer ids.
+ */
+
+#ifndef ZYCORE_SPARSESET_H
+#define ZYCORE_SPARSESET_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanSparseSet` struct.
+ *
+ * The sparse set stores a subset of the integers `[0, universe)`. The present elements are kept in
+ * a densely packed array in insertion order (modified by removals), while a second array maps each
+ * possible element to its position in the dense array. This allows constant time insertion,
+ * removal, membership tests and clearing, while iteration only touches the present elements.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanSparseSet_
+{
+    /**
+     * The `ZyanAllocator` instance.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The number of possible elements.
+     */
+    ZyanU32 universe;
+    /**
+     * The number of present elements.
+     */
+    ZyanU32 size;
+    /**
+     * Maps each possible element to its position in the dense array.
+     */
+    ZyanU32* sparse;
+    /**
+     * The densely packed present elements.
+     */
+    ZyanU32* dense;
+} ZyanSparseSet;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanSparseSet` instance.
+ *
+ * @param   set         A pointer to the `ZyanSparseSet` instance.
+ * @param   universe    The number of possible elements. Valid elements are `0` to `universe - 1`.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the set is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanSparseSetDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanSparseSetInit(ZyanSparseSet* set,
+    ZyanU32 universe);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanSparseSet` instance and sets a custom `allocator`.
+ *
+ * @param   set         A pointer to the `ZyanSparseSet` instance.
+ * @param   universe    The number of possible elements. Valid elements are `0` to `universe - 1`.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanSparseSetDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSparseSetInitEx(ZyanSparseSet* set, ZyanU32 universe,
+    ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanSparseSet` instance.
+ *
+ * @param   set A pointer to the `ZyanSparseSet` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSparseSetDestroy(ZyanSparseSet* set);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion and deletion                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Inserts the given element into the set.
+ *
+ * @param   set     A pointer to the `ZyanSparseSet` instance.
+ * @param   element The element.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the element was inserted, `ZYAN_STATUS_FALSE` if it was already
+ *          present or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSparseSetInsert(ZyanSparseSet* set, ZyanU32 element);
+
+/**
+ * Removes the given element from the set.
+ *
+ * @param   set     A pointer to the `ZyanSparseSet` instance.
+ * @param   element The element.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the element was removed, `ZYAN_STATUS_FALSE` if it was not present
+ *          or another zyan status code if an error occurred.
+ *
+ * The last element of the dense array is moved into the position of the removed element.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSparseSetRemove(ZyanSparseSet* set, ZyanU32 element);
+
+/**
+ * Removes the most recently inserted element that is still present from the set.
+ *
+ * @param   set     A pointer to the `ZyanSparseSet` instance.
+ * @param   element Receives the removed element.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if an element was removed, `ZYAN_STATUS_FALSE` if the set is empty
+ *          or another zyan status code if an error occurred.
+ *
+ * Together with `ZyanSparseSetInsert`, this allows using the set as a worklist that never contains
+ * the same element twice.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSparseSetPop(ZyanSparseSet* set, ZyanU32* element);
+
+/**
+ * Removes all elements from the set in constant time.
+ *
+ * @param   set A pointer to the `ZyanSparseSet` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSparseSetClear(ZyanSparseSet* set);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Checks, if the given element is present in the set.
+ *
+ * @param   set     A pointer to the `ZyanSparseSet` instance.
+ * @param   element The element.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the element is present, `ZYAN_STATUS_FALSE` if not or another
+ *          zyan status code if an error occurred.
+ *
+ * Elements outside of the universe are never present.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSparseSetContains(const ZyanSparseSet* set, ZyanU32 element);
+
+/**
+ * Returns a constant pointer to the densely packed present elements.
+ *
+ * @param   set         A pointer to the `ZyanSparseSet` instance.
+ * @param   elements    Receives a constant pointer to the first element.
+ *
+ * @return  A zyan status code.
+ *
+ * Use `ZyanSparseSetGetSize` to obtain the number of elements. The pointer stays valid until the
+ * set is destroyed, but the contents change with every insertion and removal.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSparseSetGetElements(const ZyanSparseSet* set,
+    const ZyanU32** elements);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current number of elements in the set.
+ *
+ * @param   set     A pointer to the `ZyanSparseSet` instance.
+ * @param   size    Receives the number of elements.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSparseSetGetSize(const ZyanSparseSet* set, ZyanUSize* size);
+
+/**
+ * Returns the number of possible elements of the set.
+ *
+ * @param   set         A pointer to the `ZyanSparseSet` instance.
+ * @param   universe    Receives the number of possible elements.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSparseSetGetUniverse(const ZyanSparseSet* set, ZyanU32* universe);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_SPARSESET_H */
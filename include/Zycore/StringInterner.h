@@ -0,0 +1,250 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a string interning table that maps unique strings to compact integer ids.
+ */
+
+#ifndef ZYCORE_STRINGINTERNER_H
+#define ZYCORE_STRINGINTERNER_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/HashMap.h>
+#include <Zycore/Status.h>
+#include <Zycore/String.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The default size of a single string storage block in bytes.
+ */
+#define ZYAN_STRING_INTERNER_DEFAULT_BLOCK_SIZE 4096
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanStringInterner` struct.
+ *
+ * The interner copies every unique string exactly once into a chain of storage blocks and assigns
+ * it a 32-bit id. Ids are assigned consecutively starting at `0`. The string data never moves, so
+ * views returned by the interner stay valid until the interner is cleared or destroyed.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanStringInterner_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The default size of a single storage block in bytes.
+     */
+    ZyanUSize block_size;
+    /**
+     * The storage block that is currently filled (head of the block chain).
+     */
+    void* block;
+    /**
+     * The next free byte inside the current storage block.
+     */
+    char* cursor;
+    /**
+     * The number of free bytes in the current storage block.
+     */
+    ZyanUSize remaining;
+    /**
+     * Maps ids to the stored strings.
+     */
+    ZyanVector strings;
+    /**
+     * Maps the stored strings to their ids.
+     */
+    ZyanHashMap lookup;
+} ZyanStringInterner;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanStringInterner` instance.
+ *
+ * @param   interner    A pointer to the `ZyanStringInterner` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory is dynamically allocated by the default allocator using the default block size.
+ *
+ * Finalization with `ZyanStringInternerDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanStringInternerInit(ZyanStringInterner* interner);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanStringInterner` instance and sets a custom `allocator` and block
+ * size.
+ *
+ * @param   interner    A pointer to the `ZyanStringInterner` instance.
+ * @param   block_size  The size of a single storage block in bytes or `0` to use the default
+ *                      size. Strings that do not fit into a block get a dedicated one.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanStringInternerDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringInternerInitEx(ZyanStringInterner* interner,
+    ZyanUSize block_size, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanStringInterner` instance.
+ *
+ * @param   interner    A pointer to the `ZyanStringInterner` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringInternerDestroy(ZyanStringInterner* interner);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Interning                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the id of the given string and adds it to the interner if it is not already present.
+ *
+ * @param   interner    A pointer to the `ZyanStringInterner` instance.
+ * @param   string      A pointer to the `ZyanStringView` instance.
+ * @param   id          Receives the id of the string.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the string was added, `ZYAN_STATUS_FALSE` if it was already
+ *          present or another zyan status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringInternerIntern(ZyanStringInterner* interner,
+    const ZyanStringView* string, ZyanU32* id);
+
+/**
+ * Removes all strings from the given interner.
+ *
+ * @param   interner    A pointer to the `ZyanStringInterner` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All previously returned ids and views are invalidated.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringInternerClear(ZyanStringInterner* interner);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the id of the given string without adding it to the interner.
+ *
+ * @param   interner    A pointer to the `ZyanStringInterner` instance.
+ * @param   string      A pointer to the `ZyanStringView` instance.
+ * @param   id          Receives the id of the string. Optional.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the string was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringInternerFind(const ZyanStringInterner* interner,
+    const ZyanStringView* string, ZyanU32* id);
+
+/**
+ * Returns a view on the string with the given id.
+ *
+ * @param   interner    A pointer to the `ZyanStringInterner` instance.
+ * @param   id          The id of the string.
+ * @param   view        Receives the view. The referenced data is null-terminated and stays valid
+ *                      until the interner is cleared or destroyed.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringInternerGetView(const ZyanStringInterner* interner, ZyanU32 id,
+    ZyanStringView* view);
+
+/**
+ * Returns a pointer to the null-terminated string with the given id.
+ *
+ * @param   interner    A pointer to the `ZyanStringInterner` instance.
+ * @param   id          The id of the string.
+ * @param   string      Receives a pointer to the string data.
+ * @param   length      Receives the length of the string (excluding the terminating `\0`
+ *                      character). Optional.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringInternerGetString(const ZyanStringInterner* interner,
+    ZyanU32 id, const char** string, ZyanUSize* length);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the number of unique strings in the given interner.
+ *
+ * @param   interner    A pointer to the `ZyanStringInterner` instance.
+ * @param   size        Receives the number of strings.
+ *
+ * @return  A zyan status code.
+ *
+ * Valid ids are in the range `[0, size)`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringInternerGetSize(const ZyanStringInterner* interner,
+    ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_STRINGINTERNER_H */
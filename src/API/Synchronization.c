@@ -152,6 +152,68 @@ ZyanStatus ZyanCriticalSectionDelete(ZyanCriticalSection* critical_section)
     return ZYAN_STATUS_SUCCESS;
 }
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Reader-writer lock                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Translates the error code of a `pthread_rwlock_*` function.
+ *
+ * @param   error   The error code.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanReadWriteLockTranslateError(int error)
+{
+    switch (error)
+    {
+    case 0:
+        return ZYAN_STATUS_SUCCESS;
+    case EAGAIN:
+        return ZYAN_STATUS_OUT_OF_RESOURCES;
+    case ENOMEM:
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    case EPERM:
+    case EDEADLK:
+        return ZYAN_STATUS_INVALID_OPERATION;
+    case EBUSY:
+    case EINVAL:
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    default:
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+}
+
+ZyanStatus ZyanReadWriteLockInitialize(ZyanReadWriteLock* lock)
+{
+    return ZyanReadWriteLockTranslateError(pthread_rwlock_init(lock, ZYAN_NULL));
+}
+
+ZyanStatus ZyanReadWriteLockAcquireShared(ZyanReadWriteLock* lock)
+{
+    return ZyanReadWriteLockTranslateError(pthread_rwlock_rdlock(lock));
+}
+
+ZyanStatus ZyanReadWriteLockReleaseShared(ZyanReadWriteLock* lock)
+{
+    return ZyanReadWriteLockTranslateError(pthread_rwlock_unlock(lock));
+}
+
+ZyanStatus ZyanReadWriteLockAcquireExclusive(ZyanReadWriteLock* lock)
+{
+    return ZyanReadWriteLockTranslateError(pthread_rwlock_wrlock(lock));
+}
+
+ZyanStatus ZyanReadWriteLockReleaseExclusive(ZyanReadWriteLock* lock)
+{
+    return ZyanReadWriteLockTranslateError(pthread_rwlock_unlock(lock));
+}
+
+ZyanStatus ZyanReadWriteLockDelete(ZyanReadWriteLock* lock)
+{
+    return ZyanReadWriteLockTranslateError(pthread_rwlock_destroy(lock));
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 
 #elif defined(ZYAN_WINDOWS)
@@ -193,6 +255,53 @@ ZyanStatus ZyanCriticalSectionDelete(ZyanCriticalSection* critical_section)
     return ZYAN_STATUS_SUCCESS;
 }
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Reader-writer lock                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanReadWriteLockInitialize(ZyanReadWriteLock* lock)
+{
+    InitializeSRWLock(lock);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanReadWriteLockAcquireShared(ZyanReadWriteLock* lock)
+{
+    AcquireSRWLockShared(lock);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanReadWriteLockReleaseShared(ZyanReadWriteLock* lock)
+{
+    ReleaseSRWLockShared(lock);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanReadWriteLockAcquireExclusive(ZyanReadWriteLock* lock)
+{
+    AcquireSRWLockExclusive(lock);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanReadWriteLockReleaseExclusive(ZyanReadWriteLock* lock)
+{
+    ReleaseSRWLockExclusive(lock);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanReadWriteLockDelete(ZyanReadWriteLock* lock)
+{
+    // Slim reader-writer locks do not own any resources
+    ZYAN_UNUSED(lock);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 
 #else
@@ -25,8 +25,30 @@
 ***************************************************************************************************/
 
 #include <Zycore/ArgParse.h>
+#include <Zycore/HashMap.h>
 #include <Zycore/LibC.h>
 
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanArgParseDefinitionEntry` struct.
+ *
+ * Stored in the definition lookup map, keyed by the argument name.
+ */
+typedef struct ZyanArgParseDefinitionEntry_
+{
+    /**
+     * The argument definition.
+     */
+    const ZyanArgParseDefinition* def;
+    /**
+     * Signals, if the argument was encountered while parsing.
+     */
+    ZyanBool found;
+} ZyanArgParseDefinitionEntry;
+
 /* ============================================================================================== */
 /* Exported functions                                                                             */
 /* ============================================================================================== */
@@ -45,23 +67,21 @@ ZyanStatus ZyanArgParseEx(const ZyanArgParseConfig *cfg, ZyanVector* parsed,
     const char** error_token, ZyanAllocator* allocator)
 {
 #   define ZYAN_ERR_TOK(tok) if (error_token) { *error_token = tok; }
+#   define ZYAN_ARGPARSE_CHECK(status) \
+        if (!ZYAN_SUCCESS(err = (status))) { goto failure; }
 
     ZYAN_ASSERT(cfg);
     ZYAN_ASSERT(parsed);
 
-    // TODO: Once we have a decent hash map impl, refactor this to use it. The majority of for
-    //       loops through the argument list could be avoided.
-
     if (cfg->min_unnamed_args > cfg->max_unnamed_args)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
     // Check argument syntax.
+    ZyanUSize num_defs = 0;
     for (const ZyanArgParseDefinition* def = cfg->args; def && def->name; ++def)
     {
-        // TODO: Duplicate check
-
         if (!def->name)
         {
             return ZYAN_STATUS_INVALID_ARGUMENT;
@@ -78,13 +98,45 @@ ZyanStatus ZyanArgParseEx(const ZyanArgParseConfig *cfg, ZyanVector* parsed,
         {
             return ZYAN_STATUS_INVALID_ARGUMENT;
         }
+
+        ++num_defs;
     }
 
-    // Initialize output vector.
-    ZYAN_CHECK(ZyanVectorInitEx(parsed, sizeof(ZyanArgParseArg), cfg->argc, ZYAN_NULL, allocator,
-        ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD));
+    // Build the definition lookup map.
+    ZyanHashMap defs;
+    ZYAN_CHECK(ZyanHashMapInitStringViewEx(&defs, sizeof(ZyanArgParseDefinitionEntry), num_defs,
+        allocator));
 
     ZyanStatus err;
+    for (const ZyanArgParseDefinition* def = cfg->args; def && def->name; ++def)
+    {
+        ZyanStringView name;
+        ZyanArgParseDefinitionEntry entry;
+        entry.def = def;
+        entry.found = ZYAN_FALSE;
+
+        err = ZyanStringViewInsideBuffer(&name, def->name);
+        if (ZYAN_SUCCESS(err))
+        {
+            err = ZyanHashMapInsert(&defs, &name, &entry);
+        }
+        if (err != ZYAN_STATUS_TRUE)
+        {
+            // Duplicate argument definition.
+            ZYAN_CHECK(ZyanHashMapDestroy(&defs));
+            return ZYAN_SUCCESS(err) ? ZYAN_STATUS_INVALID_ARGUMENT : err;
+        }
+    }
+
+    // Initialize output vector.
+    err = ZyanVectorInitEx(parsed, sizeof(ZyanArgParseArg), cfg->argc, ZYAN_NULL, allocator,
+        ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD);
+    if (!ZYAN_SUCCESS(err))
+    {
+        ZYAN_CHECK(ZyanHashMapDestroy(&defs));
+        return err;
+    }
+
     ZyanBool accept_dash_args = ZYAN_TRUE;
     ZyanUSize num_unnamed_args = 0;
     for (ZyanUSize i = 1; i < cfg->argc; ++i)
@@ -105,26 +157,24 @@ ZyanStatus ZyanArgParseEx(const ZyanArgParseConfig *cfg, ZyanVector* parsed,
             {
                 // Allocate parsed argument struct.
                 ZyanArgParseArg* parsed_arg;
-                ZYAN_CHECK(ZyanVectorEmplace(parsed, (void**)&parsed_arg, ZYAN_NULL));
+                ZYAN_ARGPARSE_CHECK(ZyanVectorEmplace(parsed, (void**)&parsed_arg, ZYAN_NULL));
                 ZYAN_MEMSET(parsed_arg, 0, sizeof(*parsed_arg));
 
                 // Find corresponding argument definition.
-                for (const ZyanArgParseDefinition* def = cfg->args; def && def->name; ++def)
-                {
-                    if (ZYAN_STRCMP(def->name, cur_arg) == 0)
-                    {
-                        parsed_arg->def = def;
-                        break;
-                    }
-                }
+                ZyanStringView name;
+                ZyanArgParseDefinitionEntry* entry;
+                ZYAN_ARGPARSE_CHECK(ZyanStringViewInsideBufferEx(&name, cur_arg, arg_len));
+                ZYAN_ARGPARSE_CHECK(ZyanHashMapGetMutable(&defs, &name, (void**)&entry));
 
-                // Search exhausted & argument not found. RIP.
-                if (!parsed_arg->def)
+                // Argument not found. RIP.
+                if (!entry)
                 {
                     err = ZYAN_STATUS_ARG_NOT_UNDERSTOOD;
                     ZYAN_ERR_TOK(cur_arg);
                     goto failure;
                 }
+                parsed_arg->def = entry->def;
+                entry->found = ZYAN_TRUE;
 
                 // Does the argument expect a value? If yes, consume next token.
                 if (!parsed_arg->def->boolean)
@@ -136,7 +186,8 @@ ZyanStatus ZyanArgParseEx(const ZyanArgParseConfig *cfg, ZyanVector* parsed,
                         goto failure;
                     }
                     parsed_arg->has_value = ZYAN_TRUE;
-                    ZYAN_CHECK(ZyanStringViewInsideBuffer(&parsed_arg->value, cfg->argv[++i]));
+                    ZYAN_ARGPARSE_CHECK(ZyanStringViewInsideBuffer(&parsed_arg->value,
+                        cfg->argv[++i]));
                 }
             }
 
@@ -155,28 +206,25 @@ ZyanStatus ZyanArgParseEx(const ZyanArgParseConfig *cfg, ZyanVector* parsed,
             {
                 // Allocate parsed argument struct.
                 ZyanArgParseArg* parsed_arg;
-                ZYAN_CHECK(ZyanVectorEmplace(parsed, (void**)&parsed_arg, ZYAN_NULL));
+                ZYAN_ARGPARSE_CHECK(ZyanVectorEmplace(parsed, (void**)&parsed_arg, ZYAN_NULL));
                 ZYAN_MEMSET(parsed_arg, 0, sizeof(*parsed_arg));
 
                 // Find corresponding argument definition.
-                for (const ZyanArgParseDefinition* def = cfg->args; def && def->name; ++def)
-                {
-                    if (ZYAN_STRLEN(def->name) == 2 &&
-                        def->name[0] == '-' &&
-                        def->name[1] == *read_ptr)
-                    {
-                        parsed_arg->def = def;
-                        break;
-                    }
-                }
-
-                // Search exhausted, no match found?
-                if (!parsed_arg->def)
+                const char short_name[3] = { '-', *read_ptr, '\0' };
+                ZyanStringView name;
+                ZyanArgParseDefinitionEntry* entry;
+                ZYAN_ARGPARSE_CHECK(ZyanStringViewInsideBufferEx(&name, short_name, 2));
+                ZYAN_ARGPARSE_CHECK(ZyanHashMapGetMutable(&defs, &name, (void**)&entry));
+
+                // No match found?
+                if (!entry)
                 {
                     err = ZYAN_STATUS_ARG_NOT_UNDERSTOOD;
                     ZYAN_ERR_TOK(cur_arg);
                     goto failure;
                 }
+                parsed_arg->def = entry->def;
+                entry->found = ZYAN_TRUE;
 
                 // Requires value?
                 if (!parsed_arg->def->boolean)
@@ -185,7 +233,8 @@ ZyanStatus ZyanArgParseEx(const ZyanArgParseConfig *cfg, ZyanVector* parsed,
                     if (read_ptr[1])
                     {
                         parsed_arg->has_value = ZYAN_TRUE;
-                        ZYAN_CHECK(ZyanStringViewInsideBuffer(&parsed_arg->value, read_ptr + 1));
+                        ZYAN_ARGPARSE_CHECK(ZyanStringViewInsideBuffer(&parsed_arg->value,
+                            read_ptr + 1));
                     }
                     // If not, consume next token (e.g. `-n 1000`).
                     else
@@ -198,7 +247,8 @@ ZyanStatus ZyanArgParseEx(const ZyanArgParseConfig *cfg, ZyanVector* parsed,
                         }
 
                         parsed_arg->has_value = ZYAN_TRUE;
-                        ZYAN_CHECK(ZyanStringViewInsideBuffer(&parsed_arg->value, cfg->argv[++i]));
+                        ZYAN_ARGPARSE_CHECK(ZyanStringViewInsideBuffer(&parsed_arg->value,
+                            cfg->argv[++i]));
                     }
 
                     // Either way, continue with next argument.
@@ -218,10 +268,10 @@ ZyanStatus ZyanArgParseEx(const ZyanArgParseConfig *cfg, ZyanVector* parsed,
 
         // Allocate parsed argument struct.
         ZyanArgParseArg* parsed_arg;
-        ZYAN_CHECK(ZyanVectorEmplace(parsed, (void**)&parsed_arg, ZYAN_NULL));
+        ZYAN_ARGPARSE_CHECK(ZyanVectorEmplace(parsed, (void**)&parsed_arg, ZYAN_NULL));
         ZYAN_MEMSET(parsed_arg, 0, sizeof(*parsed_arg));
         parsed_arg->has_value = ZYAN_TRUE;
-        ZYAN_CHECK(ZyanStringViewInsideBuffer(&parsed_arg->value, cur_arg));
+        ZYAN_ARGPARSE_CHECK(ZyanStringViewInsideBuffer(&parsed_arg->value, cur_arg));
 
     continue_main_loop:;
     }
@@ -234,30 +284,21 @@ ZyanStatus ZyanArgParseEx(const ZyanArgParseConfig *cfg, ZyanVector* parsed,
         goto failure;
     }
 
-    // Check whether all required arguments are present.
-    ZyanUSize num_parsed_args;
-    ZYAN_CHECK(ZyanVectorGetSize(parsed, &num_parsed_args));
+    // Check whether all required arguments are present. The definitions are checked in their
+    // original order, so the first missing one is reported.
     for (const ZyanArgParseDefinition* def = cfg->args; def && def->name; ++def)
     {
-        if (!def->required) continue;
-
-        ZyanBool arg_found = ZYAN_FALSE;
-        for (ZyanUSize i = 0; i < num_parsed_args; ++i)
+        if (!def->required)
         {
-            const ZyanArgParseArg* arg = ZYAN_NULL;
-            ZYAN_CHECK(ZyanVectorGetPointer(parsed, i, (const void**)&arg));
-
-            // Skip unnamed args.
-            if (!arg->def) continue;
-
-            if (arg->def == def)
-            {
-                arg_found = ZYAN_TRUE;
-                break;
-            }
+            continue;
         }
 
-        if (!arg_found)
+        ZyanStringView name;
+        const ZyanArgParseDefinitionEntry* entry;
+        ZYAN_ARGPARSE_CHECK(ZyanStringViewInsideBuffer(&name, def->name));
+        ZYAN_ARGPARSE_CHECK(ZyanHashMapGet(&defs, &name, (const void**)&entry));
+        ZYAN_ASSERT(entry);
+        if (!entry->found)
         {
             err = ZYAN_STATUS_REQUIRED_ARG_MISSING;
             ZYAN_ERR_TOK(def->name);
@@ -266,13 +307,16 @@ ZyanStatus ZyanArgParseEx(const ZyanArgParseConfig *cfg, ZyanVector* parsed,
     }
 
     // Yay!
+    ZYAN_CHECK(ZyanHashMapDestroy(&defs));
     ZYAN_ERR_TOK(ZYAN_NULL);
     return ZYAN_STATUS_SUCCESS;
 
 failure:
     ZYAN_CHECK(ZyanVectorDestroy(parsed));
+    ZYAN_CHECK(ZyanHashMapDestroy(&defs));
     return err;
 
+#   undef ZYAN_ARGPARSE_CHECK
 #   undef ZYAN_ERR_TOK
 }
 
@@ -0,0 +1,297 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/AtomicBitset.h>
+#include <Zycore/LibC.h>
+#include <Zycore/Internal/Bits.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Returns the mask of the given bit inside of its word.
+ *
+ * @param   index   The bit index.
+ *
+ * @return  The mask of the bit.
+ */
+#define ZYAN_ATOMIC_BITSET_MASK(index) \
+    (1ULL << ((index) % 64))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/**
+ * Returns the mask of the valid bits of the word at `word_index`.
+ *
+ * @param   bitset      A pointer to the `ZyanAtomicBitset` instance.
+ * @param   word_index  The word index.
+ *
+ * @return  The mask of the valid bits.
+ */
+static ZyanU64 ZyanAtomicBitsetValidMask(const ZyanAtomicBitset* bitset, ZyanUSize word_index)
+{
+    const ZyanUSize used = bitset->size % 64;
+    return ((word_index + 1 == bitset->word_count) && used) ? ((1ULL << used) - 1) : ~0ULL;
+}
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanAtomicBitsetInit(ZyanAtomicBitset* bitset, ZyanUSize count)
+{
+    return ZyanAtomicBitsetInitEx(bitset, count, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanAtomicBitsetInitEx(ZyanAtomicBitset* bitset, ZyanUSize count,
+    ZyanAllocator* allocator)
+{
+    if (!bitset || !count || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(allocator->allocate);
+    ZYAN_ASSERT(allocator->deallocate);
+
+    const ZyanUSize word_count = (count + 63) / 64;
+    void* memory;
+    ZYAN_CHECK(allocator->allocate(allocator, &memory, sizeof(ZyanAtomic64), word_count));
+    ZYAN_MEMSET(memory, 0, word_count * sizeof(ZyanAtomic64));
+
+    bitset->allocator  = allocator;
+    bitset->size       = count;
+    bitset->word_count = word_count;
+    bitset->words      = (ZyanAtomic64*)memory;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanAtomicBitsetDestroy(ZyanAtomicBitset* bitset)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return bitset->allocator->deallocate(bitset->allocator, bitset->words, sizeof(ZyanAtomic64),
+        bitset->word_count);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Atomic bit access                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanAtomicBitsetTestAndSet(ZyanAtomicBitset* bitset, ZyanUSize index)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= bitset->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    const ZyanU64 mask = ZYAN_ATOMIC_BITSET_MASK(index);
+    ZyanAtomic64* const word = &bitset->words[index / 64];
+
+    // Reading first avoids a locked instruction (and the exclusive cache line ownership it
+    // requires) for bits that are already set, which is the common case when marking
+    if (word->value & mask)
+    {
+        return ZYAN_STATUS_TRUE;
+    }
+
+    return (ZyanAtomicFetchOr64(word, mask) & mask) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanAtomicBitsetTestAndReset(ZyanAtomicBitset* bitset, ZyanUSize index)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= bitset->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    const ZyanU64 mask = ZYAN_ATOMIC_BITSET_MASK(index);
+    ZyanAtomic64* const word = &bitset->words[index / 64];
+    if (!(word->value & mask))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    return (ZyanAtomicFetchAnd64(word, ~mask) & mask) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanAtomicBitsetTest(const ZyanAtomicBitset* bitset, ZyanUSize index)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= bitset->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    return (bitset->words[index / 64].value & ZYAN_ATOMIC_BITSET_MASK(index)) ?
+        ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanAtomicBitsetFetchOrWord(ZyanAtomicBitset* bitset, ZyanUSize word_index,
+    ZyanU64 mask, ZyanU64* previous)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (word_index >= bitset->word_count)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    // Keep the bits past the end of the bitset cleared
+    mask &= ZyanAtomicBitsetValidMask(bitset, word_index);
+    const ZyanU64 value = ZyanAtomicFetchOr64(&bitset->words[word_index], mask);
+    if (previous)
+    {
+        *previous = value;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanAtomicBitsetFetchAndWord(ZyanAtomicBitset* bitset, ZyanUSize word_index,
+    ZyanU64 mask, ZyanU64* previous)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (word_index >= bitset->word_count)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    const ZyanU64 value = ZyanAtomicFetchAnd64(&bitset->words[word_index], mask);
+    if (previous)
+    {
+        *previous = value;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Non-atomic access                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanAtomicBitsetResetAll(ZyanAtomicBitset* bitset)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    for (ZyanUSize i = 0; i < bitset->word_count; ++i)
+    {
+        bitset->words[i].value = 0;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanAtomicBitsetCount(const ZyanAtomicBitset* bitset, ZyanUSize* count)
+{
+    if (!bitset || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize result = 0;
+    for (ZyanUSize i = 0; i < bitset->word_count; ++i)
+    {
+        result += ZyanBitPopCount64(bitset->words[i].value);
+    }
+    *count = result;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanAtomicBitsetSnapshot(const ZyanAtomicBitset* bitset, ZyanBitset* destination)
+{
+    if (!bitset || !destination)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanBitsetClear(destination));
+    ZYAN_CHECK(ZyanBitsetReserve(destination, bitset->size));
+
+    ZyanUSize remaining = bitset->size;
+    for (ZyanUSize i = 0; i < bitset->word_count; ++i, remaining -= 64)
+    {
+        const ZyanU8 count = (ZyanU8)ZYAN_MIN(remaining, 64);
+        ZYAN_CHECK(ZyanBitsetAppendWord(destination, bitset->words[i].value, count));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanAtomicBitsetGetSize(const ZyanAtomicBitset* bitset, ZyanUSize* size)
+{
+    if (!bitset || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = bitset->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,1173 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/BTree.h>
+#include <Zycore/LibC.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * The maximum height of a tree. Every inner node has at least three children, which limits the
+ * height of a tree with `2^64` entries to about `41`.
+ */
+#define ZYAN_BTREE_MAX_HEIGHT   48
+
+/**
+ * The minimum number of entries (leaf nodes) or keys (inner nodes) per node.
+ */
+#define ZYAN_BTREE_MIN_CAPACITY 4
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanBTreeLeaf` struct.
+ *
+ * The header of a leaf node. The keys and values follow at the offsets stored in the tree.
+ */
+typedef struct ZyanBTreeLeaf_
+{
+    /**
+     * The number of entries.
+     */
+    ZyanUSize count;
+    /**
+     * The previous leaf node.
+     */
+    struct ZyanBTreeLeaf_* prev;
+    /**
+     * The next leaf node.
+     */
+    struct ZyanBTreeLeaf_* next;
+} ZyanBTreeLeaf;
+
+/**
+ * Defines the `ZyanBTreeInner` struct.
+ *
+ * The header of an inner node. The child pointers directly follow the header, the separator keys
+ * follow at the offset stored in the tree. All keys in `children[i]` are less than `keys[i]` and
+ * all keys in `children[i + 1]` are greater than or equal to `keys[i]`.
+ */
+typedef struct ZyanBTreeInner_
+{
+    /**
+     * The number of keys (the number of children minus one).
+     */
+    ZyanUSize count;
+} ZyanBTreeInner;
+
+/**
+ * Defines the `ZyanBTreePath` struct.
+ *
+ * Records the inner nodes visited while descending to a leaf.
+ */
+typedef struct ZyanBTreePath_
+{
+    /**
+     * The inner nodes, starting at the root.
+     */
+    ZyanBTreeInner* nodes[ZYAN_BTREE_MAX_HEIGHT];
+    /**
+     * The index of the child that was descended into.
+     */
+    ZyanUSize indices[ZYAN_BTREE_MAX_HEIGHT];
+} ZyanBTreePath;
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+#define ZYAN_BTREE_LEAF_KEY(tree, leaf, index) \
+    ((ZyanU8*)(leaf) + (tree)->leaf_keys_offset + (index) * (tree)->key_size)
+
+#define ZYAN_BTREE_LEAF_VALUE(tree, leaf, index) \
+    ((ZyanU8*)(leaf) + (tree)->leaf_values_offset + (index) * (tree)->value_size)
+
+#define ZYAN_BTREE_INNER_KEY(tree, node, index) \
+    ((ZyanU8*)(node) + (tree)->inner_keys_offset + (index) * (tree)->key_size)
+
+#define ZYAN_BTREE_INNER_CHILDREN(node) \
+    ((void**)((ZyanU8*)(node) + sizeof(ZyanBTreeInner)))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Layout                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Calculates the required node size for a leaf node with the given capacity.
+ *
+ * @param   tree        A pointer to the `ZyanBTree` instance.
+ * @param   capacity    The capacity.
+ * @param   keys        Receives the offset of the keys.
+ * @param   values      Receives the offset of the values.
+ *
+ * @return  The required node size in bytes.
+ *
+ * Every node has storage for one additional entry, which is used temporarily while a node is
+ * split.
+ */
+static ZyanUSize ZyanBTreeLeafSize(const ZyanBTree* tree, ZyanUSize capacity, ZyanUSize* keys,
+    ZyanUSize* values)
+{
+    const ZyanUSize key_alignment = ZYAN_MIN(tree->key_size & (~tree->key_size + 1), 8);
+    const ZyanUSize value_alignment =
+        tree->value_size ? ZYAN_MIN(tree->value_size & (~tree->value_size + 1), 8) : 1;
+
+    *keys = ZYAN_ALIGN_UP(sizeof(ZyanBTreeLeaf), key_alignment);
+    *values = ZYAN_ALIGN_UP(*keys + (capacity + 1) * tree->key_size, value_alignment);
+    return *values + (capacity + 1) * tree->value_size;
+}
+
+/**
+ * Calculates the required node size for an inner node with the given capacity.
+ *
+ * @param   tree        A pointer to the `ZyanBTree` instance.
+ * @param   capacity    The capacity.
+ * @param   keys        Receives the offset of the keys.
+ *
+ * @return  The required node size in bytes.
+ */
+static ZyanUSize ZyanBTreeInnerSize(const ZyanBTree* tree, ZyanUSize capacity, ZyanUSize* keys)
+{
+    const ZyanUSize key_alignment = ZYAN_MIN(tree->key_size & (~tree->key_size + 1), 8);
+
+    *keys = ZYAN_ALIGN_UP(sizeof(ZyanBTreeInner) + (capacity + 2) * sizeof(void*),
+        key_alignment);
+    return *keys + (capacity + 1) * tree->key_size;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Node management                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Allocates a new node.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    Receives a pointer to the new node.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanBTreeAllocateNode(ZyanBTree* tree, void** node)
+{
+    ZYAN_CHECK(tree->allocator->allocate(tree->allocator, node, 1, tree->node_size));
+    ZYAN_MEMSET(*node, 0, sizeof(ZyanBTreeLeaf));
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Frees the given node.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the node.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanBTreeFreeNode(ZyanBTree* tree, void* node)
+{
+    return tree->allocator->deallocate(tree->allocator, node, 1, tree->node_size);
+}
+
+/**
+ * Frees the given subtree.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the root node of the subtree.
+ * @param   height  The height of the subtree.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanBTreeFreeSubtree(ZyanBTree* tree, void* node, ZyanUSize height)
+{
+    if (height > 1)
+    {
+        const ZyanBTreeInner* const inner = (const ZyanBTreeInner*)node;
+        void** const children = ZYAN_BTREE_INNER_CHILDREN(inner);
+        for (ZyanUSize i = 0; i <= inner->count; ++i)
+        {
+            ZYAN_CHECK(ZyanBTreeFreeSubtree(tree, children[i], height - 1));
+        }
+    }
+
+    return ZyanBTreeFreeNode(tree, node);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Searching                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the index of the child of the given inner node that contains the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the inner node.
+ * @param   key     A pointer to the key.
+ *
+ * @return  The index of the child.
+ */
+static ZyanUSize ZyanBTreeInnerFind(const ZyanBTree* tree, const ZyanBTreeInner* node,
+    const void* key)
+{
+    // Returns the number of separator keys less than or equal to `key`
+    ZyanUSize lo = 0;
+    ZyanUSize hi = node->count;
+    while (lo < hi)
+    {
+        const ZyanUSize mid = lo + (hi - lo) / 2;
+        if (tree->compare(ZYAN_BTREE_INNER_KEY(tree, node, mid), key) <= 0)
+        {
+            lo = mid + 1;
+        } else
+        {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * Returns the index of the first entry of the given leaf node that is not less (or greater, if
+ * `upper` is set) than the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   leaf    A pointer to the leaf node.
+ * @param   key     A pointer to the key.
+ * @param   upper   `ZYAN_TRUE` to search for the upper bound instead of the lower bound.
+ *
+ * @return  The index of the entry.
+ */
+static ZyanUSize ZyanBTreeLeafFind(const ZyanBTree* tree, const ZyanBTreeLeaf* leaf,
+    const void* key, ZyanBool upper)
+{
+    ZyanUSize lo = 0;
+    ZyanUSize hi = leaf->count;
+    while (lo < hi)
+    {
+        const ZyanUSize mid = lo + (hi - lo) / 2;
+        const ZyanI32 c = tree->compare(ZYAN_BTREE_LEAF_KEY(tree, leaf, mid), key);
+        if ((c < 0) || (upper && (c == 0)))
+        {
+            lo = mid + 1;
+        } else
+        {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * Descends from the root to the leaf node that may contain the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   path    Receives the visited inner nodes. Optional.
+ *
+ * @return  A pointer to the leaf node. The tree must not be empty.
+ */
+static ZyanBTreeLeaf* ZyanBTreeDescend(const ZyanBTree* tree, const void* key,
+    ZyanBTreePath* path)
+{
+    void* node = tree->root;
+    for (ZyanUSize level = 0; level + 1 < tree->height; ++level)
+    {
+        ZyanBTreeInner* const inner = (ZyanBTreeInner*)node;
+        const ZyanUSize index = ZyanBTreeInnerFind(tree, inner, key);
+        if (path)
+        {
+            path->nodes[level] = inner;
+            path->indices[level] = index;
+        }
+        node = ZYAN_BTREE_INNER_CHILDREN(inner)[index];
+    }
+    return (ZyanBTreeLeaf*)node;
+}
+
+/**
+ * Searches for the entry with the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a pointer to the value. Optional.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was found, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ */
+static ZyanStatus ZyanBTreeFind(const ZyanBTree* tree, const void* key, void** value)
+{
+    if (!tree || !key)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (value)
+    {
+        *value = ZYAN_NULL;
+    }
+    if (!tree->root)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    const ZyanBTreeLeaf* const leaf = ZyanBTreeDescend(tree, key, ZYAN_NULL);
+    const ZyanUSize index = ZyanBTreeLeafFind(tree, leaf, key, ZYAN_FALSE);
+    if ((index == leaf->count) || tree->compare(ZYAN_BTREE_LEAF_KEY(tree, leaf, index), key))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    if (value)
+    {
+        *value = ZYAN_BTREE_LEAF_VALUE(tree, leaf, index);
+    }
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/**
+ * Positions a cursor at the first entry not less (or greater) than the given `key`.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   cursor  A pointer to the `ZyanBTreeCursor` instance.
+ * @param   upper   `ZYAN_TRUE` to search for the upper bound instead of the lower bound.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the cursor points to an entry, `ZYAN_STATUS_FALSE` if not or
+ *          another zyan status code if an error occurred.
+ */
+static ZyanStatus ZyanBTreeBound(const ZyanBTree* tree, const void* key, ZyanBTreeCursor* cursor,
+    ZyanBool upper)
+{
+    if (!tree || !key || !cursor)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    cursor->tree  = tree;
+    cursor->leaf  = ZYAN_NULL;
+    cursor->index = 0;
+    if (!tree->root)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZyanBTreeLeaf* leaf = ZyanBTreeDescend(tree, key, ZYAN_NULL);
+    ZyanUSize index = ZyanBTreeLeafFind(tree, leaf, key, upper);
+    if (index == leaf->count)
+    {
+        // The bound is the first entry of the next leaf node
+        leaf = leaf->next;
+        index = 0;
+    }
+
+    cursor->leaf  = leaf;
+    cursor->index = index;
+
+    return leaf ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Node modification                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Moves entries inside a leaf node or between two leaf nodes.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   dst     A pointer to the destination leaf node.
+ * @param   dst_idx The destination index.
+ * @param   src     A pointer to the source leaf node.
+ * @param   src_idx The source index.
+ * @param   count   The number of entries to move.
+ */
+static void ZyanBTreeLeafMove(const ZyanBTree* tree, ZyanBTreeLeaf* dst, ZyanUSize dst_idx,
+    const ZyanBTreeLeaf* src, ZyanUSize src_idx, ZyanUSize count)
+{
+    ZYAN_MEMMOVE(ZYAN_BTREE_LEAF_KEY(tree, dst, dst_idx), ZYAN_BTREE_LEAF_KEY(tree, src, src_idx),
+        count * tree->key_size);
+    if (tree->value_size)
+    {
+        ZYAN_MEMMOVE(ZYAN_BTREE_LEAF_VALUE(tree, dst, dst_idx),
+            ZYAN_BTREE_LEAF_VALUE(tree, src, src_idx), count * tree->value_size);
+    }
+}
+
+/**
+ * Moves keys and children inside an inner node or between two inner nodes.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   dst     A pointer to the destination inner node.
+ * @param   dst_idx The destination index.
+ * @param   src     A pointer to the source inner node.
+ * @param   src_idx The source index.
+ * @param   count   The number of keys and children to move.
+ *
+ * Moves `keys[src_idx..]` and `children[src_idx..]`.
+ */
+static void ZyanBTreeInnerMove(const ZyanBTree* tree, ZyanBTreeInner* dst, ZyanUSize dst_idx,
+    const ZyanBTreeInner* src, ZyanUSize src_idx, ZyanUSize count)
+{
+    ZYAN_MEMMOVE(ZYAN_BTREE_INNER_KEY(tree, dst, dst_idx),
+        ZYAN_BTREE_INNER_KEY(tree, src, src_idx), count * tree->key_size);
+    ZYAN_MEMMOVE(ZYAN_BTREE_INNER_CHILDREN(dst) + dst_idx,
+        ZYAN_BTREE_INNER_CHILDREN(src) + src_idx, count * sizeof(void*));
+}
+
+/**
+ * Inserts a separator key and the child to its right into the given inner node.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the inner node.
+ * @param   index   The index of the new key.
+ * @param   key     A pointer to the key.
+ * @param   child   A pointer to the child (inserted at `index + 1`).
+ *
+ * The node may temporarily exceed its capacity by one key.
+ */
+static void ZyanBTreeInnerInsert(const ZyanBTree* tree, ZyanBTreeInner* node, ZyanUSize index,
+    const void* key, void* child)
+{
+    void** const children = ZYAN_BTREE_INNER_CHILDREN(node);
+
+    ZYAN_MEMMOVE(ZYAN_BTREE_INNER_KEY(tree, node, index + 1),
+        ZYAN_BTREE_INNER_KEY(tree, node, index), (node->count - index) * tree->key_size);
+    ZYAN_MEMMOVE(children + index + 2, children + index + 1,
+        (node->count - index) * sizeof(void*));
+    ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, node, index), key, tree->key_size);
+    children[index + 1] = child;
+    ++node->count;
+}
+
+/**
+ * Removes a separator key and the child to its right from the given inner node.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   node    A pointer to the inner node.
+ * @param   index   The index of the key.
+ */
+static void ZyanBTreeInnerRemove(const ZyanBTree* tree, ZyanBTreeInner* node, ZyanUSize index)
+{
+    void** const children = ZYAN_BTREE_INNER_CHILDREN(node);
+
+    ZYAN_MEMMOVE(ZYAN_BTREE_INNER_KEY(tree, node, index),
+        ZYAN_BTREE_INNER_KEY(tree, node, index + 1), (node->count - index - 1) * tree->key_size);
+    ZYAN_MEMMOVE(children + index + 1, children + index + 2,
+        (node->count - index - 1) * sizeof(void*));
+    --node->count;
+}
+
+/**
+ * Inserts the given separator key and child into the inner nodes along the given path,
+ * splitting full nodes as necessary.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   path    A pointer to the path.
+ * @param   key     A pointer to the separator key.
+ * @param   child   A pointer to the new child that follows the separator key.
+ *
+ * @return  A zyan status code.
+ *
+ * The separator key must not be stored in any node along the path.
+ */
+static ZyanStatus ZyanBTreePropagateSplit(ZyanBTree* tree, const ZyanBTreePath* path,
+    const void* key, void* child)
+{
+    for (ZyanUSize level = tree->height - 1; level-- > 0; )
+    {
+        ZyanBTreeInner* const node = path->nodes[level];
+        ZyanBTreeInnerInsert(tree, node, path->indices[level], key, child);
+        if (node->count <= tree->inner_capacity)
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+
+        // Split the overfull node. The middle key moves up, but stays readable in the unused
+        // storage of the left node until it has been copied into the parent
+        void* memory;
+        ZYAN_CHECK(ZyanBTreeAllocateNode(tree, &memory));
+        ZyanBTreeInner* const right = (ZyanBTreeInner*)memory;
+        const ZyanUSize mid = node->count / 2;
+        right->count = node->count - mid - 1;
+        ZyanBTreeInnerMove(tree, right, 0, node, mid + 1, right->count);
+        ZYAN_BTREE_INNER_CHILDREN(right)[right->count] =
+            ZYAN_BTREE_INNER_CHILDREN(node)[node->count];
+        node->count = mid;
+
+        key = ZYAN_BTREE_INNER_KEY(tree, node, mid);
+        child = right;
+    }
+
+    // The root was split
+    void* memory;
+    ZYAN_CHECK(ZyanBTreeAllocateNode(tree, &memory));
+    ZyanBTreeInner* const root = (ZyanBTreeInner*)memory;
+    root->count = 1;
+    ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, root, 0), key, tree->key_size);
+    ZYAN_BTREE_INNER_CHILDREN(root)[0] = tree->root;
+    ZYAN_BTREE_INNER_CHILDREN(root)[1] = child;
+    tree->root = root;
+    ++tree->height;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Restores the minimum fill of the nodes along the given path after an entry was removed from
+ * the given leaf node.
+ *
+ * @param   tree    A pointer to the `ZyanBTree` instance.
+ * @param   path    A pointer to the path.
+ * @param   leaf    A pointer to the leaf node.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanBTreeRebalance(ZyanBTree* tree, const ZyanBTreePath* path,
+    ZyanBTreeLeaf* leaf)
+{
+    // Leaf level
+    if ((tree->height == 1) || (leaf->count >= tree->leaf_capacity / 2))
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanUSize level = tree->height - 2;
+    ZyanBTreeInner* parent = path->nodes[level];
+    ZyanUSize index = path->indices[level];
+    void** children = ZYAN_BTREE_INNER_CHILDREN(parent);
+    ZyanUSize separator = index ? index - 1 : 0;
+    ZyanBTreeLeaf* left = (ZyanBTreeLeaf*)children[separator];
+    ZyanBTreeLeaf* right = (ZyanBTreeLeaf*)children[separator + 1];
+
+    if (left->count + right->count <= tree->leaf_capacity)
+    {
+        ZyanBTreeLeafMove(tree, left, left->count, right, 0, right->count);
+        left->count += right->count;
+        left->next = right->next;
+        if (right->next)
+        {
+            right->next->prev = left;
+        } else
+        {
+            tree->last = left;
+        }
+        ZyanBTreeInnerRemove(tree, parent, separator);
+        ZYAN_CHECK(ZyanBTreeFreeNode(tree, right));
+    } else
+    {
+        if (leaf == right)
+        {
+            ZyanBTreeLeafMove(tree, right, 1, right, 0, right->count);
+            ZyanBTreeLeafMove(tree, right, 0, left, left->count - 1, 1);
+            --left->count;
+            ++right->count;
+        } else
+        {
+            ZyanBTreeLeafMove(tree, left, left->count, right, 0, 1);
+            ZyanBTreeLeafMove(tree, right, 0, right, 1, right->count - 1);
+            ++left->count;
+            --right->count;
+        }
+        ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, parent, separator),
+            ZYAN_BTREE_LEAF_KEY(tree, right, 0), tree->key_size);
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // Inner levels
+    while (level > 0)
+    {
+        ZyanBTreeInner* const node = parent;
+        if (node->count >= tree->inner_capacity / 2)
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+
+        --level;
+        parent = path->nodes[level];
+        index = path->indices[level];
+        children = ZYAN_BTREE_INNER_CHILDREN(parent);
+        separator = index ? index - 1 : 0;
+        ZyanBTreeInner* const l = (ZyanBTreeInner*)children[separator];
+        ZyanBTreeInner* const r = (ZyanBTreeInner*)children[separator + 1];
+        void** const l_children = ZYAN_BTREE_INNER_CHILDREN(l);
+        void** const r_children = ZYAN_BTREE_INNER_CHILDREN(r);
+        void* const parent_key = ZYAN_BTREE_INNER_KEY(tree, parent, separator);
+
+        if (l->count + r->count + 1 <= tree->inner_capacity)
+        {
+            // Merge: the separator key moves down between the keys of both nodes
+            ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, l, l->count), parent_key, tree->key_size);
+            ZyanBTreeInnerMove(tree, l, l->count + 1, r, 0, r->count);
+            l_children[l->count + 1 + r->count] = r_children[r->count];
+            l->count += r->count + 1;
+            ZyanBTreeInnerRemove(tree, parent, separator);
+            ZYAN_CHECK(ZyanBTreeFreeNode(tree, r));
+            continue;
+        }
+
+        // Rotate a single key through the parent
+        if (node == r)
+        {
+            r_children[r->count + 1] = r_children[r->count];
+            ZyanBTreeInnerMove(tree, r, 1, r, 0, r->count);
+            ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, r, 0), parent_key, tree->key_size);
+            r_children[0] = l_children[l->count];
+            ZYAN_MEMCPY(parent_key, ZYAN_BTREE_INNER_KEY(tree, l, l->count - 1), tree->key_size);
+            --l->count;
+            ++r->count;
+        } else
+        {
+            ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, l, l->count), parent_key, tree->key_size);
+            l_children[l->count + 1] = r_children[0];
+            ZYAN_MEMCPY(parent_key, ZYAN_BTREE_INNER_KEY(tree, r, 0), tree->key_size);
+            ZyanBTreeInnerMove(tree, r, 0, r, 1, r->count - 1);
+            r_children[r->count - 1] = r_children[r->count];
+            ++l->count;
+            --r->count;
+        }
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // Collapse the root, if it only has a single child left
+    if (!parent->count)
+    {
+        tree->root = ZYAN_BTREE_INNER_CHILDREN(parent)[0];
+        --tree->height;
+        ZYAN_CHECK(ZyanBTreeFreeNode(tree, parent));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanBTreeInit(ZyanBTree* tree, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanComparison compare)
+{
+    return ZyanBTreeInitEx(tree, key_size, value_size, compare, 0, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanBTreeInitEx(ZyanBTree* tree, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanComparison compare, ZyanUSize node_size, ZyanAllocator* allocator)
+{
+    if (!tree || !key_size || !compare || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(allocator->allocate);
+    ZYAN_ASSERT(allocator->deallocate);
+
+    tree->allocator  = allocator;
+    tree->key_size   = key_size;
+    tree->value_size = value_size;
+    tree->compare    = compare;
+    tree->size       = 0;
+    tree->height     = 0;
+    tree->root       = ZYAN_NULL;
+    tree->first      = ZYAN_NULL;
+    tree->last       = ZYAN_NULL;
+
+    ZyanUSize keys;
+    ZyanUSize values;
+    node_size = node_size ? node_size : ZYAN_BTREE_DEFAULT_NODE_SIZE;
+    node_size = ZYAN_MAX(node_size,
+        ZyanBTreeLeafSize(tree, ZYAN_BTREE_MIN_CAPACITY, &keys, &values));
+    node_size = ZYAN_MAX(node_size, ZyanBTreeInnerSize(tree, ZYAN_BTREE_MIN_CAPACITY, &keys));
+    tree->node_size = node_size;
+
+    // Start at an upper bound of the capacity and decrease it until the node fits
+    ZyanUSize capacity = node_size / (key_size + value_size);
+    while (ZyanBTreeLeafSize(tree, capacity, &keys, &values) > node_size)
+    {
+        --capacity;
+    }
+    tree->leaf_capacity      = (ZyanU32)ZYAN_MIN(capacity, ZYAN_UINT32_MAX);
+    tree->leaf_keys_offset   = keys;
+    tree->leaf_values_offset = values;
+
+    capacity = node_size / (key_size + sizeof(void*));
+    while (ZyanBTreeInnerSize(tree, capacity, &keys) > node_size)
+    {
+        --capacity;
+    }
+    tree->inner_capacity    = (ZyanU32)ZYAN_MIN(capacity, ZYAN_UINT32_MAX);
+    tree->inner_keys_offset = keys;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBTreeDestroy(ZyanBTree* tree)
+{
+    return ZyanBTreeClear(tree);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBTreeInsert(ZyanBTree* tree, const void* key, const void* value)
+{
+    if (!tree || !key || (tree->value_size && !value))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (!tree->root)
+    {
+        void* memory;
+        ZYAN_CHECK(ZyanBTreeAllocateNode(tree, &memory));
+        tree->root   = memory;
+        tree->first  = memory;
+        tree->last   = memory;
+        tree->height = 1;
+    }
+
+    ZyanBTreePath path;
+    ZyanBTreeLeaf* const leaf = ZyanBTreeDescend(tree, key, &path);
+    const ZyanUSize index = ZyanBTreeLeafFind(tree, leaf, key, ZYAN_FALSE);
+    if ((index < leaf->count) && !tree->compare(ZYAN_BTREE_LEAF_KEY(tree, leaf, index), key))
+    {
+        if (tree->value_size)
+        {
+            ZYAN_MEMCPY(ZYAN_BTREE_LEAF_VALUE(tree, leaf, index), value, tree->value_size);
+        }
+        return ZYAN_STATUS_FALSE;
+    }
+
+    // Nodes have storage for one additional entry, so the entry is always inserted first
+    ZyanBTreeLeafMove(tree, leaf, index + 1, leaf, index, leaf->count - index);
+    ZYAN_MEMCPY(ZYAN_BTREE_LEAF_KEY(tree, leaf, index), key, tree->key_size);
+    if (tree->value_size)
+    {
+        ZYAN_MEMCPY(ZYAN_BTREE_LEAF_VALUE(tree, leaf, index), value, tree->value_size);
+    }
+    ++leaf->count;
+    ++tree->size;
+
+    if (leaf->count <= tree->leaf_capacity)
+    {
+        return ZYAN_STATUS_TRUE;
+    }
+
+    void* memory;
+    const ZyanStatus status = ZyanBTreeAllocateNode(tree, &memory);
+    if (!ZYAN_SUCCESS(status))
+    {
+        // Undo the insertion
+        ZyanBTreeLeafMove(tree, leaf, index, leaf, index + 1, leaf->count - index - 1);
+        --leaf->count;
+        --tree->size;
+        return status;
+    }
+
+    // Keep the left node completely filled, if the entry was appended to the last leaf node.
+    // This results in densely packed leaf nodes for ascending insertions
+    ZyanBTreeLeaf* const right = (ZyanBTreeLeaf*)memory;
+    const ZyanUSize split = ((index == tree->leaf_capacity) && !leaf->next) ?
+        tree->leaf_capacity : leaf->count / 2;
+    right->count = leaf->count - split;
+    ZyanBTreeLeafMove(tree, right, 0, leaf, split, right->count);
+    leaf->count = split;
+
+    right->prev = leaf;
+    right->next = leaf->next;
+    if (leaf->next)
+    {
+        leaf->next->prev = right;
+    } else
+    {
+        tree->last = right;
+    }
+    leaf->next = right;
+
+    ZYAN_CHECK(ZyanBTreePropagateSplit(tree, &path, ZYAN_BTREE_LEAF_KEY(tree, right, 0), right));
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanBTreeBulkLoad(ZyanBTree* tree, const ZyanVector* keys, const ZyanVector* values)
+{
+    if (!tree || !keys || (keys->element_size != tree->key_size) || tree->root ||
+        (tree->value_size && (!values || (values->element_size != tree->value_size) ||
+        (values->size != keys->size))))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize count = keys->size;
+    if (!count)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+    for (ZyanUSize i = 1; i < count; ++i)
+    {
+        if (tree->compare((const ZyanU8*)keys->data + (i - 1) * tree->key_size,
+            (const ZyanU8*)keys->data + i * tree->key_size) >= 0)
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+    }
+
+    // Every level is stored as an array of node pointers, followed by pointers to the smallest
+    // key of every node
+    ZyanUSize nodes = (count + tree->leaf_capacity - 1) / tree->leaf_capacity;
+    const ZyanUSize level_size = nodes * 2 * sizeof(void*);
+    void* level_memory;
+    ZYAN_CHECK(tree->allocator->allocate(tree->allocator, &level_memory, 1, level_size));
+    void** const level = (void**)level_memory;
+    const void** const min_keys = (const void**)(level + nodes);
+
+    // On failure, the nodes `level[0..created)` of the current level and the remaining nodes
+    // `level[rest..rest_end)` of the previous level are released
+    ZyanStatus status;
+    ZyanUSize height = 1;
+    ZyanUSize created = 0;
+    ZyanUSize rest = 0;
+    ZyanUSize rest_end = 0;
+
+    // Leaf level: distribute the entries evenly, so that every node is at least half full
+    ZyanBTreeLeaf* prev = ZYAN_NULL;
+    ZyanUSize offset = 0;
+    for (; created < nodes; ++created)
+    {
+        void* memory;
+        status = ZyanBTreeAllocateNode(tree, &memory);
+        if (!ZYAN_SUCCESS(status))
+        {
+            goto failure;
+        }
+
+        ZyanBTreeLeaf* const leaf = (ZyanBTreeLeaf*)memory;
+        leaf->count = count / nodes + (created < count % nodes);
+        ZYAN_MEMCPY(ZYAN_BTREE_LEAF_KEY(tree, leaf, 0),
+            (const ZyanU8*)keys->data + offset * tree->key_size, leaf->count * tree->key_size);
+        if (tree->value_size)
+        {
+            ZYAN_MEMCPY(ZYAN_BTREE_LEAF_VALUE(tree, leaf, 0),
+                (const ZyanU8*)values->data + offset * tree->value_size,
+                leaf->count * tree->value_size);
+        }
+        offset += leaf->count;
+
+        leaf->prev = prev;
+        if (prev)
+        {
+            prev->next = leaf;
+        }
+        prev = leaf;
+
+        level[created] = leaf;
+        min_keys[created] = ZYAN_BTREE_LEAF_KEY(tree, leaf, 0);
+    }
+
+    void* const first = level[0];
+
+    // Inner levels
+    while (nodes > 1)
+    {
+        const ZyanUSize children = nodes;
+        const ZyanUSize fanout = (ZyanUSize)tree->inner_capacity + 1;
+        nodes = (children + fanout - 1) / fanout;
+        ++height;
+        created = 0;
+        rest = 0;
+        rest_end = children;
+
+        for (; created < nodes; ++created)
+        {
+            void* memory;
+            status = ZyanBTreeAllocateNode(tree, &memory);
+            if (!ZYAN_SUCCESS(status))
+            {
+                goto failure;
+            }
+
+            ZyanBTreeInner* const node = (ZyanBTreeInner*)memory;
+            const ZyanUSize n = children / nodes + (created < children % nodes);
+            void** const node_children = ZYAN_BTREE_INNER_CHILDREN(node);
+            for (ZyanUSize j = 0; j < n; ++j)
+            {
+                node_children[j] = level[rest + j];
+                if (j)
+                {
+                    ZYAN_MEMCPY(ZYAN_BTREE_INNER_KEY(tree, node, j - 1), min_keys[rest + j],
+                        tree->key_size);
+                }
+            }
+            node->count = n - 1;
+
+            // Entries of the previous level are always consumed before they are overwritten,
+            // as `created <= rest`
+            const void* const min_key = min_keys[rest];
+            level[created] = node;
+            min_keys[created] = min_key;
+            rest += n;
+        }
+    }
+
+    tree->root   = level[0];
+    tree->first  = first;
+    tree->last   = prev;
+    tree->height = height;
+    tree->size   = count;
+
+    return tree->allocator->deallocate(tree->allocator, level_memory, 1, level_size);
+
+failure:
+    for (ZyanUSize i = 0; i < created; ++i)
+    {
+        ZyanBTreeFreeSubtree(tree, level[i], height);
+    }
+    for (ZyanUSize i = rest; i < rest_end; ++i)
+    {
+        ZyanBTreeFreeSubtree(tree, level[i], height - 1);
+    }
+    tree->allocator->deallocate(tree->allocator, level_memory, 1, level_size);
+
+    return status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBTreeRemove(ZyanBTree* tree, const void* key)
+{
+    if (!tree || !key)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (!tree->root)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZyanBTreePath path;
+    ZyanBTreeLeaf* const leaf = ZyanBTreeDescend(tree, key, &path);
+    const ZyanUSize index = ZyanBTreeLeafFind(tree, leaf, key, ZYAN_FALSE);
+    if ((index == leaf->count) || tree->compare(ZYAN_BTREE_LEAF_KEY(tree, leaf, index), key))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZyanBTreeLeafMove(tree, leaf, index, leaf, index + 1, leaf->count - index - 1);
+    --leaf->count;
+    --tree->size;
+
+    if (!tree->size)
+    {
+        ZYAN_CHECK(ZyanBTreeClear(tree));
+        return ZYAN_STATUS_TRUE;
+    }
+
+    ZYAN_CHECK(ZyanBTreeRebalance(tree, &path, leaf));
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanBTreeClear(ZyanBTree* tree)
+{
+    if (!tree)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (tree->root)
+    {
+        ZYAN_CHECK(ZyanBTreeFreeSubtree(tree, tree->root, tree->height));
+    }
+
+    tree->size   = 0;
+    tree->height = 0;
+    tree->root   = ZYAN_NULL;
+    tree->first  = ZYAN_NULL;
+    tree->last   = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBTreeGet(const ZyanBTree* tree, const void* key, const void** value)
+{
+    return ZyanBTreeFind(tree, key, (void**)value);
+}
+
+ZyanStatus ZyanBTreeGetMutable(ZyanBTree* tree, const void* key, void** value)
+{
+    return ZyanBTreeFind(tree, key, value);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Cursors                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBTreeBegin(const ZyanBTree* tree, ZyanBTreeCursor* cursor)
+{
+    if (!tree || !cursor)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    cursor->tree  = tree;
+    cursor->leaf  = tree->first;
+    cursor->index = 0;
+
+    return cursor->leaf ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanBTreeLast(const ZyanBTree* tree, ZyanBTreeCursor* cursor)
+{
+    if (!tree || !cursor)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    cursor->tree  = tree;
+    cursor->leaf  = tree->last;
+    cursor->index = tree->last ? ((const ZyanBTreeLeaf*)tree->last)->count - 1 : 0;
+
+    return cursor->leaf ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanBTreeLowerBound(const ZyanBTree* tree, const void* key, ZyanBTreeCursor* cursor)
+{
+    return ZyanBTreeBound(tree, key, cursor, ZYAN_FALSE);
+}
+
+ZyanStatus ZyanBTreeUpperBound(const ZyanBTree* tree, const void* key, ZyanBTreeCursor* cursor)
+{
+    return ZyanBTreeBound(tree, key, cursor, ZYAN_TRUE);
+}
+
+ZyanStatus ZyanBTreeCursorNext(ZyanBTreeCursor* cursor)
+{
+    if (!cursor || !cursor->leaf)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanBTreeLeaf* const leaf = (const ZyanBTreeLeaf*)cursor->leaf;
+    if (++cursor->index == leaf->count)
+    {
+        cursor->leaf  = leaf->next;
+        cursor->index = 0;
+    }
+
+    return cursor->leaf ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanBTreeCursorPrev(ZyanBTreeCursor* cursor)
+{
+    if (!cursor || !cursor->leaf)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (cursor->index)
+    {
+        --cursor->index;
+        return ZYAN_STATUS_TRUE;
+    }
+
+    const ZyanBTreeLeaf* const prev = ((const ZyanBTreeLeaf*)cursor->leaf)->prev;
+    cursor->leaf  = (void*)prev;
+    cursor->index = prev ? prev->count - 1 : 0;
+
+    return prev ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanBTreeCursorGet(const ZyanBTreeCursor* cursor, const void** key,
+    const void** value)
+{
+    return ZyanBTreeCursorGetMutable(cursor, key, (void**)value);
+}
+
+ZyanStatus ZyanBTreeCursorGetMutable(const ZyanBTreeCursor* cursor, const void** key,
+    void** value)
+{
+    if (!cursor || !cursor->tree)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (!cursor->leaf)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (key)
+    {
+        *key = ZYAN_BTREE_LEAF_KEY(cursor->tree, cursor->leaf, cursor->index);
+    }
+    if (value)
+    {
+        *value = ZYAN_BTREE_LEAF_VALUE(cursor->tree, cursor->leaf, cursor->index);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBTreeGetSize(const ZyanBTree* tree, ZyanUSize* size)
+{
+    if (!tree || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = tree->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -26,6 +26,26 @@
 
 #include <Zycore/Bitset.h>
 #include <Zycore/LibC.h>
+#include <Zycore/Internal/Bits.h>
+#include <Zycore/Internal/CPU.h>
+
+#if !defined(ZYAN_KERNEL) && (defined(ZYAN_X64) || defined(ZYAN_X86)) && defined(__AVX2__)
+#   define ZYAN_BITSET_AVX2
+#   include <immintrin.h>
+#elif !defined(ZYAN_KERNEL) && (defined(ZYAN_X64) || (defined(ZYAN_X86) && \
+    (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))))
+#   define ZYAN_BITSET_SSE2
+#   include <emmintrin.h>
+#elif !defined(ZYAN_KERNEL) && defined(ZYAN_AARCH64)
+#   define ZYAN_BITSET_NEON
+#   include <arm_neon.h>
+#endif
+
+#if !defined(ZYAN_KERNEL) && (defined(ZYAN_X64) || defined(ZYAN_X86)) && \
+    (defined(ZYAN_GNUC) || defined(ZYAN_MSVC))
+#   define ZYAN_BITSET_POPCOUNT_X86
+#   include <immintrin.h>
+#endif
 
 /* ============================================================================================== */
 /* Internal constants                                                                             */
@@ -34,88 +54,1466 @@
 #define ZYAN_BITSET_GROWTH_FACTOR    2
 #define ZYAN_BITSET_SHRINK_THRESHOLD 2
 
+/**
+ * The number of bits covered by a block of the rank/select directory (one cache line).
+ */
+#define ZYAN_BITSET_RANK_BLOCK_BITS         512
+
+/**
+ * The number of blocks covered by a superblock of the rank/select directory. Chosen so that the
+ * relative block counts fit into 16 bits.
+ */
+#define ZYAN_BITSET_RANK_SUPERBLOCK_BLOCKS  128
+
+/**
+ * The distance between two select samples of the rank/select directory, in set bits.
+ */
+#define ZYAN_BITSET_SELECT_SAMPLE_RATE      8192
+
+#if defined(ZYAN_BITSET_AVX2) || defined(ZYAN_BITSET_SSE2) || defined(ZYAN_BITSET_NEON)
+
+/**
+ * Maps every byte value to the offsets of its set bits in ascending index order (bit `0` is the
+ * most significant bit of the byte). Unused entries are zero.
+ */
+static const ZyanU8 ZYAN_BITSET_DECODE_TABLE[256][8] =
+{
+    { 0, 0, 0, 0, 0, 0, 0, 0 }, { 7, 0, 0, 0, 0, 0, 0, 0 }, { 6, 0, 0, 0, 0, 0, 0, 0 },
+    { 6, 7, 0, 0, 0, 0, 0, 0 }, { 5, 0, 0, 0, 0, 0, 0, 0 }, { 5, 7, 0, 0, 0, 0, 0, 0 },
+    { 5, 6, 0, 0, 0, 0, 0, 0 }, { 5, 6, 7, 0, 0, 0, 0, 0 }, { 4, 0, 0, 0, 0, 0, 0, 0 },
+    { 4, 7, 0, 0, 0, 0, 0, 0 }, { 4, 6, 0, 0, 0, 0, 0, 0 }, { 4, 6, 7, 0, 0, 0, 0, 0 },
+    { 4, 5, 0, 0, 0, 0, 0, 0 }, { 4, 5, 7, 0, 0, 0, 0, 0 }, { 4, 5, 6, 0, 0, 0, 0, 0 },
+    { 4, 5, 6, 7, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0, 0, 0 }, { 3, 7, 0, 0, 0, 0, 0, 0 },
+    { 3, 6, 0, 0, 0, 0, 0, 0 }, { 3, 6, 7, 0, 0, 0, 0, 0 }, { 3, 5, 0, 0, 0, 0, 0, 0 },
+    { 3, 5, 7, 0, 0, 0, 0, 0 }, { 3, 5, 6, 0, 0, 0, 0, 0 }, { 3, 5, 6, 7, 0, 0, 0, 0 },
+    { 3, 4, 0, 0, 0, 0, 0, 0 }, { 3, 4, 7, 0, 0, 0, 0, 0 }, { 3, 4, 6, 0, 0, 0, 0, 0 },
+    { 3, 4, 6, 7, 0, 0, 0, 0 }, { 3, 4, 5, 0, 0, 0, 0, 0 }, { 3, 4, 5, 7, 0, 0, 0, 0 },
+    { 3, 4, 5, 6, 0, 0, 0, 0 }, { 3, 4, 5, 6, 7, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0, 0, 0 },
+    { 2, 7, 0, 0, 0, 0, 0, 0 }, { 2, 6, 0, 0, 0, 0, 0, 0 }, { 2, 6, 7, 0, 0, 0, 0, 0 },
+    { 2, 5, 0, 0, 0, 0, 0, 0 }, { 2, 5, 7, 0, 0, 0, 0, 0 }, { 2, 5, 6, 0, 0, 0, 0, 0 },
+    { 2, 5, 6, 7, 0, 0, 0, 0 }, { 2, 4, 0, 0, 0, 0, 0, 0 }, { 2, 4, 7, 0, 0, 0, 0, 0 },
+    { 2, 4, 6, 0, 0, 0, 0, 0 }, { 2, 4, 6, 7, 0, 0, 0, 0 }, { 2, 4, 5, 0, 0, 0, 0, 0 },
+    { 2, 4, 5, 7, 0, 0, 0, 0 }, { 2, 4, 5, 6, 0, 0, 0, 0 }, { 2, 4, 5, 6, 7, 0, 0, 0 },
+    { 2, 3, 0, 0, 0, 0, 0, 0 }, { 2, 3, 7, 0, 0, 0, 0, 0 }, { 2, 3, 6, 0, 0, 0, 0, 0 },
+    { 2, 3, 6, 7, 0, 0, 0, 0 }, { 2, 3, 5, 0, 0, 0, 0, 0 }, { 2, 3, 5, 7, 0, 0, 0, 0 },
+    { 2, 3, 5, 6, 0, 0, 0, 0 }, { 2, 3, 5, 6, 7, 0, 0, 0 }, { 2, 3, 4, 0, 0, 0, 0, 0 },
+    { 2, 3, 4, 7, 0, 0, 0, 0 }, { 2, 3, 4, 6, 0, 0, 0, 0 }, { 2, 3, 4, 6, 7, 0, 0, 0 },
+    { 2, 3, 4, 5, 0, 0, 0, 0 }, { 2, 3, 4, 5, 7, 0, 0, 0 }, { 2, 3, 4, 5, 6, 0, 0, 0 },
+    { 2, 3, 4, 5, 6, 7, 0, 0 }, { 1, 0, 0, 0, 0, 0, 0, 0 }, { 1, 7, 0, 0, 0, 0, 0, 0 },
+    { 1, 6, 0, 0, 0, 0, 0, 0 }, { 1, 6, 7, 0, 0, 0, 0, 0 }, { 1, 5, 0, 0, 0, 0, 0, 0 },
+    { 1, 5, 7, 0, 0, 0, 0, 0 }, { 1, 5, 6, 0, 0, 0, 0, 0 }, { 1, 5, 6, 7, 0, 0, 0, 0 },
+    { 1, 4, 0, 0, 0, 0, 0, 0 }, { 1, 4, 7, 0, 0, 0, 0, 0 }, { 1, 4, 6, 0, 0, 0, 0, 0 },
+    { 1, 4, 6, 7, 0, 0, 0, 0 }, { 1, 4, 5, 0, 0, 0, 0, 0 }, { 1, 4, 5, 7, 0, 0, 0, 0 },
+    { 1, 4, 5, 6, 0, 0, 0, 0 }, { 1, 4, 5, 6, 7, 0, 0, 0 }, { 1, 3, 0, 0, 0, 0, 0, 0 },
+    { 1, 3, 7, 0, 0, 0, 0, 0 }, { 1, 3, 6, 0, 0, 0, 0, 0 }, { 1, 3, 6, 7, 0, 0, 0, 0 },
+    { 1, 3, 5, 0, 0, 0, 0, 0 }, { 1, 3, 5, 7, 0, 0, 0, 0 }, { 1, 3, 5, 6, 0, 0, 0, 0 },
+    { 1, 3, 5, 6, 7, 0, 0, 0 }, { 1, 3, 4, 0, 0, 0, 0, 0 }, { 1, 3, 4, 7, 0, 0, 0, 0 },
+    { 1, 3, 4, 6, 0, 0, 0, 0 }, { 1, 3, 4, 6, 7, 0, 0, 0 }, { 1, 3, 4, 5, 0, 0, 0, 0 },
+    { 1, 3, 4, 5, 7, 0, 0, 0 }, { 1, 3, 4, 5, 6, 0, 0, 0 }, { 1, 3, 4, 5, 6, 7, 0, 0 },
+    { 1, 2, 0, 0, 0, 0, 0, 0 }, { 1, 2, 7, 0, 0, 0, 0, 0 }, { 1, 2, 6, 0, 0, 0, 0, 0 },
+    { 1, 2, 6, 7, 0, 0, 0, 0 }, { 1, 2, 5, 0, 0, 0, 0, 0 }, { 1, 2, 5, 7, 0, 0, 0, 0 },
+    { 1, 2, 5, 6, 0, 0, 0, 0 }, { 1, 2, 5, 6, 7, 0, 0, 0 }, { 1, 2, 4, 0, 0, 0, 0, 0 },
+    { 1, 2, 4, 7, 0, 0, 0, 0 }, { 1, 2, 4, 6, 0, 0, 0, 0 }, { 1, 2, 4, 6, 7, 0, 0, 0 },
+    { 1, 2, 4, 5, 0, 0, 0, 0 }, { 1, 2, 4, 5, 7, 0, 0, 0 }, { 1, 2, 4, 5, 6, 0, 0, 0 },
+    { 1, 2, 4, 5, 6, 7, 0, 0 }, { 1, 2, 3, 0, 0, 0, 0, 0 }, { 1, 2, 3, 7, 0, 0, 0, 0 },
+    { 1, 2, 3, 6, 0, 0, 0, 0 }, { 1, 2, 3, 6, 7, 0, 0, 0 }, { 1, 2, 3, 5, 0, 0, 0, 0 },
+    { 1, 2, 3, 5, 7, 0, 0, 0 }, { 1, 2, 3, 5, 6, 0, 0, 0 }, { 1, 2, 3, 5, 6, 7, 0, 0 },
+    { 1, 2, 3, 4, 0, 0, 0, 0 }, { 1, 2, 3, 4, 7, 0, 0, 0 }, { 1, 2, 3, 4, 6, 0, 0, 0 },
+    { 1, 2, 3, 4, 6, 7, 0, 0 }, { 1, 2, 3, 4, 5, 0, 0, 0 }, { 1, 2, 3, 4, 5, 7, 0, 0 },
+    { 1, 2, 3, 4, 5, 6, 0, 0 }, { 1, 2, 3, 4, 5, 6, 7, 0 }, { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 7, 0, 0, 0, 0, 0, 0 }, { 0, 6, 0, 0, 0, 0, 0, 0 }, { 0, 6, 7, 0, 0, 0, 0, 0 },
+    { 0, 5, 0, 0, 0, 0, 0, 0 }, { 0, 5, 7, 0, 0, 0, 0, 0 }, { 0, 5, 6, 0, 0, 0, 0, 0 },
+    { 0, 5, 6, 7, 0, 0, 0, 0 }, { 0, 4, 0, 0, 0, 0, 0, 0 }, { 0, 4, 7, 0, 0, 0, 0, 0 },
+    { 0, 4, 6, 0, 0, 0, 0, 0 }, { 0, 4, 6, 7, 0, 0, 0, 0 }, { 0, 4, 5, 0, 0, 0, 0, 0 },
+    { 0, 4, 5, 7, 0, 0, 0, 0 }, { 0, 4, 5, 6, 0, 0, 0, 0 }, { 0, 4, 5, 6, 7, 0, 0, 0 },
+    { 0, 3, 0, 0, 0, 0, 0, 0 }, { 0, 3, 7, 0, 0, 0, 0, 0 }, { 0, 3, 6, 0, 0, 0, 0, 0 },
+    { 0, 3, 6, 7, 0, 0, 0, 0 }, { 0, 3, 5, 0, 0, 0, 0, 0 }, { 0, 3, 5, 7, 0, 0, 0, 0 },
+    { 0, 3, 5, 6, 0, 0, 0, 0 }, { 0, 3, 5, 6, 7, 0, 0, 0 }, { 0, 3, 4, 0, 0, 0, 0, 0 },
+    { 0, 3, 4, 7, 0, 0, 0, 0 }, { 0, 3, 4, 6, 0, 0, 0, 0 }, { 0, 3, 4, 6, 7, 0, 0, 0 },
+    { 0, 3, 4, 5, 0, 0, 0, 0 }, { 0, 3, 4, 5, 7, 0, 0, 0 }, { 0, 3, 4, 5, 6, 0, 0, 0 },
+    { 0, 3, 4, 5, 6, 7, 0, 0 }, { 0, 2, 0, 0, 0, 0, 0, 0 }, { 0, 2, 7, 0, 0, 0, 0, 0 },
+    { 0, 2, 6, 0, 0, 0, 0, 0 }, { 0, 2, 6, 7, 0, 0, 0, 0 }, { 0, 2, 5, 0, 0, 0, 0, 0 },
+    { 0, 2, 5, 7, 0, 0, 0, 0 }, { 0, 2, 5, 6, 0, 0, 0, 0 }, { 0, 2, 5, 6, 7, 0, 0, 0 },
+    { 0, 2, 4, 0, 0, 0, 0, 0 }, { 0, 2, 4, 7, 0, 0, 0, 0 }, { 0, 2, 4, 6, 0, 0, 0, 0 },
+    { 0, 2, 4, 6, 7, 0, 0, 0 }, { 0, 2, 4, 5, 0, 0, 0, 0 }, { 0, 2, 4, 5, 7, 0, 0, 0 },
+    { 0, 2, 4, 5, 6, 0, 0, 0 }, { 0, 2, 4, 5, 6, 7, 0, 0 }, { 0, 2, 3, 0, 0, 0, 0, 0 },
+    { 0, 2, 3, 7, 0, 0, 0, 0 }, { 0, 2, 3, 6, 0, 0, 0, 0 }, { 0, 2, 3, 6, 7, 0, 0, 0 },
+    { 0, 2, 3, 5, 0, 0, 0, 0 }, { 0, 2, 3, 5, 7, 0, 0, 0 }, { 0, 2, 3, 5, 6, 0, 0, 0 },
+    { 0, 2, 3, 5, 6, 7, 0, 0 }, { 0, 2, 3, 4, 0, 0, 0, 0 }, { 0, 2, 3, 4, 7, 0, 0, 0 },
+    { 0, 2, 3, 4, 6, 0, 0, 0 }, { 0, 2, 3, 4, 6, 7, 0, 0 }, { 0, 2, 3, 4, 5, 0, 0, 0 },
+    { 0, 2, 3, 4, 5, 7, 0, 0 }, { 0, 2, 3, 4, 5, 6, 0, 0 }, { 0, 2, 3, 4, 5, 6, 7, 0 },
+    { 0, 1, 0, 0, 0, 0, 0, 0 }, { 0, 1, 7, 0, 0, 0, 0, 0 }, { 0, 1, 6, 0, 0, 0, 0, 0 },
+    { 0, 1, 6, 7, 0, 0, 0, 0 }, { 0, 1, 5, 0, 0, 0, 0, 0 }, { 0, 1, 5, 7, 0, 0, 0, 0 },
+    { 0, 1, 5, 6, 0, 0, 0, 0 }, { 0, 1, 5, 6, 7, 0, 0, 0 }, { 0, 1, 4, 0, 0, 0, 0, 0 },
+    { 0, 1, 4, 7, 0, 0, 0, 0 }, { 0, 1, 4, 6, 0, 0, 0, 0 }, { 0, 1, 4, 6, 7, 0, 0, 0 },
+    { 0, 1, 4, 5, 0, 0, 0, 0 }, { 0, 1, 4, 5, 7, 0, 0, 0 }, { 0, 1, 4, 5, 6, 0, 0, 0 },
+    { 0, 1, 4, 5, 6, 7, 0, 0 }, { 0, 1, 3, 0, 0, 0, 0, 0 }, { 0, 1, 3, 7, 0, 0, 0, 0 },
+    { 0, 1, 3, 6, 0, 0, 0, 0 }, { 0, 1, 3, 6, 7, 0, 0, 0 }, { 0, 1, 3, 5, 0, 0, 0, 0 },
+    { 0, 1, 3, 5, 7, 0, 0, 0 }, { 0, 1, 3, 5, 6, 0, 0, 0 }, { 0, 1, 3, 5, 6, 7, 0, 0 },
+    { 0, 1, 3, 4, 0, 0, 0, 0 }, { 0, 1, 3, 4, 7, 0, 0, 0 }, { 0, 1, 3, 4, 6, 0, 0, 0 },
+    { 0, 1, 3, 4, 6, 7, 0, 0 }, { 0, 1, 3, 4, 5, 0, 0, 0 }, { 0, 1, 3, 4, 5, 7, 0, 0 },
+    { 0, 1, 3, 4, 5, 6, 0, 0 }, { 0, 1, 3, 4, 5, 6, 7, 0 }, { 0, 1, 2, 0, 0, 0, 0, 0 },
+    { 0, 1, 2, 7, 0, 0, 0, 0 }, { 0, 1, 2, 6, 0, 0, 0, 0 }, { 0, 1, 2, 6, 7, 0, 0, 0 },
+    { 0, 1, 2, 5, 0, 0, 0, 0 }, { 0, 1, 2, 5, 7, 0, 0, 0 }, { 0, 1, 2, 5, 6, 0, 0, 0 },
+    { 0, 1, 2, 5, 6, 7, 0, 0 }, { 0, 1, 2, 4, 0, 0, 0, 0 }, { 0, 1, 2, 4, 7, 0, 0, 0 },
+    { 0, 1, 2, 4, 6, 0, 0, 0 }, { 0, 1, 2, 4, 6, 7, 0, 0 }, { 0, 1, 2, 4, 5, 0, 0, 0 },
+    { 0, 1, 2, 4, 5, 7, 0, 0 }, { 0, 1, 2, 4, 5, 6, 0, 0 }, { 0, 1, 2, 4, 5, 6, 7, 0 },
+    { 0, 1, 2, 3, 0, 0, 0, 0 }, { 0, 1, 2, 3, 7, 0, 0, 0 }, { 0, 1, 2, 3, 6, 0, 0, 0 },
+    { 0, 1, 2, 3, 6, 7, 0, 0 }, { 0, 1, 2, 3, 5, 0, 0, 0 }, { 0, 1, 2, 3, 5, 7, 0, 0 },
+    { 0, 1, 2, 3, 5, 6, 0, 0 }, { 0, 1, 2, 3, 5, 6, 7, 0 }, { 0, 1, 2, 3, 4, 0, 0, 0 },
+    { 0, 1, 2, 3, 4, 7, 0, 0 }, { 0, 1, 2, 3, 4, 6, 0, 0 }, { 0, 1, 2, 3, 4, 6, 7, 0 },
+    { 0, 1, 2, 3, 4, 5, 0, 0 }, { 0, 1, 2, 3, 4, 5, 7, 0 }, { 0, 1, 2, 3, 4, 5, 6, 0 },
+    { 0, 1, 2, 3, 4, 5, 6, 7 }
+};
+
+#endif
+
 /* ============================================================================================== */
 /* Internal macros                                                                                */
 /* ============================================================================================== */
 
 /**
- * Computes the smallest integer value not less than `x`.
+ * Converts bits to bytes.
+ *
+ * @param   x   The value in bits.
+ *
+ * @return  The amount of bytes needed to fit `x` bits.
+ */
+#define ZYAN_BITSET_BITS_TO_BYTES(x) \
+    (((x) + 7) / 8)
+
+/**
+ * Returns the offset of the given bit within its byte.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   index   The bit index.
+ *
+ * @return  The offset of the given bit.
+ */
+#define ZYAN_BITSET_BIT_OFFSET(bitset, index) \
+    (((bitset)->layout == ZYAN_BITSET_LAYOUT_LSB_FIRST) ? ((index) % 8) : (7 - ((index) % 8)))
+
+/**
+ * Returns a pointer to the bytes of the given bitset.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ *
+ * @return  A pointer to the first byte.
+ */
+#define ZYAN_BITSET_DATA(bitset) \
+    ((ZyanU8*)(bitset)->bits.data)
+
+/* ============================================================================================== */
+/* Vector primitives                                                                              */
+/* ============================================================================================== */
+
+#if defined(ZYAN_BITSET_AVX2)
+
+typedef __m256i ZyanBitsetVector;
+
+#   define ZYAN_BITSET_VECTOR_SIZE      32
+#   define ZYAN_BITSET_VLOAD(p)         _mm256_loadu_si256((const __m256i*)(p))
+#   define ZYAN_BITSET_VSTORE(p, v)     _mm256_storeu_si256((__m256i*)(p), (v))
+#   define ZYAN_BITSET_VAND(a, b)       _mm256_and_si256((a), (b))
+#   define ZYAN_BITSET_VOR(a, b)        _mm256_or_si256((a), (b))
+#   define ZYAN_BITSET_VXOR(a, b)       _mm256_xor_si256((a), (b))
+#   define ZYAN_BITSET_VANDNOT(a, b)    _mm256_andnot_si256((b), (a))
+#   define ZYAN_BITSET_VNOT(a)          _mm256_xor_si256((a), _mm256_set1_epi32(-1))
+
+#elif defined(ZYAN_BITSET_SSE2)
+
+typedef __m128i ZyanBitsetVector;
+
+#   define ZYAN_BITSET_VECTOR_SIZE      16
+#   define ZYAN_BITSET_VLOAD(p)         _mm_loadu_si128((const __m128i*)(p))
+#   define ZYAN_BITSET_VSTORE(p, v)     _mm_storeu_si128((__m128i*)(p), (v))
+#   define ZYAN_BITSET_VAND(a, b)       _mm_and_si128((a), (b))
+#   define ZYAN_BITSET_VOR(a, b)        _mm_or_si128((a), (b))
+#   define ZYAN_BITSET_VXOR(a, b)       _mm_xor_si128((a), (b))
+#   define ZYAN_BITSET_VANDNOT(a, b)    _mm_andnot_si128((b), (a))
+#   define ZYAN_BITSET_VNOT(a)          _mm_xor_si128((a), _mm_set1_epi32(-1))
+
+#elif defined(ZYAN_BITSET_NEON)
+
+typedef uint8x16_t ZyanBitsetVector;
+
+#   define ZYAN_BITSET_VECTOR_SIZE      16
+#   define ZYAN_BITSET_VLOAD(p)         vld1q_u8((p))
+#   define ZYAN_BITSET_VSTORE(p, v)     vst1q_u8((p), (v))
+#   define ZYAN_BITSET_VAND(a, b)       vandq_u8((a), (b))
+#   define ZYAN_BITSET_VOR(a, b)        vorrq_u8((a), (b))
+#   define ZYAN_BITSET_VXOR(a, b)       veorq_u8((a), (b))
+#   define ZYAN_BITSET_VANDNOT(a, b)    vbicq_u8((a), (b))
+#   define ZYAN_BITSET_VNOT(a)          vmvnq_u8((a))
+
+#else
+
+typedef ZyanU64 ZyanBitsetVector;
+
+#   define ZYAN_BITSET_VECTOR_SIZE      8
+#   define ZYAN_BITSET_VLOAD(p)         ZyanLoadU64((p))
+#   define ZYAN_BITSET_VSTORE(p, v)     ZyanStoreU64((p), (v))
+#   define ZYAN_BITSET_VAND(a, b)       ((a) & (b))
+#   define ZYAN_BITSET_VOR(a, b)        ((a) | (b))
+#   define ZYAN_BITSET_VXOR(a, b)       ((a) ^ (b))
+#   define ZYAN_BITSET_VANDNOT(a, b)    ((a) & ~(b))
+#   define ZYAN_BITSET_VNOT(a)          (~(a))
+
+#endif
+
+/**
+ * Applies the given expressions to `n` bytes of the inputs `a`, `b` and `c` and stores the
+ * results in `d`.
+ *
+ * The expressions may refer to the current input vectors `va`, `vb`, `vc` and the current input
+ * bytes `sa`, `sb`, `sc`. Inputs not referenced by the expressions are never actually loaded by
+ * an optimizing compiler.
+ */
+#define ZYAN_BITSET_KERNEL_LOOP(vector_expression, byte_expression) \
+    for (; i + ZYAN_BITSET_VECTOR_SIZE <= n; i += ZYAN_BITSET_VECTOR_SIZE) \
+    { \
+        const ZyanBitsetVector va = ZYAN_BITSET_VLOAD(a + i); \
+        const ZyanBitsetVector vb = ZYAN_BITSET_VLOAD(b + i); \
+        const ZyanBitsetVector vc = ZYAN_BITSET_VLOAD(c + i); \
+        ZYAN_UNUSED(vb); \
+        ZYAN_UNUSED(vc); \
+        ZYAN_BITSET_VSTORE(d + i, vector_expression); \
+    } \
+    for (; i < n; ++i) \
+    { \
+        const ZyanU8 sa = a[i]; \
+        const ZyanU8 sb = b[i]; \
+        const ZyanU8 sc = c[i]; \
+        ZYAN_UNUSED(sb); \
+        ZYAN_UNUSED(sc); \
+        d[i] = (ZyanU8)(byte_expression); \
+    }
+
+/* ============================================================================================== */
+/* Population count primitives                                                                    */
+/* ============================================================================================== */
+
+/**
+ * Counts the set bits of the given expressions applied to `n` bytes of the inputs `a` and `b`
+ * and adds them to `result`.
+ *
+ * The expressions may refer to the current input words `va`, `vb` and the current input bytes
+ * `sa`, `sb`. `popcount` is used to count the bits of a single 64-bit word.
+ */
+#define ZYAN_BITSET_COUNT_LOOP(popcount, word_expression, byte_expression) \
+    for (; i + 8 <= n; i += 8) \
+    { \
+        const ZyanU64 va = ZyanLoadU64(a + i); \
+        const ZyanU64 vb = ZyanLoadU64(b + i); \
+        ZYAN_UNUSED(vb); \
+        result += popcount(word_expression); \
+    } \
+    for (; i < n; ++i) \
+    { \
+        const ZyanU8 sa = a[i]; \
+        const ZyanU8 sb = b[i]; \
+        ZYAN_UNUSED(sb); \
+        result += popcount((ZyanU8)(byte_expression)); \
+    }
+
+#if defined(ZYAN_BITSET_NEON)
+
+/**
+ * Counts the set bits of the given vector expression applied to the inputs `a` and `b` using the
+ * NEON `CNT` instruction.
+ *
+ * Leaves the remaining `n % 16` bytes to `ZYAN_BITSET_COUNT_LOOP`.
+ */
+#define ZYAN_BITSET_COUNT_VECTOR_LOOP(vector_expression) \
+    for (; i + ZYAN_BITSET_VECTOR_SIZE <= n; i += ZYAN_BITSET_VECTOR_SIZE) \
+    { \
+        const ZyanBitsetVector va = ZYAN_BITSET_VLOAD(a + i); \
+        const ZyanBitsetVector vb = ZYAN_BITSET_VLOAD(b + i); \
+        ZYAN_UNUSED(vb); \
+        result += vaddvq_u8(vcntq_u8(vector_expression)); \
+    }
+
+#else
+
+#define ZYAN_BITSET_COUNT_VECTOR_LOOP(vector_expression)
+
+#endif
+
+#if defined(ZYAN_BITSET_POPCOUNT_X86)
+
+#if defined(ZYAN_GNUC)
+#   define ZYAN_BITSET_POPCNT64(x)  __builtin_popcountll(x)
+#elif defined(ZYAN_X64)
+#   define ZYAN_BITSET_POPCNT64(x)  __popcnt64(x)
+#else
+#   define ZYAN_BITSET_POPCNT64(x)  (__popcnt((ZyanU32)(x)) + __popcnt((ZyanU32)((x) >> 32)))
+#endif
+
+/**
+ * The number of bytes processed by a single iteration of the Harley-Seal loop.
+ */
+#define ZYAN_BITSET_HARLEY_SEAL_BLOCK_SIZE  512
+
+#define ZYAN_BITSET_LOAD256(p) \
+    _mm256_loadu_si256((const __m256i*)(p))
+
+/**
+ * Loads the `k`th 256-bit vector of the current Harley-Seal block and applies the respective
+ * operation.
+ */
+#define ZYAN_BITSET_HARLEY_SEAL_LOAD_A(k) \
+    ZYAN_BITSET_LOAD256(a + i + 32 * (k))
+#define ZYAN_BITSET_HARLEY_SEAL_LOAD_AND(k) \
+    _mm256_and_si256(ZYAN_BITSET_LOAD256(a + i + 32 * (k)), ZYAN_BITSET_LOAD256(b + i + 32 * (k)))
+#define ZYAN_BITSET_HARLEY_SEAL_LOAD_OR(k) \
+    _mm256_or_si256(ZYAN_BITSET_LOAD256(a + i + 32 * (k)), ZYAN_BITSET_LOAD256(b + i + 32 * (k)))
+#define ZYAN_BITSET_HARLEY_SEAL_LOAD_XOR(k) \
+    _mm256_xor_si256(ZYAN_BITSET_LOAD256(a + i + 32 * (k)), ZYAN_BITSET_LOAD256(b + i + 32 * (k)))
+#define ZYAN_BITSET_HARLEY_SEAL_LOAD_ANDNOT(k) \
+    _mm256_andnot_si256(ZYAN_BITSET_LOAD256(b + i + 32 * (k)), \
+        ZYAN_BITSET_LOAD256(a + i + 32 * (k)))
+
+/**
+ * Carry-save adder: adds the bits of `x`, `y` and `z` and stores the resulting two-bit sums in
+ * `high` and `low`. `low` may be identical to `x`.
+ */
+#define ZYAN_BITSET_CSA(high, low, x, y, z) \
+    { \
+        const __m256i csa_y = (y); \
+        const __m256i csa_z = (z); \
+        const __m256i csa_u = _mm256_xor_si256((x), csa_y); \
+        (high) = _mm256_or_si256(_mm256_and_si256((x), csa_y), _mm256_and_si256(csa_u, csa_z)); \
+        (low) = _mm256_xor_si256(csa_u, csa_z); \
+    }
+
+/**
+ * Runs the Harley-Seal loop over all complete `ZYAN_BITSET_HARLEY_SEAL_BLOCK_SIZE` byte blocks.
+ *
+ * Sixteen vectors are reduced to a single vector of bits with weight 16 by a tree of carry-save
+ * adders, so the (comparatively expensive) vector population count is only executed once per
+ * block. The partial sums of lower weight are kept in `ones`, `twos`, `fours` and `eights`.
+ */
+#define ZYAN_BITSET_HARLEY_SEAL_LOOP(load) \
+    for (; i + ZYAN_BITSET_HARLEY_SEAL_BLOCK_SIZE <= n; i += ZYAN_BITSET_HARLEY_SEAL_BLOCK_SIZE) \
+    { \
+        __m256i twos_a, twos_b, fours_a, fours_b, eights_a, eights_b, sixteens; \
+        ZYAN_BITSET_CSA(twos_a, ones, ones, load(0), load(1)); \
+        ZYAN_BITSET_CSA(twos_b, ones, ones, load(2), load(3)); \
+        ZYAN_BITSET_CSA(fours_a, twos, twos, twos_a, twos_b); \
+        ZYAN_BITSET_CSA(twos_a, ones, ones, load(4), load(5)); \
+        ZYAN_BITSET_CSA(twos_b, ones, ones, load(6), load(7)); \
+        ZYAN_BITSET_CSA(fours_b, twos, twos, twos_a, twos_b); \
+        ZYAN_BITSET_CSA(eights_a, fours, fours, fours_a, fours_b); \
+        ZYAN_BITSET_CSA(twos_a, ones, ones, load(8), load(9)); \
+        ZYAN_BITSET_CSA(twos_b, ones, ones, load(10), load(11)); \
+        ZYAN_BITSET_CSA(fours_a, twos, twos, twos_a, twos_b); \
+        ZYAN_BITSET_CSA(twos_a, ones, ones, load(12), load(13)); \
+        ZYAN_BITSET_CSA(twos_b, ones, ones, load(14), load(15)); \
+        ZYAN_BITSET_CSA(fours_b, twos, twos, twos_a, twos_b); \
+        ZYAN_BITSET_CSA(eights_b, fours, fours, fours_a, fours_b); \
+        ZYAN_BITSET_CSA(sixteens, eights, eights, eights_a, eights_b); \
+        total = _mm256_add_epi64(total, ZyanBitsetPopcount256(sixteens)); \
+    }
+
+#endif
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanBitsetKernelOperation` enum.
+ */
+typedef enum ZyanBitsetKernelOperation_
+{
+    /**
+     * `d = a & b`
+     */
+    ZYAN_BITSET_KERNEL_AND,
+    /**
+     * `d = a | b`
+     */
+    ZYAN_BITSET_KERNEL_OR,
+    /**
+     * `d = a ^ b`
+     */
+    ZYAN_BITSET_KERNEL_XOR,
+    /**
+     * `d = a & ~b`
+     */
+    ZYAN_BITSET_KERNEL_ANDNOT,
+    /**
+     * `d = ~a`
+     */
+    ZYAN_BITSET_KERNEL_NOT,
+    /**
+     * `d = a | (b & ~c)`
+     */
+    ZYAN_BITSET_KERNEL_ORANDNOT
+} ZyanBitsetKernelOperation;
+
+/**
+ * Defines the `ZyanBitsetRangeOperation` enum.
+ */
+typedef enum ZyanBitsetRangeOperation_
+{
+    /**
+     * Sets all bits in the range.
+     */
+    ZYAN_BITSET_RANGE_SET,
+    /**
+     * Clears all bits in the range.
+     */
+    ZYAN_BITSET_RANGE_RESET,
+    /**
+     * Toggles all bits in the range.
+     */
+    ZYAN_BITSET_RANGE_FLIP
+} ZyanBitsetRangeOperation;
+
+/**
+ * Defines the `ZyanBitsetCountOperation` enum.
+ */
+typedef enum ZyanBitsetCountOperation_
+{
+    /**
+     * `popcount(a)`
+     */
+    ZYAN_BITSET_COUNT_A,
+    /**
+     * `popcount(a & b)`
+     */
+    ZYAN_BITSET_COUNT_AND,
+    /**
+     * `popcount(a | b)`
+     */
+    ZYAN_BITSET_COUNT_OR,
+    /**
+     * `popcount(a ^ b)`
+     */
+    ZYAN_BITSET_COUNT_XOR,
+    /**
+     * `popcount(a & ~b)`
+     */
+    ZYAN_BITSET_COUNT_ANDNOT
+} ZyanBitsetCountOperation;
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a mask of the bits of a byte whose offset within the byte is at least `offset`.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   offset  The index of the first bit within the byte (`0` to `7`).
+ *
+ * @return  The mask.
+ */
+static ZyanU8 ZyanBitsetMaskFrom(const ZyanBitset* bitset, ZyanUSize offset)
+{
+    if (bitset->layout == ZYAN_BITSET_LAYOUT_LSB_FIRST)
+    {
+        return (ZyanU8)(0xFF << offset);
+    }
+    return (ZyanU8)(0xFF >> offset);
+}
+
+/**
+ * Returns a mask of the bits of a byte whose offset within the byte is at most `offset`.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   offset  The index of the last bit within the byte (`0` to `7`).
+ *
+ * @return  The mask.
+ */
+static ZyanU8 ZyanBitsetMaskUpTo(const ZyanBitset* bitset, ZyanUSize offset)
+{
+    if (bitset->layout == ZYAN_BITSET_LAYOUT_LSB_FIRST)
+    {
+        return (ZyanU8)(0xFF >> (7 - offset));
+    }
+    return (ZyanU8)(0xFF << (7 - offset));
+}
+
+/**
+ * Clears the unused bits of the last byte of the given bitset.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ *
+ * Keeping these bits cleared allows all whole-bitset operations to work on complete bytes (or
+ * words) without special handling of the last one.
+ */
+static void ZyanBitsetClearUnusedBits(ZyanBitset* bitset)
+{
+    const ZyanUSize used = bitset->size % 8;
+    if (used)
+    {
+        ZYAN_BITSET_DATA(bitset)[bitset->size / 8] &= ZyanBitsetMaskUpTo(bitset, used - 1);
+    }
+}
+
+/**
+ * Changes the size of the given bitset to `count` bits. New bits are cleared.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   count   The new size in bits.
+ *
+ * @return  A zyan status code.
+ *
+ * Growing the underlying vector takes at most a single allocation; the new bytes are cleared with
+ * a single `memset`.
+ */
+static ZyanStatus ZyanBitsetResizeInternal(ZyanBitset* bitset, ZyanUSize count)
+{
+    ZYAN_ASSERT(bitset);
+
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
+    const ZyanUSize old_bytes = bitset->bits.size;
+    const ZyanUSize new_bytes = ZYAN_BITSET_BITS_TO_BYTES(count);
+    ZYAN_CHECK(ZyanVectorResize(&bitset->bits, new_bytes));
+    if (new_bytes > old_bytes)
+    {
+        ZYAN_MEMSET(ZYAN_BITSET_DATA(bitset) + old_bytes, 0x00, new_bytes - old_bytes);
+    }
+
+    bitset->size = count;
+    ZyanBitsetClearUnusedBits(bitset);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Applies the given operation to `n` bytes.
+ *
+ * @param   operation   The operation.
+ * @param   d           A pointer to the destination bytes.
+ * @param   a           A pointer to the first input bytes.
+ * @param   b           A pointer to the second input bytes.
+ * @param   c           A pointer to the third input bytes.
+ * @param   n           The number of bytes.
+ *
+ * All input pointers must be valid for `n` bytes, even if the operation does not use them. The
+ * destination may be identical to any of the inputs.
+ */
+static void ZyanBitsetKernel(ZyanBitsetKernelOperation operation, ZyanU8* d, const ZyanU8* a,
+    const ZyanU8* b, const ZyanU8* c, ZyanUSize n)
+{
+    ZyanUSize i = 0;
+    switch (operation)
+    {
+    case ZYAN_BITSET_KERNEL_AND:
+        ZYAN_BITSET_KERNEL_LOOP(ZYAN_BITSET_VAND(va, vb), sa & sb);
+        break;
+    case ZYAN_BITSET_KERNEL_OR:
+        ZYAN_BITSET_KERNEL_LOOP(ZYAN_BITSET_VOR(va, vb), sa | sb);
+        break;
+    case ZYAN_BITSET_KERNEL_XOR:
+        ZYAN_BITSET_KERNEL_LOOP(ZYAN_BITSET_VXOR(va, vb), sa ^ sb);
+        break;
+    case ZYAN_BITSET_KERNEL_ANDNOT:
+        ZYAN_BITSET_KERNEL_LOOP(ZYAN_BITSET_VANDNOT(va, vb), sa & ~sb);
+        break;
+    case ZYAN_BITSET_KERNEL_NOT:
+        ZYAN_BITSET_KERNEL_LOOP(ZYAN_BITSET_VNOT(va), ~sa);
+        break;
+    case ZYAN_BITSET_KERNEL_ORANDNOT:
+        ZYAN_BITSET_KERNEL_LOOP(ZYAN_BITSET_VOR(va, ZYAN_BITSET_VANDNOT(vb, vc)), sa | (sb & ~sc));
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * Applies the given range operation to the bits of a single byte selected by `mask`.
+ *
+ * @param   operation   The range operation.
+ * @param   byte        A pointer to the byte.
+ * @param   mask        The mask of the affected bits.
+ */
+static void ZyanBitsetApplyMask(ZyanBitsetRangeOperation operation, ZyanU8* byte, ZyanU8 mask)
+{
+    switch (operation)
+    {
+    case ZYAN_BITSET_RANGE_SET:
+        *byte |= mask;
+        break;
+    case ZYAN_BITSET_RANGE_RESET:
+        *byte &= (ZyanU8)~mask;
+        break;
+    case ZYAN_BITSET_RANGE_FLIP:
+        *byte ^= mask;
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * Applies the given range operation to the bits `[begin, end)`.
+ *
+ * @param   bitset      A pointer to the `ZyanBitset` instance.
+ * @param   begin       The index of the first bit.
+ * @param   end         The index past the last bit.
+ * @param   operation   The range operation.
+ *
+ * @return  A zyan status code.
+ *
+ * Only the first and the last byte of the range are masked; all bytes in between are processed
+ * with `memset` (or the vectorized kernel).
+ */
+static ZyanStatus ZyanBitsetApplyRange(ZyanBitset* bitset, ZyanUSize begin, ZyanUSize end,
+    ZyanBitsetRangeOperation operation)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+    if ((begin > end) || (end > bitset->size))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+    if (begin == end)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanU8* const data = ZYAN_BITSET_DATA(bitset);
+    const ZyanUSize first = begin / 8;
+    const ZyanUSize last = (end - 1) / 8;
+    const ZyanU8 head = ZyanBitsetMaskFrom(bitset, begin % 8);
+    const ZyanU8 tail = ZyanBitsetMaskUpTo(bitset, (end - 1) % 8);
+
+    if (first == last)
+    {
+        ZyanBitsetApplyMask(operation, &data[first], head & tail);
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanBitsetApplyMask(operation, &data[first], head);
+    ZyanU8* const middle = data + first + 1;
+    const ZyanUSize n = last - first - 1;
+    switch (operation)
+    {
+    case ZYAN_BITSET_RANGE_SET:
+        ZYAN_MEMSET(middle, 0xFF, n);
+        break;
+    case ZYAN_BITSET_RANGE_RESET:
+        ZYAN_MEMSET(middle, 0x00, n);
+        break;
+    case ZYAN_BITSET_RANGE_FLIP:
+        ZyanBitsetKernel(ZYAN_BITSET_KERNEL_NOT, middle, middle, middle, middle, n);
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+    ZyanBitsetApplyMask(operation, &data[last], tail);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Checks, if any (or all) of the bits `[begin, end)` are set.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   begin   The index of the first bit.
+ * @param   end     The index past the last bit.
+ * @param   all     `ZYAN_TRUE` to check, if all bits are set, `ZYAN_FALSE` to check, if any bit is
+ *                  set.
+ *
+ * @return  `ZYAN_STATUS_TRUE` or `ZYAN_STATUS_FALSE`. Another zyan status code, if an error
+ *          occurred.
+ */
+static ZyanStatus ZyanBitsetTestRange(const ZyanBitset* bitset, ZyanUSize begin, ZyanUSize end,
+    ZyanBool all)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if ((begin > end) || (end > bitset->size))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    // Inverting the bits turns the "all" check into an "any" check; the first nonzero (masked)
+    // byte or word decides the result
+    const ZyanU64 invert = all ? ~0ULL : 0;
+    const ZyanStatus decided = all ? ZYAN_STATUS_FALSE : ZYAN_STATUS_TRUE;
+    const ZyanStatus undecided = all ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+    if (begin == end)
+    {
+        return undecided;
+    }
+
+    const ZyanU8* const data = ZYAN_BITSET_DATA(bitset);
+    const ZyanUSize first = begin / 8;
+    const ZyanUSize last = (end - 1) / 8;
+    ZyanU8 head = ZyanBitsetMaskFrom(bitset, begin % 8);
+    const ZyanU8 tail = ZyanBitsetMaskUpTo(bitset, (end - 1) % 8);
+
+    if (first == last)
+    {
+        head &= tail;
+    }
+    if ((data[first] ^ (ZyanU8)invert) & head)
+    {
+        return decided;
+    }
+    if (first == last)
+    {
+        return undecided;
+    }
+
+    ZyanUSize i = first + 1;
+    for (; i + 8 <= last; i += 8)
+    {
+        if (ZyanLoadU64(data + i) ^ invert)
+        {
+            return decided;
+        }
+    }
+    for (; i < last; ++i)
+    {
+        if (data[i] ^ (ZyanU8)invert)
+        {
+            return decided;
+        }
+    }
+    if ((data[last] ^ (ZyanU8)invert) & tail)
+    {
+        return decided;
+    }
+
+    return undecided;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Population count                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Counts the set bits of the given operation applied to `n` bytes using portable code (or NEON
+ * on AArch64).
+ *
+ * @param   operation   The operation.
+ * @param   a           A pointer to the first input bytes.
+ * @param   b           A pointer to the second input bytes.
+ * @param   n           The number of bytes.
+ *
+ * @return  The number of set bits.
+ */
+static ZyanUSize ZyanBitsetPopcountGeneric(ZyanBitsetCountOperation operation, const ZyanU8* a,
+    const ZyanU8* b, ZyanUSize n)
+{
+    ZyanUSize result = 0;
+    ZyanUSize i = 0;
+    switch (operation)
+    {
+    case ZYAN_BITSET_COUNT_A:
+        ZYAN_BITSET_COUNT_VECTOR_LOOP(va);
+        ZYAN_BITSET_COUNT_LOOP(ZyanBitPopCount64, va, sa);
+        break;
+    case ZYAN_BITSET_COUNT_AND:
+        ZYAN_BITSET_COUNT_VECTOR_LOOP(ZYAN_BITSET_VAND(va, vb));
+        ZYAN_BITSET_COUNT_LOOP(ZyanBitPopCount64, va & vb, sa & sb);
+        break;
+    case ZYAN_BITSET_COUNT_OR:
+        ZYAN_BITSET_COUNT_VECTOR_LOOP(ZYAN_BITSET_VOR(va, vb));
+        ZYAN_BITSET_COUNT_LOOP(ZyanBitPopCount64, va | vb, sa | sb);
+        break;
+    case ZYAN_BITSET_COUNT_XOR:
+        ZYAN_BITSET_COUNT_VECTOR_LOOP(ZYAN_BITSET_VXOR(va, vb));
+        ZYAN_BITSET_COUNT_LOOP(ZyanBitPopCount64, va ^ vb, sa ^ sb);
+        break;
+    case ZYAN_BITSET_COUNT_ANDNOT:
+        ZYAN_BITSET_COUNT_VECTOR_LOOP(ZYAN_BITSET_VANDNOT(va, vb));
+        ZYAN_BITSET_COUNT_LOOP(ZyanBitPopCount64, va & ~vb, sa & ~sb);
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+    return result;
+}
+
+#if defined(ZYAN_BITSET_POPCOUNT_X86)
+
+/**
+ * Counts the set bits of the given operation applied to `n` bytes using the `POPCNT`
+ * instruction.
+ *
+ * @param   operation   The operation.
+ * @param   a           A pointer to the first input bytes.
+ * @param   b           A pointer to the second input bytes.
+ * @param   n           The number of bytes.
+ *
+ * @return  The number of set bits.
+ */
+#if defined(ZYAN_GNUC)
+__attribute__((target("popcnt")))
+#endif
+static ZyanUSize ZyanBitsetPopcountPOPCNT(ZyanBitsetCountOperation operation, const ZyanU8* a,
+    const ZyanU8* b, ZyanUSize n)
+{
+    ZyanUSize result = 0;
+    ZyanUSize i = 0;
+    switch (operation)
+    {
+    case ZYAN_BITSET_COUNT_A:
+        ZYAN_BITSET_COUNT_LOOP(ZYAN_BITSET_POPCNT64, va, sa);
+        break;
+    case ZYAN_BITSET_COUNT_AND:
+        ZYAN_BITSET_COUNT_LOOP(ZYAN_BITSET_POPCNT64, va & vb, sa & sb);
+        break;
+    case ZYAN_BITSET_COUNT_OR:
+        ZYAN_BITSET_COUNT_LOOP(ZYAN_BITSET_POPCNT64, va | vb, sa | sb);
+        break;
+    case ZYAN_BITSET_COUNT_XOR:
+        ZYAN_BITSET_COUNT_LOOP(ZYAN_BITSET_POPCNT64, va ^ vb, sa ^ sb);
+        break;
+    case ZYAN_BITSET_COUNT_ANDNOT:
+        ZYAN_BITSET_COUNT_LOOP(ZYAN_BITSET_POPCNT64, va & ~vb, sa & ~sb);
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+    return result;
+}
+
+/**
+ * Counts the set bits in each byte of the given vector and sums them up per 64-bit lane.
+ *
+ * @param   value   The vector.
+ *
+ * @return  A vector with four 64-bit partial sums.
+ */
+#if defined(ZYAN_GNUC)
+__attribute__((target("avx2")))
+#endif
+static __m256i ZyanBitsetPopcount256(__m256i value)
+{
+    const __m256i lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    const __m256i lo = _mm256_and_si256(value, mask);
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(value, 4), mask);
+    const __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo),
+        _mm256_shuffle_epi8(lookup, hi));
+    return _mm256_sad_epu8(bytes, _mm256_setzero_si256());
+}
+
+/**
+ * Counts the set bits of the given operation applied to `n` bytes using AVX2 and the
+ * Harley-Seal carry-save adder scheme.
+ *
+ * @param   operation   The operation.
+ * @param   a           A pointer to the first input bytes.
+ * @param   b           A pointer to the second input bytes.
+ * @param   n           The number of bytes.
+ *
+ * @return  The number of set bits.
+ *
+ * Bytes that do not fill a complete block are counted with `ZyanBitsetPopcountPOPCNT`.
+ */
+#if defined(ZYAN_GNUC)
+__attribute__((target("avx2")))
+#endif
+static ZyanUSize ZyanBitsetPopcountAVX2(ZyanBitsetCountOperation operation, const ZyanU8* a,
+    const ZyanU8* b, ZyanUSize n)
+{
+    __m256i total  = _mm256_setzero_si256();
+    __m256i ones   = _mm256_setzero_si256();
+    __m256i twos   = _mm256_setzero_si256();
+    __m256i fours  = _mm256_setzero_si256();
+    __m256i eights = _mm256_setzero_si256();
+    ZyanUSize i = 0;
+    switch (operation)
+    {
+    case ZYAN_BITSET_COUNT_A:
+        ZYAN_BITSET_HARLEY_SEAL_LOOP(ZYAN_BITSET_HARLEY_SEAL_LOAD_A);
+        break;
+    case ZYAN_BITSET_COUNT_AND:
+        ZYAN_BITSET_HARLEY_SEAL_LOOP(ZYAN_BITSET_HARLEY_SEAL_LOAD_AND);
+        break;
+    case ZYAN_BITSET_COUNT_OR:
+        ZYAN_BITSET_HARLEY_SEAL_LOOP(ZYAN_BITSET_HARLEY_SEAL_LOAD_OR);
+        break;
+    case ZYAN_BITSET_COUNT_XOR:
+        ZYAN_BITSET_HARLEY_SEAL_LOOP(ZYAN_BITSET_HARLEY_SEAL_LOAD_XOR);
+        break;
+    case ZYAN_BITSET_COUNT_ANDNOT:
+        ZYAN_BITSET_HARLEY_SEAL_LOOP(ZYAN_BITSET_HARLEY_SEAL_LOAD_ANDNOT);
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+    total = _mm256_slli_epi64(total, 4);
+    total = _mm256_add_epi64(total, _mm256_slli_epi64(ZyanBitsetPopcount256(eights), 3));
+    total = _mm256_add_epi64(total, _mm256_slli_epi64(ZyanBitsetPopcount256(fours), 2));
+    total = _mm256_add_epi64(total, _mm256_slli_epi64(ZyanBitsetPopcount256(twos), 1));
+    total = _mm256_add_epi64(total, ZyanBitsetPopcount256(ones));
+
+    ZyanU64 lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, total);
+
+    return (ZyanUSize)(lanes[0] + lanes[1] + lanes[2] + lanes[3]) +
+        ZyanBitsetPopcountPOPCNT(operation, a + i, b + i, n - i);
+}
+
+#endif
+
+/**
+ * Counts the set bits of the given operation applied to `n` bytes.
+ *
+ * @param   operation   The operation.
+ * @param   a           A pointer to the first input bytes.
+ * @param   b           A pointer to the second input bytes.
+ * @param   n           The number of bytes.
+ *
+ * @return  The number of set bits.
+ *
+ * All input pointers must be valid for `n` bytes, even if the operation does not use them. The
+ * fastest implementation supported by the current CPU is selected at runtime.
+ */
+static ZyanUSize ZyanBitsetPopcount(ZyanBitsetCountOperation operation, const ZyanU8* a,
+    const ZyanU8* b, ZyanUSize n)
+{
+#if defined(ZYAN_BITSET_POPCOUNT_X86)
+    const ZyanU32 features = ZyanCPUGetFeatures();
+    if ((features & ZYAN_CPU_FEATURE_POPCNT) && (features & ZYAN_CPU_FEATURE_AVX2))
+    {
+        return ZyanBitsetPopcountAVX2(operation, a, b, n);
+    }
+    if (features & ZYAN_CPU_FEATURE_POPCNT)
+    {
+        return ZyanBitsetPopcountPOPCNT(operation, a, b, n);
+    }
+#endif
+
+    return ZyanBitsetPopcountGeneric(operation, a, b, n);
+}
+
+/**
+ * Counts the set bits of the given operation applied to the bitsets `a` and `b`.
  *
- * @param   x   The value.
+ * @param   a           A pointer to the first input `ZyanBitset` instance.
+ * @param   b           A pointer to the second input `ZyanBitset` instance.
+ * @param   operation   The operation.
+ * @param   count       Receives the number of set bits.
  *
- * @return  The smallest integer value not less than `x`.
+ * @return  A zyan status code.
  */
-#define ZYAN_BITSET_CEIL(x) \
-    (((x) == ((ZyanU32)(x))) ? (ZyanU32)(x) : ((ZyanU32)(x)) + 1)
+static ZyanStatus ZyanBitsetCountCombined(const ZyanBitset* a, const ZyanBitset* b,
+    ZyanBitsetCountOperation operation, ZyanUSize* count)
+{
+    if (!a || !b || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if ((a->size != b->size) || (a->layout != b->layout))
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
+    *count = ZyanBitsetPopcount(operation, ZYAN_BITSET_DATA(a), ZYAN_BITSET_DATA(b),
+        a->bits.size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
 
 /**
- * Converts bits to bytes.
+ * Loads the 64-bit word at the given byte offset so that the bit with the lowest index is the
+ * most significant one.
  *
- * @param   x   The value in bits.
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   offset  The byte offset of the word. Must be a multiple of `8`.
  *
- * @return  The amount of bytes needed to fit `x` bits.
+ * @return  The word. Bytes past the end of the bitset read as zero.
+ *
+ * All word-level iteration works on this representation, regardless of the layout. Bitsets using
+ * the LSB-first layout pay for an additional bit reversal.
  */
-#define ZYAN_BITSET_BITS_TO_BYTES(x) \
-    ZYAN_BITSET_CEIL((x) / 8)
+static ZyanU64 ZyanBitsetLoadWord(const ZyanBitset* bitset, ZyanUSize offset)
+{
+    const ZyanU8* const data = ZYAN_BITSET_DATA(bitset);
+    const ZyanUSize n = bitset->bits.size;
+    const ZyanBool lsb_first = (bitset->layout == ZYAN_BITSET_LAYOUT_LSB_FIRST);
+    if (offset + 8 <= n)
+    {
+        return lsb_first ? ZyanBitReverse64(ZyanLoadU64LE(data + offset)) :
+            ZyanLoadU64BE(data + offset);
+    }
+
+    ZyanU64 word = 0;
+    for (ZyanUSize i = offset; i < n; ++i)
+    {
+        word |= (ZyanU64)data[i] << (8 * (i - offset));
+    }
+    return lsb_first ? ZyanBitReverse64(word) : ZyanByteSwap64(word);
+}
 
 /**
- * Returns the offset of the given bit.
+ * Writes the indices of all set bits of the given word to `out`.
  *
- * @param   index   The bit index.
+ * @param   out     A pointer to the output buffer. Must have room for the number of set bits in
+ *                  `word`.
+ * @param   end     A pointer past the end of the output buffer.
+ * @param   word    The word, as returned by `ZyanBitsetLoadWord`.
+ * @param   base    The index of the first bit of the word.
  *
- * @return  The offset of the given bit.
+ * @return  A pointer past the last written index.
  */
-#define ZYAN_BITSET_BIT_OFFSET(index) \
-    (7 - ((index) % 8))
+static ZyanU32* ZyanBitsetDecodeWord(ZyanU32* out, const ZyanU32* end, ZyanU64 word,
+    ZyanU32 base)
+{
+#if defined(ZYAN_BITSET_AVX2) || defined(ZYAN_BITSET_SSE2) || defined(ZYAN_BITSET_NEON)
+    // The vector stores always write 8 elements, so the last few indices of the buffer are decoded
+    // one at a time below
+    for (; word && (end - out >= 8); word <<= 8, base += 8)
+    {
+        const ZyanU8 byte = (ZyanU8)(word >> 56);
+        const ZyanU8* const offsets = ZYAN_BITSET_DECODE_TABLE[byte];
+#   if defined(ZYAN_BITSET_AVX2)
+        const __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)offsets));
+        _mm256_storeu_si256((__m256i*)out, _mm256_add_epi32(v, _mm256_set1_epi32((int)base)));
+#   elif defined(ZYAN_BITSET_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i b = _mm_set1_epi32((int)base);
+        const __m128i v = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)offsets), zero);
+        _mm_storeu_si128((__m128i*)out, _mm_add_epi32(_mm_unpacklo_epi16(v, zero), b));
+        _mm_storeu_si128((__m128i*)(out + 4), _mm_add_epi32(_mm_unpackhi_epi16(v, zero), b));
+#   else
+        const uint16x8_t v = vmovl_u8(vld1_u8(offsets));
+        const uint32x4_t b = vdupq_n_u32(base);
+        vst1q_u32(out, vaddq_u32(vmovl_u16(vget_low_u16(v)), b));
+        vst1q_u32(out + 4, vaddq_u32(vmovl_u16(vget_high_u16(v)), b));
+#   endif
+        out += ZyanBitPopCount64(byte);
+    }
+#else
+    ZYAN_UNUSED(end);
+#endif
+    while (word)
+    {
+        const ZyanU8 offset = ZyanBitCountLeadingZeros64(word);
+        *out++ = base + offset;
+        word &= ~(0x8000000000000000ULL >> offset);
+    }
+    return out;
+}
 
-/* ============================================================================================== */
-/* Internal functions                                                                             */
-/* ============================================================================================== */
+/**
+ * Returns the offset of the `k`-th set bit of the given word.
+ *
+ * @param   word    The word, as returned by `ZyanBitsetLoadWord`. Must contain more than `k` set
+ *                  bits.
+ * @param   k       The zero-based number of the set bit.
+ *
+ * @return  The offset of the set bit relative to the first bit of the word.
+ */
+static ZyanU8 ZyanBitsetSelectInWord(ZyanU64 word, ZyanUSize k)
+{
+    // Skip whole bytes first, then clear the remaining lower set bits one by one
+    ZyanU8 offset = 0;
+    for (;;)
+    {
+        const ZyanU8 count = ZyanBitPopCount64(word >> 56);
+        if (k < count)
+        {
+            break;
+        }
+        k -= count;
+        word <<= 8;
+        offset += 8;
+    }
+    while (k--)
+    {
+        word &= ~(0x8000000000000000ULL >> ZyanBitCountLeadingZeros64(word));
+    }
+    return offset + ZyanBitCountLeadingZeros64(word);
+}
 
-/* ---------------------------------------------------------------------------------------------- */
-/* Helper functions                                                                               */
-/* ---------------------------------------------------------------------------------------------- */
+/**
+ * Returns the number of set bits before the given block of a rank/select directory.
+ *
+ * @param   directory   A pointer to the `ZyanBitsetRankSelect` instance.
+ * @param   block       The block index.
+ *
+ * @return  The number of set bits before the block.
+ */
+static ZyanUSize ZyanBitsetRankBlock(const ZyanBitsetRankSelect* directory, ZyanUSize block)
+{
+    return (ZyanUSize)directory->superblocks[block / ZYAN_BITSET_RANK_SUPERBLOCK_BLOCKS] +
+        directory->blocks[block];
+}
 
 /**
- * Initializes the given `vector` with `count` "zero"-bytes.
+ * Applies the given operation to the common bytes of `destination` and `source` and stores the
+ * result in `destination`.
  *
- * @param   vector  A pointer to the `ZyanVector` instance.
- * @param   count   The number of bytes.
+ * @param   destination A pointer to the `ZyanBitset` instance that is used as the first input and
+ *                      as the destination.
+ * @param   source      A pointer to the `ZyanBitset` instance that is used as the second input.
+ * @param   operation   The operation.
  *
  * @return  A zyan status code.
  */
-static ZyanStatus ZyanBitsetInitVectorElements(ZyanVector* vector, ZyanUSize count)
+static ZyanStatus ZyanBitsetApply(ZyanBitset* destination, const ZyanBitset* source,
+    ZyanBitsetKernelOperation operation)
 {
-    ZYAN_ASSERT(vector);
+    if (!destination || !source)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (destination->read_only || (destination->layout != source->layout))
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
+    const ZyanUSize n = ZYAN_MIN(destination->bits.size, source->bits.size);
+    ZyanU8* const d = ZYAN_BITSET_DATA(destination);
+    const ZyanU8* const s = ZYAN_BITSET_DATA(source);
+    ZyanBitsetKernel(operation, d, d, s, s, n);
+    ZyanBitsetClearUnusedBits(destination);
+
+    return ZYAN_STATUS_SUCCESS;
+}
 
-    static const ZyanU8 zero = 0;
-    for (ZyanUSize i = 0; i < count; ++i)
+/**
+ * Applies the given operation to the inputs `a`, `b` and `c` and stores the result in
+ * `destination`.
+ *
+ * @param   destination A pointer to the `ZyanBitset` instance that receives the result.
+ * @param   a           A pointer to the first input `ZyanBitset` instance.
+ * @param   b           A pointer to the second input `ZyanBitset` instance.
+ * @param   c           A pointer to the third input `ZyanBitset` instance.
+ * @param   operation   The operation.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanBitsetApplyAssign(ZyanBitset* destination, const ZyanBitset* a,
+    const ZyanBitset* b, const ZyanBitset* c, ZyanBitsetKernelOperation operation)
+{
+    if (!destination || !a || !b || !c)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (destination->read_only ||
+        (destination->size != a->size) || (destination->size != b->size) ||
+        (destination->size != c->size) ||
+        (destination->layout != a->layout) || (destination->layout != b->layout) ||
+        (destination->layout != c->layout))
     {
-        ZYAN_CHECK(ZyanVectorPushBack(vector, &zero));
+        return ZYAN_STATUS_INVALID_OPERATION;
     }
 
+    ZyanBitsetKernel(operation, ZYAN_BITSET_DATA(destination), ZYAN_BITSET_DATA(a),
+        ZYAN_BITSET_DATA(b), ZYAN_BITSET_DATA(c), destination->bits.size);
+
     return ZYAN_STATUS_SUCCESS;
 }
 
 /* ---------------------------------------------------------------------------------------------- */
-/* Byte operations                                                                                */
+/* Word access                                                                                    */
 /* ---------------------------------------------------------------------------------------------- */
 
-static ZyanStatus ZyanBitsetOperationAND(ZyanU8* b1, const ZyanU8* b2)
+/**
+ * Loads the 64-bit word at the given byte offset so that the bit with the lowest index is the
+ * least significant one.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   offset  The byte offset of the word.
+ *
+ * @return  The word. Bytes past the end of the bitset read as zero.
+ *
+ * This is the natural representation for shifts and arithmetic. Bitsets using the LSB-first
+ * layout load it directly, bitsets using the MSB-first layout reverse the bits of every byte.
+ */
+static ZyanU64 ZyanBitsetLoadWordLE(const ZyanBitset* bitset, ZyanUSize offset)
+{
+    const ZyanU8* const data = ZYAN_BITSET_DATA(bitset);
+    const ZyanUSize n = bitset->bits.size;
+
+    ZyanU64 word = 0;
+    if (offset + 8 <= n)
+    {
+        word = ZyanLoadU64LE(data + offset);
+    } else
+    {
+        for (ZyanUSize i = offset; i < n; ++i)
+        {
+            word |= (ZyanU64)data[i] << (8 * (i - offset));
+        }
+    }
+
+    return (bitset->layout == ZYAN_BITSET_LAYOUT_LSB_FIRST) ? word : ZyanBitReverseBytes64(word);
+}
+
+/**
+ * Stores a word in the representation returned by `ZyanBitsetLoadWordLE` at the given byte
+ * offset.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   offset  The byte offset of the word.
+ * @param   word    The word. Bytes past the end of the bitset are discarded.
+ */
+static void ZyanBitsetStoreWordLE(ZyanBitset* bitset, ZyanUSize offset, ZyanU64 word)
+{
+    ZyanU8* const data = ZYAN_BITSET_DATA(bitset);
+    const ZyanUSize n = bitset->bits.size;
+
+    if (bitset->layout != ZYAN_BITSET_LAYOUT_LSB_FIRST)
+    {
+        word = ZyanBitReverseBytes64(word);
+    }
+
+    if (offset + 8 <= n)
+    {
+        ZyanStoreU64LE(data + offset, word);
+        return;
+    }
+    for (ZyanUSize i = offset; i < n; ++i)
+    {
+        data[i] = (ZyanU8)(word >> (8 * (i - offset)));
+    }
+}
+
+/**
+ * Returns the bits `[index, index + count)` of the given bitset.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   index   The index of the first bit.
+ * @param   count   The number of bits (`1` to `64`).
+ *
+ * @return  The bits, with bit `index` as the least significant one.
+ */
+static ZyanU64 ZyanBitsetLoadBits(const ZyanBitset* bitset, ZyanUSize index, ZyanU8 count)
+{
+    ZYAN_ASSERT(count && (count <= 64));
+
+    const ZyanUSize offset = index / 8;
+    const ZyanU8 shift = (ZyanU8)(index % 8);
+
+    ZyanU64 value = ZyanBitsetLoadWordLE(bitset, offset) >> shift;
+    if (shift && (count > 64 - shift))
+    {
+        value |= ZyanBitsetLoadWordLE(bitset, offset + 8) << (64 - shift);
+    }
+    if (count < 64)
+    {
+        value &= ~(~0ULL << count);
+    }
+
+    return value;
+}
+
+/**
+ * Replaces the bits `[index, index + count)` of the given bitset.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   index   The index of the first bit.
+ * @param   value   The new bits, with bit `index` as the least significant one.
+ * @param   count   The number of bits (`1` to `64`).
+ */
+static void ZyanBitsetStoreBits(ZyanBitset* bitset, ZyanUSize index, ZyanU64 value,
+    ZyanU8 count)
+{
+    ZYAN_ASSERT(count && (count <= 64));
+
+    const ZyanUSize offset = index / 8;
+    const ZyanU8 shift = (ZyanU8)(index % 8);
+    const ZyanU64 mask = (count < 64) ? ~(~0ULL << count) : ~0ULL;
+    value &= mask;
+
+    ZyanU64 word = ZyanBitsetLoadWordLE(bitset, offset);
+    word = (word & ~(mask << shift)) | (value << shift);
+    ZyanBitsetStoreWordLE(bitset, offset, word);
+
+    if (shift && (count > 64 - shift))
+    {
+        // The remaining bits spill into the first byte of the next word
+        word = ZyanBitsetLoadWordLE(bitset, offset + 8);
+        word = (word & ~(mask >> (64 - shift))) | (value >> (64 - shift));
+        ZyanBitsetStoreWordLE(bitset, offset + 8, word);
+    }
+}
+
+/**
+ * Reverses the order of the bits `[begin, end)` of the given bitset.
+ *
+ * @param   bitset  A pointer to the `ZyanBitset` instance.
+ * @param   begin   The index of the first bit.
+ * @param   end     The index past the last bit.
+ *
+ * Swaps up to 64 bits from both ends of the range at a time.
+ */
+static void ZyanBitsetReverseRange(ZyanBitset* bitset, ZyanUSize begin, ZyanUSize end)
+{
+    while (end - begin >= 2)
+    {
+        const ZyanU8 count = (ZyanU8)ZYAN_MIN(64, (end - begin) / 2);
+        const ZyanU64 low = ZyanBitsetLoadBits(bitset, begin, count);
+        const ZyanU64 high = ZyanBitsetLoadBits(bitset, end - count, count);
+        ZyanBitsetStoreBits(bitset, begin, ZyanBitReverse64(high) >> (64 - count), count);
+        ZyanBitsetStoreBits(bitset, end - count, ZyanBitReverse64(low) >> (64 - count), count);
+        begin += count;
+        end -= count;
+    }
+}
+
+/**
+ * Checks, if `source` can be combined into `destination` by one of the shift, rotate or
+ * arithmetic operations.
+ *
+ * @param   destination A pointer to the destination `ZyanBitset` instance.
+ * @param   source      A pointer to the source `ZyanBitset` instance.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanBitsetCheckOperands(const ZyanBitset* destination,
+    const ZyanBitset* source)
 {
-    *b1 &= *b2;
+    if (!destination || !source)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (destination->read_only || (destination->size != source->size) ||
+        (destination->layout != source->layout))
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
     return ZYAN_STATUS_SUCCESS;
 }
 
-static ZyanStatus ZyanBitsetOperationOR (ZyanU8* b1, const ZyanU8* b2)
+/**
+ * Shifts the bits of `source` by `count` positions and stores the result in `destination`.
+ *
+ * @param   destination A pointer to the `ZyanBitset` instance that receives the result. May be
+ *                      identical to `source`.
+ * @param   source      A pointer to the input `ZyanBitset` instance.
+ * @param   count       The number of positions.
+ * @param   left        `ZYAN_TRUE` to shift towards higher indices, `ZYAN_FALSE` to shift
+ *                      towards lower ones.
+ *
+ * @return  A zyan status code.
+ *
+ * Every destination word is assembled from at most two (unaligned) source words. Words are
+ * processed in the direction that never reads a word that has already been written, which makes
+ * the operation safe in place.
+ */
+static ZyanStatus ZyanBitsetShift(ZyanBitset* destination, const ZyanBitset* source,
+    ZyanUSize count, ZyanBool left)
 {
-    *b1 |= *b2;
+    ZYAN_CHECK(ZyanBitsetCheckOperands(destination, source));
+
+    const ZyanUSize n = destination->size;
+    const ZyanUSize words = (n + 63) / 64;
+    for (ZyanUSize i = 0; i < words; ++i)
+    {
+        const ZyanUSize w = left ? (words - 1 - i) : i;
+        const ZyanUSize index = w * 64;
+        const ZyanU8 bits = (ZyanU8)ZYAN_MIN(64, n - index);
+
+        ZyanU64 value = 0;
+        if (left && (index + bits > count))
+        {
+            if (index >= count)
+            {
+                value = ZyanBitsetLoadBits(source, index - count, bits);
+            } else
+            {
+                const ZyanU8 skip = (ZyanU8)(count - index);
+                value = ZyanBitsetLoadBits(source, 0, (ZyanU8)(bits - skip)) << skip;
+            }
+        }
+        if (!left && (count < n - index))
+        {
+            value = ZyanBitsetLoadBits(source, index + count,
+                (ZyanU8)ZYAN_MIN(bits, n - index - count));
+        }
+
+        ZyanBitsetStoreWordLE(destination, index / 8, value);
+    }
+
     return ZYAN_STATUS_SUCCESS;
 }
 
-static ZyanStatus ZyanBitsetOperationXOR(ZyanU8* b1, const ZyanU8* b2)
+/**
+ * Rotates the bits of `source` by `count` positions towards higher indices and stores the result
+ * in `destination`.
+ *
+ * @param   destination A pointer to the `ZyanBitset` instance that receives the result. May be
+ *                      identical to `source`.
+ * @param   source      A pointer to the input `ZyanBitset` instance.
+ * @param   count       The number of positions.
+ *
+ * @return  A zyan status code.
+ *
+ * Distinct bitsets are processed one destination word at a time. In place, the rotation is
+ * performed by three range reversals, which does not require a temporary buffer.
+ */
+static ZyanStatus ZyanBitsetRotate(ZyanBitset* destination, const ZyanBitset* source,
+    ZyanUSize count)
 {
-    *b1 ^= *b2;
+    ZYAN_CHECK(ZyanBitsetCheckOperands(destination, source));
+
+    const ZyanUSize n = destination->size;
+    if (!n)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+    count %= n;
+
+    if (destination == source)
+    {
+        if (count)
+        {
+            ZyanBitsetReverseRange(destination, 0, n - count);
+            ZyanBitsetReverseRange(destination, n - count, n);
+            ZyanBitsetReverseRange(destination, 0, n);
+        }
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    for (ZyanUSize index = 0; index < n; index += 64)
+    {
+        const ZyanU8 bits = (ZyanU8)ZYAN_MIN(64, n - index);
+        const ZyanUSize from = (index >= count) ? (index - count) : (index + n - count);
+
+        ZyanU64 value;
+        if (from + bits <= n)
+        {
+            value = ZyanBitsetLoadBits(source, from, bits);
+        } else
+        {
+            const ZyanU8 low = (ZyanU8)(n - from);
+            value = ZyanBitsetLoadBits(source, from, low) |
+                (ZyanBitsetLoadBits(source, 0, (ZyanU8)(bits - low)) << low);
+        }
+
+        ZyanBitsetStoreWordLE(destination, index / 8, value);
+    }
+
     return ZYAN_STATUS_SUCCESS;
 }
 
@@ -131,62 +1529,164 @@ static ZyanStatus ZyanBitsetOperationXOR(ZyanU8* b1, const ZyanU8* b2)
 
 #ifndef ZYAN_NO_LIBC
 
-ZyanStatus ZyanBitsetInit(ZyanBitset* bitset, ZyanUSize count)
-{
-    return ZyanBitsetInitEx(bitset, count, ZyanAllocatorDefault(), ZYAN_BITSET_GROWTH_FACTOR,
-        ZYAN_BITSET_SHRINK_THRESHOLD);
+ZyanStatus ZyanBitsetInit(ZyanBitset* bitset, ZyanUSize count)
+{
+    return ZyanBitsetInitEx(bitset, count, ZyanAllocatorDefault(), ZYAN_BITSET_GROWTH_FACTOR,
+        ZYAN_BITSET_SHRINK_THRESHOLD);
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanBitsetInitEx(ZyanBitset* bitset, ZyanUSize count, ZyanAllocator* allocator,
+    ZyanU8 growth_factor, ZyanU8 shrink_threshold)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    bitset->size = 0;
+    bitset->layout = ZYAN_BITSET_LAYOUT_MSB_FIRST;
+    bitset->read_only = ZYAN_FALSE;
+    ZYAN_CHECK(ZyanVectorInitEx(&bitset->bits, sizeof(ZyanU8), ZYAN_BITSET_BITS_TO_BYTES(count),
+        ZYAN_NULL, allocator, growth_factor, shrink_threshold));
+
+    return ZyanBitsetResizeInternal(bitset, count);
+}
+
+ZyanStatus ZyanBitsetInitBuffer(ZyanBitset* bitset, ZyanUSize count, void* buffer,
+    ZyanUSize capacity)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (capacity < ZYAN_BITSET_BITS_TO_BYTES(count))
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    bitset->size = 0;
+    bitset->layout = ZYAN_BITSET_LAYOUT_MSB_FIRST;
+    bitset->read_only = ZYAN_FALSE;
+    ZYAN_CHECK(ZyanVectorInitCustomBuffer(&bitset->bits, sizeof(ZyanU8), buffer, capacity,
+        ZYAN_NULL));
+
+    return ZyanBitsetResizeInternal(bitset, count);
+}
+
+ZyanStatus ZyanBitsetInitExternal(ZyanBitset* bitset, ZyanUSize count, ZyanBitsetLayout layout,
+    void* buffer, ZyanUSize capacity)
+{
+    if (!bitset || !buffer || (layout > ZYAN_BITSET_LAYOUT_LSB_FIRST))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize bytes = ZYAN_BITSET_BITS_TO_BYTES(count);
+    if (capacity < bytes)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    bitset->layout = layout;
+    bitset->read_only = ZYAN_FALSE;
+    ZYAN_CHECK(ZyanVectorInitCustomBuffer(&bitset->bits, sizeof(ZyanU8), buffer, capacity,
+        ZYAN_NULL));
+    // Resizing the vector without an initializer does not touch the existing bytes
+    ZYAN_CHECK(ZyanVectorResize(&bitset->bits, bytes));
+    bitset->size = count;
+    // This is the only write to the caller's buffer (see the documentation)
+    ZyanBitsetClearUnusedBits(bitset);
+
+    return ZYAN_STATUS_SUCCESS;
 }
 
-#endif // ZYAN_NO_LIBC
-
-ZyanStatus ZyanBitsetInitEx(ZyanBitset* bitset, ZyanUSize count, ZyanAllocator* allocator,
-    ZyanU8 growth_factor, ZyanU8 shrink_threshold)
+ZyanStatus ZyanBitsetInitReadOnly(ZyanBitset* bitset, ZyanUSize count, ZyanBitsetLayout layout,
+    const void* buffer)
 {
-    if (!bitset)
+    if (!bitset || !buffer || (layout > ZYAN_BITSET_LAYOUT_LSB_FIRST))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    const ZyanU32 bytes = ZYAN_BITSET_BITS_TO_BYTES(count);
+    bitset->layout = layout;
+    const ZyanUSize bytes = ZYAN_BITSET_BITS_TO_BYTES(count);
+    const ZyanUSize used = count % 8;
+    if (used && (((const ZyanU8*)buffer)[bytes - 1] & ~ZyanBitsetMaskUpTo(bitset, used - 1)))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
 
+    // The vector requires a non-zero capacity, even if the bitset is empty. The buffer is never
+    // written to, as all mutating functions reject read-only bitsets
+    bitset->read_only = ZYAN_TRUE;
+    ZYAN_CHECK(ZyanVectorInitCustomBuffer(&bitset->bits, sizeof(ZyanU8), (void*)buffer,
+        ZYAN_MAX(1, bytes), ZYAN_NULL));
+    ZYAN_CHECK(ZyanVectorResize(&bitset->bits, bytes));
     bitset->size = count;
-    ZYAN_CHECK(ZyanVectorInitEx(&bitset->bits, sizeof(ZyanU8), bytes, ZYAN_NULL, allocator,
-        growth_factor, shrink_threshold));
-    ZYAN_CHECK(ZyanBitsetInitVectorElements(&bitset->bits, bytes));
 
     return ZYAN_STATUS_SUCCESS;
 }
 
-ZyanStatus ZyanBitsetInitBuffer(ZyanBitset* bitset, ZyanUSize count, void* buffer,
-    ZyanUSize capacity)
+ZyanStatus ZyanBitsetDestroy(ZyanBitset* bitset)
 {
     if (!bitset)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    const ZyanU32 bytes = ZYAN_BITSET_BITS_TO_BYTES(count);
-    if (capacity < bytes)
+    return ZyanVectorDestroy(&bitset->bits);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Layout                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBitsetSetLayout(ZyanBitset* bitset, ZyanBitsetLayout layout)
+{
+    if (!bitset || (layout > ZYAN_BITSET_LAYOUT_LSB_FIRST))
     {
-        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+    if (bitset->layout == layout)
+    {
+        return ZYAN_STATUS_SUCCESS;
     }
 
-    bitset->size = count;
-    ZYAN_CHECK(ZyanVectorInitCustomBuffer(&bitset->bits, sizeof(ZyanU8), buffer, capacity,
-        ZYAN_NULL));
-    ZYAN_CHECK(ZyanBitsetInitVectorElements(&bitset->bits, bytes));
+    // Both layouts only differ in the order of the bits within each byte. The unused bits of the
+    // last byte end up in the unused positions of the new layout and stay cleared
+    ZyanU8* const data = ZYAN_BITSET_DATA(bitset);
+    const ZyanUSize n = bitset->bits.size;
+    ZyanUSize i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        ZyanStoreU64(data + i, ZyanBitReverseBytes64(ZyanLoadU64(data + i)));
+    }
+    for (; i < n; ++i)
+    {
+        data[i] = (ZyanU8)ZyanBitReverseBytes64(data[i]);
+    }
+    bitset->layout = layout;
 
     return ZYAN_STATUS_SUCCESS;
 }
 
-ZyanStatus ZyanBitsetDestroy(ZyanBitset* bitset)
+ZyanStatus ZyanBitsetGetLayout(const ZyanBitset* bitset, ZyanBitsetLayout* layout)
 {
-    if (!bitset)
+    if (!bitset || !layout)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    return ZyanVectorDestroy(&bitset->bits);
+    *layout = bitset->layout;
+
+    return ZYAN_STATUS_SUCCESS;
 }
 
 /* ---------------------------------------------------------------------------------------------- */
@@ -200,42 +1700,76 @@ ZyanStatus ZyanBitsetPerformByteOperation(ZyanBitset* destination, const ZyanBit
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-
-    ZyanUSize s1;
-    ZyanUSize s2;
-    ZYAN_CHECK(ZyanVectorGetSize(&destination->bits, &s1));
-    ZYAN_CHECK(ZyanVectorGetSize(&source->bits, &s2));
-
-    const ZyanUSize min = ZYAN_MIN(s1, s2);
-    for (ZyanUSize i = 0; i < min; ++i)
+    if (destination->read_only || (destination->layout != source->layout))
     {
-        ZyanU8* v1;
-        const ZyanU8* v2;
-        ZYAN_CHECK(ZyanVectorGetPointerMutable(&destination->bits, i, (void**)&v1));
-        ZYAN_CHECK(ZyanVectorGetPointer(&source->bits, i, (const void**)&v2));
-
-        ZYAN_ASSERT(v1);
-        ZYAN_ASSERT(v2);
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
 
-        ZYAN_CHECK(operation(v1, v2));
+    const ZyanUSize n = ZYAN_MIN(destination->bits.size, source->bits.size);
+    ZyanU8* const d = ZYAN_BITSET_DATA(destination);
+    const ZyanU8* const s = ZYAN_BITSET_DATA(source);
+    for (ZyanUSize i = 0; i < n; ++i)
+    {
+        const ZyanStatus status = operation(&d[i], &s[i]);
+        if (!ZYAN_SUCCESS(status))
+        {
+            ZyanBitsetClearUnusedBits(destination);
+            return status;
+        }
     }
+    ZyanBitsetClearUnusedBits(destination);
 
     return ZYAN_STATUS_SUCCESS;
 }
 
 ZyanStatus ZyanBitsetAND(ZyanBitset* destination, const ZyanBitset* source)
 {
-    return ZyanBitsetPerformByteOperation(destination, source, ZyanBitsetOperationAND);
+    return ZyanBitsetApply(destination, source, ZYAN_BITSET_KERNEL_AND);
 }
 
 ZyanStatus ZyanBitsetOR (ZyanBitset* destination, const ZyanBitset* source)
 {
-    return ZyanBitsetPerformByteOperation(destination, source, ZyanBitsetOperationOR );
+    return ZyanBitsetApply(destination, source, ZYAN_BITSET_KERNEL_OR);
 }
 
 ZyanStatus ZyanBitsetXOR(ZyanBitset* destination, const ZyanBitset* source)
 {
-    return ZyanBitsetPerformByteOperation(destination, source, ZyanBitsetOperationXOR);
+    return ZyanBitsetApply(destination, source, ZYAN_BITSET_KERNEL_XOR);
+}
+
+ZyanStatus ZyanBitsetANDNOT(ZyanBitset* destination, const ZyanBitset* source)
+{
+    return ZyanBitsetApply(destination, source, ZYAN_BITSET_KERNEL_ANDNOT);
+}
+
+ZyanStatus ZyanBitsetAssignAND(ZyanBitset* destination, const ZyanBitset* a,
+    const ZyanBitset* b)
+{
+    return ZyanBitsetApplyAssign(destination, a, b, b, ZYAN_BITSET_KERNEL_AND);
+}
+
+ZyanStatus ZyanBitsetAssignOR(ZyanBitset* destination, const ZyanBitset* a,
+    const ZyanBitset* b)
+{
+    return ZyanBitsetApplyAssign(destination, a, b, b, ZYAN_BITSET_KERNEL_OR);
+}
+
+ZyanStatus ZyanBitsetAssignXOR(ZyanBitset* destination, const ZyanBitset* a,
+    const ZyanBitset* b)
+{
+    return ZyanBitsetApplyAssign(destination, a, b, b, ZYAN_BITSET_KERNEL_XOR);
+}
+
+ZyanStatus ZyanBitsetAssignANDNOT(ZyanBitset* destination, const ZyanBitset* a,
+    const ZyanBitset* b)
+{
+    return ZyanBitsetApplyAssign(destination, a, b, b, ZYAN_BITSET_KERNEL_ANDNOT);
+}
+
+ZyanStatus ZyanBitsetAssignORANDNOT(ZyanBitset* destination, const ZyanBitset* a,
+    const ZyanBitset* b, const ZyanBitset* c)
+{
+    return ZyanBitsetApplyAssign(destination, a, b, c, ZYAN_BITSET_KERNEL_ORANDNOT);
 }
 
 ZyanStatus ZyanBitsetFlip(ZyanBitset* bitset)
@@ -244,14 +1778,104 @@ ZyanStatus ZyanBitsetFlip(ZyanBitset* bitset)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
+    ZyanU8* const data = ZYAN_BITSET_DATA(bitset);
+    ZyanBitsetKernel(ZYAN_BITSET_KERNEL_NOT, data, data, data, data, bitset->bits.size);
+    ZyanBitsetClearUnusedBits(bitset);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Shift and arithmetic operations                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBitsetShiftLeft(ZyanBitset* bitset, ZyanUSize count)
+{
+    return ZyanBitsetShift(bitset, bitset, count, ZYAN_TRUE);
+}
+
+ZyanStatus ZyanBitsetShiftRight(ZyanBitset* bitset, ZyanUSize count)
+{
+    return ZyanBitsetShift(bitset, bitset, count, ZYAN_FALSE);
+}
+
+ZyanStatus ZyanBitsetAssignShiftLeft(ZyanBitset* destination, const ZyanBitset* source,
+    ZyanUSize count)
+{
+    return ZyanBitsetShift(destination, source, count, ZYAN_TRUE);
+}
+
+ZyanStatus ZyanBitsetAssignShiftRight(ZyanBitset* destination, const ZyanBitset* source,
+    ZyanUSize count)
+{
+    return ZyanBitsetShift(destination, source, count, ZYAN_FALSE);
+}
+
+ZyanStatus ZyanBitsetRotateLeft(ZyanBitset* bitset, ZyanUSize count)
+{
+    return ZyanBitsetAssignRotateLeft(bitset, bitset, count);
+}
+
+ZyanStatus ZyanBitsetRotateRight(ZyanBitset* bitset, ZyanUSize count)
+{
+    return ZyanBitsetAssignRotateRight(bitset, bitset, count);
+}
+
+ZyanStatus ZyanBitsetAssignRotateLeft(ZyanBitset* destination, const ZyanBitset* source,
+    ZyanUSize count)
+{
+    return ZyanBitsetRotate(destination, source, count);
+}
+
+ZyanStatus ZyanBitsetAssignRotateRight(ZyanBitset* destination, const ZyanBitset* source,
+    ZyanUSize count)
+{
+    if (!source)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // Rotating right by `count` is the same as rotating left by the remaining positions
+    const ZyanUSize n = source->size;
+    return ZyanBitsetRotate(destination, source, n ? (n - count % n) : 0);
+}
+
+ZyanStatus ZyanBitsetAdd(ZyanBitset* destination, const ZyanBitset* source, ZyanBool* carry)
+{
+    ZYAN_CHECK(ZyanBitsetCheckOperands(destination, source));
+
+    const ZyanUSize n = destination->size;
+    ZyanU64 c = (carry && *carry) ? 1 : 0;
+    for (ZyanUSize index = 0; index < n; index += 64)
+    {
+        const ZyanUSize offset = index / 8;
+        const ZyanU64 a = ZyanBitsetLoadWordLE(destination, offset);
+        const ZyanU64 b = ZyanBitsetLoadWordLE(source, offset);
+        const ZyanU64 partial = a + b;
+        ZyanU64 sum = partial + c;
+
+        const ZyanUSize bits = ZYAN_MIN(64, n - index);
+        if (bits == 64)
+        {
+            c = (partial < a) | (sum < partial);
+        } else
+        {
+            // The unused bits are zero, so the carry ends up in the first bit past the end
+            c = (sum >> bits) & 1;
+            sum &= ~(~0ULL << bits);
+        }
+
+        ZyanBitsetStoreWordLE(destination, offset, sum);
+    }
 
-    ZyanUSize size;
-    ZYAN_CHECK(ZyanVectorGetSize(&bitset->bits, &size));
-    for (ZyanUSize i = 0; i < size; ++i)
+    if (carry)
     {
-        ZyanU8* value;
-        ZYAN_CHECK(ZyanVectorGetPointerMutable(&bitset->bits, i, (void**)&value));
-        *value = ~(*value);
+        *carry = c ? ZYAN_TRUE : ZYAN_FALSE;
     }
 
     return ZYAN_STATUS_SUCCESS;
@@ -267,6 +1891,10 @@ ZyanStatus ZyanBitsetSet(ZyanBitset* bitset, ZyanUSize index)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
     if (index >= bitset->size)
     {
         return ZYAN_STATUS_OUT_OF_RANGE;
@@ -275,7 +1903,7 @@ ZyanStatus ZyanBitsetSet(ZyanBitset* bitset, ZyanUSize index)
     ZyanU8* value;
     ZYAN_CHECK(ZyanVectorGetPointerMutable(&bitset->bits, index / 8, (void**)&value));
 
-    *value |= (1 << ZYAN_BITSET_BIT_OFFSET(index));
+    *value |= (1 << ZYAN_BITSET_BIT_OFFSET(bitset, index));
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -286,6 +1914,10 @@ ZyanStatus ZyanBitsetReset(ZyanBitset* bitset, ZyanUSize index)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
     if (index >= bitset->size)
     {
         return ZYAN_STATUS_OUT_OF_RANGE;
@@ -293,7 +1925,7 @@ ZyanStatus ZyanBitsetReset(ZyanBitset* bitset, ZyanUSize index)
 
     ZyanU8* value;
     ZYAN_CHECK(ZyanVectorGetPointerMutable(&bitset->bits, index / 8, (void**)&value));
-    *value &= ~(1 << ZYAN_BITSET_BIT_OFFSET(index));
+    *value &= ~(1 << ZYAN_BITSET_BIT_OFFSET(bitset, index));
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -308,6 +1940,28 @@ ZyanStatus ZyanBitsetAssign(ZyanBitset* bitset, ZyanUSize index, ZyanBool value)
 }
 
 ZyanStatus ZyanBitsetToggle(ZyanBitset* bitset, ZyanUSize index)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+    if (index >= bitset->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    ZyanU8* value;
+    ZYAN_CHECK(ZyanVectorGetPointerMutable(&bitset->bits, index / 8, (void**)&value));
+    *value ^= (1 << ZYAN_BITSET_BIT_OFFSET(bitset, index));
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBitsetTest(ZyanBitset* bitset, ZyanUSize index)
 {
     if (!bitset)
     {
@@ -318,84 +1972,294 @@ ZyanStatus ZyanBitsetToggle(ZyanBitset* bitset, ZyanUSize index)
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    ZyanU8* value;
-    ZYAN_CHECK(ZyanVectorGetPointerMutable(&bitset->bits, index / 8, (void**)&value));
-    *value ^= (1 << ZYAN_BITSET_BIT_OFFSET(index));
-
-    return ZYAN_STATUS_SUCCESS;
+    const ZyanU8* value;
+    ZYAN_CHECK(ZyanVectorGetPointer(&bitset->bits, index / 8, (const void**)&value));
+    if ((*value & (1 << ZYAN_BITSET_BIT_OFFSET(bitset, index))) == 0)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanBitsetTestMSB(ZyanBitset* bitset)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanBitsetTest(bitset, bitset->size - 1);
+}
+
+ZyanStatus ZyanBitsetTestLSB(ZyanBitset* bitset)
+{
+    return ZyanBitsetTest(bitset, 0);
+}
+
+ZyanStatus ZyanBitsetGetWord(const ZyanBitset* bitset, ZyanUSize index, ZyanU8 count,
+    ZyanU64* value)
+{
+    if (!bitset || (count > 64) || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if ((count > bitset->size) || (index > bitset->size - count))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    *value = count ? ZyanBitsetLoadBits(bitset, index, count) : 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBitsetSetWord(ZyanBitset* bitset, ZyanUSize index, ZyanU64 value, ZyanU8 count)
+{
+    if (!bitset || (count > 64))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+    if ((count > bitset->size) || (index > bitset->size - count))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (count)
+    {
+        ZyanBitsetStoreBits(bitset, index, value, count);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBitsetSetAll(ZyanBitset* bitset)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
+    if (bitset->bits.size)
+    {
+        ZYAN_MEMSET(bitset->bits.data, 0xFF, bitset->bits.size);
+        ZyanBitsetClearUnusedBits(bitset);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBitsetResetAll(ZyanBitset* bitset)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
+    if (bitset->bits.size)
+    {
+        ZYAN_MEMSET(bitset->bits.data, 0x00, bitset->bits.size);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBitsetSetRange(ZyanBitset* bitset, ZyanUSize begin, ZyanUSize end)
+{
+    return ZyanBitsetApplyRange(bitset, begin, end, ZYAN_BITSET_RANGE_SET);
+}
+
+ZyanStatus ZyanBitsetResetRange(ZyanBitset* bitset, ZyanUSize begin, ZyanUSize end)
+{
+    return ZyanBitsetApplyRange(bitset, begin, end, ZYAN_BITSET_RANGE_RESET);
+}
+
+ZyanStatus ZyanBitsetFlipRange(ZyanBitset* bitset, ZyanUSize begin, ZyanUSize end)
+{
+    return ZyanBitsetApplyRange(bitset, begin, end, ZYAN_BITSET_RANGE_FLIP);
+}
+
+ZyanStatus ZyanBitsetAnyRange(const ZyanBitset* bitset, ZyanUSize begin, ZyanUSize end)
+{
+    return ZyanBitsetTestRange(bitset, begin, end, ZYAN_FALSE);
+}
+
+ZyanStatus ZyanBitsetAllRange(const ZyanBitset* bitset, ZyanUSize begin, ZyanUSize end)
+{
+    return ZyanBitsetTestRange(bitset, begin, end, ZYAN_TRUE);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBitsetFindFirstSet(const ZyanBitset* bitset, ZyanUSize* found)
+{
+    return ZyanBitsetFindNextSet(bitset, 0, found);
+}
+
+ZyanStatus ZyanBitsetFindNextSet(const ZyanBitset* bitset, ZyanUSize index, ZyanUSize* found)
+{
+    if (!bitset || !found)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index > bitset->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+    if (index == bitset->size)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    const ZyanUSize words = (bitset->size + 63) / 64;
+    ZyanUSize w = index / 64;
+    ZyanU64 word = ZyanBitsetLoadWord(bitset, w * 8) & (~0ULL >> (index % 64));
+    while (!word)
+    {
+        if (++w == words)
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+        word = ZyanBitsetLoadWord(bitset, w * 8);
+    }
+
+    *found = w * 64 + ZyanBitCountLeadingZeros64(word);
+    return ZYAN_STATUS_TRUE;
 }
 
-ZyanStatus ZyanBitsetTest(ZyanBitset* bitset, ZyanUSize index)
+ZyanStatus ZyanBitsetFindNextClear(const ZyanBitset* bitset, ZyanUSize index, ZyanUSize* found)
 {
-    if (!bitset)
+    if (!bitset || !found)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (index >= bitset->size)
+    if (index > bitset->size)
     {
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
+    if (index == bitset->size)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
 
-    const ZyanU8* value;
-    ZYAN_CHECK(ZyanVectorGetPointer(&bitset->bits, index / 8, (const void**)&value));
-    if ((*value & (1 << ZYAN_BITSET_BIT_OFFSET(index))) == 0)
+    const ZyanUSize words = (bitset->size + 63) / 64;
+    ZyanUSize w = index / 64;
+    ZyanU64 word = ~ZyanBitsetLoadWord(bitset, w * 8) & (~0ULL >> (index % 64));
+    while (!word)
+    {
+        if (++w == words)
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+        word = ~ZyanBitsetLoadWord(bitset, w * 8);
+    }
+
+    // The bits past the end of the bitset read as cleared
+    const ZyanUSize result = w * 64 + ZyanBitCountLeadingZeros64(word);
+    if (result >= bitset->size)
     {
         return ZYAN_STATUS_FALSE;
     }
+
+    *found = result;
     return ZYAN_STATUS_TRUE;
 }
 
-ZyanStatus ZyanBitsetTestMSB(ZyanBitset* bitset)
+ZyanStatus ZyanBitsetFindLastSet(const ZyanBitset* bitset, ZyanUSize* found)
 {
-    if (!bitset)
+    if (!bitset || !found)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    return ZyanBitsetTest(bitset, bitset->size - 1);
-}
+    for (ZyanUSize w = (bitset->size + 63) / 64; w--;)
+    {
+        const ZyanU64 word = ZyanBitsetLoadWord(bitset, w * 8);
+        if (word)
+        {
+            *found = w * 64 + 63 - ZyanBitCountTrailingZeros64(word);
+            return ZYAN_STATUS_TRUE;
+        }
+    }
 
-ZyanStatus ZyanBitsetTestLSB(ZyanBitset* bitset)
-{
-    return ZyanBitsetTest(bitset, 0);
+    return ZYAN_STATUS_FALSE;
 }
 
-/* ---------------------------------------------------------------------------------------------- */
-
-ZyanStatus ZyanBitsetSetAll(ZyanBitset* bitset)
+ZyanStatus ZyanBitsetForEachSet(const ZyanBitset* bitset, ZyanBitsetCallback callback,
+    void* user_data)
 {
-    if (!bitset)
+    if (!bitset || !callback)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    ZyanUSize size;
-    ZYAN_CHECK(ZyanVectorGetSize(&bitset->bits, &size));
-    for (ZyanUSize i = 0; i < size; ++i)
+    const ZyanUSize words = (bitset->size + 63) / 64;
+    for (ZyanUSize w = 0; w < words; ++w)
     {
-        ZyanU8* value;
-        ZYAN_CHECK(ZyanVectorGetPointerMutable(&bitset->bits, i, (void**)&value));
-        *value = 0xFF;
+        ZyanU64 word = ZyanBitsetLoadWord(bitset, w * 8);
+        while (word)
+        {
+            const ZyanU8 offset = ZyanBitCountLeadingZeros64(word);
+            const ZyanStatus status = callback(w * 64 + offset, user_data);
+            if (status != ZYAN_STATUS_TRUE)
+            {
+                return status;
+            }
+            word &= ~(0x8000000000000000ULL >> offset);
+        }
     }
 
-    return ZYAN_STATUS_SUCCESS;
+    return ZYAN_STATUS_TRUE;
 }
 
-ZyanStatus ZyanBitsetResetAll(ZyanBitset* bitset)
+ZyanStatus ZyanBitsetExportIndices(const ZyanBitset* bitset, ZyanVector* indices)
 {
-    if (!bitset)
+    if (!bitset || !indices || (indices->element_size != sizeof(ZyanU32)))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
+    if ((ZyanU64)bitset->size > 0x100000000ULL)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
+    ZyanUSize count;
+    ZYAN_CHECK(ZyanBitsetCount(bitset, &count));
+    if (!count)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    const ZyanUSize size = indices->size;
+    ZYAN_CHECK(ZyanVectorResize(indices, size + count));
 
-    ZyanUSize size;
-    ZYAN_CHECK(ZyanVectorGetSize(&bitset->bits, &size));
-    for (ZyanUSize i = 0; i < size; ++i)
+    ZyanU32* out = (ZyanU32*)indices->data + size;
+    const ZyanU32* const end = out + count;
+    const ZyanUSize words = (bitset->size + 63) / 64;
+    for (ZyanUSize w = 0; w < words; ++w)
     {
-        ZyanU8* value;
-        ZYAN_CHECK(ZyanVectorGetPointerMutable(&bitset->bits, i, (void**)&value));
-        *value = 0x00;
+        const ZyanU64 word = ZyanBitsetLoadWord(bitset, w * 8);
+        if (word)
+        {
+            out = ZyanBitsetDecodeWord(out, end, word, (ZyanU32)(w * 64));
+        }
     }
+    ZYAN_ASSERT(out == end);
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -410,6 +2274,10 @@ ZyanStatus ZyanBitsetPush(ZyanBitset* bitset, ZyanBool value)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
 
     if ((bitset->size++ % 8) == 0)
     {
@@ -426,21 +2294,120 @@ ZyanStatus ZyanBitsetPop(ZyanBitset* bitset)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
+    if (!bitset->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
 
     if ((--bitset->size % 8) == 0)
     {
         return ZyanVectorPopBack(&bitset->bits);
     }
+    ZyanBitsetClearUnusedBits(bitset);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBitsetAppend(ZyanBitset* bitset, ZyanUSize count, ZyanBool value)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize begin = bitset->size;
+    ZYAN_CHECK(ZyanBitsetResizeInternal(bitset, begin + count));
+    if (value)
+    {
+        return ZyanBitsetApplyRange(bitset, begin, begin + count, ZYAN_BITSET_RANGE_SET);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBitsetAppendWord(ZyanBitset* bitset, ZyanU64 value, ZyanU8 count)
+{
+    if (!bitset || (count > 64))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (!count)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    const ZyanUSize begin = bitset->size;
+    ZYAN_CHECK(ZyanBitsetResizeInternal(bitset, begin + count));
+
+    ZyanU8* const data = ZYAN_BITSET_DATA(bitset) + begin / 8;
+    const ZyanU8 offset = (ZyanU8)(begin % 8);
+    const ZyanUSize bytes = (offset + count + 7) / 8;
+
+    if (bitset->layout == ZYAN_BITSET_LAYOUT_LSB_FIRST)
+    {
+        // The stream already is in storage order; it is written to the (already cleared)
+        // destination bytes starting with its least significant byte
+        ZyanU64 stream = value;
+        if (count < 64)
+        {
+            stream &= ~(~0ULL << count);
+        }
+
+        data[0] |= (ZyanU8)(stream << offset);
+        stream >>= 8 - offset;
+        for (ZyanUSize i = 1; i < bytes; ++i)
+        {
+            data[i] = (ZyanU8)stream;
+            stream >>= 8;
+        }
+
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // Bit `0` of `value` has to end up in the most significant position of the stream, which is
+    // then written to the (already cleared) destination bytes from left to right
+    ZyanU64 stream = ZyanBitReverse64(value);
+    if (count < 64)
+    {
+        stream &= ~(~0ULL >> count);
+    }
+
+    data[0] |= (ZyanU8)(stream >> (56 + offset));
+    stream <<= 8 - offset;
+    for (ZyanUSize i = 1; i < bytes; ++i)
+    {
+        data[i] = (ZyanU8)(stream >> 56);
+        stream <<= 8;
+    }
 
     return ZYAN_STATUS_SUCCESS;
 }
 
+ZyanStatus ZyanBitsetResize(ZyanBitset* bitset, ZyanUSize count)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanBitsetResizeInternal(bitset, count);
+}
+
 ZyanStatus ZyanBitsetClear(ZyanBitset* bitset)
 {
     if (!bitset)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
 
     bitset->size = 0;
     return ZyanVectorClear(&bitset->bits);
@@ -452,11 +2419,29 @@ ZyanStatus ZyanBitsetClear(ZyanBitset* bitset)
 
 ZyanStatus ZyanBitsetReserve(ZyanBitset* bitset, ZyanUSize count)
 {
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
     return ZyanVectorReserve(&bitset->bits, ZYAN_BITSET_BITS_TO_BYTES(count));
 }
 
 ZyanStatus ZyanBitsetShrinkToFit(ZyanBitset* bitset)
 {
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (bitset->read_only)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
     return ZyanVectorShrinkToFit(&bitset->bits);
 }
 
@@ -513,26 +2498,30 @@ ZyanStatus ZyanBitsetCount(const ZyanBitset* bitset, ZyanUSize* count)
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    *count = 0;
+    const ZyanU8* const data = ZYAN_BITSET_DATA(bitset);
+    *count = ZyanBitsetPopcount(ZYAN_BITSET_COUNT_A, data, data, bitset->bits.size);
 
-    ZyanUSize size;
-    ZYAN_CHECK(ZyanVectorGetSize(&bitset->bits, &size));
-    for (ZyanUSize i = 0; i < size; ++i)
-    {
-        ZyanU8* value;
-        ZYAN_CHECK(ZyanVectorGetPointer(&bitset->bits, i, (const void**)&value));
+    return ZYAN_STATUS_SUCCESS;
+}
 
-        ZyanU8 popcnt = *value;
-        popcnt = (popcnt & 0x55) + ((popcnt >> 1) & 0x55);
-        popcnt = (popcnt & 0x33) + ((popcnt >> 2) & 0x33);
-        popcnt = (popcnt & 0x0F) + ((popcnt >> 4) & 0x0F);
+ZyanStatus ZyanBitsetCountAND(const ZyanBitset* a, const ZyanBitset* b, ZyanUSize* count)
+{
+    return ZyanBitsetCountCombined(a, b, ZYAN_BITSET_COUNT_AND, count);
+}
 
-        *count += popcnt;
-    }
+ZyanStatus ZyanBitsetCountOR(const ZyanBitset* a, const ZyanBitset* b, ZyanUSize* count)
+{
+    return ZyanBitsetCountCombined(a, b, ZYAN_BITSET_COUNT_OR, count);
+}
 
-    *count = ZYAN_MIN(*count, bitset->size);
+ZyanStatus ZyanBitsetCountXOR(const ZyanBitset* a, const ZyanBitset* b, ZyanUSize* count)
+{
+    return ZyanBitsetCountCombined(a, b, ZYAN_BITSET_COUNT_XOR, count);
+}
 
-    return ZYAN_STATUS_SUCCESS;
+ZyanStatus ZyanBitsetCountANDNOT(const ZyanBitset* a, const ZyanBitset* b, ZyanUSize* count)
+{
+    return ZyanBitsetCountCombined(a, b, ZYAN_BITSET_COUNT_ANDNOT, count);
 }
 
 ZyanStatus ZyanBitsetAll(const ZyanBitset* bitset)
@@ -542,28 +2531,31 @@ ZyanStatus ZyanBitsetAll(const ZyanBitset* bitset)
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    ZyanUSize size;
-    ZYAN_CHECK(ZyanVectorGetSize(&bitset->bits, &size));
-    for (ZyanUSize i = 0; i < size; ++i)
+    const ZyanU8* const data = ZYAN_BITSET_DATA(bitset);
+    const ZyanUSize full = bitset->size / 8;
+
+    ZyanUSize i = 0;
+    for (; i + 8 <= full; i += 8)
     {
-        ZyanU8* value;
-        ZYAN_CHECK(ZyanVectorGetPointer(&bitset->bits, i, (const void**)&value));
-        if (i < (size - 1))
+        if (ZyanLoadU64(data + i) != ~(ZyanU64)0)
         {
-            if (*value != 0xFF)
-            {
-                return ZYAN_STATUS_FALSE;
-            }
-        } else
+            return ZYAN_STATUS_FALSE;
+        }
+    }
+    for (; i < full; ++i)
+    {
+        if (data[i] != 0xFF)
         {
-            const ZyanU8 mask = ~(8 - (bitset->size % 8));
-            if ((*value & mask) != mask)
-            {
-                return ZYAN_STATUS_FALSE;
-            }
+            return ZYAN_STATUS_FALSE;
         }
     }
 
+    const ZyanUSize used = bitset->size % 8;
+    if (used && (data[full] != ZyanBitsetMaskUpTo(bitset, used - 1)))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
     return ZYAN_STATUS_TRUE;
 }
 
@@ -574,25 +2566,23 @@ ZyanStatus ZyanBitsetAny(const ZyanBitset* bitset)
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    ZyanUSize size;
-    ZYAN_CHECK(ZyanVectorGetSize(&bitset->bits, &size));
-    for (ZyanUSize i = 0; i < size; ++i)
+    // The unused bits of the last byte are always cleared
+    const ZyanU8* const data = ZYAN_BITSET_DATA(bitset);
+    const ZyanUSize n = bitset->bits.size;
+
+    ZyanUSize i = 0;
+    for (; i + 8 <= n; i += 8)
     {
-        ZyanU8* value;
-        ZYAN_CHECK(ZyanVectorGetPointer(&bitset->bits, i, (const void**)&value));
-        if (i < (size - 1))
+        if (ZyanLoadU64(data + i))
         {
-            if (*value != 0x00)
-            {
-                return ZYAN_STATUS_TRUE;
-            }
-        } else
+            return ZYAN_STATUS_TRUE;
+        }
+    }
+    for (; i < n; ++i)
+    {
+        if (data[i])
         {
-            const ZyanU8 mask = ~(8 - (bitset->size % 8));
-            if ((*value & mask) != 0x00)
-            {
-                return ZYAN_STATUS_TRUE;
-            }
+            return ZYAN_STATUS_TRUE;
         }
     }
 
@@ -601,34 +2591,13 @@ ZyanStatus ZyanBitsetAny(const ZyanBitset* bitset)
 
 ZyanStatus ZyanBitsetNone(const ZyanBitset* bitset)
 {
-    if (!bitset)
-    {
-        return ZYAN_STATUS_INVALID_ARGUMENT;
-    }
-
-    ZyanUSize size;
-    ZYAN_CHECK(ZyanVectorGetSize(&bitset->bits, &size));
-    for (ZyanUSize i = 0; i < size; ++i)
+    const ZyanStatus status = ZyanBitsetAny(bitset);
+    if (!ZYAN_SUCCESS(status))
     {
-        ZyanU8* value;
-        ZYAN_CHECK(ZyanVectorGetPointer(&bitset->bits, i, (const void**)&value));
-        if (i < (size - 1))
-        {
-            if (*value != 0x00)
-            {
-                return ZYAN_STATUS_FALSE;
-            }
-        } else
-        {
-            const ZyanU8 mask = ~(8 - (bitset->size % 8));
-            if ((*value & mask) != 0x00)
-            {
-                return ZYAN_STATUS_FALSE;
-            }
-        }
+        return status;
     }
 
-    return ZYAN_STATUS_TRUE;
+    return (status == ZYAN_STATUS_TRUE) ? ZYAN_STATUS_FALSE : ZYAN_STATUS_TRUE;
 }
 
 /* ---------------------------------------------------------------------------------------------- */
@@ -665,6 +2634,196 @@ ZyanStatus ZyanBitsetNone(const ZyanBitset* bitset)
 //    return ZYAN_STATUS_SUCCESS;
 //}
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Rank and select                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanBitsetRankSelectInit(ZyanBitsetRankSelect* directory, const ZyanBitset* bitset)
+{
+    return ZyanBitsetRankSelectInitEx(directory, bitset, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanBitsetRankSelectInitEx(ZyanBitsetRankSelect* directory, const ZyanBitset* bitset,
+    ZyanAllocator* allocator)
+{
+    if (!directory || !bitset || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize block_bytes = ZYAN_BITSET_RANK_BLOCK_BITS / 8;
+    const ZyanUSize block_count = (bitset->bits.size + block_bytes - 1) / block_bytes;
+    const ZyanUSize superblock_count =
+        (block_count + ZYAN_BITSET_RANK_SUPERBLOCK_BLOCKS - 1) / ZYAN_BITSET_RANK_SUPERBLOCK_BLOCKS;
+
+    void* superblocks;
+    void* blocks;
+    ZYAN_CHECK(allocator->allocate(allocator, &superblocks, sizeof(ZyanU64),
+        ZYAN_MAX(1, superblock_count)));
+    ZyanStatus status = allocator->allocate(allocator, &blocks, sizeof(ZyanU16),
+        ZYAN_MAX(1, block_count));
+    if (!ZYAN_SUCCESS(status))
+    {
+        allocator->deallocate(allocator, superblocks, sizeof(ZyanU64),
+            ZYAN_MAX(1, superblock_count));
+        return status;
+    }
+
+    directory->allocator   = allocator;
+    directory->bitset      = bitset;
+    directory->block_count = block_count;
+    directory->superblocks = (ZyanU64*)superblocks;
+    directory->blocks      = (ZyanU16*)blocks;
+
+    // Count the set bits of every block
+    const ZyanU8* const data = ZYAN_BITSET_DATA(bitset);
+    ZyanUSize count = 0;
+    for (ZyanUSize i = 0; i < block_count; ++i)
+    {
+        if ((i % ZYAN_BITSET_RANK_SUPERBLOCK_BLOCKS) == 0)
+        {
+            directory->superblocks[i / ZYAN_BITSET_RANK_SUPERBLOCK_BLOCKS] = count;
+        }
+        directory->blocks[i] = (ZyanU16)(count -
+            directory->superblocks[i / ZYAN_BITSET_RANK_SUPERBLOCK_BLOCKS]);
+
+        const ZyanUSize offset = i * block_bytes;
+        const ZyanUSize n = ZYAN_MIN(block_bytes, bitset->bits.size - offset);
+        count += ZyanBitsetPopcount(ZYAN_BITSET_COUNT_A, data + offset, data + offset, n);
+    }
+    directory->count = count;
+
+    // Record the block of every `ZYAN_BITSET_SELECT_SAMPLE_RATE`-th set bit
+    const ZyanUSize sample_count =
+        (count + ZYAN_BITSET_SELECT_SAMPLE_RATE - 1) / ZYAN_BITSET_SELECT_SAMPLE_RATE;
+    void* samples;
+    status = allocator->allocate(allocator, &samples, sizeof(ZyanUSize),
+        ZYAN_MAX(1, sample_count));
+    if (!ZYAN_SUCCESS(status))
+    {
+        allocator->deallocate(allocator, blocks, sizeof(ZyanU16), ZYAN_MAX(1, block_count));
+        allocator->deallocate(allocator, superblocks, sizeof(ZyanU64),
+            ZYAN_MAX(1, superblock_count));
+        return status;
+    }
+    directory->sample_count = sample_count;
+    directory->samples      = (ZyanUSize*)samples;
+
+    ZyanUSize sample = 0;
+    for (ZyanUSize i = 0; (i < block_count) && (sample < sample_count); ++i)
+    {
+        const ZyanUSize end = (i + 1 < block_count) ? ZyanBitsetRankBlock(directory, i + 1) : count;
+        while ((sample < sample_count) && (sample * ZYAN_BITSET_SELECT_SAMPLE_RATE < end))
+        {
+            directory->samples[sample++] = i;
+        }
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBitsetRankSelectDestroy(ZyanBitsetRankSelect* directory)
+{
+    if (!directory)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanAllocator* const allocator = directory->allocator;
+    const ZyanUSize superblock_count = (directory->block_count +
+        ZYAN_BITSET_RANK_SUPERBLOCK_BLOCKS - 1) / ZYAN_BITSET_RANK_SUPERBLOCK_BLOCKS;
+    ZYAN_CHECK(allocator->deallocate(allocator, directory->samples, sizeof(ZyanUSize),
+        ZYAN_MAX(1, directory->sample_count)));
+    ZYAN_CHECK(allocator->deallocate(allocator, directory->blocks, sizeof(ZyanU16),
+        ZYAN_MAX(1, directory->block_count)));
+    ZYAN_CHECK(allocator->deallocate(allocator, directory->superblocks, sizeof(ZyanU64),
+        ZYAN_MAX(1, superblock_count)));
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBitsetRank(const ZyanBitsetRankSelect* directory, ZyanUSize index,
+    ZyanUSize* rank)
+{
+    if (!directory || !rank)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanBitset* const bitset = directory->bitset;
+    if (index >= bitset->size)
+    {
+        if (index > bitset->size)
+        {
+            return ZYAN_STATUS_OUT_OF_RANGE;
+        }
+        *rank = directory->count;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    const ZyanUSize block = index / ZYAN_BITSET_RANK_BLOCK_BITS;
+    ZyanUSize result = ZyanBitsetRankBlock(directory, block);
+    for (ZyanUSize w = block * (ZYAN_BITSET_RANK_BLOCK_BITS / 64); w < index / 64; ++w)
+    {
+        result += ZyanBitPopCount64(ZyanBitsetLoadWord(bitset, w * 8));
+    }
+    if (index % 64)
+    {
+        result += ZyanBitPopCount64(ZyanBitsetLoadWord(bitset, (index / 64) * 8) >>
+            (64 - index % 64));
+    }
+    *rank = result;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBitsetSelect(const ZyanBitsetRankSelect* directory, ZyanUSize k, ZyanUSize* index)
+{
+    if (!directory || !index)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (k >= directory->count)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    // The samples narrow the search down to the blocks between two consecutive samples
+    const ZyanUSize sample = k / ZYAN_BITSET_SELECT_SAMPLE_RATE;
+    ZyanUSize lo = directory->samples[sample];
+    ZyanUSize hi = (sample + 1 < directory->sample_count)
+        ? directory->samples[sample + 1] + 1
+        : directory->block_count;
+    while (hi - lo > 1)
+    {
+        const ZyanUSize mid = lo + (hi - lo) / 2;
+        if (ZyanBitsetRankBlock(directory, mid) <= k)
+        {
+            lo = mid;
+        } else
+        {
+            hi = mid;
+        }
+    }
+
+    k -= ZyanBitsetRankBlock(directory, lo);
+    for (ZyanUSize w = lo * (ZYAN_BITSET_RANK_BLOCK_BITS / 64);; ++w)
+    {
+        const ZyanU64 word = ZyanBitsetLoadWord(directory->bitset, w * 8);
+        const ZyanU8 count = ZyanBitPopCount64(word);
+        if (k < count)
+        {
+            *index = w * 64 + ZyanBitsetSelectInWord(word, k);
+            return ZYAN_STATUS_SUCCESS;
+        }
+        k -= count;
+    }
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
@@ -0,0 +1,410 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/BloomFilter.h>
+#include <Zycore/Hash.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * The alignment of the bit array in bytes (the size of a block).
+ */
+#define ZYAN_BLOOM_FILTER_ALIGNMENT (ZYAN_BLOOM_FILTER_BLOCK_BITS / 8)
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * The natural logarithm of `2`.
+ */
+#define ZYAN_BLOOM_FILTER_LN2       0.69314718055994530942
+
+#endif // ZYAN_NO_LIBC
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Returns the mask of the given bit within its byte (using the `ZyanBitset` bit order).
+ *
+ * @param   index   The bit index.
+ *
+ * @return  The mask of the given bit.
+ */
+#define ZYAN_BLOOM_FILTER_BIT_MASK(index) \
+    ((ZyanU8)(0x80 >> ((index) & 7)))
+
+/**
+ * Derives a second, independent looking 64-bit value from the given hash.
+ *
+ * @param   hash    The 64-bit hash.
+ *
+ * @return  The remixed value.
+ */
+#define ZYAN_BLOOM_FILTER_REMIX(hash) \
+    (((hash) ^ ((hash) >> 29)) * 0xBF58476D1CE4E5B9ULL)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Calculates the natural logarithm of `x`.
+ *
+ * @param   x   The value (must be greater than `0`).
+ *
+ * @return  The natural logarithm of `x`.
+ *
+ * This avoids a dependency on the math library, which is not available in all environments
+ * supported by this library. The precision is more than sufficient for sizing purposes.
+ */
+static double ZyanBloomFilterLog(double x)
+{
+    ZYAN_ASSERT(x > 0);
+
+    // Reduce `x` to the range `[1, 2)`
+    int exponent = 0;
+    while (x >= 2)
+    {
+        x /= 2;
+        ++exponent;
+    }
+    while (x < 1)
+    {
+        x *= 2;
+        --exponent;
+    }
+
+    // `ln(x) = 2 * atanh(t)` with `t = (x - 1) / (x + 1)` converges quickly for `t < 1/3`
+    const double t = (x - 1) / (x + 1);
+    const double t2 = t * t;
+    double term = t;
+    double sum = 0;
+    for (int i = 1; i < 40; i += 2)
+    {
+        sum += term / i;
+        term *= t2;
+    }
+
+    return exponent * ZYAN_BLOOM_FILTER_LN2 + 2 * sum;
+}
+
+#endif // ZYAN_NO_LIBC
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Sizing                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanBloomFilterCalculateSize(ZyanBloomFilterType type, ZyanUSize expected_items,
+    double false_positive_rate, ZyanUSize* bit_count, ZyanU8* hash_count)
+{
+    if (!expected_items || !(false_positive_rate > 0) || !(false_positive_rate < 1) ||
+        !bit_count || !hash_count ||
+        ((type != ZYAN_BLOOM_FILTER_STANDARD) && (type != ZYAN_BLOOM_FILTER_BLOCKED)))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const double bits_per_item = -ZyanBloomFilterLog(false_positive_rate) /
+        (ZYAN_BLOOM_FILTER_LN2 * ZYAN_BLOOM_FILTER_LN2);
+    const double bits = bits_per_item * (double)expected_items + 1;
+    if ((bits >= (double)(0xFFFFFFFF - ZYAN_BLOOM_FILTER_BLOCK_BITS / 8) * 8) ||
+        (bits >= (double)(ZyanUSize)~(ZyanUSize)0))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    ZyanUSize m = (ZyanUSize)bits;
+    if (type == ZYAN_BLOOM_FILTER_BLOCKED)
+    {
+        m = ZYAN_ALIGN_UP(m, ZYAN_BLOOM_FILTER_BLOCK_BITS);
+    }
+
+    ZyanUSize k = (ZyanUSize)(bits_per_item * ZYAN_BLOOM_FILTER_LN2 + 0.5);
+    k = ZYAN_MAX(k, 1);
+    k = ZYAN_MIN(k, ZYAN_BLOOM_FILTER_MAX_HASHES);
+
+    *bit_count = m;
+    *hash_count = (ZyanU8)k;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+#endif // ZYAN_NO_LIBC
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanBloomFilterInit(ZyanBloomFilter* filter, ZyanBloomFilterType type,
+    ZyanUSize bit_count, ZyanU8 hash_count)
+{
+    return ZyanBloomFilterInitEx(filter, type, bit_count, hash_count, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanBloomFilterInitEx(ZyanBloomFilter* filter, ZyanBloomFilterType type,
+    ZyanUSize bit_count, ZyanU8 hash_count, ZyanAllocator* allocator)
+{
+    if (!filter || !bit_count || !hash_count || (hash_count > ZYAN_BLOOM_FILTER_MAX_HASHES) ||
+        !allocator || ((type != ZYAN_BLOOM_FILTER_STANDARD) && (type != ZYAN_BLOOM_FILTER_BLOCKED)))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (bit_count / 8 >= 0xFFFFFFFF - ZYAN_BLOOM_FILTER_BLOCK_BITS / 8)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (type == ZYAN_BLOOM_FILTER_BLOCKED)
+    {
+        bit_count = ZYAN_ALIGN_UP(bit_count, ZYAN_BLOOM_FILTER_BLOCK_BITS);
+    }
+
+    filter->type       = type;
+    filter->hash_count = hash_count;
+    filter->bit_count  = bit_count;
+    filter->allocator  = allocator;
+
+    // The allocator does not guarantee cache line alignment, so the bit array is placed at the
+    // first aligned address of a slightly larger block. This keeps every block of a blocked filter
+    // within a single cache line
+    const ZyanUSize bytes = ZYAN_ALIGN_UP(bit_count, 8) / 8;
+    void* memory;
+    ZYAN_CHECK(allocator->allocate(allocator, &memory, 1, bytes + ZYAN_BLOOM_FILTER_ALIGNMENT));
+    void* const bits = (void*)ZYAN_ALIGN_UP((ZyanUPointer)memory, ZYAN_BLOOM_FILTER_ALIGNMENT);
+
+    const ZyanStatus status = ZyanBitsetInitBuffer(&filter->bits, bit_count, bits, bytes);
+    if (!ZYAN_SUCCESS(status))
+    {
+        allocator->deallocate(allocator, memory, 1, bytes + ZYAN_BLOOM_FILTER_ALIGNMENT);
+        return status;
+    }
+    filter->memory = memory;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBloomFilterDestroy(ZyanBloomFilter* filter)
+{
+    if (!filter)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanBitsetDestroy(&filter->bits));
+
+    const ZyanStatus status = filter->allocator->deallocate(filter->allocator, filter->memory, 1,
+        ZYAN_ALIGN_UP(filter->bit_count, 8) / 8 + ZYAN_BLOOM_FILTER_ALIGNMENT);
+    filter->memory = ZYAN_NULL;
+
+    return status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBloomFilterAdd(ZyanBloomFilter* filter, const void* data, ZyanUSize size)
+{
+    if (!data && size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanBloomFilterAddHash(filter, ZyanHash64(data, size, 0));
+}
+
+ZyanStatus ZyanBloomFilterAddHash(ZyanBloomFilter* filter, ZyanU64 hash)
+{
+    if (!filter)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU8* const bits = (ZyanU8*)filter->bits.bits.data;
+    const ZyanU64 remix = ZYAN_BLOOM_FILTER_REMIX(hash);
+
+    if (filter->type == ZYAN_BLOOM_FILTER_BLOCKED)
+    {
+        // Select the block using the upper half of the hash and derive the in-block positions
+        // from the top 9 bits of `h1 + i * h2`
+        const ZyanU64 block_count = filter->bit_count / ZYAN_BLOOM_FILTER_BLOCK_BITS;
+        ZyanU8* const block = bits + (ZyanUSize)(((hash >> 32) * block_count) >> 32) *
+            (ZYAN_BLOOM_FILTER_BLOCK_BITS / 8);
+        ZyanU32 h1 = (ZyanU32)remix;
+        const ZyanU32 h2 = (ZyanU32)(remix >> 32) | 1;
+        for (ZyanU8 i = 0; i < filter->hash_count; ++i)
+        {
+            const ZyanU32 position = h1 >> 23;
+            block[position >> 3] |= ZYAN_BLOOM_FILTER_BIT_MASK(position);
+            h1 += h2;
+        }
+    } else
+    {
+        // Kirsch-Mitzenmacher double hashing
+        const ZyanU64 h2 = remix | 1;
+        ZyanU64 h = hash;
+        for (ZyanU8 i = 0; i < filter->hash_count; ++i)
+        {
+            const ZyanUSize position = (ZyanUSize)(h % filter->bit_count);
+            bits[position >> 3] |= ZYAN_BLOOM_FILTER_BIT_MASK(position);
+            h += h2;
+        }
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBloomFilterUnion(ZyanBloomFilter* destination, const ZyanBloomFilter* source)
+{
+    if (!destination || !source)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if ((destination->type != source->type) ||
+        (destination->bit_count != source->bit_count) ||
+        (destination->hash_count != source->hash_count))
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
+    return ZyanBitsetOR(&destination->bits, &source->bits);
+}
+
+ZyanStatus ZyanBloomFilterClear(ZyanBloomFilter* filter)
+{
+    if (!filter)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanBitsetResetAll(&filter->bits);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBloomFilterContains(const ZyanBloomFilter* filter, const void* data,
+    ZyanUSize size)
+{
+    if (!data && size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanBloomFilterContainsHash(filter, ZyanHash64(data, size, 0));
+}
+
+ZyanStatus ZyanBloomFilterContainsHash(const ZyanBloomFilter* filter, ZyanU64 hash)
+{
+    if (!filter)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* const bits = (const ZyanU8*)filter->bits.bits.data;
+    const ZyanU64 remix = ZYAN_BLOOM_FILTER_REMIX(hash);
+
+    if (filter->type == ZYAN_BLOOM_FILTER_BLOCKED)
+    {
+        const ZyanU64 block_count = filter->bit_count / ZYAN_BLOOM_FILTER_BLOCK_BITS;
+        const ZyanU8* const block = bits + (ZyanUSize)(((hash >> 32) * block_count) >> 32) *
+            (ZYAN_BLOOM_FILTER_BLOCK_BITS / 8);
+        ZyanU32 h1 = (ZyanU32)remix;
+        const ZyanU32 h2 = (ZyanU32)(remix >> 32) | 1;
+        for (ZyanU8 i = 0; i < filter->hash_count; ++i)
+        {
+            const ZyanU32 position = h1 >> 23;
+            if (!(block[position >> 3] & ZYAN_BLOOM_FILTER_BIT_MASK(position)))
+            {
+                return ZYAN_STATUS_FALSE;
+            }
+            h1 += h2;
+        }
+    } else
+    {
+        const ZyanU64 h2 = remix | 1;
+        ZyanU64 h = hash;
+        for (ZyanU8 i = 0; i < filter->hash_count; ++i)
+        {
+            const ZyanUSize position = (ZyanUSize)(h % filter->bit_count);
+            if (!(bits[position >> 3] & ZYAN_BLOOM_FILTER_BIT_MASK(position)))
+            {
+                return ZYAN_STATUS_FALSE;
+            }
+            h += h2;
+        }
+    }
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanBloomFilterGetBitCount(const ZyanBloomFilter* filter, ZyanUSize* bit_count)
+{
+    if (!filter || !bit_count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *bit_count = filter->bit_count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanBloomFilterGetHashCount(const ZyanBloomFilter* filter, ZyanU8* hash_count)
+{
+    if (!filter || !hash_count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *hash_count = filter->hash_count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,170 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Internal/CPU.h>
+#include <Zycore/Atomic.h>
+
+#if !defined(ZYAN_KERNEL) && (defined(ZYAN_X64) || defined(ZYAN_X86))
+#   define ZYAN_CPU_X86
+#   if defined(ZYAN_MSVC)
+#       include <intrin.h>
+#   elif defined(ZYAN_GNUC)
+#       include <cpuid.h>
+#   else
+#       undef ZYAN_CPU_X86
+#   endif
+#endif
+
+/* ============================================================================================== */
+/* Internal variables                                                                             */
+/* ============================================================================================== */
+
+/**
+ * Signals that the features have been detected.
+ */
+#define ZYAN_CPU_FEATURES_VALID     0x80000000
+
+/**
+ * The cached feature flags.
+ *
+ * Concurrent first calls may detect the features more than once, but only the first result is
+ * stored (and all of them are equal).
+ */
+static ZyanAtomic32 g_features = { 0 };
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+#ifdef ZYAN_CPU_X86
+
+/**
+ * Executes the `CPUID` instruction.
+ *
+ * @param   leaf        The leaf.
+ * @param   subleaf     The sub-leaf.
+ * @param   registers   Receives the values of the `EAX`, `EBX`, `ECX` and `EDX` registers.
+ */
+static void ZyanCPUID(ZyanU32 leaf, ZyanU32 subleaf, ZyanU32 registers[4])
+{
+#if defined(ZYAN_MSVC)
+    int info[4];
+    __cpuidex(info, (int)leaf, (int)subleaf);
+    registers[0] = (ZyanU32)info[0];
+    registers[1] = (ZyanU32)info[1];
+    registers[2] = (ZyanU32)info[2];
+    registers[3] = (ZyanU32)info[3];
+#else
+    unsigned int eax, ebx, ecx, edx;
+    __cpuid_count(leaf, subleaf, eax, ebx, ecx, edx);
+    registers[0] = eax;
+    registers[1] = ebx;
+    registers[2] = ecx;
+    registers[3] = edx;
+#endif
+}
+
+/**
+ * Reads the `XCR0` register.
+ *
+ * @return  The value of the `XCR0` register.
+ */
+static ZyanU64 ZyanCPUReadXCR0(void)
+{
+#if defined(ZYAN_MSVC)
+    return _xgetbv(0);
+#else
+    ZyanU32 eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((ZyanU64)edx << 32) | eax;
+#endif
+}
+
+/**
+ * Detects the supported features.
+ *
+ * @return  A combination of `ZYAN_CPU_FEATURE_*` flags.
+ */
+static ZyanU32 ZyanCPUDetectFeatures(void)
+{
+    ZyanU32 registers[4];
+    ZyanCPUID(0, 0, registers);
+    const ZyanU32 max_leaf = registers[0];
+    if (max_leaf < 1)
+    {
+        return 0;
+    }
+
+    ZyanU32 features = 0;
+    ZyanCPUID(1, 0, registers);
+    if (registers[2] & (1u << 20))
+    {
+        features |= ZYAN_CPU_FEATURE_SSE42;
+    }
+    if (registers[2] & (1u << 23))
+    {
+        features |= ZYAN_CPU_FEATURE_POPCNT;
+    }
+
+    // AVX requires the OS to save the YMM registers on context switches (`OSXSAVE` and `AVX` set
+    // and XCR0 bits 1 and 2 enabled)
+    const ZyanBool os_avx = ((registers[2] & (3u << 27)) == (3u << 27)) &&
+        ((ZyanCPUReadXCR0() & 6) == 6);
+    if (os_avx && (max_leaf >= 7))
+    {
+        ZyanCPUID(7, 0, registers);
+        if (registers[1] & (1u << 5))
+        {
+            features |= ZYAN_CPU_FEATURE_AVX2;
+        }
+    }
+
+    return features;
+}
+
+#endif // ZYAN_CPU_X86
+
+/* ============================================================================================== */
+/* Functions                                                                                      */
+/* ============================================================================================== */
+
+ZyanU32 ZyanCPUGetFeatures(void)
+{
+    ZyanU32 features = ZyanAtomicCompareExchange32(&g_features, 0, 0);
+    if (!features)
+    {
+#ifdef ZYAN_CPU_X86
+        features = ZyanCPUDetectFeatures() | ZYAN_CPU_FEATURES_VALID;
+#else
+        features = ZYAN_CPU_FEATURES_VALID;
+#endif
+        ZyanAtomicCompareExchange32(&g_features, 0, features);
+    }
+
+    return features & ~ZYAN_CPU_FEATURES_VALID;
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,655 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Cache.h>
+#include <Zycore/Hash.h>
+#include <Zycore/LibC.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * Marks an empty index slot or the end of an entry list.
+ */
+#define ZYAN_CACHE_INVALID  0xFFFFFFFFu
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanCacheEntry` struct.
+ *
+ * The header of a single entry. The key and value follow at the offsets stored in the cache.
+ */
+typedef struct ZyanCacheEntry_
+{
+    /**
+     * The hash of the key.
+     */
+    ZyanU64 hash;
+    /**
+     * The weight of the entry.
+     */
+    ZyanUSize weight;
+    /**
+     * The previous (more recently used) entry.
+     */
+    ZyanU32 prev;
+    /**
+     * The next (less recently used) entry or the next unused entry.
+     */
+    ZyanU32 next;
+    /**
+     * Signals, if the entry is in use.
+     */
+    ZyanBool used;
+    /**
+     * The reference bit (CLOCK policy).
+     */
+    ZyanBool referenced;
+} ZyanCacheEntry;
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+#define ZYAN_CACHE_ENTRY(cache, index) \
+    ((ZyanCacheEntry*)((ZyanU8*)(cache)->entries + (ZyanUSize)(index) * (cache)->entry_size))
+
+#define ZYAN_CACHE_KEY(cache, entry) \
+    ((void*)((ZyanU8*)(entry) + (cache)->key_offset))
+
+#define ZYAN_CACHE_VALUE(cache, entry) \
+    ((void*)((ZyanU8*)(entry) + (cache)->value_offset))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the natural alignment for a key or value of the given size.
+ *
+ * @param   size    The size in bytes.
+ *
+ * @return  The alignment in bytes.
+ */
+static ZyanUSize ZyanCacheGetAlignment(ZyanUSize size)
+{
+    if (!size)
+    {
+        return 1;
+    }
+
+    const ZyanUSize alignment = size & (~size + 1);
+    return ZYAN_MIN(alignment, 8);
+}
+
+/**
+ * Calculates the hash of the given key.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   key     A pointer to the key.
+ *
+ * @return  The 64-bit hash.
+ */
+static ZyanU64 ZyanCacheHashKey(const ZyanCache* cache, const void* key)
+{
+    return cache->hash ? cache->hash(key) : ZyanHash64(key, cache->key_size, 0);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Index                                                                                          */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Searches the index for the given key.
+ *
+ * @param   cache       A pointer to the `ZyanCache` instance.
+ * @param   key         A pointer to the key.
+ * @param   hash        The hash of the key.
+ * @param   position    Receives the index slot of the entry or the empty index slot at which the
+ *                      entry would have to be inserted.
+ *
+ * @return  `ZYAN_TRUE` if the entry was found or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanCacheFind(const ZyanCache* cache, const void* key, ZyanU64 hash,
+    ZyanU32* position)
+{
+    ZyanU32 i = (ZyanU32)hash & cache->index_mask;
+    while (cache->index[i] != ZYAN_CACHE_INVALID)
+    {
+        const ZyanCacheEntry* const entry = ZYAN_CACHE_ENTRY(cache, cache->index[i]);
+        if (entry->hash == hash)
+        {
+            const void* const other = ZYAN_CACHE_KEY(cache, entry);
+            if (cache->equals ? cache->equals(other, key) :
+                !ZYAN_MEMCMP(other, key, cache->key_size))
+            {
+                *position = i;
+                return ZYAN_TRUE;
+            }
+        }
+        i = (i + 1) & cache->index_mask;
+    }
+
+    *position = i;
+    return ZYAN_FALSE;
+}
+
+/**
+ * Removes the entry at the given index slot from the index.
+ *
+ * @param   cache       A pointer to the `ZyanCache` instance.
+ * @param   position    The index slot.
+ *
+ * Subsequent entries of the same probe sequence are shifted backwards, so that no tombstones are
+ * required.
+ */
+static void ZyanCacheIndexRemove(ZyanCache* cache, ZyanU32 position)
+{
+    ZyanU32 i = position;
+    ZyanU32 j = position;
+    for (;;)
+    {
+        j = (j + 1) & cache->index_mask;
+        if (cache->index[j] == ZYAN_CACHE_INVALID)
+        {
+            break;
+        }
+
+        // Move the entry, unless its home slot lies cyclically within `(i, j]`
+        const ZyanU32 home =
+            (ZyanU32)ZYAN_CACHE_ENTRY(cache, cache->index[j])->hash & cache->index_mask;
+        if ((i <= j) ? ((i < home) && (home <= j)) : ((i < home) || (home <= j)))
+        {
+            continue;
+        }
+
+        cache->index[i] = cache->index[j];
+        i = j;
+    }
+
+    cache->index[i] = ZYAN_CACHE_INVALID;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Entry management                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Unlinks the given entry from the recency list.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   entry   A pointer to the entry.
+ */
+static void ZyanCacheUnlink(ZyanCache* cache, const ZyanCacheEntry* entry)
+{
+    if (entry->prev != ZYAN_CACHE_INVALID)
+    {
+        ZYAN_CACHE_ENTRY(cache, entry->prev)->next = entry->next;
+    } else
+    {
+        cache->head = entry->next;
+    }
+    if (entry->next != ZYAN_CACHE_INVALID)
+    {
+        ZYAN_CACHE_ENTRY(cache, entry->next)->prev = entry->prev;
+    } else
+    {
+        cache->tail = entry->prev;
+    }
+}
+
+/**
+ * Links the given entry at the front of the recency list.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   index   The index of the entry.
+ */
+static void ZyanCacheLinkFront(ZyanCache* cache, ZyanU32 index)
+{
+    ZyanCacheEntry* const entry = ZYAN_CACHE_ENTRY(cache, index);
+    entry->prev = ZYAN_CACHE_INVALID;
+    entry->next = cache->head;
+    if (cache->head != ZYAN_CACHE_INVALID)
+    {
+        ZYAN_CACHE_ENTRY(cache, cache->head)->prev = index;
+    } else
+    {
+        cache->tail = index;
+    }
+    cache->head = index;
+}
+
+/**
+ * Marks the given entry as used.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   index   The index of the entry.
+ */
+static void ZyanCacheTouch(ZyanCache* cache, ZyanU32 index)
+{
+    if (cache->policy == ZYAN_CACHE_POLICY_CLOCK)
+    {
+        ZYAN_CACHE_ENTRY(cache, index)->referenced = ZYAN_TRUE;
+        return;
+    }
+
+    if (cache->head != index)
+    {
+        ZyanCacheUnlink(cache, ZYAN_CACHE_ENTRY(cache, index));
+        ZyanCacheLinkFront(cache, index);
+    }
+}
+
+/**
+ * Removes the given entry from the cache.
+ *
+ * @param   cache       A pointer to the `ZyanCache` instance.
+ * @param   index       The index of the entry.
+ * @param   position    The index slot of the entry.
+ */
+static void ZyanCacheRelease(ZyanCache* cache, ZyanU32 index, ZyanU32 position)
+{
+    ZyanCacheEntry* const entry = ZYAN_CACHE_ENTRY(cache, index);
+    if (cache->callback)
+    {
+        cache->callback(ZYAN_CACHE_KEY(cache, entry), ZYAN_CACHE_VALUE(cache, entry),
+            entry->weight, cache->user_data);
+    }
+
+    ZyanCacheIndexRemove(cache, position);
+    if (cache->policy == ZYAN_CACHE_POLICY_LRU)
+    {
+        ZyanCacheUnlink(cache, entry);
+    }
+
+    cache->weight -= entry->weight;
+    --cache->size;
+    entry->used = ZYAN_FALSE;
+    entry->next = cache->free;
+    cache->free = index;
+}
+
+/**
+ * Evicts a single entry.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ * @param   protect The index of an entry that must not be evicted or `ZYAN_CACHE_INVALID`.
+ *
+ * The cache must contain at least one entry besides the protected one.
+ */
+static void ZyanCacheEvict(ZyanCache* cache, ZyanU32 protect)
+{
+    ZyanU32 victim;
+    if (cache->policy == ZYAN_CACHE_POLICY_LRU)
+    {
+        victim = cache->tail;
+        if (victim == protect)
+        {
+            victim = ZYAN_CACHE_ENTRY(cache, victim)->prev;
+        }
+    } else
+    {
+        // Give every referenced entry a second chance
+        for (;;)
+        {
+            victim = cache->hand;
+            cache->hand = (cache->hand + 1 == cache->max_entries) ? 0 : cache->hand + 1;
+
+            ZyanCacheEntry* const entry = ZYAN_CACHE_ENTRY(cache, victim);
+            if (!entry->used || (victim == protect))
+            {
+                continue;
+            }
+            if (entry->referenced)
+            {
+                entry->referenced = ZYAN_FALSE;
+                continue;
+            }
+            break;
+        }
+    }
+    ZYAN_ASSERT(victim != ZYAN_CACHE_INVALID);
+
+    // Locate the index slot of the victim
+    const ZyanCacheEntry* const entry = ZYAN_CACHE_ENTRY(cache, victim);
+    ZyanU32 position = (ZyanU32)entry->hash & cache->index_mask;
+    while (cache->index[position] != victim)
+    {
+        position = (position + 1) & cache->index_mask;
+    }
+
+    ZyanCacheRelease(cache, victim, position);
+}
+
+/**
+ * Resets the entry pool, the index and the recency list.
+ *
+ * @param   cache   A pointer to the `ZyanCache` instance.
+ */
+static void ZyanCacheReset(ZyanCache* cache)
+{
+    for (ZyanU32 i = 0; i < cache->max_entries; ++i)
+    {
+        ZyanCacheEntry* const entry = ZYAN_CACHE_ENTRY(cache, i);
+        entry->used = ZYAN_FALSE;
+        entry->next = (i + 1 < cache->max_entries) ? i + 1 : ZYAN_CACHE_INVALID;
+    }
+    ZYAN_MEMSET(cache->index, 0xFF, ((ZyanUSize)cache->index_mask + 1) * sizeof(ZyanU32));
+
+    cache->size   = 0;
+    cache->weight = 0;
+    cache->head   = ZYAN_CACHE_INVALID;
+    cache->tail   = ZYAN_CACHE_INVALID;
+    cache->free   = 0;
+    cache->hand   = 0;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanCacheInit(ZyanCache* cache, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanCachePolicy policy, ZyanU32 max_entries, ZyanUSize max_weight, ZyanHashFunction hash,
+    ZyanEqualityComparison equals)
+{
+    return ZyanCacheInitEx(cache, key_size, value_size, policy, max_entries, max_weight, hash,
+        equals, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanCacheInitEx(ZyanCache* cache, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanCachePolicy policy, ZyanU32 max_entries, ZyanUSize max_weight, ZyanHashFunction hash,
+    ZyanEqualityComparison equals, ZyanAllocator* allocator)
+{
+    if (!cache || !key_size || !max_entries || (max_entries > 0x7FFFFFFF) || !allocator ||
+        ((policy != ZYAN_CACHE_POLICY_LRU) && (policy != ZYAN_CACHE_POLICY_CLOCK)))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(allocator->allocate);
+    ZYAN_ASSERT(allocator->deallocate);
+
+    const ZyanUSize key_alignment = ZyanCacheGetAlignment(key_size);
+    const ZyanUSize value_alignment = ZyanCacheGetAlignment(value_size);
+
+    cache->allocator    = allocator;
+    cache->policy       = policy;
+    cache->key_size     = key_size;
+    cache->value_size   = value_size;
+    cache->key_offset   = ZYAN_ALIGN_UP(sizeof(ZyanCacheEntry), key_alignment);
+    cache->value_offset = ZYAN_ALIGN_UP(cache->key_offset + key_size, value_alignment);
+    cache->entry_size   = ZYAN_ALIGN_UP(cache->value_offset + value_size, 8);
+    cache->hash         = hash;
+    cache->equals       = equals;
+    cache->callback     = ZYAN_NULL;
+    cache->user_data    = ZYAN_NULL;
+    cache->max_entries  = max_entries;
+    cache->max_weight   = max_weight;
+
+    // Keep the load factor of the index at or below 50%
+    ZyanU32 index_size = 1;
+    while (index_size < 2 * max_entries)
+    {
+        index_size <<= 1;
+    }
+    cache->index_mask = index_size - 1;
+
+    ZYAN_CHECK(allocator->allocate(allocator, &cache->entries, cache->entry_size, max_entries));
+    void* index;
+    const ZyanStatus status = allocator->allocate(allocator, &index, sizeof(ZyanU32), index_size);
+    if (!ZYAN_SUCCESS(status))
+    {
+        allocator->deallocate(allocator, cache->entries, cache->entry_size, max_entries);
+        return status;
+    }
+    cache->index = (ZyanU32*)index;
+
+    ZyanCacheReset(cache);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanCacheDestroy(ZyanCache* cache)
+{
+    ZYAN_CHECK(ZyanCacheClear(cache));
+
+    ZYAN_CHECK(cache->allocator->deallocate(cache->allocator, cache->index, sizeof(ZyanU32),
+        (ZyanUSize)cache->index_mask + 1));
+
+    return cache->allocator->deallocate(cache->allocator, cache->entries, cache->entry_size,
+        cache->max_entries);
+}
+
+ZyanStatus ZyanCacheSetEvictionCallback(ZyanCache* cache, ZyanCacheEvictionCallback callback,
+    void* user_data)
+{
+    if (!cache)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    cache->callback  = callback;
+    cache->user_data = user_data;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCachePut(ZyanCache* cache, const void* key, const void* value, ZyanUSize weight)
+{
+    if (!cache || !key || (cache->value_size && !value) ||
+        (cache->max_weight && (weight > cache->max_weight)))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU64 hash = ZyanCacheHashKey(cache, key);
+    ZyanU32 position;
+    if (ZyanCacheFind(cache, key, hash, &position))
+    {
+        const ZyanU32 index = cache->index[position];
+        ZyanCacheEntry* const entry = ZYAN_CACHE_ENTRY(cache, index);
+        // The old value leaves the cache, so the owner gets a chance to release its resources
+        if (cache->callback)
+        {
+            cache->callback(ZYAN_CACHE_KEY(cache, entry), ZYAN_CACHE_VALUE(cache, entry),
+                entry->weight, cache->user_data);
+        }
+        ZYAN_MEMCPY(ZYAN_CACHE_VALUE(cache, entry), value, cache->value_size);
+        cache->weight = cache->weight - entry->weight + weight;
+        entry->weight = weight;
+        ZyanCacheTouch(cache, index);
+
+        while (cache->max_weight && (cache->weight > cache->max_weight))
+        {
+            ZyanCacheEvict(cache, index);
+        }
+        return ZYAN_STATUS_FALSE;
+    }
+
+    if ((cache->size == cache->max_entries) ||
+        (cache->max_weight && (cache->weight + weight > cache->max_weight)))
+    {
+        do
+        {
+            ZyanCacheEvict(cache, ZYAN_CACHE_INVALID);
+        } while (cache->max_weight && (cache->weight + weight > cache->max_weight));
+
+        // Evictions might have moved the empty index slot
+        ZyanCacheFind(cache, key, hash, &position);
+    }
+
+    const ZyanU32 index = cache->free;
+    ZyanCacheEntry* const entry = ZYAN_CACHE_ENTRY(cache, index);
+    cache->free = entry->next;
+
+    entry->hash       = hash;
+    entry->weight     = weight;
+    entry->used       = ZYAN_TRUE;
+    entry->referenced = ZYAN_FALSE;
+    ZYAN_MEMCPY(ZYAN_CACHE_KEY(cache, entry), key, cache->key_size);
+    ZYAN_MEMCPY(ZYAN_CACHE_VALUE(cache, entry), value, cache->value_size);
+    if (cache->policy == ZYAN_CACHE_POLICY_LRU)
+    {
+        ZyanCacheLinkFront(cache, index);
+    }
+
+    cache->index[position] = index;
+    cache->weight += weight;
+    ++cache->size;
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCacheRemove(ZyanCache* cache, const void* key)
+{
+    if (!cache || !key)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU32 position;
+    if (!ZyanCacheFind(cache, key, ZyanCacheHashKey(cache, key), &position))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZyanCacheRelease(cache, cache->index[position], position);
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanCacheClear(ZyanCache* cache)
+{
+    if (!cache)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (cache->callback)
+    {
+        for (ZyanU32 i = 0; i < cache->max_entries; ++i)
+        {
+            ZyanCacheEntry* const entry = ZYAN_CACHE_ENTRY(cache, i);
+            if (entry->used)
+            {
+                cache->callback(ZYAN_CACHE_KEY(cache, entry), ZYAN_CACHE_VALUE(cache, entry),
+                    entry->weight, cache->user_data);
+            }
+        }
+    }
+
+    ZyanCacheReset(cache);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCacheGet(ZyanCache* cache, const void* key, const void** value)
+{
+    return ZyanCacheGetMutable(cache, key, (void**)value);
+}
+
+ZyanStatus ZyanCacheGetMutable(ZyanCache* cache, const void* key, void** value)
+{
+    if (!cache || !key || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU32 position;
+    if (!ZyanCacheFind(cache, key, ZyanCacheHashKey(cache, key), &position))
+    {
+        *value = ZYAN_NULL;
+        return ZYAN_STATUS_FALSE;
+    }
+
+    const ZyanU32 index = cache->index[position];
+    ZyanCacheTouch(cache, index);
+    *value = ZYAN_CACHE_VALUE(cache, ZYAN_CACHE_ENTRY(cache, index));
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCacheGetSize(const ZyanCache* cache, ZyanUSize* size)
+{
+    if (!cache || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = cache->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanCacheGetWeight(const ZyanCache* cache, ZyanUSize* weight)
+{
+    if (!cache || !weight)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *weight = cache->weight;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
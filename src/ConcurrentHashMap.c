@@ -0,0 +1,358 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/ConcurrentHashMap.h>
+#include <Zycore/Hash.h>
+#include <Zycore/LibC.h>
+
+#ifndef ZYAN_NO_LIBC
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * The assumed size of a cache line. Shards are placed at multiples of this size to prevent false
+ * sharing between the locks of neighboring shards.
+ */
+#define ZYAN_CONCURRENT_HASHMAP_CACHE_LINE_SIZE 64
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Returns a pointer to the shard at the given `index`.
+ */
+#define ZYAN_CONCURRENT_HASHMAP_SHARD(map, index) \
+    ((ZyanConcurrentHashMapShard*)((map)->shards + (index) * (map)->shard_stride))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/**
+ * Returns the shard responsible for the given key.
+ *
+ * @param   map A pointer to the `ZyanConcurrentHashMap` instance.
+ * @param   key A pointer to the key.
+ *
+ * @return  A pointer to the shard.
+ */
+static ZyanConcurrentHashMapShard* ZyanConcurrentHashMapGetShard(const ZyanConcurrentHashMap* map,
+    const void* key)
+{
+    const ZyanU64 hash = map->hash ? map->hash(key) : ZyanHash64(key, map->key_size, 0);
+
+    // The shard maps use the lower bits of the hash, so the shard is selected by the upper bits.
+    // Many user supplied hash functions only produce 32-bit values, so the hash is mixed first to
+    // spread it over all 64 bits. The shift is split to stay defined for a single shard
+    const ZyanU64 mixed = ZyanHashMix64(hash);
+    const ZyanUSize index = (ZyanUSize)((mixed >> 32) >> (32 - map->shard_bits));
+    return ZYAN_CONCURRENT_HASHMAP_SHARD(map, index);
+}
+
+/**
+ * Destroys the first `count` shards of the given map and frees the shard memory.
+ *
+ * @param   map     A pointer to the `ZyanConcurrentHashMap` instance.
+ * @param   count   The number of initialized shards.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanConcurrentHashMapFreeShards(ZyanConcurrentHashMap* map, ZyanUSize count)
+{
+    ZyanStatus result = ZYAN_STATUS_SUCCESS;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        ZyanConcurrentHashMapShard* const shard = ZYAN_CONCURRENT_HASHMAP_SHARD(map, i);
+        const ZyanStatus map_status = ZyanHashMapDestroy(&shard->map);
+        const ZyanStatus lock_status = ZyanReadWriteLockDelete(&shard->lock);
+        if (ZYAN_SUCCESS(result))
+        {
+            result = !ZYAN_SUCCESS(map_status) ? map_status : lock_status;
+        }
+    }
+
+    const ZyanStatus status = map->allocator->deallocate(map->allocator, map->memory, 1,
+        map->shard_count * map->shard_stride + ZYAN_CONCURRENT_HASHMAP_CACHE_LINE_SIZE);
+    map->memory = ZYAN_NULL;
+    map->shards = ZYAN_NULL;
+
+    return ZYAN_SUCCESS(result) ? status : result;
+}
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanConcurrentHashMapInit(ZyanConcurrentHashMap* map, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanUSize shard_count, ZyanHashFunction hash,
+    ZyanEqualityComparison equals)
+{
+    return ZyanConcurrentHashMapInitEx(map, key_size, value_size, shard_count, hash, equals,
+        ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanConcurrentHashMapInitEx(ZyanConcurrentHashMap* map, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanUSize shard_count, ZyanHashFunction hash,
+    ZyanEqualityComparison equals, ZyanAllocator* allocator)
+{
+    if (!map || !key_size || !allocator ||
+        (shard_count > ZYAN_CONCURRENT_HASHMAP_MAX_SHARD_COUNT))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (!shard_count)
+    {
+        shard_count = ZYAN_CONCURRENT_HASHMAP_DEFAULT_SHARD_COUNT;
+    }
+    ZyanU8 shard_bits = 0;
+    while (((ZyanUSize)1 << shard_bits) < shard_count)
+    {
+        ++shard_bits;
+    }
+
+    map->allocator    = allocator;
+    map->key_size     = key_size;
+    map->value_size   = value_size;
+    map->hash         = hash;
+    map->shard_count  = (ZyanUSize)1 << shard_bits;
+    map->shard_bits   = shard_bits;
+    map->shard_stride = ZYAN_ALIGN_UP(sizeof(ZyanConcurrentHashMapShard),
+        ZYAN_CONCURRENT_HASHMAP_CACHE_LINE_SIZE);
+
+    // The allocator does not guarantee cache line alignment, so the shards are placed at the first
+    // aligned address of a slightly larger block
+    void* memory;
+    ZYAN_CHECK(allocator->allocate(allocator, &memory, 1,
+        map->shard_count * map->shard_stride + ZYAN_CONCURRENT_HASHMAP_CACHE_LINE_SIZE));
+    map->memory = memory;
+    map->shards = (ZyanU8*)ZYAN_ALIGN_UP((ZyanUPointer)memory,
+        ZYAN_CONCURRENT_HASHMAP_CACHE_LINE_SIZE);
+
+    for (ZyanUSize i = 0; i < map->shard_count; ++i)
+    {
+        ZyanConcurrentHashMapShard* const shard = ZYAN_CONCURRENT_HASHMAP_SHARD(map, i);
+        ZyanStatus status = ZyanReadWriteLockInitialize(&shard->lock);
+        if (ZYAN_SUCCESS(status))
+        {
+            status = ZyanHashMapInitEx(&shard->map, key_size, value_size, 0, hash, equals,
+                allocator);
+            if (!ZYAN_SUCCESS(status))
+            {
+                ZyanReadWriteLockDelete(&shard->lock);
+            }
+        }
+        if (!ZYAN_SUCCESS(status))
+        {
+            ZyanConcurrentHashMapFreeShards(map, i);
+            return status;
+        }
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanConcurrentHashMapDestroy(ZyanConcurrentHashMap* map)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanConcurrentHashMapFreeShards(map, map->shard_count);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanConcurrentHashMapInsert(ZyanConcurrentHashMap* map, const void* key,
+    const void* value)
+{
+    if (!map || !key)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanConcurrentHashMapShard* const shard = ZyanConcurrentHashMapGetShard(map, key);
+    ZYAN_CHECK(ZyanReadWriteLockAcquireExclusive(&shard->lock));
+    const ZyanStatus status = ZyanHashMapInsert(&shard->map, key, value);
+    ZYAN_CHECK(ZyanReadWriteLockReleaseExclusive(&shard->lock));
+
+    return status;
+}
+
+ZyanStatus ZyanConcurrentHashMapTryInsert(ZyanConcurrentHashMap* map, const void* key,
+    const void* value, void* current)
+{
+    if (!map || !key)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanConcurrentHashMapShard* const shard = ZyanConcurrentHashMapGetShard(map, key);
+    ZYAN_CHECK(ZyanReadWriteLockAcquireExclusive(&shard->lock));
+    const void* existing;
+    ZyanStatus status = ZyanHashMapGet(&shard->map, key, &existing);
+    if (status == ZYAN_STATUS_TRUE)
+    {
+        if (current && map->value_size)
+        {
+            ZYAN_MEMCPY(current, existing, map->value_size);
+        }
+        status = ZYAN_STATUS_FALSE;
+    } else if (status == ZYAN_STATUS_FALSE)
+    {
+        status = ZyanHashMapInsert(&shard->map, key, value);
+    }
+    ZYAN_CHECK(ZyanReadWriteLockReleaseExclusive(&shard->lock));
+
+    return status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanConcurrentHashMapRemove(ZyanConcurrentHashMap* map, const void* key)
+{
+    if (!map || !key)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanConcurrentHashMapShard* const shard = ZyanConcurrentHashMapGetShard(map, key);
+    ZYAN_CHECK(ZyanReadWriteLockAcquireExclusive(&shard->lock));
+    const ZyanStatus status = ZyanHashMapRemove(&shard->map, key);
+    ZYAN_CHECK(ZyanReadWriteLockReleaseExclusive(&shard->lock));
+
+    return status;
+}
+
+ZyanStatus ZyanConcurrentHashMapClear(ZyanConcurrentHashMap* map)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    for (ZyanUSize i = 0; i < map->shard_count; ++i)
+    {
+        ZyanConcurrentHashMapShard* const shard = ZYAN_CONCURRENT_HASHMAP_SHARD(map, i);
+        ZYAN_CHECK(ZyanReadWriteLockAcquireExclusive(&shard->lock));
+        const ZyanStatus status = ZyanHashMapClear(&shard->map);
+        ZYAN_CHECK(ZyanReadWriteLockReleaseExclusive(&shard->lock));
+        ZYAN_CHECK(status);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanConcurrentHashMapGet(ZyanConcurrentHashMap* map, const void* key, void* value)
+{
+    if (!map || !key)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanConcurrentHashMapShard* const shard = ZyanConcurrentHashMapGetShard(map, key);
+    ZYAN_CHECK(ZyanReadWriteLockAcquireShared(&shard->lock));
+    const void* existing;
+    const ZyanStatus status = ZyanHashMapGet(&shard->map, key, &existing);
+    if ((status == ZYAN_STATUS_TRUE) && value && map->value_size)
+    {
+        ZYAN_MEMCPY(value, existing, map->value_size);
+    }
+    ZYAN_CHECK(ZyanReadWriteLockReleaseShared(&shard->lock));
+
+    return status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanConcurrentHashMapReserve(ZyanConcurrentHashMap* map, ZyanUSize count)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // Leave some headroom for the uneven distribution of the keys
+    const ZyanUSize per_shard = count / map->shard_count + count / (map->shard_count * 8) + 1;
+    for (ZyanUSize i = 0; i < map->shard_count; ++i)
+    {
+        ZyanConcurrentHashMapShard* const shard = ZYAN_CONCURRENT_HASHMAP_SHARD(map, i);
+        ZYAN_CHECK(ZyanReadWriteLockAcquireExclusive(&shard->lock));
+        const ZyanStatus status = ZyanHashMapReserve(&shard->map, per_shard);
+        ZYAN_CHECK(ZyanReadWriteLockReleaseExclusive(&shard->lock));
+        ZYAN_CHECK(status);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanConcurrentHashMapGetSize(ZyanConcurrentHashMap* map, ZyanUSize* size)
+{
+    if (!map || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize result = 0;
+    for (ZyanUSize i = 0; i < map->shard_count; ++i)
+    {
+        ZyanConcurrentHashMapShard* const shard = ZYAN_CONCURRENT_HASHMAP_SHARD(map, i);
+        ZYAN_CHECK(ZyanReadWriteLockAcquireShared(&shard->lock));
+        result += shard->map.size;
+        ZYAN_CHECK(ZyanReadWriteLockReleaseShared(&shard->lock));
+    }
+    *size = result;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYAN_NO_LIBC */
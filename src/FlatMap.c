@@ -0,0 +1,658 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/FlatMap.h>
+#include <Zycore/LibC.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * The length of the runs that are sorted using insertion sort before merging.
+ */
+#define ZYAN_FLATMAP_SORT_RUN_LENGTH    16
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Returns a pointer to the entry at the given `index` of the given entry array.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   base    A pointer to the first entry.
+ * @param   index   The entry index.
+ *
+ * @return  A pointer to the entry at the given `index`.
+ */
+#define ZYAN_FLATMAP_ENTRY(map, base, index) \
+    ((ZyanU8*)(base) + (index) * (map)->entries.element_size)
+
+/**
+ * Returns a pointer to the value of the given entry.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   entry   A pointer to the entry.
+ *
+ * @return  A pointer to the value of the given entry.
+ */
+#define ZYAN_FLATMAP_VALUE(map, entry) \
+    ((ZyanU8*)(entry) + (map)->value_offset)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the natural alignment for an object of the given `size`.
+ *
+ * @param   size    The object size.
+ *
+ * @return  The alignment (the lowest set bit of `size`, limited to `8`).
+ */
+static ZyanUSize ZyanFlatMapGetAlignment(ZyanUSize size)
+{
+    if (!size)
+    {
+        return 1;
+    }
+
+    const ZyanUSize alignment = size & (~size + 1);
+    return ZYAN_MIN(alignment, 8);
+}
+
+/**
+ * Writes the given key and value to the entry pointed to by `entry`.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   entry   A pointer to the entry.
+ * @param   key     A pointer to the key.
+ * @param   value   A pointer to the value or `ZYAN_NULL`.
+ */
+static void ZyanFlatMapWriteEntry(const ZyanFlatMap* map, void* entry, const void* key,
+    const void* value)
+{
+    ZYAN_MEMCPY(entry, key, map->key_size);
+    if (map->value_size)
+    {
+        ZYAN_MEMCPY(ZYAN_FLATMAP_VALUE(map, entry), value, map->value_size);
+    }
+}
+
+/**
+ * Searches for the first entry with a key that is not less (or, if `upper` is set, greater)
+ * than the given `key`.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   upper   `ZYAN_TRUE` to search for the upper bound instead of the lower bound.
+ * @param   found   Receives `ZYAN_TRUE`, if an entry with a key equal to `key` was encountered.
+ *
+ * @return  The index of the entry or the size of the map, if there is no such entry.
+ */
+static ZyanUSize ZyanFlatMapSearch(const ZyanFlatMap* map, const void* key, ZyanBool upper,
+    ZyanBool* found)
+{
+    ZYAN_ASSERT(map);
+    ZYAN_ASSERT(key);
+    ZYAN_ASSERT(found);
+
+    *found = ZYAN_FALSE;
+
+    ZyanUSize l = 0;
+    ZyanUSize h = map->entries.size;
+    while (l < h)
+    {
+        const ZyanUSize mid = l + ((h - l) >> 1);
+        const ZyanI32 cmp = map->compare(ZYAN_FLATMAP_ENTRY(map, map->entries.data, mid), key);
+        if (cmp == 0)
+        {
+            *found = ZYAN_TRUE;
+        }
+        if ((cmp < 0) || (upper && (cmp == 0)))
+        {
+            l = mid + 1;
+        } else
+        {
+            h = mid;
+        }
+    }
+
+    return l;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Sorting                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Sorts the given entry range using a stable insertion sort.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   base    A pointer to the first entry.
+ * @param   count   The number of entries.
+ * @param   temp    A pointer to a temporary buffer that is able to hold a single entry.
+ */
+static void ZyanFlatMapInsertionSort(const ZyanFlatMap* map, ZyanU8* base, ZyanUSize count,
+    void* temp)
+{
+    const ZyanUSize entry_size = map->entries.element_size;
+
+    for (ZyanUSize i = 1; i < count; ++i)
+    {
+        ZyanU8* const current = ZYAN_FLATMAP_ENTRY(map, base, i);
+        ZyanUSize j = i;
+        while ((j > 0) && (map->compare(ZYAN_FLATMAP_ENTRY(map, base, j - 1), current) > 0))
+        {
+            --j;
+        }
+        if (j == i)
+        {
+            continue;
+        }
+
+        ZyanU8* const dest = ZYAN_FLATMAP_ENTRY(map, base, j);
+        ZYAN_MEMCPY(temp, current, entry_size);
+        ZYAN_MEMMOVE(dest + entry_size, dest, (i - j) * entry_size);
+        ZYAN_MEMCPY(dest, temp, entry_size);
+    }
+}
+
+/**
+ * Merges two adjacent sorted entry ranges into the given destination buffer.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   source  A pointer to the first entry of the first range.
+ * @param   mid     The number of entries in the first range.
+ * @param   count   The total number of entries in both ranges.
+ * @param   dest    A pointer to the destination buffer.
+ *
+ * Entries of the first range precede equal entries of the second range, which makes the merge
+ * stable.
+ */
+static void ZyanFlatMapMergeRuns(const ZyanFlatMap* map, const ZyanU8* source, ZyanUSize mid,
+    ZyanUSize count, ZyanU8* dest)
+{
+    const ZyanUSize entry_size = map->entries.element_size;
+
+    ZyanUSize i = 0;
+    ZyanUSize j = mid;
+    while ((i < mid) && (j < count))
+    {
+        const ZyanU8* const lhs = ZYAN_FLATMAP_ENTRY(map, source, i);
+        const ZyanU8* const rhs = ZYAN_FLATMAP_ENTRY(map, source, j);
+        if (map->compare(rhs, lhs) < 0)
+        {
+            ZYAN_MEMCPY(dest, rhs, entry_size);
+            ++j;
+        } else
+        {
+            ZYAN_MEMCPY(dest, lhs, entry_size);
+            ++i;
+        }
+        dest += entry_size;
+    }
+
+    if (i < mid)
+    {
+        ZYAN_MEMCPY(dest, ZYAN_FLATMAP_ENTRY(map, source, i), (mid - i) * entry_size);
+    }
+    if (j < count)
+    {
+        ZYAN_MEMCPY(dest, ZYAN_FLATMAP_ENTRY(map, source, j), (count - j) * entry_size);
+    }
+}
+
+/**
+ * Sorts the given entry range using a stable bottom-up merge sort.
+ *
+ * @param   map     A pointer to the `ZyanFlatMap` instance.
+ * @param   base    A pointer to the first entry of the range to sort.
+ * @param   scratch A pointer to a scratch buffer that is able to hold `count` entries.
+ * @param   count   The number of entries.
+ *
+ * @return  A pointer to the buffer that contains the sorted entries (either `base` or
+ *          `scratch`).
+ */
+static ZyanU8* ZyanFlatMapSort(const ZyanFlatMap* map, ZyanU8* base, ZyanU8* scratch,
+    ZyanUSize count)
+{
+    for (ZyanUSize i = 0; i < count; i += ZYAN_FLATMAP_SORT_RUN_LENGTH)
+    {
+        ZyanFlatMapInsertionSort(map, ZYAN_FLATMAP_ENTRY(map, base, i),
+            ZYAN_MIN(ZYAN_FLATMAP_SORT_RUN_LENGTH, count - i), scratch);
+    }
+
+    ZyanU8* source = base;
+    ZyanU8* dest = scratch;
+    for (ZyanUSize width = ZYAN_FLATMAP_SORT_RUN_LENGTH; width < count; width *= 2)
+    {
+        for (ZyanUSize i = 0; i < count; i += 2 * width)
+        {
+            const ZyanUSize n = ZYAN_MIN(2 * width, count - i);
+            ZyanFlatMapMergeRuns(map, ZYAN_FLATMAP_ENTRY(map, source, i), ZYAN_MIN(width, n), n,
+                ZYAN_FLATMAP_ENTRY(map, dest, i));
+        }
+
+        ZyanU8* const temp = source;
+        source = dest;
+        dest = temp;
+    }
+
+    return source;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanFlatMapInit(ZyanFlatMap* map, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanComparison compare, ZyanUSize capacity)
+{
+    return ZyanFlatMapInitEx(map, key_size, value_size, compare, capacity,
+        ZyanAllocatorDefault(), ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR,
+        ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD);
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanFlatMapInitEx(ZyanFlatMap* map, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanComparison compare, ZyanUSize capacity, ZyanAllocator* allocator, ZyanU8 growth_factor,
+    ZyanU8 shrink_threshold)
+{
+    if (!map || !key_size || !compare)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize key_alignment = ZyanFlatMapGetAlignment(key_size);
+    const ZyanUSize value_alignment = ZyanFlatMapGetAlignment(value_size);
+    const ZyanUSize value_offset = ZYAN_ALIGN_UP(key_size, value_alignment);
+    const ZyanUSize entry_size = ZYAN_ALIGN_UP(value_offset + value_size,
+        ZYAN_MAX(key_alignment, value_alignment));
+
+    map->key_size     = key_size;
+    map->value_size   = value_size;
+    map->value_offset = value_offset;
+    map->compare      = compare;
+
+    return ZyanVectorInitEx(&map->entries, entry_size, capacity, ZYAN_NULL, allocator,
+        growth_factor, shrink_threshold);
+}
+
+ZyanStatus ZyanFlatMapDestroy(ZyanFlatMap* map)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorDestroy(&map->entries);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanFlatMapInsert(ZyanFlatMap* map, const void* key, const void* value)
+{
+    if (!map || !key || (map->value_size && !value))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanBool found;
+    const ZyanUSize index = ZyanFlatMapSearch(map, key, ZYAN_FALSE, &found);
+
+    if (found)
+    {
+        if (map->value_size)
+        {
+            ZYAN_MEMCPY(ZYAN_FLATMAP_VALUE(map,
+                ZYAN_FLATMAP_ENTRY(map, map->entries.data, index)), value, map->value_size);
+        }
+        return ZYAN_STATUS_FALSE;
+    }
+
+    void* entry;
+    ZYAN_CHECK(ZyanVectorEmplaceEx(&map->entries, index, &entry, ZYAN_NULL));
+    ZyanFlatMapWriteEntry(map, entry, key, value);
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanFlatMapInsertBulk(ZyanFlatMap* map, const void* keys, const void* values,
+    ZyanUSize count)
+{
+    if (!map || (count && (!keys || (map->value_size && !values))))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (!count)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    const ZyanUSize size = map->entries.size;
+    if (count > ((ZyanUSize)-1 - size) / 2)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // The entry buffer is split into three regions:
+    // [0, size)                          existing entries
+    // [size, size + count)               scratch area for the merge sort
+    // [size + count, size + 2 * count)   the new entries
+    ZYAN_CHECK(ZyanVectorReserve(&map->entries, size + 2 * count));
+
+    const ZyanUSize entry_size = map->entries.element_size;
+    ZyanU8* const data = (ZyanU8*)map->entries.data;
+    ZyanU8* const scratch = ZYAN_FLATMAP_ENTRY(map, data, size);
+    ZyanU8* const batch = ZYAN_FLATMAP_ENTRY(map, data, size + count);
+
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        ZyanFlatMapWriteEntry(map, ZYAN_FLATMAP_ENTRY(map, batch, i),
+            (const ZyanU8*)keys + i * map->key_size,
+            map->value_size ? (const ZyanU8*)values + i * map->value_size : ZYAN_NULL);
+    }
+
+    // Sort the new entries and move them back into the batch region while removing duplicates.
+    // The sort is stable, so keeping the last entry of each run of equal keys keeps the entry
+    // that was passed last
+    const ZyanU8* const sorted = ZyanFlatMapSort(map, batch, scratch, count);
+    ZyanUSize unique = 0;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        const ZyanU8* const entry = ZYAN_FLATMAP_ENTRY(map, sorted, i);
+        if ((i + 1 < count) &&
+            (map->compare(entry, ZYAN_FLATMAP_ENTRY(map, sorted, i + 1)) == 0))
+        {
+            continue;
+        }
+        ZyanU8* const dest = ZYAN_FLATMAP_ENTRY(map, batch, unique++);
+        if (dest != entry)
+        {
+            ZYAN_MEMMOVE(dest, entry, entry_size);
+        }
+    }
+
+    // Merge backwards into [0, size + unique). The write position never overtakes the unread
+    // existing entries. Every key that is already present in the map leaves a gap of one entry
+    // which is closed after the merge
+    ZyanUSize i = size;
+    ZyanUSize j = unique;
+    ZyanUSize w = size + unique;
+    while (j > 0)
+    {
+        const ZyanU8* const rhs = ZYAN_FLATMAP_ENTRY(map, batch, j - 1);
+        ZyanI32 cmp = -1;
+        if (i > 0)
+        {
+            cmp = map->compare(ZYAN_FLATMAP_ENTRY(map, data, i - 1), rhs);
+        }
+
+        --w;
+        if (cmp > 0)
+        {
+            --i;
+            ZYAN_MEMCPY(ZYAN_FLATMAP_ENTRY(map, data, w), ZYAN_FLATMAP_ENTRY(map, data, i),
+                entry_size);
+            continue;
+        }
+        if (cmp == 0)
+        {
+            --i;
+        }
+        --j;
+        ZYAN_MEMCPY(ZYAN_FLATMAP_ENTRY(map, data, w), rhs, entry_size);
+    }
+
+    const ZyanUSize end = size + unique;
+    if (w > i)
+    {
+        ZYAN_MEMMOVE(ZYAN_FLATMAP_ENTRY(map, data, i), ZYAN_FLATMAP_ENTRY(map, data, w),
+            (end - w) * entry_size);
+    }
+    map->entries.size = end - (w - i);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanFlatMapRemove(ZyanFlatMap* map, const void* key)
+{
+    if (!map || !key)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanBool found;
+    const ZyanUSize index = ZyanFlatMapSearch(map, key, ZYAN_FALSE, &found);
+    if (!found)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZYAN_CHECK(ZyanVectorDelete(&map->entries, index));
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanFlatMapRemoveRange(ZyanFlatMap* map, ZyanUSize index, ZyanUSize count)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (!count)
+    {
+        return (index > map->entries.size) ? ZYAN_STATUS_OUT_OF_RANGE : ZYAN_STATUS_SUCCESS;
+    }
+
+    return ZyanVectorDeleteRange(&map->entries, index, count);
+}
+
+ZyanStatus ZyanFlatMapClear(ZyanFlatMap* map)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorClear(&map->entries);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanFlatMapFind(const ZyanFlatMap* map, const void* key, ZyanUSize* found_index)
+{
+    if (!map || !key || !found_index)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanBool found;
+    *found_index = ZyanFlatMapSearch(map, key, ZYAN_FALSE, &found);
+
+    return found ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanFlatMapGet(const ZyanFlatMap* map, const void* key, const void** value)
+{
+    return ZyanFlatMapGetMutable((ZyanFlatMap*)map, key, (void**)value);
+}
+
+ZyanStatus ZyanFlatMapGetMutable(ZyanFlatMap* map, const void* key, void** value)
+{
+    if (!map || !key || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanBool found;
+    const ZyanUSize index = ZyanFlatMapSearch(map, key, ZYAN_FALSE, &found);
+    if (!found)
+    {
+        *value = ZYAN_NULL;
+        return ZYAN_STATUS_FALSE;
+    }
+
+    *value = ZYAN_FLATMAP_VALUE(map, ZYAN_FLATMAP_ENTRY(map, map->entries.data, index));
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanFlatMapLowerBound(const ZyanFlatMap* map, const void* key, ZyanUSize* index)
+{
+    if (!map || !key || !index)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanBool found;
+    *index = ZyanFlatMapSearch(map, key, ZYAN_FALSE, &found);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanFlatMapUpperBound(const ZyanFlatMap* map, const void* key, ZyanUSize* index)
+{
+    if (!map || !key || !index)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanBool found;
+    *index = ZyanFlatMapSearch(map, key, ZYAN_TRUE, &found);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanFlatMapGetEntry(const ZyanFlatMap* map, ZyanUSize index, const void** key,
+    const void** value)
+{
+    return ZyanFlatMapGetEntryMutable((ZyanFlatMap*)map, index, key, (void**)value);
+}
+
+ZyanStatus ZyanFlatMapGetEntryMutable(ZyanFlatMap* map, ZyanUSize index, const void** key,
+    void** value)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= map->entries.size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    ZyanU8* const entry = ZYAN_FLATMAP_ENTRY(map, map->entries.data, index);
+    if (key)
+    {
+        *key = entry;
+    }
+    if (value)
+    {
+        *value = map->value_size ? ZYAN_FLATMAP_VALUE(map, entry) : ZYAN_NULL;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanFlatMapReserve(ZyanFlatMap* map, ZyanUSize capacity)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorReserve(&map->entries, capacity);
+}
+
+ZyanStatus ZyanFlatMapShrinkToFit(ZyanFlatMap* map)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorShrinkToFit(&map->entries);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanFlatMapGetSize(const ZyanFlatMap* map, ZyanUSize* size)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorGetSize(&map->entries, size);
+}
+
+ZyanStatus ZyanFlatMapGetCapacity(const ZyanFlatMap* map, ZyanUSize* capacity)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorGetCapacity(&map->entries, capacity);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,795 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Hash.h>
+#include <Zycore/HashMap.h>
+#include <Zycore/LibC.h>
+#include <Zycore/Internal/Bits.h>
+
+#if !defined(ZYAN_KERNEL) && (defined(ZYAN_X64) || (defined(ZYAN_X86) && \
+    (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))))
+#   define ZYAN_HASHMAP_SSE2
+#   include <emmintrin.h>
+#endif
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * Marks an empty slot.
+ */
+#define ZYAN_HASHMAP_CTRL_EMPTY     0x80
+
+/**
+ * Marks a slot that contained an entry which was removed.
+ */
+#define ZYAN_HASHMAP_CTRL_DELETED   0xFE
+
+#ifdef ZYAN_HASHMAP_SSE2
+
+/**
+ * The number of control bytes that are matched at once.
+ */
+#   define ZYAN_HASHMAP_GROUP_WIDTH    16
+
+/**
+ * The shift that converts a bit index of a group match mask to a slot offset.
+ */
+#   define ZYAN_HASHMAP_GROUP_SHIFT    0
+
+#else
+
+#   define ZYAN_HASHMAP_GROUP_WIDTH    8
+#   define ZYAN_HASHMAP_GROUP_SHIFT    3
+
+/**
+ * A 64-bit value with the least significant bit of each byte set.
+ */
+#   define ZYAN_HASHMAP_LSBS           0x0101010101010101ULL
+
+/**
+ * A 64-bit value with the most significant bit of each byte set.
+ */
+#   define ZYAN_HASHMAP_MSBS           0x8080808080808080ULL
+
+#endif
+
+ZYAN_STATIC_ASSERT(ZYAN_HASHMAP_MIN_CAPACITY >= ZYAN_HASHMAP_GROUP_WIDTH);
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Returns a pointer to the slot at the given `index`.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   index   The slot index.
+ *
+ * @return  A pointer to the slot at the given `index`.
+ */
+#define ZYAN_HASHMAP_SLOT(map, index) \
+    ((map)->slots + (index) * (map)->slot_size)
+
+/**
+ * Checks if the given control byte marks a full slot.
+ *
+ * @param   ctrl    The control byte.
+ *
+ * @return  `ZYAN_TRUE`, if the control byte marks a full slot or `ZYAN_FALSE`, if not.
+ */
+#define ZYAN_HASHMAP_IS_FULL(ctrl) \
+    (((ctrl) & 0x80) == 0)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Hashing                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Calculates the hash of the given `ZyanStringView` key.
+ *
+ * @param   key A pointer to the `ZyanStringView` instance.
+ *
+ * @return  The 64-bit hash.
+ */
+static ZyanU64 ZyanHashMapHashStringView(const void* key)
+{
+    return ZyanHashStringView((const ZyanStringView*)key, 0);
+}
+
+/**
+ * Compares two `ZyanStringView` keys.
+ *
+ * @param   left    A pointer to the first `ZyanStringView` instance.
+ * @param   right   A pointer to the second `ZyanStringView` instance.
+ *
+ * @return  `ZYAN_TRUE`, if both strings are equal or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanHashMapEqualsStringView(const void* left, const void* right)
+{
+    const ZyanStringView* const a = (const ZyanStringView*)left;
+    const ZyanStringView* const b = (const ZyanStringView*)right;
+
+    return (a->string.vector.size == b->string.vector.size) &&
+        !ZYAN_MEMCMP(a->string.vector.data, b->string.vector.data, a->string.vector.size - 1);
+}
+
+/**
+ * Calculates the hash of the given key.
+ *
+ * @param   map A pointer to the `ZyanHashMap` instance.
+ * @param   key A pointer to the key.
+ *
+ * @return  The 64-bit hash.
+ */
+static ZyanU64 ZyanHashMapHashKey(const ZyanHashMap* map, const void* key)
+{
+    return map->hash ? map->hash(key) : ZyanHash64(key, map->key_size, 0);
+}
+
+/**
+ * Compares the key of the given slot with the given `key`.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   slot    A pointer to the slot.
+ * @param   key     A pointer to the key.
+ *
+ * @return  `ZYAN_TRUE`, if both keys are equal or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanHashMapKeyEquals(const ZyanHashMap* map, const void* slot, const void* key)
+{
+    return map->equals ? map->equals(slot, key) : !ZYAN_MEMCMP(slot, key, map->key_size);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Group matching                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/*
+ * A group is a window of `ZYAN_HASHMAP_GROUP_WIDTH` consecutive control bytes. The match functions
+ * return a bitmask with one bit (SSE2) or one byte (SWAR) per control byte, which is converted to
+ * a slot offset by `ZyanHashMapNextMatch`.
+ */
+
+#ifdef ZYAN_HASHMAP_SSE2
+
+static ZyanU64 ZyanHashMapMatch(const ZyanU8* group, ZyanU8 h2)
+{
+    const __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+    return (ZyanU32)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)h2)));
+}
+
+static ZyanU64 ZyanHashMapMatchEmpty(const ZyanU8* group)
+{
+    const __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+    return (ZyanU32)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)ZYAN_HASHMAP_CTRL_EMPTY)));
+}
+
+static ZyanU64 ZyanHashMapMatchEmptyOrDeleted(const ZyanU8* group)
+{
+    // Only empty and deleted slots have the most significant bit set
+    return (ZyanU32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+}
+
+#else
+
+static ZyanU64 ZyanHashMapLoadGroup(const ZyanU8* group)
+{
+    // Compilers turn this into a single load on little-endian targets
+    return  (ZyanU64)group[0]        | ((ZyanU64)group[1] <<  8) |
+           ((ZyanU64)group[2] << 16) | ((ZyanU64)group[3] << 24) |
+           ((ZyanU64)group[4] << 32) | ((ZyanU64)group[5] << 40) |
+           ((ZyanU64)group[6] << 48) | ((ZyanU64)group[7] << 56);
+}
+
+static ZyanU64 ZyanHashMapMatch(const ZyanU8* group, ZyanU8 h2)
+{
+    // Might report false positives for full slots following a real match. These are filtered out
+    // by the key comparison
+    const ZyanU64 x = ZyanHashMapLoadGroup(group) ^ (ZYAN_HASHMAP_LSBS * h2);
+    return (x - ZYAN_HASHMAP_LSBS) & ~x & ZYAN_HASHMAP_MSBS;
+}
+
+static ZyanU64 ZyanHashMapMatchEmpty(const ZyanU8* group)
+{
+    // Empty is the only state with bit 7 set and bit 1 clear
+    const ZyanU64 ctrl = ZyanHashMapLoadGroup(group);
+    return ctrl & ~(ctrl << 6) & ZYAN_HASHMAP_MSBS;
+}
+
+static ZyanU64 ZyanHashMapMatchEmptyOrDeleted(const ZyanU8* group)
+{
+    return ZyanHashMapLoadGroup(group) & ZYAN_HASHMAP_MSBS;
+}
+
+#endif
+
+/**
+ * Returns the slot offset of the lowest match in the given match mask.
+ *
+ * @param   mask    The match mask. Must not be `0`.
+ *
+ * @return  The slot offset relative to the start of the group.
+ */
+static ZyanUSize ZyanHashMapNextMatch(ZyanU64 mask)
+{
+    return ZyanBitCountTrailingZeros64(mask) >> ZYAN_HASHMAP_GROUP_SHIFT;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Table management                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the maximum number of entries for the given capacity.
+ *
+ * @param   capacity    The number of slots.
+ *
+ * @return  The maximum number of entries (7/8 of the slots).
+ */
+static ZyanUSize ZyanHashMapMaxLoad(ZyanUSize capacity)
+{
+    return capacity - capacity / 8;
+}
+
+/**
+ * Returns the smallest valid capacity that is able to hold `count` entries.
+ *
+ * @param   count   The number of entries.
+ *
+ * @return  The capacity.
+ */
+static ZyanUSize ZyanHashMapCapacityFor(ZyanUSize count)
+{
+    ZyanUSize capacity = ZYAN_HASHMAP_MIN_CAPACITY;
+    while (ZyanHashMapMaxLoad(capacity) < count)
+    {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+/**
+ * Returns the number of bytes that are needed for a table with the given capacity.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   capacity    The number of slots.
+ *
+ * @return  The size of the table in bytes.
+ */
+static ZyanUSize ZyanHashMapTableSize(const ZyanHashMap* map, ZyanUSize capacity)
+{
+    // The first `GROUP_WIDTH - 1` control bytes are mirrored behind the last one, so that a group
+    // can be loaded at any slot index without wrapping around
+    return capacity * map->slot_size + capacity + ZYAN_HASHMAP_GROUP_WIDTH - 1;
+}
+
+/**
+ * Sets the control byte of the given slot (and its mirrored copy).
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   index   The slot index.
+ * @param   ctrl    The control byte.
+ */
+static void ZyanHashMapSetControl(ZyanHashMap* map, ZyanUSize index, ZyanU8 ctrl)
+{
+    const ZyanUSize mask = map->capacity - 1;
+    map->control[index] = ctrl;
+    map->control[((index - (ZYAN_HASHMAP_GROUP_WIDTH - 1)) & mask) +
+        (ZYAN_HASHMAP_GROUP_WIDTH - 1)] = ctrl;
+}
+
+/**
+ * Searches for the slot that contains the given `key`.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   hash    The hash of the key.
+ * @param   index   Receives the slot index.
+ *
+ * @return  `ZYAN_TRUE`, if the key was found or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanHashMapFind(const ZyanHashMap* map, const void* key, ZyanU64 hash,
+    ZyanUSize* index)
+{
+    if (!map->size)
+    {
+        return ZYAN_FALSE;
+    }
+
+    const ZyanUSize mask = map->capacity - 1;
+    const ZyanU8 h2 = (ZyanU8)(hash & 0x7F);
+    ZyanUSize position = (ZyanUSize)(hash >> 7) & mask;
+    ZyanUSize step = 0;
+
+    // The table always contains empty slots, so the probe sequence is guaranteed to terminate
+    for (;;)
+    {
+        const ZyanU8* const group = map->control + position;
+        for (ZyanU64 match = ZyanHashMapMatch(group, h2); match; match &= match - 1)
+        {
+            const ZyanUSize i = (position + ZyanHashMapNextMatch(match)) & mask;
+            if (ZyanHashMapKeyEquals(map, ZYAN_HASHMAP_SLOT(map, i), key))
+            {
+                *index = i;
+                return ZYAN_TRUE;
+            }
+        }
+        if (ZyanHashMapMatchEmpty(group))
+        {
+            return ZYAN_FALSE;
+        }
+
+        // Triangular probing visits every group exactly once for power of two capacities
+        step += ZYAN_HASHMAP_GROUP_WIDTH;
+        position = (position + step) & mask;
+    }
+}
+
+/**
+ * Returns the index of the first empty or deleted slot in the probe sequence of the given
+ * `hash`.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   hash    The key hash.
+ *
+ * @return  The slot index.
+ */
+static ZyanUSize ZyanHashMapFindInsertSlot(const ZyanHashMap* map, ZyanU64 hash)
+{
+    const ZyanUSize mask = map->capacity - 1;
+    ZyanUSize position = (ZyanUSize)(hash >> 7) & mask;
+    ZyanUSize step = 0;
+
+    for (;;)
+    {
+        const ZyanU64 match = ZyanHashMapMatchEmptyOrDeleted(map->control + position);
+        if (match)
+        {
+            return (position + ZyanHashMapNextMatch(match)) & mask;
+        }
+
+        step += ZYAN_HASHMAP_GROUP_WIDTH;
+        position = (position + step) & mask;
+    }
+}
+
+/**
+ * Moves all entries into a new table with the given capacity.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   capacity    The new capacity. Must be a power of two and large enough to hold all
+ *                      entries.
+ *
+ * @return  A zyan status code.
+ *
+ * The map is left unchanged, if the allocation of the new table fails.
+ */
+static ZyanStatus ZyanHashMapResize(ZyanHashMap* map, ZyanUSize capacity)
+{
+    ZYAN_ASSERT(map);
+    ZYAN_ASSERT(ZYAN_IS_POWER_OF_2(capacity));
+    ZYAN_ASSERT(ZyanHashMapMaxLoad(capacity) >= map->size);
+
+    void* table;
+    ZYAN_CHECK(map->allocator->allocate(map->allocator, &table, 1,
+        ZyanHashMapTableSize(map, capacity)));
+
+    ZyanHashMap old = *map;
+
+    map->slots = (ZyanU8*)table;
+    map->control = map->slots + capacity * map->slot_size;
+    map->capacity = capacity;
+    map->growth_left = ZyanHashMapMaxLoad(capacity) - map->size;
+    ZYAN_MEMSET(map->control, ZYAN_HASHMAP_CTRL_EMPTY, capacity + ZYAN_HASHMAP_GROUP_WIDTH - 1);
+
+    for (ZyanUSize i = 0; i < old.capacity; ++i)
+    {
+        if (!ZYAN_HASHMAP_IS_FULL(old.control[i]))
+        {
+            continue;
+        }
+
+        const ZyanU8* const slot = ZYAN_HASHMAP_SLOT(&old, i);
+        const ZyanUSize index = ZyanHashMapFindInsertSlot(map, ZyanHashMapHashKey(map, slot));
+        ZyanHashMapSetControl(map, index, old.control[i]);
+        ZYAN_MEMCPY(ZYAN_HASHMAP_SLOT(map, index), slot, map->slot_size);
+    }
+
+    if (old.capacity)
+    {
+        ZYAN_CHECK(map->allocator->deallocate(map->allocator, old.slots, 1,
+            ZyanHashMapTableSize(&old, old.capacity)));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanHashMapInit(ZyanHashMap* map, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanUSize capacity, ZyanHashFunction hash, ZyanEqualityComparison equals)
+{
+    return ZyanHashMapInitEx(map, key_size, value_size, capacity, hash, equals,
+        ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanHashMapInitEx(ZyanHashMap* map, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanUSize capacity, ZyanHashFunction hash, ZyanEqualityComparison equals,
+    ZyanAllocator* allocator)
+{
+    if (!map || !key_size || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(allocator->allocate);
+    ZYAN_ASSERT(allocator->deallocate);
+
+    // Keys and values are aligned to the largest power of two dividing their size (up to 8)
+    const ZyanUSize key_alignment = ZYAN_MIN(key_size & (~key_size + 1), 8);
+    const ZyanUSize value_alignment =
+        value_size ? ZYAN_MIN(value_size & (~value_size + 1), 8) : 1;
+
+    map->allocator    = allocator;
+    map->key_size     = key_size;
+    map->value_size   = value_size;
+    map->value_offset = ZYAN_ALIGN_UP(key_size, value_alignment);
+    map->slot_size    = ZYAN_ALIGN_UP(map->value_offset + value_size,
+        ZYAN_MAX(key_alignment, value_alignment));
+    map->hash         = hash;
+    map->equals       = equals;
+    map->size         = 0;
+    map->capacity     = 0;
+    map->growth_left  = 0;
+    map->control      = ZYAN_NULL;
+    map->slots        = ZYAN_NULL;
+
+    if (capacity)
+    {
+        return ZyanHashMapResize(map, ZyanHashMapCapacityFor(capacity));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanHashMapInitStringView(ZyanHashMap* map, ZyanUSize value_size, ZyanUSize capacity)
+{
+    return ZyanHashMapInitStringViewEx(map, value_size, capacity, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanHashMapInitStringViewEx(ZyanHashMap* map, ZyanUSize value_size,
+    ZyanUSize capacity, ZyanAllocator* allocator)
+{
+    return ZyanHashMapInitEx(map, sizeof(ZyanStringView), value_size, capacity,
+        &ZyanHashMapHashStringView, &ZyanHashMapEqualsStringView, allocator);
+}
+
+ZyanStatus ZyanHashMapDestroy(ZyanHashMap* map)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (map->capacity)
+    {
+        ZYAN_CHECK(map->allocator->deallocate(map->allocator, map->slots, 1,
+            ZyanHashMapTableSize(map, map->capacity)));
+    }
+
+    map->size     = 0;
+    map->capacity = 0;
+    map->control  = ZYAN_NULL;
+    map->slots    = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashMapInsert(ZyanHashMap* map, const void* key, const void* value)
+{
+    if (!map || !key || (map->value_size && !value))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU64 hash = ZyanHashMapHashKey(map, key);
+
+    ZyanUSize index;
+    if (ZyanHashMapFind(map, key, hash, &index))
+    {
+        if (map->value_size)
+        {
+            ZYAN_MEMCPY(ZYAN_HASHMAP_SLOT(map, index) + map->value_offset, value,
+                map->value_size);
+        }
+        return ZYAN_STATUS_FALSE;
+    }
+
+    if (!map->growth_left)
+    {
+        // Removed entries leave markers behind that count against the load factor. If the table
+        // is mostly filled with these markers, rebuilding it at the same size is sufficient
+        ZyanUSize capacity = ZYAN_HASHMAP_MIN_CAPACITY;
+        if (map->capacity)
+        {
+            capacity = (map->size + 1 > ZyanHashMapMaxLoad(map->capacity) / 2) ?
+                map->capacity * 2 : map->capacity;
+        }
+        ZYAN_CHECK(ZyanHashMapResize(map, capacity));
+    }
+
+    index = ZyanHashMapFindInsertSlot(map, hash);
+    if (map->control[index] == ZYAN_HASHMAP_CTRL_EMPTY)
+    {
+        --map->growth_left;
+    }
+    ZyanHashMapSetControl(map, index, (ZyanU8)(hash & 0x7F));
+
+    ZyanU8* const slot = ZYAN_HASHMAP_SLOT(map, index);
+    ZYAN_MEMCPY(slot, key, map->key_size);
+    if (map->value_size)
+    {
+        ZYAN_MEMCPY(slot + map->value_offset, value, map->value_size);
+    }
+    ++map->size;
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashMapRemove(ZyanHashMap* map, const void* key)
+{
+    if (!map || !key)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize index;
+    if (!ZyanHashMapFind(map, key, ZyanHashMapHashKey(map, key), &index))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    // The slot can only be marked as empty, if no probe sequence ever passed it while looking for
+    // a free slot. That is the case, if every group containing the slot has an empty slot
+    const ZyanUSize mask = map->capacity - 1;
+    const ZyanUSize before = (index - ZYAN_HASHMAP_GROUP_WIDTH) & mask;
+    const ZyanU64 empty_before = ZyanHashMapMatchEmpty(map->control + before);
+    const ZyanU64 empty_after = ZyanHashMapMatchEmpty(map->control + index);
+    ZyanBool was_never_full = ZYAN_FALSE;
+    if (empty_before && empty_after)
+    {
+        // Distance from the slot to the nearest empty slot in both directions
+        ZyanUSize distance_before = 0;
+        for (ZyanU64 m = empty_before; m; m &= m - 1)
+        {
+            distance_before = ZYAN_HASHMAP_GROUP_WIDTH - ZyanHashMapNextMatch(m);
+        }
+        const ZyanUSize distance_after = ZyanHashMapNextMatch(empty_after);
+        was_never_full = (distance_before + distance_after <= ZYAN_HASHMAP_GROUP_WIDTH);
+    }
+
+    if (was_never_full)
+    {
+        ZyanHashMapSetControl(map, index, ZYAN_HASHMAP_CTRL_EMPTY);
+        ++map->growth_left;
+    } else
+    {
+        ZyanHashMapSetControl(map, index, ZYAN_HASHMAP_CTRL_DELETED);
+    }
+    --map->size;
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanHashMapClear(ZyanHashMap* map)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (map->capacity)
+    {
+        ZYAN_MEMSET(map->control, ZYAN_HASHMAP_CTRL_EMPTY,
+            map->capacity + ZYAN_HASHMAP_GROUP_WIDTH - 1);
+        map->growth_left = ZyanHashMapMaxLoad(map->capacity);
+    }
+    map->size = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashMapGet(const ZyanHashMap* map, const void* key, const void** value)
+{
+    return ZyanHashMapGetMutable((ZyanHashMap*)map, key, (void**)value);
+}
+
+ZyanStatus ZyanHashMapGetMutable(ZyanHashMap* map, const void* key, void** value)
+{
+    if (!map || !key)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize index;
+    if (!ZyanHashMapFind(map, key, ZyanHashMapHashKey(map, key), &index))
+    {
+        if (value)
+        {
+            *value = ZYAN_NULL;
+        }
+        return ZYAN_STATUS_FALSE;
+    }
+
+    if (value)
+    {
+        *value = map->value_size ? ZYAN_HASHMAP_SLOT(map, index) + map->value_offset : ZYAN_NULL;
+    }
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashMapIterate(const ZyanHashMap* map, ZyanUSize* iterator, const void** key,
+    const void** value)
+{
+    if (!map || !iterator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    for (ZyanUSize i = *iterator; i < map->capacity; ++i)
+    {
+        if (!ZYAN_HASHMAP_IS_FULL(map->control[i]))
+        {
+            continue;
+        }
+
+        const ZyanU8* const slot = ZYAN_HASHMAP_SLOT(map, i);
+        if (key)
+        {
+            *key = slot;
+        }
+        if (value)
+        {
+            *value = map->value_size ? slot + map->value_offset : ZYAN_NULL;
+        }
+        *iterator = i + 1;
+
+        return ZYAN_STATUS_TRUE;
+    }
+
+    *iterator = map->capacity;
+    return ZYAN_STATUS_FALSE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashMapReserve(ZyanHashMap* map, ZyanUSize count)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (count <= map->size + map->growth_left)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    return ZyanHashMapResize(map, ZyanHashMapCapacityFor(count));
+}
+
+ZyanStatus ZyanHashMapRehash(ZyanHashMap* map, ZyanUSize count)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    count = ZYAN_MAX(count, map->size);
+    if (!count)
+    {
+        // Release the table
+        ZYAN_CHECK(ZyanHashMapDestroy(map));
+        map->growth_left = 0;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    return ZyanHashMapResize(map, ZyanHashMapCapacityFor(count));
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashMapGetSize(const ZyanHashMap* map, ZyanUSize* size)
+{
+    if (!map || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = map->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHashMapGetCapacity(const ZyanHashMap* map, ZyanUSize* capacity)
+{
+    if (!map || !capacity)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *capacity = map->capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
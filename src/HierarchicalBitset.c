@@ -0,0 +1,341 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/HierarchicalBitset.h>
+#include <Zycore/LibC.h>
+#include <Zycore/Internal/Bits.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Returns a pointer to the first word of the given level.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ * @param   level   The level.
+ *
+ * @return  A pointer to the first word of the level.
+ */
+#define ZYAN_HIERARCHICAL_BITSET_LEVEL(bitset, level) \
+    ((bitset)->words + (bitset)->level_offsets[level])
+
+/**
+ * Returns the number of words of the given level.
+ *
+ * @param   bitset  A pointer to the `ZyanHierarchicalBitset` instance.
+ * @param   level   The level.
+ *
+ * @return  The number of words of the level.
+ */
+#define ZYAN_HIERARCHICAL_BITSET_LEVEL_SIZE(bitset, level) \
+    ((bitset)->level_offsets[(level) + 1] - (bitset)->level_offsets[level])
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanHierarchicalBitsetInit(ZyanHierarchicalBitset* bitset, ZyanUSize count)
+{
+    return ZyanHierarchicalBitsetInitEx(bitset, count, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanHierarchicalBitsetInitEx(ZyanHierarchicalBitset* bitset, ZyanUSize count,
+    ZyanAllocator* allocator)
+{
+    if (!bitset || !count || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(allocator->allocate);
+    ZYAN_ASSERT(allocator->deallocate);
+
+    // Every level needs one bit per word of the level below, until a single word remains
+    ZyanU8 level_count = 0;
+    ZyanUSize total = 0;
+    ZyanUSize bits = count;
+    do
+    {
+        ZYAN_ASSERT(level_count < ZYAN_HIERARCHICAL_BITSET_MAX_LEVELS);
+        const ZyanUSize words = bits / 64 + ((bits % 64) ? 1 : 0);
+        bitset->level_offsets[level_count++] = total;
+        total += words;
+        bits = words;
+    } while (bits > 1);
+    bitset->level_offsets[level_count] = total;
+
+    void* memory;
+    ZYAN_CHECK(allocator->allocate(allocator, &memory, sizeof(ZyanU64), total));
+    ZYAN_MEMSET(memory, 0, total * sizeof(ZyanU64));
+
+    bitset->allocator   = allocator;
+    bitset->size        = count;
+    bitset->count       = 0;
+    bitset->level_count = level_count;
+    bitset->words       = (ZyanU64*)memory;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHierarchicalBitsetDestroy(ZyanHierarchicalBitset* bitset)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return bitset->allocator->deallocate(bitset->allocator, bitset->words, sizeof(ZyanU64),
+        bitset->level_offsets[bitset->level_count]);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Bit access                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHierarchicalBitsetSet(ZyanHierarchicalBitset* bitset, ZyanUSize index)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= bitset->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    ZyanU64* word = &bitset->words[index / 64];
+    const ZyanU64 mask = 1ULL << (index % 64);
+    if (*word & mask)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+    ++bitset->count;
+
+    // A summary bit only changes, if the word below was empty before
+    for (ZyanU8 level = 1; ; ++level)
+    {
+        const ZyanBool was_empty = !*word;
+        *word |= 1ULL << (index % 64);
+        if (!was_empty || (level == bitset->level_count))
+        {
+            break;
+        }
+        index /= 64;
+        word = &ZYAN_HIERARCHICAL_BITSET_LEVEL(bitset, level)[index / 64];
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHierarchicalBitsetReset(ZyanHierarchicalBitset* bitset, ZyanUSize index)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= bitset->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    ZyanU64* word = &bitset->words[index / 64];
+    const ZyanU64 mask = 1ULL << (index % 64);
+    if (!(*word & mask))
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+    --bitset->count;
+
+    // A summary bit only changes, if the word below becomes empty
+    for (ZyanU8 level = 1; ; ++level)
+    {
+        *word &= ~(1ULL << (index % 64));
+        if (*word || (level == bitset->level_count))
+        {
+            break;
+        }
+        index /= 64;
+        word = &ZYAN_HIERARCHICAL_BITSET_LEVEL(bitset, level)[index / 64];
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHierarchicalBitsetAssign(ZyanHierarchicalBitset* bitset, ZyanUSize index,
+    ZyanBool value)
+{
+    if (value)
+    {
+        return ZyanHierarchicalBitsetSet(bitset, index);
+    }
+    return ZyanHierarchicalBitsetReset(bitset, index);
+}
+
+ZyanStatus ZyanHierarchicalBitsetTest(const ZyanHierarchicalBitset* bitset, ZyanUSize index)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= bitset->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    return ((bitset->words[index / 64] >> (index % 64)) & 1) ? ZYAN_STATUS_TRUE :
+        ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanHierarchicalBitsetResetAll(ZyanHierarchicalBitset* bitset)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_MEMSET(bitset->words, 0, bitset->level_offsets[bitset->level_count] * sizeof(ZyanU64));
+    bitset->count = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Searching                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHierarchicalBitsetFindFirstSet(const ZyanHierarchicalBitset* bitset,
+    ZyanUSize* found)
+{
+    return ZyanHierarchicalBitsetFindNextSet(bitset, 0, found);
+}
+
+ZyanStatus ZyanHierarchicalBitsetFindNextSet(const ZyanHierarchicalBitset* bitset,
+    ZyanUSize index, ZyanUSize* found)
+{
+    if (!bitset || !found)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index > bitset->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    // Ascend until a word contains a set bit at or after the current position ...
+    ZyanU8 level = 0;
+    for (;;)
+    {
+        const ZyanUSize w = index / 64;
+        if (w < ZYAN_HIERARCHICAL_BITSET_LEVEL_SIZE(bitset, level))
+        {
+            const ZyanU64 word =
+                ZYAN_HIERARCHICAL_BITSET_LEVEL(bitset, level)[w] & (~0ULL << (index % 64));
+            if (word)
+            {
+                index = w * 64 + ZyanBitCountTrailingZeros64(word);
+                break;
+            }
+        }
+        if (++level == bitset->level_count)
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+        index = w + 1;
+    }
+
+    // ... and descend along the first non-empty word of every level below
+    while (level--)
+    {
+        const ZyanU64 word = ZYAN_HIERARCHICAL_BITSET_LEVEL(bitset, level)[index];
+        ZYAN_ASSERT(word);
+        index = index * 64 + ZyanBitCountTrailingZeros64(word);
+    }
+    ZYAN_ASSERT(index < bitset->size);
+    *found = index;
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHierarchicalBitsetGetSize(const ZyanHierarchicalBitset* bitset, ZyanUSize* size)
+{
+    if (!bitset || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = bitset->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHierarchicalBitsetCount(const ZyanHierarchicalBitset* bitset, ZyanUSize* count)
+{
+    if (!bitset || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *count = bitset->count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHierarchicalBitsetAny(const ZyanHierarchicalBitset* bitset)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return bitset->count ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanHierarchicalBitsetNone(const ZyanHierarchicalBitset* bitset)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return bitset->count ? ZYAN_STATUS_FALSE : ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,504 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/IntervalMap.h>
+#include <Zycore/LibC.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+#define ZYAN_INTERVALMAP_STARTS(map) \
+    ((ZyanU64*)(map)->starts.data)
+
+#define ZYAN_INTERVALMAP_ENDS(map) \
+    ((ZyanU64*)(map)->ends.data)
+
+#define ZYAN_INTERVALMAP_VALUE(map, index) \
+    ((ZyanU8*)(map)->values.data + (index) * (map)->value_size)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/**
+ * Returns the number of elements in the sorted `keys` array that are less than or equal to the
+ * given `key`.
+ *
+ * @param   keys    A pointer to the sorted keys.
+ * @param   size    The number of keys.
+ * @param   key     The key.
+ *
+ * @return  The index of the first element greater than `key`.
+ *
+ * The loop has a fixed trip count of `log2(size)` iterations and the only data dependent
+ * decision is written as a conditional move.
+ */
+static ZyanUSize ZyanIntervalMapUpperBound(const ZyanU64* keys, ZyanUSize size, ZyanU64 key)
+{
+    if (!size)
+    {
+        return 0;
+    }
+
+    const ZyanU64* base = keys;
+    while (size > 1)
+    {
+        const ZyanUSize half = size / 2;
+        base = (base[half] <= key) ? base + half : base;
+        size -= half;
+    }
+
+    return (ZyanUSize)(base - keys) + (*base <= key);
+}
+
+/**
+ * Checks if the value at the given `index` is equal to the given `value`.
+ *
+ * @param   map     A pointer to the `ZyanIntervalMap` instance.
+ * @param   index   The range index.
+ * @param   value   A pointer to the value.
+ *
+ * @return  `ZYAN_TRUE` if the values are equal or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanIntervalMapEquals(const ZyanIntervalMap* map, ZyanUSize index,
+    const void* value)
+{
+    if (!map->value_size)
+    {
+        return ZYAN_TRUE;
+    }
+
+    const void* const current = ZYAN_INTERVALMAP_VALUE(map, index);
+    if (map->equals)
+    {
+        return map->equals(current, value);
+    }
+
+    return !ZYAN_MEMCMP(current, value, map->value_size);
+}
+
+/**
+ * Replaces the range `[start, end)` with a new range (or nothing).
+ *
+ * @param   map     A pointer to the `ZyanIntervalMap` instance.
+ * @param   start   The start address (inclusive).
+ * @param   end     The end address (exclusive).
+ * @param   insert  `ZYAN_TRUE` to insert a new range or `ZYAN_FALSE` to only remove the
+ *                  existing ranges.
+ * @param   value   A pointer to the value of the new range.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the map was modified, `ZYAN_STATUS_FALSE` if not or another zyan
+ *          status code if an error occurred.
+ */
+static ZyanStatus ZyanIntervalMapSplice(ZyanIntervalMap* map, ZyanU64 start, ZyanU64 end,
+    ZyanBool insert, const void* value)
+{
+    if (!map || (start >= end) || (insert && map->value_size && !value))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize size = map->starts.size;
+    const ZyanU64* starts = ZYAN_INTERVALMAP_STARTS(map);
+    const ZyanU64* ends = ZYAN_INTERVALMAP_ENDS(map);
+
+    // The ranges `[first, last)` overlap the new range. Only the first and the last one of them
+    // might partially extend beyond it and must be truncated
+    ZyanUSize first = ZyanIntervalMapUpperBound(ends, size, start);
+    ZyanUSize last = ZyanIntervalMapUpperBound(starts, size, end - 1);
+    ZyanBool has_left = (first < last) && (starts[first] < start);
+    ZyanBool has_right = (first < last) && (ends[last - 1] > end);
+
+    if (insert)
+    {
+        // Coalesce with truncated or directly adjacent ranges with an equal value
+        if (has_left && ZyanIntervalMapEquals(map, first, value))
+        {
+            has_left = ZYAN_FALSE;
+            start = starts[first];
+        } else if (!has_left && first && (ends[first - 1] == start) &&
+            ZyanIntervalMapEquals(map, first - 1, value))
+        {
+            --first;
+            start = starts[first];
+        }
+        if (has_right && ZyanIntervalMapEquals(map, last - 1, value))
+        {
+            has_right = ZYAN_FALSE;
+            end = ends[last - 1];
+        } else if (!has_right && (last < size) && (starts[last] == end) &&
+            ZyanIntervalMapEquals(map, last, value))
+        {
+            ++last;
+            end = ends[last - 1];
+        }
+    } else if (first == last)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    const ZyanBool is_split = has_left && has_right && (first == last - 1);
+
+    // Resize the gap between the left and the right remainder to fit the new range. The right
+    // remainder is moved into place by this, unless a single range is split into two parts
+    const ZyanUSize existing = last - first;
+    const ZyanUSize needed = has_left + insert + has_right;
+    const ZyanUSize gap = first + has_left;
+    if (needed > existing)
+    {
+        const ZyanUSize count = needed - existing;
+        if (size + count > map->starts.capacity)
+        {
+            // Grow all vectors in advance, so that the actual insertion can not fail halfway
+            const ZyanUSize capacity =
+                ZYAN_MAX(size + count, map->starts.capacity * ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR);
+            ZYAN_CHECK(ZyanVectorReserve(&map->starts, capacity));
+            ZYAN_CHECK(ZyanVectorReserve(&map->ends, capacity));
+            if (map->value_size)
+            {
+                ZYAN_CHECK(ZyanVectorReserve(&map->values, capacity));
+            }
+        }
+
+        for (ZyanUSize i = 0; i < count; ++i)
+        {
+            void* element;
+            ZYAN_CHECK(ZyanVectorEmplaceEx(&map->starts, gap, &element, ZYAN_NULL));
+            ZYAN_CHECK(ZyanVectorEmplaceEx(&map->ends, gap, &element, ZYAN_NULL));
+            if (map->value_size)
+            {
+                ZYAN_CHECK(ZyanVectorEmplaceEx(&map->values, gap, &element, ZYAN_NULL));
+            }
+        }
+    } else if (needed < existing)
+    {
+        const ZyanUSize count = existing - needed;
+        ZYAN_CHECK(ZyanVectorDeleteRange(&map->starts, gap, count));
+        ZYAN_CHECK(ZyanVectorDeleteRange(&map->ends, gap, count));
+        if (map->value_size)
+        {
+            ZYAN_CHECK(ZyanVectorDeleteRange(&map->values, gap, count));
+        }
+    }
+
+    ZyanU64* const new_starts = ZYAN_INTERVALMAP_STARTS(map);
+    ZyanU64* const new_ends = ZYAN_INTERVALMAP_ENDS(map);
+    const ZyanUSize right = gap + insert;
+
+    if (is_split)
+    {
+        new_ends[right] = new_ends[first];
+        if (map->value_size)
+        {
+            ZYAN_MEMCPY(ZYAN_INTERVALMAP_VALUE(map, right), ZYAN_INTERVALMAP_VALUE(map, first),
+                map->value_size);
+        }
+    }
+    if (has_left)
+    {
+        new_ends[first] = start;
+    }
+    if (has_right)
+    {
+        new_starts[right] = end;
+    }
+    if (insert)
+    {
+        new_starts[gap] = start;
+        new_ends[gap] = end;
+        if (map->value_size)
+        {
+            ZYAN_MEMCPY(ZYAN_INTERVALMAP_VALUE(map, gap), value, map->value_size);
+        }
+    }
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanIntervalMapInit(ZyanIntervalMap* map, ZyanUSize value_size,
+    ZyanEqualityComparison equals)
+{
+    return ZyanIntervalMapInitEx(map, value_size, equals, 0, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanIntervalMapInitEx(ZyanIntervalMap* map, ZyanUSize value_size,
+    ZyanEqualityComparison equals, ZyanUSize capacity, ZyanAllocator* allocator)
+{
+    if (!map || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    map->value_size = value_size;
+    map->equals     = equals;
+
+    // Dynamic shrinking is disabled, so that removing elements from the parallel vectors never
+    // fails
+    ZYAN_CHECK(ZyanVectorInitEx(&map->starts, sizeof(ZyanU64), capacity, ZYAN_NULL, allocator,
+        ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, 0));
+    ZyanStatus status = ZyanVectorInitEx(&map->ends, sizeof(ZyanU64), capacity, ZYAN_NULL,
+        allocator, ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, 0);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanVectorDestroy(&map->starts);
+        return status;
+    }
+    if (value_size)
+    {
+        status = ZyanVectorInitEx(&map->values, value_size, capacity, ZYAN_NULL, allocator,
+            ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, 0);
+        if (!ZYAN_SUCCESS(status))
+        {
+            ZyanVectorDestroy(&map->ends);
+            ZyanVectorDestroy(&map->starts);
+            return status;
+        }
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanIntervalMapDestroy(ZyanIntervalMap* map)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (map->value_size)
+    {
+        ZYAN_CHECK(ZyanVectorDestroy(&map->values));
+    }
+    ZYAN_CHECK(ZyanVectorDestroy(&map->ends));
+
+    return ZyanVectorDestroy(&map->starts);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanIntervalMapInsert(ZyanIntervalMap* map, ZyanU64 start, ZyanU64 end,
+    const void* value)
+{
+    const ZyanStatus status = ZyanIntervalMapSplice(map, start, end, ZYAN_TRUE, value);
+
+    return ZYAN_SUCCESS(status) ? ZYAN_STATUS_SUCCESS : status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanIntervalMapRemove(ZyanIntervalMap* map, ZyanU64 start, ZyanU64 end)
+{
+    return ZyanIntervalMapSplice(map, start, end, ZYAN_FALSE, ZYAN_NULL);
+}
+
+ZyanStatus ZyanIntervalMapClear(ZyanIntervalMap* map)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (map->value_size)
+    {
+        ZYAN_CHECK(ZyanVectorClear(&map->values));
+    }
+    ZYAN_CHECK(ZyanVectorClear(&map->ends));
+
+    return ZyanVectorClear(&map->starts);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanIntervalMapFind(const ZyanIntervalMap* map, ZyanU64 address,
+    ZyanUSize* found_index)
+{
+    if (!map || !found_index)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize index =
+        ZyanIntervalMapUpperBound(ZYAN_INTERVALMAP_STARTS(map), map->starts.size, address);
+    if (!index || (address >= ZYAN_INTERVALMAP_ENDS(map)[index - 1]))
+    {
+        *found_index = index;
+        return ZYAN_STATUS_FALSE;
+    }
+
+    *found_index = index - 1;
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanIntervalMapGet(const ZyanIntervalMap* map, ZyanU64 address, const void** value)
+{
+    if (!map || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize index;
+    const ZyanStatus status = ZyanIntervalMapFind(map, address, &index);
+    *value = (status == ZYAN_STATUS_TRUE) && map->value_size ?
+        ZYAN_INTERVALMAP_VALUE(map, index) : ZYAN_NULL;
+
+    return status;
+}
+
+ZyanStatus ZyanIntervalMapFindOverlapping(const ZyanIntervalMap* map, ZyanU64 start,
+    ZyanU64 end, ZyanUSize* index, ZyanUSize* count)
+{
+    if (!map || !index || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize size = map->starts.size;
+    const ZyanUSize first = ZyanIntervalMapUpperBound(ZYAN_INTERVALMAP_ENDS(map), size, start);
+    const ZyanUSize last = (start < end) ?
+        ZyanIntervalMapUpperBound(ZYAN_INTERVALMAP_STARTS(map), size, end - 1) : first;
+
+    *index = first;
+    *count = (last > first) ? last - first : 0;
+
+    return *count ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanIntervalMapGetEntry(const ZyanIntervalMap* map, ZyanUSize index,
+    ZyanU64* start, ZyanU64* end, const void** value)
+{
+    return ZyanIntervalMapGetEntryMutable((ZyanIntervalMap*)map, index, start, end,
+        (void**)value);
+}
+
+ZyanStatus ZyanIntervalMapGetEntryMutable(ZyanIntervalMap* map, ZyanUSize index,
+    ZyanU64* start, ZyanU64* end, void** value)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= map->starts.size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (start)
+    {
+        *start = ZYAN_INTERVALMAP_STARTS(map)[index];
+    }
+    if (end)
+    {
+        *end = ZYAN_INTERVALMAP_ENDS(map)[index];
+    }
+    if (value)
+    {
+        *value = map->value_size ? ZYAN_INTERVALMAP_VALUE(map, index) : ZYAN_NULL;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanIntervalMapReserve(ZyanIntervalMap* map, ZyanUSize capacity)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanVectorReserve(&map->starts, capacity));
+    ZYAN_CHECK(ZyanVectorReserve(&map->ends, capacity));
+    if (map->value_size)
+    {
+        ZYAN_CHECK(ZyanVectorReserve(&map->values, capacity));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanIntervalMapShrinkToFit(ZyanIntervalMap* map)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanVectorShrinkToFit(&map->starts));
+    ZYAN_CHECK(ZyanVectorShrinkToFit(&map->ends));
+    if (map->value_size)
+    {
+        ZYAN_CHECK(ZyanVectorShrinkToFit(&map->values));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanIntervalMapGetSize(const ZyanIntervalMap* map, ZyanUSize* size)
+{
+    if (!map || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = map->starts.size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,508 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/PackedVector.h>
+#include <Zycore/Internal/Bits.h>
+
+#if !defined(ZYAN_KERNEL) && (defined(ZYAN_X64) || (defined(ZYAN_X86) && \
+    (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))))
+#   define ZYAN_PACKEDVECTOR_SSE2
+#   include <emmintrin.h>
+#elif !defined(ZYAN_KERNEL) && defined(ZYAN_AARCH64) && !defined(__AARCH64EB__)
+#   define ZYAN_PACKEDVECTOR_NEON
+#   include <arm_neon.h>
+#endif
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Returns the mask of the lowest `width` bits.
+ */
+#define ZYAN_PACKEDVECTOR_MASK(width) \
+    (((width) == 64) ? ~(ZyanU64)0 : (((ZyanU64)1 << (width)) - 1))
+
+/**
+ * Returns the number of words required to store `size` elements of the given `width` (including
+ * the padding word).
+ */
+#define ZYAN_PACKEDVECTOR_WORDS(size, width) \
+    ((ZyanUSize)((((ZyanU64)(size) * (width) + 63) >> 6) + 1))
+
+#define ZYAN_PACKEDVECTOR_DATA(vector) \
+    ((ZyanU64*)(vector)->words.data)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the number of bits required to represent the given value.
+ *
+ * @param   value   The value.
+ *
+ * @return  The number of significant bits (at least `1`).
+ */
+static ZyanU8 ZyanPackedVectorBitLength(ZyanU64 value)
+{
+    return value ? (ZyanU8)(64 - ZyanBitCountLeadingZeros64(value)) : 1;
+}
+
+/**
+ * Reads a single element.
+ *
+ * @param   words   A pointer to the words.
+ * @param   width   The number of bits per element.
+ * @param   index   The element index.
+ *
+ * @return  The value of the element.
+ *
+ * The padding word guarantees that the word following the first word of the element always
+ * exists, which allows reading both halves without branching.
+ */
+static ZyanU64 ZyanPackedVectorRead(const ZyanU64* words, ZyanU8 width, ZyanUSize index)
+{
+    const ZyanU64 bit = (ZyanU64)index * width;
+    const ZyanUSize word = (ZyanUSize)(bit >> 6);
+    const ZyanU8 offset = (ZyanU8)(bit & 63);
+
+    // The double shift avoids an undefined shift by 64 for `offset == 0`
+    const ZyanU64 low = words[word] >> offset;
+    const ZyanU64 high = (words[word + 1] << 1) << (63 - offset);
+
+    return (low | high) & ZYAN_PACKEDVECTOR_MASK(width);
+}
+
+/**
+ * Writes a single element.
+ *
+ * @param   words   A pointer to the words.
+ * @param   width   The number of bits per element.
+ * @param   index   The element index.
+ * @param   value   The value (must fit into `width` bits).
+ */
+static void ZyanPackedVectorWrite(ZyanU64* words, ZyanU8 width, ZyanUSize index, ZyanU64 value)
+{
+    const ZyanU64 bit = (ZyanU64)index * width;
+    const ZyanUSize word = (ZyanUSize)(bit >> 6);
+    const ZyanU8 offset = (ZyanU8)(bit & 63);
+    const ZyanU64 mask = ZYAN_PACKEDVECTOR_MASK(width);
+
+    words[word] = (words[word] & ~(mask << offset)) | (value << offset);
+    if (offset + width > 64)
+    {
+        const ZyanU8 shift = 64 - offset;
+        words[word + 1] = (words[word + 1] & ~(mask >> shift)) | (value >> shift);
+    }
+}
+
+/**
+ * Ensures that the value fits into the current element width.
+ *
+ * @param   vector  A pointer to the `ZyanPackedVector` instance.
+ * @param   value   The value.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanPackedVectorEnsureWidth(ZyanPackedVector* vector, ZyanU64 value)
+{
+    if (value <= ZYAN_PACKEDVECTOR_MASK(vector->width))
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    return ZyanPackedVectorWiden(vector, ZyanPackedVectorBitLength(value));
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanPackedVectorInit(ZyanPackedVector* vector, ZyanU8 width)
+{
+    return ZyanPackedVectorInitEx(vector, width, 0, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanPackedVectorInitEx(ZyanPackedVector* vector, ZyanU8 width, ZyanUSize capacity,
+    ZyanAllocator* allocator)
+{
+    if (!vector || !width || (width > 64) || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    vector->width = width;
+    vector->size  = 0;
+
+    // Dynamic shrinking is disabled, so that removing elements never fails
+    ZYAN_CHECK(ZyanVectorInitEx(&vector->words, sizeof(ZyanU64),
+        ZYAN_PACKEDVECTOR_WORDS(capacity, width), ZYAN_NULL, allocator,
+        ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, 0));
+
+    static const ZyanU64 zero = 0;
+    const ZyanStatus status = ZyanVectorPushBack(&vector->words, &zero);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanVectorDestroy(&vector->words);
+        return status;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPackedVectorDestroy(ZyanPackedVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorDestroy(&vector->words);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Element access                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPackedVectorGet(const ZyanPackedVector* vector, ZyanUSize index, ZyanU64* value)
+{
+    if (!vector || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= vector->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    *value = ZyanPackedVectorRead(ZYAN_PACKEDVECTOR_DATA(vector), vector->width, index);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPackedVectorSet(ZyanPackedVector* vector, ZyanUSize index, ZyanU64 value)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= vector->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    ZYAN_CHECK(ZyanPackedVectorEnsureWidth(vector, value));
+    ZyanPackedVectorWrite(ZYAN_PACKEDVECTOR_DATA(vector), vector->width, index, value);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPackedVectorUnpack(const ZyanPackedVector* vector, ZyanUSize index,
+    ZyanUSize count, ZyanU64* buffer)
+{
+    if (!vector || (!buffer && count))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if ((index > vector->size) || (count > vector->size - index))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    // Stream through the words instead of recomputing the position of every element
+    const ZyanU64* words = ZYAN_PACKEDVECTOR_DATA(vector);
+    const ZyanU8 width = vector->width;
+    const ZyanU64 mask = ZYAN_PACKEDVECTOR_MASK(width);
+    const ZyanU64 bit = (ZyanU64)index * width;
+    words += bit >> 6;
+    ZyanU8 offset = (ZyanU8)(bit & 63);
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        const ZyanU64 low = words[0] >> offset;
+        const ZyanU64 high = (words[1] << 1) << (63 - offset);
+        buffer[i] = (low | high) & mask;
+
+        offset += width;
+        words += offset >> 6;
+        offset &= 63;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPackedVectorUnpack32(const ZyanPackedVector* vector, ZyanUSize index,
+    ZyanUSize count, ZyanU32* buffer)
+{
+    if (!vector || (!buffer && count))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (vector->width > 32)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+    if ((index > vector->size) || (count > vector->size - index))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    const ZyanU8 width = vector->width;
+    ZyanUSize i = 0;
+
+#if defined(ZYAN_PACKEDVECTOR_SSE2) || defined(ZYAN_PACKEDVECTOR_NEON)
+    // Byte-aligned widths are plain little-endian arrays that only need to be zero-extended
+    const ZyanU8* const bytes = (const ZyanU8*)vector->words.data;
+    if (width == 8)
+    {
+        const ZyanU8* source = bytes + index;
+        for (; i + 16 <= count; i += 16, source += 16)
+        {
+#   if defined(ZYAN_PACKEDVECTOR_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i v = _mm_loadu_si128((const __m128i*)source);
+            const __m128i lo = _mm_unpacklo_epi8(v, zero);
+            const __m128i hi = _mm_unpackhi_epi8(v, zero);
+            _mm_storeu_si128((__m128i*)(buffer + i +  0), _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128((__m128i*)(buffer + i +  4), _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128((__m128i*)(buffer + i +  8), _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128((__m128i*)(buffer + i + 12), _mm_unpackhi_epi16(hi, zero));
+#   else
+            const uint8x16_t v = vld1q_u8(source);
+            const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+            const uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+            vst1q_u32(buffer + i +  0, vmovl_u16(vget_low_u16(lo)));
+            vst1q_u32(buffer + i +  4, vmovl_u16(vget_high_u16(lo)));
+            vst1q_u32(buffer + i +  8, vmovl_u16(vget_low_u16(hi)));
+            vst1q_u32(buffer + i + 12, vmovl_u16(vget_high_u16(hi)));
+#   endif
+        }
+    } else if (width == 16)
+    {
+        const ZyanU8* source = bytes + index * 2;
+        for (; i + 8 <= count; i += 8, source += 16)
+        {
+#   if defined(ZYAN_PACKEDVECTOR_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i v = _mm_loadu_si128((const __m128i*)source);
+            _mm_storeu_si128((__m128i*)(buffer + i + 0), _mm_unpacklo_epi16(v, zero));
+            _mm_storeu_si128((__m128i*)(buffer + i + 4), _mm_unpackhi_epi16(v, zero));
+#   else
+            const uint16x8_t v = vreinterpretq_u16_u8(vld1q_u8(source));
+            vst1q_u32(buffer + i + 0, vmovl_u16(vget_low_u16(v)));
+            vst1q_u32(buffer + i + 4, vmovl_u16(vget_high_u16(v)));
+#   endif
+        }
+    } else if (width == 32)
+    {
+        ZYAN_MEMCPY(buffer, bytes + index * 4, count * sizeof(ZyanU32));
+        return ZYAN_STATUS_SUCCESS;
+    }
+#endif
+
+    const ZyanU64* words = ZYAN_PACKEDVECTOR_DATA(vector);
+    const ZyanU64 mask = ZYAN_PACKEDVECTOR_MASK(width);
+    const ZyanU64 bit = (ZyanU64)(index + i) * width;
+    words += bit >> 6;
+    ZyanU8 offset = (ZyanU8)(bit & 63);
+    for (; i < count; ++i)
+    {
+        const ZyanU64 low = words[0] >> offset;
+        const ZyanU64 high = (words[1] << 1) << (63 - offset);
+        buffer[i] = (ZyanU32)((low | high) & mask);
+
+        offset += width;
+        words += offset >> 6;
+        offset &= 63;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion and deletion                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPackedVectorPushBack(ZyanPackedVector* vector, ZyanU64 value)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanPackedVectorEnsureWidth(vector, value));
+    ZYAN_CHECK(ZyanPackedVectorResize(vector, vector->size + 1));
+    ZyanPackedVectorWrite(ZYAN_PACKEDVECTOR_DATA(vector), vector->width, vector->size - 1, value);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPackedVectorPopBack(ZyanPackedVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (!vector->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    return ZyanPackedVectorResize(vector, vector->size - 1);
+}
+
+ZyanStatus ZyanPackedVectorClear(ZyanPackedVector* vector)
+{
+    return ZyanPackedVectorResize(vector, 0);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPackedVectorResize(ZyanPackedVector* vector, ZyanUSize size)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // All bits past the last element are kept cleared, so that growing only has to append zero
+    // words
+    static const ZyanU64 zero = 0;
+    ZYAN_CHECK(ZyanVectorResizeEx(&vector->words, ZYAN_PACKEDVECTOR_WORDS(size, vector->width),
+        &zero));
+    if (size < vector->size)
+    {
+        ZyanU64* const words = ZYAN_PACKEDVECTOR_DATA(vector);
+        const ZyanU64 bit = (ZyanU64)size * vector->width;
+        ZyanUSize word = (ZyanUSize)(bit >> 6);
+        words[word] &= ((ZyanU64)1 << (bit & 63)) - 1;
+        while (++word < vector->words.size)
+        {
+            words[word] = 0;
+        }
+    }
+
+    vector->size = size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPackedVectorReserve(ZyanPackedVector* vector, ZyanUSize capacity)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorReserve(&vector->words, ZYAN_PACKEDVECTOR_WORDS(capacity, vector->width));
+}
+
+ZyanStatus ZyanPackedVectorWiden(ZyanPackedVector* vector, ZyanU8 width)
+{
+    if (!vector || !width || (width > 64))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (width <= vector->width)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    static const ZyanU64 zero = 0;
+    const ZyanUSize count = ZYAN_PACKEDVECTOR_WORDS(vector->size, width);
+    ZyanVector words;
+    ZYAN_CHECK(ZyanVectorInitEx(&words, sizeof(ZyanU64), count, ZYAN_NULL,
+        vector->words.allocator, vector->words.growth_factor, vector->words.shrink_threshold));
+    ZyanStatus status = ZyanVectorResizeEx(&words, count, &zero);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanVectorDestroy(&words);
+        return status;
+    }
+
+    const ZyanU64* const source = ZYAN_PACKEDVECTOR_DATA(vector);
+    ZyanU64* const destination = (ZyanU64*)words.data;
+    for (ZyanUSize i = 0; i < vector->size; ++i)
+    {
+        ZyanPackedVectorWrite(destination, width, i,
+            ZyanPackedVectorRead(source, vector->width, i));
+    }
+
+    ZYAN_CHECK(ZyanVectorDestroy(&vector->words));
+    vector->words = words;
+    vector->width = width;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPackedVectorGetSize(const ZyanPackedVector* vector, ZyanUSize* size)
+{
+    if (!vector || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = vector->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPackedVectorGetWidth(const ZyanPackedVector* vector, ZyanU8* width)
+{
+    if (!vector || !width)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *width = vector->width;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,567 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Format.h>
+#include <Zycore/Hash.h>
+#include <Zycore/LibC.h>
+#include <Zycore/PerfectHash.h>
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanPerfectHashContext` struct.
+ *
+ * Holds the temporary buffers used during the construction of a table.
+ */
+typedef struct ZyanPerfectHashContext_
+{
+    /**
+     * The hashes of the keys.
+     */
+    ZyanU64* hashes;
+    /**
+     * The indices of the keys, grouped by bucket.
+     */
+    ZyanU32* order;
+    /**
+     * The start of every bucket inside `order` (`bucket_count + 1` entries).
+     */
+    ZyanU32* bucket_start;
+    /**
+     * The indices of the buckets, sorted by size in descending order.
+     */
+    ZyanU32* bucket_order;
+    /**
+     * The number of buckets per size (`key_count + 2` entries).
+     */
+    ZyanU32* size_count;
+    /**
+     * The candidate slots of the bucket that is currently placed.
+     */
+    ZyanU32* candidates;
+    /**
+     * Marks the occupied slots.
+     */
+    ZyanU8* taken;
+} ZyanPerfectHashContext;
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Hashing                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the bucket of the given key hash.
+ *
+ * @param   hash            The key hash.
+ * @param   bucket_count    The number of buckets.
+ *
+ * @return  The index of the bucket.
+ */
+static ZyanU32 ZyanPerfectHashGetBucket(ZyanU64 hash, ZyanU32 bucket_count)
+{
+    // Maps the upper 32 bits of the hash to `[0, bucket_count)` without a division
+    return (ZyanU32)(((hash >> 32) * bucket_count) >> 32);
+}
+
+/**
+ * Returns the slot of the given key hash.
+ *
+ * @param   hash        The key hash.
+ * @param   pilot       The pilot value of the bucket.
+ * @param   key_count   The number of keys.
+ *
+ * @return  The index of the slot.
+ */
+static ZyanU32 ZyanPerfectHashGetSlot(ZyanU64 hash, ZyanU32 pilot, ZyanU32 key_count)
+{
+    return (ZyanU32)((hash ^ ZyanHashMix64(pilot)) % key_count);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Construction                                                                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Distributes the keys to the buckets and sorts the buckets by size.
+ *
+ * @param   table   A pointer to the `ZyanPerfectHash` instance.
+ * @param   keys    A pointer to the keys.
+ * @param   context A pointer to the `ZyanPerfectHashContext` instance.
+ *
+ * @return  `ZYAN_STATUS_SUCCESS`, if the keys were distributed, `ZYAN_STATUS_FALSE`, if two keys
+ *          share the same hash or `ZYAN_STATUS_INVALID_ARGUMENT`, if the key set contains
+ *          duplicates.
+ */
+static ZyanStatus ZyanPerfectHashDistribute(const ZyanPerfectHash* table,
+    const ZyanStringView* keys, ZyanPerfectHashContext* context)
+{
+    const ZyanU32 n = table->key_count;
+    const ZyanU32 b = table->bucket_count;
+
+    ZYAN_MEMSET(context->bucket_start, 0, (b + 1) * sizeof(ZyanU32));
+    for (ZyanU32 i = 0; i < n; ++i)
+    {
+        context->hashes[i] = ZyanHashStringView(&keys[i], table->seed);
+        ++context->bucket_start[ZyanPerfectHashGetBucket(context->hashes[i], b) + 1];
+    }
+    for (ZyanU32 i = 0; i < b; ++i)
+    {
+        context->bucket_start[i + 1] += context->bucket_start[i];
+    }
+
+    // Counting sort of the keys by bucket (`bucket_order` temporarily serves as insert cursor)
+    ZYAN_MEMCPY(context->bucket_order, context->bucket_start, b * sizeof(ZyanU32));
+    for (ZyanU32 i = 0; i < n; ++i)
+    {
+        const ZyanU32 bucket = ZyanPerfectHashGetBucket(context->hashes[i], b);
+        context->order[context->bucket_order[bucket]++] = i;
+    }
+
+    // Keys with identical hashes can never be separated by any pilot value
+    for (ZyanU32 i = 0; i < b; ++i)
+    {
+        for (ZyanU32 j = context->bucket_start[i]; j < context->bucket_start[i + 1]; ++j)
+        {
+            for (ZyanU32 k = j + 1; k < context->bucket_start[i + 1]; ++k)
+            {
+                const ZyanU32 x = context->order[j];
+                const ZyanU32 y = context->order[k];
+                if (context->hashes[x] != context->hashes[y])
+                {
+                    continue;
+                }
+                if ((keys[x].string.vector.size == keys[y].string.vector.size) &&
+                    !ZYAN_MEMCMP(keys[x].string.vector.data, keys[y].string.vector.data,
+                        keys[x].string.vector.size - 1))
+                {
+                    return ZYAN_STATUS_INVALID_ARGUMENT;
+                }
+                return ZYAN_STATUS_FALSE;
+            }
+        }
+    }
+
+    // Counting sort of the buckets by size in descending order. Large buckets are placed first,
+    // while most slots are still free
+    ZYAN_MEMSET(context->size_count, 0, (n + 2) * sizeof(ZyanU32));
+    for (ZyanU32 i = 0; i < b; ++i)
+    {
+        const ZyanU32 size = context->bucket_start[i + 1] - context->bucket_start[i];
+        ++context->size_count[n - size + 1];
+    }
+    for (ZyanU32 i = 0; i <= n; ++i)
+    {
+        context->size_count[i + 1] += context->size_count[i];
+    }
+    for (ZyanU32 i = 0; i < b; ++i)
+    {
+        const ZyanU32 size = context->bucket_start[i + 1] - context->bucket_start[i];
+        context->bucket_order[context->size_count[n - size]++] = i;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Searches a pilot value for every bucket.
+ *
+ * @param   table   A pointer to the `ZyanPerfectHash` instance.
+ * @param   context A pointer to the `ZyanPerfectHashContext` instance.
+ *
+ * @return  `ZYAN_STATUS_SUCCESS`, if all buckets were placed or `ZYAN_STATUS_FALSE`, if no pilot
+ *          value was found for at least one bucket.
+ */
+static ZyanStatus ZyanPerfectHashPlace(ZyanPerfectHash* table, ZyanPerfectHashContext* context)
+{
+    const ZyanU32 n = table->key_count;
+
+    // The last buckets compete for very few free slots. The expected number of attempts for a
+    // single key and a single free slot is `n`
+    const ZyanU64 max_pilot = ZYAN_MIN((ZyanU64)n * 16 + 1024, (ZyanU64)ZYAN_UINT32_MAX);
+
+    ZYAN_MEMSET(context->taken, 0, n);
+    ZYAN_MEMSET(table->pilots, 0, table->bucket_count * sizeof(ZyanU32));
+
+    for (ZyanU32 i = 0; i < table->bucket_count; ++i)
+    {
+        const ZyanU32 bucket = context->bucket_order[i];
+        const ZyanU32* const members = context->order + context->bucket_start[bucket];
+        const ZyanU32 size = context->bucket_start[bucket + 1] - context->bucket_start[bucket];
+        if (!size)
+        {
+            // Buckets are sorted by size, so all remaining buckets are empty
+            break;
+        }
+
+        ZyanU32 pilot = 0;
+        for (;; ++pilot)
+        {
+            if (pilot >= max_pilot)
+            {
+                return ZYAN_STATUS_FALSE;
+            }
+
+            ZyanU32 j = 0;
+            for (; j < size; ++j)
+            {
+                const ZyanU32 slot = ZyanPerfectHashGetSlot(context->hashes[members[j]], pilot, n);
+                if (context->taken[slot])
+                {
+                    break;
+                }
+                context->taken[slot] = 1;
+                context->candidates[j] = slot;
+            }
+            if (j == size)
+            {
+                break;
+            }
+            while (j--)
+            {
+                context->taken[context->candidates[j]] = 0;
+            }
+        }
+
+        table->pilots[bucket] = pilot;
+        for (ZyanU32 j = 0; j < size; ++j)
+        {
+            table->slots[context->candidates[j]].index = members[j];
+        }
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Code generation                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Appends a null-terminated string to the given `ZyanString` instance.
+ *
+ * @param   output  A pointer to the `ZyanString` instance.
+ * @param   text    The null-terminated string.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanPerfectHashAppend(ZyanString* output, const char* text)
+{
+    ZyanStringView view;
+    ZYAN_CHECK(ZyanStringViewInsideBuffer(&view, text));
+
+    return ZyanStringAppend(output, &view);
+}
+
+/**
+ * Appends the given key as an escaped C string literal.
+ *
+ * @param   output  A pointer to the `ZyanString` instance.
+ * @param   data    A pointer to the key data.
+ * @param   length  The length of the key.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanPerfectHashAppendLiteral(ZyanString* output, const char* data,
+    ZyanU32 length)
+{
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, "\""));
+    for (ZyanU32 i = 0; i < length; ++i)
+    {
+        const ZyanU8 c = (ZyanU8)data[i];
+
+        char buffer[5];
+        ZyanUSize size = 0;
+        if ((c >= 0x20) && (c < 0x7F) && (c != '"') && (c != '\\') && (c != '?'))
+        {
+            buffer[size++] = (char)c;
+        } else
+        {
+            // Octal escapes have a fixed length and can not absorb the following characters
+            buffer[size++] = '\\';
+            buffer[size++] = (char)('0' + ((c >> 6) & 7));
+            buffer[size++] = (char)('0' + ((c >> 3) & 7));
+            buffer[size++] = (char)('0' + ( c       & 7));
+        }
+        buffer[size] = '\0';
+        ZYAN_CHECK(ZyanPerfectHashAppend(output, buffer));
+    }
+
+    return ZyanPerfectHashAppend(output, "\"");
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanPerfectHashInit(ZyanPerfectHash* table, const ZyanStringView* keys,
+    ZyanUSize count)
+{
+    return ZyanPerfectHashInitEx(table, keys, count, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanPerfectHashInitEx(ZyanPerfectHash* table, const ZyanStringView* keys,
+    ZyanUSize count, ZyanAllocator* allocator)
+{
+    if (!table || !keys || !count || (count >= ZYAN_UINT32_MAX) || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize strings_size = 0;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        ZYAN_ASSERT(keys[i].string.vector.size >= 1);
+        strings_size += keys[i].string.vector.size;
+    }
+    if (strings_size > ZYAN_UINT32_MAX)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU32 n = (ZyanU32)count;
+    const ZyanU32 b = n / ZYAN_PERFECT_HASH_BUCKET_SIZE + 1;
+
+    // The table is stored in a single block: pilots, slots and strings
+    const ZyanUSize pilots_size = b * sizeof(ZyanU32);
+    const ZyanUSize slots_size = n * sizeof(ZyanPerfectHashSlot);
+    void* memory;
+    ZYAN_CHECK(allocator->allocate(allocator, &memory, 1,
+        pilots_size + slots_size + strings_size));
+
+    table->allocator    = allocator;
+    table->key_count    = n;
+    table->bucket_count = b;
+    table->pilots       = (ZyanU32*)memory;
+    table->slots        = (ZyanPerfectHashSlot*)((ZyanU8*)memory + pilots_size);
+    table->strings      = (char*)memory + pilots_size + slots_size;
+    table->memory_size  = pilots_size + slots_size + strings_size;
+
+    const ZyanUSize temp_size = n * (sizeof(ZyanU64) + 2 * sizeof(ZyanU32) + 1) +
+        (b * 2 + 1 + n + 2) * sizeof(ZyanU32);
+    void* temp;
+    const ZyanStatus temp_status = allocator->allocate(allocator, &temp, 1, temp_size);
+    if (!ZYAN_SUCCESS(temp_status))
+    {
+        ZyanPerfectHashDestroy(table);
+        return temp_status;
+    }
+
+    ZyanPerfectHashContext context;
+    context.hashes       = (ZyanU64*)temp;
+    context.order        = (ZyanU32*)(context.hashes + n);
+    context.candidates   = context.order + n;
+    context.bucket_start = context.candidates + n;
+    context.bucket_order = context.bucket_start + b + 1;
+    context.size_count   = context.bucket_order + b;
+    context.taken        = (ZyanU8*)(context.size_count + n + 2);
+
+    ZyanStatus status = ZYAN_STATUS_FALSE;
+    for (ZyanU32 attempt = 0; (attempt < ZYAN_PERFECT_HASH_MAX_ATTEMPTS) &&
+        (status == ZYAN_STATUS_FALSE); ++attempt)
+    {
+        table->seed = ZyanHashMix64(0x9E3779B97F4A7C15ULL * (attempt + 1));
+        status = ZyanPerfectHashDistribute(table, keys, &context);
+        if (status == ZYAN_STATUS_SUCCESS)
+        {
+            status = ZyanPerfectHashPlace(table, &context);
+        }
+    }
+
+    allocator->deallocate(allocator, temp, 1, temp_size);
+    if (status != ZYAN_STATUS_SUCCESS)
+    {
+        ZyanPerfectHashDestroy(table);
+        return (status == ZYAN_STATUS_FALSE) ? ZYAN_STATUS_FAILED : status;
+    }
+
+    ZyanU32 offset = 0;
+    for (ZyanU32 i = 0; i < n; ++i)
+    {
+        ZyanPerfectHashSlot* const slot = &table->slots[i];
+        const ZyanStringView* const key = &keys[slot->index];
+        slot->offset = offset;
+        slot->length = (ZyanU32)(key->string.vector.size - 1);
+        ZYAN_MEMCPY(table->strings + offset, key->string.vector.data, slot->length);
+        table->strings[offset + slot->length] = '\0';
+        offset += slot->length + 1;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPerfectHashDestroy(ZyanPerfectHash* table)
+{
+    if (!table)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (table->pilots)
+    {
+        ZYAN_CHECK(table->allocator->deallocate(table->allocator, table->pilots, 1,
+            table->memory_size));
+    }
+
+    table->key_count    = 0;
+    table->bucket_count = 0;
+    table->pilots       = ZYAN_NULL;
+    table->slots        = ZYAN_NULL;
+    table->strings      = ZYAN_NULL;
+    table->memory_size  = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPerfectHashLookup(const ZyanPerfectHash* table, const ZyanStringView* key,
+    ZyanUSize* index)
+{
+    if (!table || !key || !table->key_count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(key->string.vector.size >= 1);
+    const ZyanUSize length = key->string.vector.size - 1;
+
+    const ZyanU64 hash = ZyanHashStringView(key, table->seed);
+    const ZyanU32 bucket = ZyanPerfectHashGetBucket(hash, table->bucket_count);
+    const ZyanPerfectHashSlot* const slot =
+        &table->slots[ZyanPerfectHashGetSlot(hash, table->pilots[bucket], table->key_count)];
+    if ((slot->length != length) ||
+        ZYAN_MEMCMP(table->strings + slot->offset, key->string.vector.data, length))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    if (index)
+    {
+        *index = slot->index;
+    }
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Code generation                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPerfectHashEmit(const ZyanPerfectHash* table, ZyanString* output,
+    const char* name)
+{
+    if (!table || !output || !name || !table->key_count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, "static const ZyanU32 "));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, name));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, "Pilots["));
+    ZYAN_CHECK(ZyanStringAppendDecU(output, table->bucket_count, 0));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, "] =\n{"));
+    for (ZyanU32 i = 0; i < table->bucket_count; ++i)
+    {
+        ZYAN_CHECK(ZyanPerfectHashAppend(output, (i % 8) ? " " : "\n    "));
+        ZYAN_CHECK(ZyanStringAppendDecU(output, table->pilots[i], 0));
+        if (i + 1 < table->bucket_count)
+        {
+            ZYAN_CHECK(ZyanPerfectHashAppend(output, ","));
+        }
+    }
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, "\n};\n\n"));
+
+    ZYAN_CHECK(ZyanPerfectHashAppend(output,
+        "static const struct\n{\n    const char* string;\n    ZyanU32 length;\n"
+        "    ZyanU32 index;\n} "));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, name));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, "Slots["));
+    ZYAN_CHECK(ZyanStringAppendDecU(output, table->key_count, 0));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, "] =\n{\n"));
+    for (ZyanU32 i = 0; i < table->key_count; ++i)
+    {
+        const ZyanPerfectHashSlot* const slot = &table->slots[i];
+        ZYAN_CHECK(ZyanPerfectHashAppend(output, "    { "));
+        ZYAN_CHECK(ZyanPerfectHashAppendLiteral(output, table->strings + slot->offset,
+            slot->length));
+        ZYAN_CHECK(ZyanPerfectHashAppend(output, ", "));
+        ZYAN_CHECK(ZyanStringAppendDecU(output, slot->length, 0));
+        ZYAN_CHECK(ZyanPerfectHashAppend(output, ", "));
+        ZYAN_CHECK(ZyanStringAppendDecU(output, slot->index, 0));
+        ZYAN_CHECK(ZyanPerfectHashAppend(output, (i + 1 < table->key_count) ? " },\n" : " }\n"));
+    }
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, "};\n\n"));
+
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, "static ZyanBool "));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, name));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output,
+        "(const char* string, ZyanUSize length, ZyanU32* index)\n{\n"
+        "    const ZyanU64 hash = ZyanHash64(string, length, 0x"));
+    ZYAN_CHECK(ZyanStringAppendHexU(output, table->seed, 16, ZYAN_TRUE));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output,
+        "ULL);\n    const ZyanU32 bucket = (ZyanU32)(((hash >> 32) * "));
+    ZYAN_CHECK(ZyanStringAppendDecU(output, table->bucket_count, 0));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output,
+        ") >> 32);\n    const ZyanU32 slot = (ZyanU32)((hash ^ ZyanHashMix64("));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, name));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, "Pilots[bucket])) % "));
+    ZYAN_CHECK(ZyanStringAppendDecU(output, table->key_count, 0));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, ");\n    if (("));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, name));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, "Slots[slot].length != length) ||\n"
+        "        ZYAN_MEMCMP("));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, name));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, "Slots[slot].string, string, length))\n"
+        "    {\n        return ZYAN_FALSE;\n    }\n    if (index)\n    {\n"
+        "        *index = "));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, name));
+    ZYAN_CHECK(ZyanPerfectHashAppend(output, "Slots[slot].index;\n    }\n"
+        "    return ZYAN_TRUE;\n}\n"));
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
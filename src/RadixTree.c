@@ -0,0 +1,1494 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/RadixTree.h>
+#include <Zycore/Internal/Bits.h>
+
+#if !defined(ZYAN_KERNEL) && (defined(ZYAN_X64) || (defined(ZYAN_X86) && \
+    (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))))
+#   define ZYAN_RADIX_SSE2
+#   include <emmintrin.h>
+#endif
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * The maximum number of prefix bytes that are stored inside an inner node. Longer prefixes are
+ * recovered from an arbitrary leaf of the node's subtree.
+ */
+#define ZYAN_RADIX_TREE_MAX_PREFIX  8
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanRadixNodeType` enum.
+ */
+typedef enum ZyanRadixNodeType_
+{
+    ZYAN_RADIX_NODE_LEAF,
+    ZYAN_RADIX_NODE_4,
+    ZYAN_RADIX_NODE_16,
+    ZYAN_RADIX_NODE_48,
+    ZYAN_RADIX_NODE_256
+} ZyanRadixNodeType;
+
+/**
+ * Defines the `ZyanRadixLeaf` struct.
+ *
+ * The header of a leaf. The value and the key follow at the offsets stored in the tree.
+ */
+typedef struct ZyanRadixLeaf_
+{
+    /**
+     * The node type (always `ZYAN_RADIX_NODE_LEAF`).
+     */
+    ZyanU8 type;
+    /**
+     * The length of the key in bytes.
+     */
+    ZyanUSize length;
+} ZyanRadixLeaf;
+
+/**
+ * Defines the `ZyanRadixNode` struct.
+ *
+ * The common header of all inner nodes.
+ */
+typedef struct ZyanRadixNode_
+{
+    /**
+     * The node type.
+     */
+    ZyanU8 type;
+    /**
+     * The number of children.
+     */
+    ZyanU16 count;
+    /**
+     * The length of the compressed prefix in bytes.
+     */
+    ZyanU32 prefix_length;
+    /**
+     * The first bytes of the compressed prefix.
+     */
+    ZyanU8 prefix[ZYAN_RADIX_TREE_MAX_PREFIX];
+    /**
+     * The leaf of the key that ends at this node (after the prefix) or `ZYAN_NULL`.
+     */
+    ZyanRadixLeaf* leaf;
+} ZyanRadixNode;
+
+/**
+ * Defines the `ZyanRadixNode4` struct.
+ */
+typedef struct ZyanRadixNode4_
+{
+    ZyanRadixNode header;
+    /**
+     * The sorted key bytes.
+     */
+    ZyanU8 keys[4];
+    /**
+     * The children.
+     */
+    void* children[4];
+} ZyanRadixNode4;
+
+/**
+ * Defines the `ZyanRadixNode16` struct.
+ */
+typedef struct ZyanRadixNode16_
+{
+    ZyanRadixNode header;
+    /**
+     * The sorted key bytes.
+     */
+    ZyanU8 keys[16];
+    /**
+     * The children.
+     */
+    void* children[16];
+} ZyanRadixNode16;
+
+/**
+ * Defines the `ZyanRadixNode48` struct.
+ */
+typedef struct ZyanRadixNode48_
+{
+    ZyanRadixNode header;
+    /**
+     * Maps every key byte to a child slot (`index + 1`) or `0`, if there is no such child.
+     */
+    ZyanU8 index[256];
+    /**
+     * The densely packed children.
+     */
+    void* children[48];
+} ZyanRadixNode48;
+
+/**
+ * Defines the `ZyanRadixNode256` struct.
+ */
+typedef struct ZyanRadixNode256_
+{
+    ZyanRadixNode header;
+    /**
+     * The children, indexed by key byte.
+     */
+    void* children[256];
+} ZyanRadixNode256;
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+#define ZYAN_RADIX_TYPE(node) \
+    (*(const ZyanU8*)(node))
+
+#define ZYAN_RADIX_LEAF_KEY(tree, leaf) \
+    ((const ZyanU8*)(leaf) + (tree)->key_offset)
+
+#define ZYAN_RADIX_LEAF_VALUE(tree, leaf) \
+    ((void*)((ZyanU8*)(leaf) + (tree)->value_offset))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the data and length of the given string view.
+ *
+ * @param   view    A pointer to the `ZyanStringView` instance.
+ * @param   data    Receives a pointer to the string data.
+ * @param   length  Receives the length of the string.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRadixTreeGetKey(const ZyanStringView* view, const ZyanU8** data,
+    ZyanUSize* length)
+{
+    if (!view || !view->string.vector.size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *data = (const ZyanU8*)view->string.vector.data;
+    *length = view->string.vector.size - 1;
+
+    // The prefix length of inner nodes is limited to 32 bits
+    if (*length > ZYAN_UINT32_MAX)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Checks if the key of the given leaf matches the given key.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   leaf    A pointer to the leaf.
+ * @param   key     A pointer to the key.
+ * @param   length  The length of the key.
+ *
+ * @return  `ZYAN_TRUE` if the keys are equal or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanRadixLeafMatches(const ZyanRadixTree* tree, const ZyanRadixLeaf* leaf,
+    const ZyanU8* key, ZyanUSize length)
+{
+    return (leaf->length == length) && !ZYAN_MEMCMP(ZYAN_RADIX_LEAF_KEY(tree, leaf), key, length);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Node management                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the size of an inner node of the given type.
+ *
+ * @param   type    The node type.
+ *
+ * @return  The size of the node in bytes.
+ */
+static ZyanUSize ZyanRadixNodeSize(ZyanU8 type)
+{
+    switch (type)
+    {
+    case ZYAN_RADIX_NODE_4:
+        return sizeof(ZyanRadixNode4);
+    case ZYAN_RADIX_NODE_16:
+        return sizeof(ZyanRadixNode16);
+    case ZYAN_RADIX_NODE_48:
+        return sizeof(ZyanRadixNode48);
+    case ZYAN_RADIX_NODE_256:
+        return sizeof(ZyanRadixNode256);
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * Allocates a new leaf.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   length  The length of the key.
+ * @param   value   A pointer to the value.
+ * @param   leaf    Receives a pointer to the new leaf.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRadixLeafCreate(ZyanRadixTree* tree, const ZyanU8* key, ZyanUSize length,
+    const void* value, ZyanRadixLeaf** leaf)
+{
+    void* memory;
+    ZYAN_CHECK(tree->allocator->allocate(tree->allocator, &memory, 1, tree->key_offset + length));
+
+    *leaf = (ZyanRadixLeaf*)memory;
+    (*leaf)->type = ZYAN_RADIX_NODE_LEAF;
+    (*leaf)->length = length;
+    if (tree->value_size)
+    {
+        ZYAN_MEMCPY((ZyanU8*)memory + tree->value_offset, value, tree->value_size);
+    }
+    ZYAN_MEMCPY((ZyanU8*)memory + tree->key_offset, key, length);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Frees the given leaf.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   leaf    A pointer to the leaf.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRadixLeafFree(ZyanRadixTree* tree, ZyanRadixLeaf* leaf)
+{
+    return tree->allocator->deallocate(tree->allocator, leaf, 1, tree->key_offset + leaf->length);
+}
+
+/**
+ * Allocates a new inner node.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   type    The node type.
+ * @param   node    Receives a pointer to the new node.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRadixNodeCreate(ZyanRadixTree* tree, ZyanU8 type, ZyanRadixNode** node)
+{
+    const ZyanUSize size = ZyanRadixNodeSize(type);
+
+    void* memory;
+    ZYAN_CHECK(tree->allocator->allocate(tree->allocator, &memory, 1, size));
+    ZYAN_MEMSET(memory, 0, size);
+
+    *node = (ZyanRadixNode*)memory;
+    (*node)->type = type;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Frees the given inner node (but not its children).
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   node    A pointer to the node.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRadixNodeFree(ZyanRadixTree* tree, ZyanRadixNode* node)
+{
+    return tree->allocator->deallocate(tree->allocator, node, 1, ZyanRadixNodeSize(node->type));
+}
+
+/**
+ * Frees the given subtree.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   node    A pointer to the root of the subtree.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRadixFreeSubtree(ZyanRadixTree* tree, void* node)
+{
+    if (ZYAN_RADIX_TYPE(node) == ZYAN_RADIX_NODE_LEAF)
+    {
+        return ZyanRadixLeafFree(tree, (ZyanRadixLeaf*)node);
+    }
+
+    ZyanRadixNode* const inner = (ZyanRadixNode*)node;
+    if (inner->leaf)
+    {
+        ZYAN_CHECK(ZyanRadixLeafFree(tree, inner->leaf));
+    }
+
+    void** children;
+    ZyanUSize count;
+    switch (inner->type)
+    {
+    case ZYAN_RADIX_NODE_4:
+        children = ((ZyanRadixNode4*)inner)->children;
+        count = inner->count;
+        break;
+    case ZYAN_RADIX_NODE_16:
+        children = ((ZyanRadixNode16*)inner)->children;
+        count = inner->count;
+        break;
+    case ZYAN_RADIX_NODE_48:
+        children = ((ZyanRadixNode48*)inner)->children;
+        count = inner->count;
+        break;
+    case ZYAN_RADIX_NODE_256:
+        children = ((ZyanRadixNode256*)inner)->children;
+        count = 256;
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        if (children[i])
+        {
+            ZYAN_CHECK(ZyanRadixFreeSubtree(tree, children[i]));
+        }
+    }
+
+    return ZyanRadixNodeFree(tree, inner);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Children                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a pointer to the child slot of the given node for the given key byte.
+ *
+ * @param   node    A pointer to the inner node.
+ * @param   byte    The key byte.
+ *
+ * @return  A pointer to the child slot or `ZYAN_NULL`, if there is no such child.
+ */
+static void** ZyanRadixFindChild(ZyanRadixNode* node, ZyanU8 byte)
+{
+    switch (node->type)
+    {
+    case ZYAN_RADIX_NODE_4:
+    {
+        ZyanRadixNode4* const n = (ZyanRadixNode4*)node;
+        for (ZyanUSize i = 0; i < node->count; ++i)
+        {
+            if (n->keys[i] == byte)
+            {
+                return &n->children[i];
+            }
+        }
+        return ZYAN_NULL;
+    }
+    case ZYAN_RADIX_NODE_16:
+    {
+        ZyanRadixNode16* const n = (ZyanRadixNode16*)node;
+#if defined(ZYAN_RADIX_SSE2)
+        const __m128i cmp = _mm_cmpeq_epi8(_mm_set1_epi8((char)byte),
+            _mm_loadu_si128((const __m128i*)n->keys));
+        const ZyanU32 mask = (ZyanU32)_mm_movemask_epi8(cmp) & ((1u << node->count) - 1);
+        return mask ? &n->children[ZyanBitCountTrailingZeros32(mask)] : ZYAN_NULL;
+#else
+        for (ZyanUSize i = 0; i < node->count; ++i)
+        {
+            if (n->keys[i] == byte)
+            {
+                return &n->children[i];
+            }
+        }
+        return ZYAN_NULL;
+#endif
+    }
+    case ZYAN_RADIX_NODE_48:
+    {
+        ZyanRadixNode48* const n = (ZyanRadixNode48*)node;
+        const ZyanU8 index = n->index[byte];
+        return index ? &n->children[index - 1] : ZYAN_NULL;
+    }
+    case ZYAN_RADIX_NODE_256:
+    {
+        ZyanRadixNode256* const n = (ZyanRadixNode256*)node;
+        return n->children[byte] ? &n->children[byte] : ZYAN_NULL;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * Inserts a child into a sorted key array.
+ *
+ * @param   keys        A pointer to the key bytes.
+ * @param   children    A pointer to the children.
+ * @param   count       The current number of children.
+ * @param   byte        The key byte.
+ * @param   child       A pointer to the child.
+ */
+static void ZyanRadixInsertSorted(ZyanU8* keys, void** children, ZyanUSize count, ZyanU8 byte,
+    void* child)
+{
+    ZyanUSize index = 0;
+    while ((index < count) && (keys[index] < byte))
+    {
+        ++index;
+    }
+
+    ZYAN_MEMMOVE(keys + index + 1, keys + index, count - index);
+    ZYAN_MEMMOVE(children + index + 1, children + index, (count - index) * sizeof(void*));
+    keys[index] = byte;
+    children[index] = child;
+}
+
+/**
+ * Replaces the given node by a node of a different type with the same contents.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   ref     A pointer to the slot that references the node.
+ * @param   type    The new node type.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRadixNodeConvert(ZyanRadixTree* tree, void** ref, ZyanU8 type)
+{
+    ZyanRadixNode* const node = (ZyanRadixNode*)*ref;
+    ZyanRadixNode* result;
+    ZYAN_CHECK(ZyanRadixNodeCreate(tree, type, &result));
+
+    ZYAN_MEMCPY(result, node, sizeof(ZyanRadixNode));
+    result->type = type;
+
+    // Collect the children of the old node in key order
+    ZyanU8 keys[256];
+    void* children[256];
+    ZyanUSize count = 0;
+    switch (node->type)
+    {
+    case ZYAN_RADIX_NODE_4:
+        count = node->count;
+        ZYAN_MEMCPY(keys, ((ZyanRadixNode4*)node)->keys, count);
+        ZYAN_MEMCPY(children, ((ZyanRadixNode4*)node)->children, count * sizeof(void*));
+        break;
+    case ZYAN_RADIX_NODE_16:
+        count = node->count;
+        ZYAN_MEMCPY(keys, ((ZyanRadixNode16*)node)->keys, count);
+        ZYAN_MEMCPY(children, ((ZyanRadixNode16*)node)->children, count * sizeof(void*));
+        break;
+    case ZYAN_RADIX_NODE_48:
+    {
+        const ZyanRadixNode48* const n = (const ZyanRadixNode48*)node;
+        for (ZyanUSize i = 0; i < 256; ++i)
+        {
+            if (n->index[i])
+            {
+                keys[count] = (ZyanU8)i;
+                children[count++] = n->children[n->index[i] - 1];
+            }
+        }
+        break;
+    }
+    case ZYAN_RADIX_NODE_256:
+    {
+        const ZyanRadixNode256* const n = (const ZyanRadixNode256*)node;
+        for (ZyanUSize i = 0; i < 256; ++i)
+        {
+            if (n->children[i])
+            {
+                keys[count] = (ZyanU8)i;
+                children[count++] = n->children[i];
+            }
+        }
+        break;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+    ZYAN_ASSERT(count == node->count);
+
+    switch (type)
+    {
+    case ZYAN_RADIX_NODE_4:
+        ZYAN_MEMCPY(((ZyanRadixNode4*)result)->keys, keys, count);
+        ZYAN_MEMCPY(((ZyanRadixNode4*)result)->children, children, count * sizeof(void*));
+        break;
+    case ZYAN_RADIX_NODE_16:
+        ZYAN_MEMCPY(((ZyanRadixNode16*)result)->keys, keys, count);
+        ZYAN_MEMCPY(((ZyanRadixNode16*)result)->children, children, count * sizeof(void*));
+        break;
+    case ZYAN_RADIX_NODE_48:
+    {
+        ZyanRadixNode48* const n = (ZyanRadixNode48*)result;
+        for (ZyanUSize i = 0; i < count; ++i)
+        {
+            n->index[keys[i]] = (ZyanU8)(i + 1);
+            n->children[i] = children[i];
+        }
+        break;
+    }
+    case ZYAN_RADIX_NODE_256:
+    {
+        ZyanRadixNode256* const n = (ZyanRadixNode256*)result;
+        for (ZyanUSize i = 0; i < count; ++i)
+        {
+            n->children[keys[i]] = children[i];
+        }
+        break;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+    *ref = result;
+
+    return ZyanRadixNodeFree(tree, node);
+}
+
+/**
+ * Adds a child to the given node, growing the node if required.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   ref     A pointer to the slot that references the node.
+ * @param   byte    The key byte. There must not be a child for this byte yet.
+ * @param   child   A pointer to the child.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRadixAddChild(ZyanRadixTree* tree, void** ref, ZyanU8 byte, void* child)
+{
+    ZyanRadixNode* node = (ZyanRadixNode*)*ref;
+
+    static const ZyanU16 capacity[] = { 0, 4, 16, 48, 256 };
+    if (node->count == capacity[node->type])
+    {
+        ZYAN_CHECK(ZyanRadixNodeConvert(tree, ref, (ZyanU8)(node->type + 1)));
+        node = (ZyanRadixNode*)*ref;
+    }
+
+    switch (node->type)
+    {
+    case ZYAN_RADIX_NODE_4:
+    {
+        ZyanRadixNode4* const n = (ZyanRadixNode4*)node;
+        ZyanRadixInsertSorted(n->keys, n->children, node->count, byte, child);
+        break;
+    }
+    case ZYAN_RADIX_NODE_16:
+    {
+        ZyanRadixNode16* const n = (ZyanRadixNode16*)node;
+        ZyanRadixInsertSorted(n->keys, n->children, node->count, byte, child);
+        break;
+    }
+    case ZYAN_RADIX_NODE_48:
+    {
+        ZyanRadixNode48* const n = (ZyanRadixNode48*)node;
+        n->children[node->count] = child;
+        n->index[byte] = (ZyanU8)(node->count + 1);
+        break;
+    }
+    case ZYAN_RADIX_NODE_256:
+        ((ZyanRadixNode256*)node)->children[byte] = child;
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+    ++node->count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Shrinks or collapses the given node after a child or its leaf was removed.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   ref     A pointer to the slot that references the node.
+ *
+ * @return  A zyan status code.
+ *
+ * Shrinking a node is an optimization only. If the allocation of the smaller node fails, the
+ * node is left unchanged.
+ */
+static ZyanStatus ZyanRadixCompact(ZyanRadixTree* tree, void** ref)
+{
+    ZyanRadixNode* const node = (ZyanRadixNode*)*ref;
+
+    switch (node->type)
+    {
+    case ZYAN_RADIX_NODE_4:
+        break;
+    case ZYAN_RADIX_NODE_16:
+        if (node->count <= 3)
+        {
+            ZyanRadixNodeConvert(tree, ref, ZYAN_RADIX_NODE_4);
+        }
+        return ZYAN_STATUS_SUCCESS;
+    case ZYAN_RADIX_NODE_48:
+        if (node->count <= 12)
+        {
+            ZyanRadixNodeConvert(tree, ref, ZYAN_RADIX_NODE_16);
+        }
+        return ZYAN_STATUS_SUCCESS;
+    case ZYAN_RADIX_NODE_256:
+        if (node->count <= 37)
+        {
+            ZyanRadixNodeConvert(tree, ref, ZYAN_RADIX_NODE_48);
+        }
+        return ZYAN_STATUS_SUCCESS;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+    ZyanRadixNode4* const n = (ZyanRadixNode4*)node;
+    if (!node->count)
+    {
+        // Only the leaf is left. Leaves store the complete key, so the prefix can be dropped
+        *ref = node->leaf;
+        return ZyanRadixNodeFree(tree, node);
+    }
+    if ((node->count > 1) || node->leaf)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    void* const child = n->children[0];
+    if (ZYAN_RADIX_TYPE(child) != ZYAN_RADIX_NODE_LEAF)
+    {
+        // Merge the prefix of this node and the key byte into the prefix of the child
+        ZyanRadixNode* const c = (ZyanRadixNode*)child;
+        ZyanU8 prefix[ZYAN_RADIX_TREE_MAX_PREFIX];
+        ZyanUSize length = ZYAN_MIN(node->prefix_length, ZYAN_RADIX_TREE_MAX_PREFIX);
+        ZYAN_MEMCPY(prefix, node->prefix, length);
+        if (length < ZYAN_RADIX_TREE_MAX_PREFIX)
+        {
+            prefix[length++] = n->keys[0];
+        }
+        if (length < ZYAN_RADIX_TREE_MAX_PREFIX)
+        {
+            ZYAN_MEMCPY(prefix + length, c->prefix, ZYAN_MIN(c->prefix_length,
+                ZYAN_RADIX_TREE_MAX_PREFIX - length));
+        }
+        ZYAN_MEMCPY(c->prefix, prefix, ZYAN_RADIX_TREE_MAX_PREFIX);
+        c->prefix_length += node->prefix_length + 1;
+    }
+
+    *ref = child;
+
+    return ZyanRadixNodeFree(tree, node);
+}
+
+/**
+ * Removes the child for the given key byte from the given node.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   ref     A pointer to the slot that references the node.
+ * @param   byte    The key byte.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRadixRemoveChild(ZyanRadixTree* tree, void** ref, ZyanU8 byte)
+{
+    ZyanRadixNode* const node = (ZyanRadixNode*)*ref;
+
+    switch (node->type)
+    {
+    case ZYAN_RADIX_NODE_4:
+    case ZYAN_RADIX_NODE_16:
+    {
+        ZyanU8* const keys = (node->type == ZYAN_RADIX_NODE_4) ?
+            ((ZyanRadixNode4*)node)->keys : ((ZyanRadixNode16*)node)->keys;
+        void** const children = (node->type == ZYAN_RADIX_NODE_4) ?
+            ((ZyanRadixNode4*)node)->children : ((ZyanRadixNode16*)node)->children;
+        ZyanUSize index = 0;
+        while (keys[index] != byte)
+        {
+            ++index;
+        }
+        ZYAN_MEMMOVE(keys + index, keys + index + 1, node->count - index - 1);
+        ZYAN_MEMMOVE(children + index, children + index + 1,
+            (node->count - index - 1) * sizeof(void*));
+        break;
+    }
+    case ZYAN_RADIX_NODE_48:
+    {
+        // Move the last child into the free slot to keep the children densely packed
+        ZyanRadixNode48* const n = (ZyanRadixNode48*)node;
+        const ZyanU8 slot = n->index[byte];
+        n->index[byte] = 0;
+        if (slot != node->count)
+        {
+            n->children[slot - 1] = n->children[node->count - 1];
+            for (ZyanUSize i = 0; i < 256; ++i)
+            {
+                if (n->index[i] == node->count)
+                {
+                    n->index[i] = slot;
+                    break;
+                }
+            }
+        }
+        break;
+    }
+    case ZYAN_RADIX_NODE_256:
+        ((ZyanRadixNode256*)node)->children[byte] = ZYAN_NULL;
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+    --node->count;
+
+    return ZyanRadixCompact(tree, ref);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Searching                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns an arbitrary leaf (the one with the smallest key) of the given subtree.
+ *
+ * @param   node    A pointer to the root of the subtree.
+ *
+ * @return  A pointer to the leaf.
+ */
+static const ZyanRadixLeaf* ZyanRadixMinimum(const void* node)
+{
+    while (ZYAN_RADIX_TYPE(node) != ZYAN_RADIX_NODE_LEAF)
+    {
+        const ZyanRadixNode* const inner = (const ZyanRadixNode*)node;
+        if (inner->leaf)
+        {
+            return inner->leaf;
+        }
+
+        switch (inner->type)
+        {
+        case ZYAN_RADIX_NODE_4:
+            node = ((const ZyanRadixNode4*)inner)->children[0];
+            break;
+        case ZYAN_RADIX_NODE_16:
+            node = ((const ZyanRadixNode16*)inner)->children[0];
+            break;
+        case ZYAN_RADIX_NODE_48:
+        {
+            const ZyanRadixNode48* const n = (const ZyanRadixNode48*)inner;
+            ZyanUSize i = 0;
+            while (!n->index[i])
+            {
+                ++i;
+            }
+            node = n->children[n->index[i] - 1];
+            break;
+        }
+        case ZYAN_RADIX_NODE_256:
+        {
+            const ZyanRadixNode256* const n = (const ZyanRadixNode256*)inner;
+            ZyanUSize i = 0;
+            while (!n->children[i])
+            {
+                ++i;
+            }
+            node = n->children[i];
+            break;
+        }
+        default:
+            ZYAN_UNREACHABLE;
+        }
+    }
+
+    return (const ZyanRadixLeaf*)node;
+}
+
+/**
+ * Compares the prefix of the given node with the given key.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   node    A pointer to the inner node.
+ * @param   key     A pointer to the key.
+ * @param   length  The length of the key.
+ * @param   depth   The offset of the node prefix inside the key.
+ *
+ * @return  The number of matching bytes. The complete prefix matched, if the result equals the
+ *          prefix length.
+ */
+static ZyanUSize ZyanRadixPrefixMismatch(const ZyanRadixTree* tree, const ZyanRadixNode* node,
+    const ZyanU8* key, ZyanUSize length, ZyanUSize depth)
+{
+    const ZyanUSize max = ZYAN_MIN(node->prefix_length, length - depth);
+    const ZyanUSize stored = ZYAN_MIN(max, ZYAN_RADIX_TREE_MAX_PREFIX);
+
+    ZyanUSize i = 0;
+    for (; i < stored; ++i)
+    {
+        if (node->prefix[i] != key[depth + i])
+        {
+            return i;
+        }
+    }
+
+    if (max > ZYAN_RADIX_TREE_MAX_PREFIX)
+    {
+        const ZyanU8* const other = ZYAN_RADIX_LEAF_KEY(tree, ZyanRadixMinimum(node));
+        for (; i < max; ++i)
+        {
+            if (other[depth + i] != key[depth + i])
+            {
+                return i;
+            }
+        }
+    }
+
+    return max;
+}
+
+/**
+ * Searches for the leaf of the given key.
+ *
+ * @param   tree    A pointer to the `ZyanRadixTree` instance.
+ * @param   key     A pointer to the key.
+ * @param   length  The length of the key.
+ *
+ * @return  A pointer to the leaf or `ZYAN_NULL`, if the key does not exist.
+ *
+ * Only the stored prefix bytes are compared while descending. The skipped bytes are verified by
+ * the final comparison with the complete key stored in the leaf.
+ */
+static ZyanRadixLeaf* ZyanRadixFindLeaf(const ZyanRadixTree* tree, const ZyanU8* key,
+    ZyanUSize length)
+{
+    void* node = tree->root;
+    ZyanUSize depth = 0;
+
+    while (node)
+    {
+        if (ZYAN_RADIX_TYPE(node) == ZYAN_RADIX_NODE_LEAF)
+        {
+            ZyanRadixLeaf* const leaf = (ZyanRadixLeaf*)node;
+            return ZyanRadixLeafMatches(tree, leaf, key, length) ? leaf : ZYAN_NULL;
+        }
+
+        ZyanRadixNode* const inner = (ZyanRadixNode*)node;
+        if (inner->prefix_length)
+        {
+            if (inner->prefix_length > length - depth)
+            {
+                return ZYAN_NULL;
+            }
+            const ZyanUSize stored = ZYAN_MIN(inner->prefix_length, ZYAN_RADIX_TREE_MAX_PREFIX);
+            if (ZYAN_MEMCMP(inner->prefix, key + depth, stored))
+            {
+                return ZYAN_NULL;
+            }
+            depth += inner->prefix_length;
+        }
+
+        if (depth == length)
+        {
+            return (inner->leaf && ZyanRadixLeafMatches(tree, inner->leaf, key, length)) ?
+                inner->leaf : ZYAN_NULL;
+        }
+
+        void** const child = ZyanRadixFindChild(inner, key[depth++]);
+        node = child ? *child : ZYAN_NULL;
+    }
+
+    return ZYAN_NULL;
+}
+
+/**
+ * Invokes the given callback for every leaf of the given subtree in key order.
+ *
+ * @param   tree        A pointer to the `ZyanRadixTree` instance.
+ * @param   node        A pointer to the root of the subtree.
+ * @param   callback    The callback function.
+ * @param   user_data   The user data pointer.
+ *
+ * @return  `ZYAN_STATUS_TRUE` to continue the iteration, `ZYAN_STATUS_FALSE` if the iteration
+ *          was stopped or another zyan status code if an error occurred.
+ */
+static ZyanStatus ZyanRadixVisit(const ZyanRadixTree* tree, const void* node,
+    ZyanRadixTreeCallback callback, void* user_data)
+{
+    if (ZYAN_RADIX_TYPE(node) == ZYAN_RADIX_NODE_LEAF)
+    {
+        const ZyanRadixLeaf* const leaf = (const ZyanRadixLeaf*)node;
+        const ZyanStatus status = callback((const char*)ZYAN_RADIX_LEAF_KEY(tree, leaf),
+            leaf->length, ZYAN_RADIX_LEAF_VALUE(tree, leaf), user_data);
+        return ((status == ZYAN_STATUS_FALSE) || !ZYAN_SUCCESS(status)) ?
+            status : ZYAN_STATUS_TRUE;
+    }
+
+    const ZyanRadixNode* const inner = (const ZyanRadixNode*)node;
+    ZyanStatus status = ZYAN_STATUS_TRUE;
+    if (inner->leaf)
+    {
+        status = ZyanRadixVisit(tree, inner->leaf, callback, user_data);
+    }
+
+    switch (inner->type)
+    {
+    case ZYAN_RADIX_NODE_4:
+    case ZYAN_RADIX_NODE_16:
+    {
+        void* const* const children = (inner->type == ZYAN_RADIX_NODE_4) ?
+            ((const ZyanRadixNode4*)inner)->children : ((const ZyanRadixNode16*)inner)->children;
+        for (ZyanUSize i = 0; (status == ZYAN_STATUS_TRUE) && (i < inner->count); ++i)
+        {
+            status = ZyanRadixVisit(tree, children[i], callback, user_data);
+        }
+        break;
+    }
+    case ZYAN_RADIX_NODE_48:
+    {
+        const ZyanRadixNode48* const n = (const ZyanRadixNode48*)inner;
+        for (ZyanUSize i = 0; (status == ZYAN_STATUS_TRUE) && (i < 256); ++i)
+        {
+            if (n->index[i])
+            {
+                status = ZyanRadixVisit(tree, n->children[n->index[i] - 1], callback,
+                    user_data);
+            }
+        }
+        break;
+    }
+    case ZYAN_RADIX_NODE_256:
+    {
+        const ZyanRadixNode256* const n = (const ZyanRadixNode256*)inner;
+        for (ZyanUSize i = 0; (status == ZYAN_STATUS_TRUE) && (i < 256); ++i)
+        {
+            if (n->children[i])
+            {
+                status = ZyanRadixVisit(tree, n->children[i], callback, user_data);
+            }
+        }
+        break;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+    return status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanRadixTreeInit(ZyanRadixTree* tree, ZyanUSize value_size)
+{
+    return ZyanRadixTreeInitEx(tree, value_size, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanRadixTreeInitEx(ZyanRadixTree* tree, ZyanUSize value_size,
+    ZyanAllocator* allocator)
+{
+    if (!tree || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(allocator->allocate);
+    ZYAN_ASSERT(allocator->deallocate);
+
+    const ZyanUSize value_alignment =
+        value_size ? ZYAN_MIN(value_size & (~value_size + 1), 8) : 1;
+
+    tree->allocator    = allocator;
+    tree->value_size   = value_size;
+    tree->value_offset = ZYAN_ALIGN_UP(sizeof(ZyanRadixLeaf), value_alignment);
+    tree->key_offset   = tree->value_offset + value_size;
+    tree->size         = 0;
+    tree->root         = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRadixTreeDestroy(ZyanRadixTree* tree)
+{
+    return ZyanRadixTreeClear(tree);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRadixTreeInsert(ZyanRadixTree* tree, const ZyanStringView* key,
+    const void* value)
+{
+    if (!tree || (tree->value_size && !value))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* data;
+    ZyanUSize length;
+    ZYAN_CHECK(ZyanRadixTreeGetKey(key, &data, &length));
+
+    void** ref = &tree->root;
+    ZyanUSize depth = 0;
+
+    while (*ref)
+    {
+        if (ZYAN_RADIX_TYPE(*ref) == ZYAN_RADIX_NODE_LEAF)
+        {
+            ZyanRadixLeaf* const leaf = (ZyanRadixLeaf*)*ref;
+            if (ZyanRadixLeafMatches(tree, leaf, data, length))
+            {
+                if (tree->value_size)
+                {
+                    ZYAN_MEMCPY(ZYAN_RADIX_LEAF_VALUE(tree, leaf), value, tree->value_size);
+                }
+                return ZYAN_STATUS_FALSE;
+            }
+
+            // Replace the leaf by a new node that branches at the first differing byte
+            ZyanRadixLeaf* new_leaf;
+            ZYAN_CHECK(ZyanRadixLeafCreate(tree, data, length, value, &new_leaf));
+            ZyanRadixNode* node;
+            const ZyanStatus status = ZyanRadixNodeCreate(tree, ZYAN_RADIX_NODE_4, &node);
+            if (!ZYAN_SUCCESS(status))
+            {
+                ZyanRadixLeafFree(tree, new_leaf);
+                return status;
+            }
+
+            const ZyanU8* const other = ZYAN_RADIX_LEAF_KEY(tree, leaf);
+            const ZyanUSize limit = ZYAN_MIN(leaf->length, length);
+            ZyanUSize split = depth;
+            while ((split < limit) && (other[split] == data[split]))
+            {
+                ++split;
+            }
+            node->prefix_length = (ZyanU32)(split - depth);
+            ZYAN_MEMCPY(node->prefix, data + depth,
+                ZYAN_MIN(node->prefix_length, ZYAN_RADIX_TREE_MAX_PREFIX));
+
+            void* slot = node;
+            ZyanRadixLeaf* const leaves[2] = { leaf, new_leaf };
+            for (ZyanUSize i = 0; i < 2; ++i)
+            {
+                if (leaves[i]->length == split)
+                {
+                    node->leaf = leaves[i];
+                    continue;
+                }
+                // A node 4 with less than 4 children never has to grow
+                ZYAN_CHECK(ZyanRadixAddChild(tree, &slot,
+                    ZYAN_RADIX_LEAF_KEY(tree, leaves[i])[split], leaves[i]));
+            }
+
+            *ref = node;
+            ++tree->size;
+            return ZYAN_STATUS_TRUE;
+        }
+
+        ZyanRadixNode* const node = (ZyanRadixNode*)*ref;
+        if (node->prefix_length)
+        {
+            const ZyanUSize match = ZyanRadixPrefixMismatch(tree, node, data, length, depth);
+            if (match < node->prefix_length)
+            {
+                // Split the prefix by inserting a new node above this one
+                ZyanRadixLeaf* new_leaf;
+                ZYAN_CHECK(ZyanRadixLeafCreate(tree, data, length, value, &new_leaf));
+                ZyanRadixNode* parent;
+                const ZyanStatus status = ZyanRadixNodeCreate(tree, ZYAN_RADIX_NODE_4, &parent);
+                if (!ZYAN_SUCCESS(status))
+                {
+                    ZyanRadixLeafFree(tree, new_leaf);
+                    return status;
+                }
+
+                parent->prefix_length = (ZyanU32)match;
+                ZYAN_MEMCPY(parent->prefix, node->prefix,
+                    ZYAN_MIN(match, ZYAN_RADIX_TREE_MAX_PREFIX));
+
+                // Strip the common part and the branch byte from the prefix of this node
+                ZyanU8 byte;
+                const ZyanUSize remaining = node->prefix_length - match - 1;
+                if (node->prefix_length <= ZYAN_RADIX_TREE_MAX_PREFIX)
+                {
+                    byte = node->prefix[match];
+                    ZYAN_MEMMOVE(node->prefix, node->prefix + match + 1, remaining);
+                } else
+                {
+                    const ZyanU8* const other =
+                        ZYAN_RADIX_LEAF_KEY(tree, ZyanRadixMinimum(node)) + depth + match;
+                    byte = other[0];
+                    ZYAN_MEMCPY(node->prefix, other + 1,
+                        ZYAN_MIN(remaining, ZYAN_RADIX_TREE_MAX_PREFIX));
+                }
+                node->prefix_length = (ZyanU32)remaining;
+
+                void* slot = parent;
+                ZYAN_CHECK(ZyanRadixAddChild(tree, &slot, byte, node));
+                if (depth + match == length)
+                {
+                    parent->leaf = new_leaf;
+                } else
+                {
+                    ZYAN_CHECK(ZyanRadixAddChild(tree, &slot, data[depth + match], new_leaf));
+                }
+
+                *ref = parent;
+                ++tree->size;
+                return ZYAN_STATUS_TRUE;
+            }
+            depth += node->prefix_length;
+        }
+
+        if (depth == length)
+        {
+            if (node->leaf)
+            {
+                if (tree->value_size)
+                {
+                    ZYAN_MEMCPY(ZYAN_RADIX_LEAF_VALUE(tree, node->leaf), value,
+                        tree->value_size);
+                }
+                return ZYAN_STATUS_FALSE;
+            }
+
+            ZYAN_CHECK(ZyanRadixLeafCreate(tree, data, length, value, &node->leaf));
+            ++tree->size;
+            return ZYAN_STATUS_TRUE;
+        }
+
+        void** const child = ZyanRadixFindChild(node, data[depth]);
+        if (!child)
+        {
+            ZyanRadixLeaf* new_leaf;
+            ZYAN_CHECK(ZyanRadixLeafCreate(tree, data, length, value, &new_leaf));
+            const ZyanStatus status = ZyanRadixAddChild(tree, ref, data[depth], new_leaf);
+            if (!ZYAN_SUCCESS(status))
+            {
+                ZyanRadixLeafFree(tree, new_leaf);
+                return status;
+            }
+            ++tree->size;
+            return ZYAN_STATUS_TRUE;
+        }
+
+        ref = child;
+        ++depth;
+    }
+
+    ZyanRadixLeaf* leaf;
+    ZYAN_CHECK(ZyanRadixLeafCreate(tree, data, length, value, &leaf));
+    *ref = leaf;
+    ++tree->size;
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRadixTreeRemove(ZyanRadixTree* tree, const ZyanStringView* key)
+{
+    if (!tree)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* data;
+    ZyanUSize length;
+    ZYAN_CHECK(ZyanRadixTreeGetKey(key, &data, &length));
+
+    if (!tree->root)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+    if (ZYAN_RADIX_TYPE(tree->root) == ZYAN_RADIX_NODE_LEAF)
+    {
+        ZyanRadixLeaf* const leaf = (ZyanRadixLeaf*)tree->root;
+        if (!ZyanRadixLeafMatches(tree, leaf, data, length))
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+        tree->root = ZYAN_NULL;
+        --tree->size;
+        ZYAN_CHECK(ZyanRadixLeafFree(tree, leaf));
+        return ZYAN_STATUS_TRUE;
+    }
+
+    void** ref = &tree->root;
+    ZyanUSize depth = 0;
+    for (;;)
+    {
+        ZyanRadixNode* const node = (ZyanRadixNode*)*ref;
+        if (ZyanRadixPrefixMismatch(tree, node, data, length, depth) != node->prefix_length)
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+        depth += node->prefix_length;
+
+        if (depth == length)
+        {
+            ZyanRadixLeaf* const leaf = node->leaf;
+            if (!leaf)
+            {
+                return ZYAN_STATUS_FALSE;
+            }
+            node->leaf = ZYAN_NULL;
+            --tree->size;
+            ZYAN_CHECK(ZyanRadixLeafFree(tree, leaf));
+            ZYAN_CHECK(ZyanRadixCompact(tree, ref));
+            return ZYAN_STATUS_TRUE;
+        }
+
+        const ZyanU8 byte = data[depth++];
+        void** const child = ZyanRadixFindChild(node, byte);
+        if (!child)
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+
+        if (ZYAN_RADIX_TYPE(*child) == ZYAN_RADIX_NODE_LEAF)
+        {
+            ZyanRadixLeaf* const leaf = (ZyanRadixLeaf*)*child;
+            if (!ZyanRadixLeafMatches(tree, leaf, data, length))
+            {
+                return ZYAN_STATUS_FALSE;
+            }
+            --tree->size;
+            ZYAN_CHECK(ZyanRadixLeafFree(tree, leaf));
+            ZYAN_CHECK(ZyanRadixRemoveChild(tree, ref, byte));
+            return ZYAN_STATUS_TRUE;
+        }
+
+        ref = child;
+    }
+}
+
+ZyanStatus ZyanRadixTreeClear(ZyanRadixTree* tree)
+{
+    if (!tree)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (tree->root)
+    {
+        ZYAN_CHECK(ZyanRadixFreeSubtree(tree, tree->root));
+    }
+    tree->root = ZYAN_NULL;
+    tree->size = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRadixTreeGet(const ZyanRadixTree* tree, const ZyanStringView* key,
+    const void** value)
+{
+    return ZyanRadixTreeGetMutable((ZyanRadixTree*)tree, key, (void**)value);
+}
+
+ZyanStatus ZyanRadixTreeGetMutable(ZyanRadixTree* tree, const ZyanStringView* key,
+    void** value)
+{
+    if (!tree || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* data;
+    ZyanUSize length;
+    ZYAN_CHECK(ZyanRadixTreeGetKey(key, &data, &length));
+
+    const ZyanRadixLeaf* const leaf = ZyanRadixFindLeaf(tree, data, length);
+    *value = leaf ? ZYAN_RADIX_LEAF_VALUE(tree, leaf) : ZYAN_NULL;
+
+    return leaf ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanRadixTreeFindLongestPrefix(const ZyanRadixTree* tree,
+    const ZyanStringView* string, ZyanUSize* length, const void** value)
+{
+    if (!tree)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* data;
+    ZyanUSize size;
+    ZYAN_CHECK(ZyanRadixTreeGetKey(string, &data, &size));
+
+    const ZyanRadixLeaf* best = ZYAN_NULL;
+    const void* node = tree->root;
+    ZyanUSize depth = 0;
+    while (node)
+    {
+        if (ZYAN_RADIX_TYPE(node) == ZYAN_RADIX_NODE_LEAF)
+        {
+            const ZyanRadixLeaf* const leaf = (const ZyanRadixLeaf*)node;
+            if ((leaf->length <= size) &&
+                !ZYAN_MEMCMP(ZYAN_RADIX_LEAF_KEY(tree, leaf), data, leaf->length))
+            {
+                best = leaf;
+            }
+            break;
+        }
+
+        ZyanRadixNode* const inner = (ZyanRadixNode*)node;
+        if (ZyanRadixPrefixMismatch(tree, inner, data, size, depth) != inner->prefix_length)
+        {
+            break;
+        }
+        depth += inner->prefix_length;
+
+        // All bytes up to `depth` were compared, so the key of the leaf is a prefix
+        if (inner->leaf)
+        {
+            best = inner->leaf;
+        }
+        if (depth == size)
+        {
+            break;
+        }
+
+        void** const child = ZyanRadixFindChild(inner, data[depth++]);
+        node = child ? *child : ZYAN_NULL;
+    }
+
+    if (length)
+    {
+        *length = best ? best->length : 0;
+    }
+    if (value)
+    {
+        *value = best ? ZYAN_RADIX_LEAF_VALUE(tree, best) : ZYAN_NULL;
+    }
+
+    return best ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRadixTreeForEachPrefix(const ZyanRadixTree* tree, const ZyanStringView* prefix,
+    ZyanRadixTreeCallback callback, void* user_data)
+{
+    if (!tree || !callback)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* data;
+    ZyanUSize length;
+    ZYAN_CHECK(ZyanRadixTreeGetKey(prefix, &data, &length));
+
+    // Descend to the smallest subtree that contains all matching keys
+    const void* node = tree->root;
+    ZyanUSize depth = 0;
+    while (node)
+    {
+        if (depth >= length)
+        {
+            return ZyanRadixVisit(tree, node, callback, user_data);
+        }
+
+        if (ZYAN_RADIX_TYPE(node) == ZYAN_RADIX_NODE_LEAF)
+        {
+            const ZyanRadixLeaf* const leaf = (const ZyanRadixLeaf*)node;
+            if ((leaf->length >= length) &&
+                !ZYAN_MEMCMP(ZYAN_RADIX_LEAF_KEY(tree, leaf), data, length))
+            {
+                return ZyanRadixVisit(tree, node, callback, user_data);
+            }
+            break;
+        }
+
+        ZyanRadixNode* const inner = (ZyanRadixNode*)node;
+        if (ZyanRadixPrefixMismatch(tree, inner, data, length, depth) !=
+            ZYAN_MIN(inner->prefix_length, length - depth))
+        {
+            break;
+        }
+        depth += inner->prefix_length;
+        if (depth >= length)
+        {
+            return ZyanRadixVisit(tree, node, callback, user_data);
+        }
+
+        void** const child = ZyanRadixFindChild(inner, data[depth++]);
+        node = child ? *child : ZYAN_NULL;
+    }
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRadixTreeGetSize(const ZyanRadixTree* tree, ZyanUSize* size)
+{
+    if (!tree || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = tree->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
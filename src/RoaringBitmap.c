@@ -0,0 +1,2357 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/RoaringBitmap.h>
+#include <Zycore/LibC.h>
+#include <Zycore/Internal/Bits.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * The maximum number of values stored in an array container.
+ */
+#define ZYAN_ROARING_ARRAY_MAX              4096
+
+/**
+ * The number of 64-bit words of a bitmap container.
+ */
+#define ZYAN_ROARING_BITMAP_WORDS           1024
+
+/**
+ * The cookie of serialized bitmaps without run containers.
+ */
+#define ZYAN_ROARING_COOKIE_NO_RUNS         12346
+
+/**
+ * The cookie of serialized bitmaps with run containers.
+ */
+#define ZYAN_ROARING_COOKIE_RUNS            12347
+
+/**
+ * Serialized bitmaps with run containers omit the offset table below this number of containers.
+ */
+#define ZYAN_ROARING_NO_OFFSET_THRESHOLD    4
+
+/* ============================================================================================== */
+/* Internal enums and types                                                                       */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanRoaringContainerType` enum.
+ */
+typedef enum ZyanRoaringContainerType_
+{
+    /**
+     * A sorted array of `ZyanU16` values.
+     */
+    ZYAN_ROARING_CONTAINER_ARRAY,
+    /**
+     * A bitmap of `ZYAN_ROARING_BITMAP_WORDS` `ZyanU64` words.
+     */
+    ZYAN_ROARING_CONTAINER_BITMAP,
+    /**
+     * A sorted array of non-overlapping `ZyanRoaringRun` entries.
+     */
+    ZYAN_ROARING_CONTAINER_RUN
+} ZyanRoaringContainerType;
+
+/**
+ * Defines the `ZyanRoaringOperation` enum.
+ */
+typedef enum ZyanRoaringOperation_
+{
+    ZYAN_ROARING_OPERATION_AND,
+    ZYAN_ROARING_OPERATION_OR,
+    ZYAN_ROARING_OPERATION_XOR,
+    ZYAN_ROARING_OPERATION_ANDNOT
+} ZyanRoaringOperation;
+
+/**
+ * Defines the `ZyanRoaringRun` struct.
+ */
+typedef struct ZyanRoaringRun_
+{
+    /**
+     * The first value of the run.
+     */
+    ZyanU16 start;
+    /**
+     * The number of values in the run minus one.
+     */
+    ZyanU16 length;
+} ZyanRoaringRun;
+
+/**
+ * Defines the `ZyanRoaringContainer` struct.
+ */
+typedef struct ZyanRoaringContainer_
+{
+    /**
+     * The upper 16 bits of all values in this container.
+     */
+    ZyanU16 key;
+    /**
+     * The container type (`ZyanRoaringContainerType`).
+     */
+    ZyanU8 type;
+    /**
+     * The number of values in this container.
+     */
+    ZyanU32 cardinality;
+    /**
+     * The number of used elements (values, words or runs).
+     */
+    ZyanU32 count;
+    /**
+     * The number of allocated elements.
+     */
+    ZyanU32 capacity;
+    /**
+     * The container data.
+     */
+    void* data;
+} ZyanRoaringContainer;
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Returns a pointer to the first container of the given bitmap.
+ *
+ * @param   bitmap  A pointer to the `ZyanRoaringBitmap` instance.
+ *
+ * @return  A pointer to the first `ZyanRoaringContainer`.
+ */
+#define ZYAN_ROARING_CONTAINERS(bitmap) \
+    ((ZyanRoaringContainer*)(bitmap)->containers.data)
+
+/**
+ * Returns the values of the given array container.
+ */
+#define ZYAN_ROARING_ARRAY(container) \
+    ((ZyanU16*)(container)->data)
+
+/**
+ * Returns the words of the given bitmap container.
+ */
+#define ZYAN_ROARING_WORDS(container) \
+    ((ZyanU64*)(container)->data)
+
+/**
+ * Returns the runs of the given run container.
+ */
+#define ZYAN_ROARING_RUNS(container) \
+    ((ZyanRoaringRun*)(container)->data)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Bitmap words                                                                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Sets all bits of the inclusive range `[first, last]`.
+ *
+ * @param   words   A pointer to the bitmap words.
+ * @param   first   The first bit.
+ * @param   last    The last bit.
+ */
+static void ZyanRoaringWordsSetRange(ZyanU64* words, ZyanU32 first, ZyanU32 last)
+{
+    const ZyanU32 first_word = first / 64;
+    const ZyanU32 last_word  = last  / 64;
+    const ZyanU64 first_mask = ~0ULL << (first % 64);
+    const ZyanU64 last_mask  = ~0ULL >> (63 - (last % 64));
+
+    if (first_word == last_word)
+    {
+        words[first_word] |= first_mask & last_mask;
+        return;
+    }
+    words[first_word] |= first_mask;
+    for (ZyanU32 i = first_word + 1; i < last_word; ++i)
+    {
+        words[i] = ~0ULL;
+    }
+    words[last_word] |= last_mask;
+}
+
+/**
+ * Counts the set bits of a bitmap.
+ *
+ * @param   words   A pointer to the bitmap words.
+ *
+ * @return  The number of set bits.
+ */
+static ZyanU32 ZyanRoaringWordsCount(const ZyanU64* words)
+{
+    ZyanU32 count = 0;
+    for (ZyanU32 i = 0; i < ZYAN_ROARING_BITMAP_WORDS; ++i)
+    {
+        count += ZyanBitPopCount64(words[i]);
+    }
+    return count;
+}
+
+/**
+ * Counts the runs of consecutive set bits of a bitmap.
+ *
+ * @param   words   A pointer to the bitmap words.
+ *
+ * @return  The number of runs.
+ */
+static ZyanU32 ZyanRoaringWordsCountRuns(const ZyanU64* words)
+{
+    ZyanU32 count = 0;
+    ZyanU64 carry = 0;
+    for (ZyanU32 i = 0; i < ZYAN_ROARING_BITMAP_WORDS; ++i)
+    {
+        const ZyanU64 word = words[i];
+        count += ZyanBitPopCount64(word & ~((word << 1) | carry));
+        carry = word >> 63;
+    }
+    return count;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Searching                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the index of the first value that is not less than `value`.
+ *
+ * @param   values  A pointer to the sorted values.
+ * @param   count   The number of values.
+ * @param   value   The value to search for.
+ *
+ * @return  The index of the first value that is not less than `value`.
+ */
+static ZyanU32 ZyanRoaringArrayLowerBound(const ZyanU16* values, ZyanU32 count, ZyanU16 value)
+{
+    ZyanU32 lo = 0;
+    ZyanU32 hi = count;
+    while (lo < hi)
+    {
+        const ZyanU32 mid = lo + (hi - lo) / 2;
+        if (values[mid] < value)
+        {
+            lo = mid + 1;
+        } else
+        {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * Returns the number of runs that start at or before `value`.
+ *
+ * @param   runs    A pointer to the sorted runs.
+ * @param   count   The number of runs.
+ * @param   value   The value to search for.
+ *
+ * @return  The number of runs that start at or before `value`. The run that may contain `value`
+ *          is the one before the returned index.
+ */
+static ZyanU32 ZyanRoaringRunUpperBound(const ZyanRoaringRun* runs, ZyanU32 count, ZyanU16 value)
+{
+    ZyanU32 lo = 0;
+    ZyanU32 hi = count;
+    while (lo < hi)
+    {
+        const ZyanU32 mid = lo + (hi - lo) / 2;
+        if (runs[mid].start <= value)
+        {
+            lo = mid + 1;
+        } else
+        {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * Searches the container with the given key.
+ *
+ * @param   containers  A pointer to the `ZyanVector` of containers.
+ * @param   key         The key.
+ * @param   index       Receives the index of the container or the index at which a container
+ *                      with the given key has to be inserted.
+ *
+ * @return  `ZYAN_TRUE`, if the container was found, `ZYAN_FALSE` if not.
+ */
+static ZyanBool ZyanRoaringFindContainer(const ZyanVector* containers, ZyanU16 key,
+    ZyanUSize* index)
+{
+    const ZyanRoaringContainer* const data = (const ZyanRoaringContainer*)containers->data;
+    ZyanUSize lo = 0;
+    ZyanUSize hi = containers->size;
+    while (lo < hi)
+    {
+        const ZyanUSize mid = lo + (hi - lo) / 2;
+        if (data[mid].key < key)
+        {
+            lo = mid + 1;
+        } else
+        {
+            hi = mid;
+        }
+    }
+    *index = lo;
+    return (lo < containers->size) && (data[lo].key == key);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Container memory                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the size of a single element of the given container type.
+ *
+ * @param   type    The container type.
+ *
+ * @return  The size of a single element.
+ */
+static ZyanUSize ZyanRoaringElementSize(ZyanU8 type)
+{
+    switch (type)
+    {
+    case ZYAN_ROARING_CONTAINER_ARRAY:
+        return sizeof(ZyanU16);
+    case ZYAN_ROARING_CONTAINER_BITMAP:
+        return sizeof(ZyanU64);
+    case ZYAN_ROARING_CONTAINER_RUN:
+        return sizeof(ZyanRoaringRun);
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * Allocates the data of an empty container.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   container   A pointer to the `ZyanRoaringContainer` struct.
+ * @param   type        The container type.
+ * @param   capacity    The number of elements to allocate.
+ *
+ * @return  A zyan status code.
+ *
+ * The key of the container is not modified.
+ */
+static ZyanStatus ZyanRoaringContainerAllocate(ZyanAllocator* allocator,
+    ZyanRoaringContainer* container, ZyanU8 type, ZyanU32 capacity)
+{
+    ZYAN_ASSERT(capacity);
+
+    void* data;
+    ZYAN_CHECK(allocator->allocate(allocator, &data, ZyanRoaringElementSize(type), capacity));
+
+    container->type        = type;
+    container->cardinality = 0;
+    container->count       = 0;
+    container->capacity    = capacity;
+    container->data        = data;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Releases the data of the given container.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   container   A pointer to the `ZyanRoaringContainer` struct.
+ */
+static void ZyanRoaringContainerFree(ZyanAllocator* allocator, ZyanRoaringContainer* container)
+{
+    if (container->data)
+    {
+        allocator->deallocate(allocator, container->data,
+            ZyanRoaringElementSize(container->type), container->capacity);
+        container->data = ZYAN_NULL;
+    }
+}
+
+/**
+ * Makes sure the given container can hold at least `capacity` elements.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   container   A pointer to the `ZyanRoaringContainer` struct.
+ * @param   capacity    The minimum number of elements.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRoaringContainerReserve(ZyanAllocator* allocator,
+    ZyanRoaringContainer* container, ZyanU32 capacity)
+{
+    if (capacity <= container->capacity)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_CHECK(allocator->reallocate(allocator, &container->data,
+        ZyanRoaringElementSize(container->type), capacity));
+    container->capacity = capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Grows the given array or run container, so that it can hold at least one more element.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   container   A pointer to the `ZyanRoaringContainer` struct.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRoaringContainerGrow(ZyanAllocator* allocator,
+    ZyanRoaringContainer* container)
+{
+    if (container->count < container->capacity)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanU32 capacity = ZYAN_MAX(4, container->capacity * 2);
+    if (container->type == ZYAN_ROARING_CONTAINER_ARRAY)
+    {
+        capacity = ZYAN_MIN(capacity, ZYAN_ROARING_ARRAY_MAX);
+    }
+    return ZyanRoaringContainerReserve(allocator, container, capacity);
+}
+
+/**
+ * Creates a deep copy of the given container.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   source      A pointer to the source container.
+ * @param   destination A pointer to the destination container.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRoaringContainerClone(ZyanAllocator* allocator,
+    const ZyanRoaringContainer* source, ZyanRoaringContainer* destination)
+{
+    ZYAN_CHECK(ZyanRoaringContainerAllocate(allocator, destination, source->type,
+        ZYAN_MAX(1, source->count)));
+    ZYAN_MEMCPY(destination->data, source->data,
+        source->count * ZyanRoaringElementSize(source->type));
+    destination->key         = source->key;
+    destination->cardinality = source->cardinality;
+    destination->count       = source->count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Container conversion                                                                           */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Creates a bitmap container with the values of the given container.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   source      A pointer to the source container.
+ * @param   destination A pointer to the destination container.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRoaringContainerToBitmap(ZyanAllocator* allocator,
+    const ZyanRoaringContainer* source, ZyanRoaringContainer* destination)
+{
+    ZYAN_CHECK(ZyanRoaringContainerAllocate(allocator, destination, ZYAN_ROARING_CONTAINER_BITMAP,
+        ZYAN_ROARING_BITMAP_WORDS));
+
+    ZyanU64* const words = ZYAN_ROARING_WORDS(destination);
+    switch (source->type)
+    {
+    case ZYAN_ROARING_CONTAINER_ARRAY:
+    {
+        ZYAN_MEMSET(words, 0, ZYAN_ROARING_BITMAP_WORDS * sizeof(ZyanU64));
+        const ZyanU16* const values = ZYAN_ROARING_ARRAY(source);
+        for (ZyanU32 i = 0; i < source->count; ++i)
+        {
+            words[values[i] / 64] |= 1ULL << (values[i] % 64);
+        }
+        break;
+    }
+    case ZYAN_ROARING_CONTAINER_BITMAP:
+        ZYAN_MEMCPY(words, source->data, ZYAN_ROARING_BITMAP_WORDS * sizeof(ZyanU64));
+        break;
+    case ZYAN_ROARING_CONTAINER_RUN:
+    {
+        ZYAN_MEMSET(words, 0, ZYAN_ROARING_BITMAP_WORDS * sizeof(ZyanU64));
+        const ZyanRoaringRun* const runs = ZYAN_ROARING_RUNS(source);
+        for (ZyanU32 i = 0; i < source->count; ++i)
+        {
+            ZyanRoaringWordsSetRange(words, runs[i].start, (ZyanU32)runs[i].start + runs[i].length);
+        }
+        break;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+    destination->key         = source->key;
+    destination->cardinality = source->cardinality;
+    destination->count       = ZYAN_ROARING_BITMAP_WORDS;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Creates an array container with the values of the given container.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   source      A pointer to the source container.
+ * @param   destination A pointer to the destination container.
+ *
+ * @return  A zyan status code.
+ *
+ * The source container must not contain more than `ZYAN_ROARING_ARRAY_MAX` values.
+ */
+static ZyanStatus ZyanRoaringContainerToArray(ZyanAllocator* allocator,
+    const ZyanRoaringContainer* source, ZyanRoaringContainer* destination)
+{
+    ZYAN_ASSERT(source->cardinality <= ZYAN_ROARING_ARRAY_MAX);
+
+    ZYAN_CHECK(ZyanRoaringContainerAllocate(allocator, destination, ZYAN_ROARING_CONTAINER_ARRAY,
+        ZYAN_MAX(1, source->cardinality)));
+
+    ZyanU16* const values = ZYAN_ROARING_ARRAY(destination);
+    switch (source->type)
+    {
+    case ZYAN_ROARING_CONTAINER_ARRAY:
+        ZYAN_MEMCPY(values, source->data, source->count * sizeof(ZyanU16));
+        break;
+    case ZYAN_ROARING_CONTAINER_BITMAP:
+    {
+        const ZyanU64* const words = ZYAN_ROARING_WORDS(source);
+        ZyanU32 n = 0;
+        for (ZyanU32 i = 0; i < ZYAN_ROARING_BITMAP_WORDS; ++i)
+        {
+            ZyanU64 word = words[i];
+            while (word)
+            {
+                values[n++] = (ZyanU16)(i * 64 + ZyanBitCountTrailingZeros64(word));
+                word &= word - 1;
+            }
+        }
+        break;
+    }
+    case ZYAN_ROARING_CONTAINER_RUN:
+    {
+        const ZyanRoaringRun* const runs = ZYAN_ROARING_RUNS(source);
+        ZyanU32 n = 0;
+        for (ZyanU32 i = 0; i < source->count; ++i)
+        {
+            for (ZyanU32 j = 0; j <= runs[i].length; ++j)
+            {
+                values[n++] = (ZyanU16)(runs[i].start + j);
+            }
+        }
+        break;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+    destination->key         = source->key;
+    destination->cardinality = source->cardinality;
+    destination->count       = source->cardinality;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Returns the number of runs of the given container.
+ *
+ * @param   container   A pointer to the `ZyanRoaringContainer` struct.
+ *
+ * @return  The number of runs.
+ */
+static ZyanU32 ZyanRoaringContainerCountRuns(const ZyanRoaringContainer* container)
+{
+    switch (container->type)
+    {
+    case ZYAN_ROARING_CONTAINER_ARRAY:
+    {
+        const ZyanU16* const values = ZYAN_ROARING_ARRAY(container);
+        ZyanU32 count = container->count ? 1 : 0;
+        for (ZyanU32 i = 1; i < container->count; ++i)
+        {
+            count += (values[i] != values[i - 1] + 1);
+        }
+        return count;
+    }
+    case ZYAN_ROARING_CONTAINER_BITMAP:
+        return ZyanRoaringWordsCountRuns(ZYAN_ROARING_WORDS(container));
+    case ZYAN_ROARING_CONTAINER_RUN:
+        return container->count;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * Creates a run container with the values of the given array or bitmap container.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   source      A pointer to the source container.
+ * @param   destination A pointer to the destination container.
+ * @param   runs        The number of runs of the source container.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRoaringContainerToRun(ZyanAllocator* allocator,
+    const ZyanRoaringContainer* source, ZyanRoaringContainer* destination, ZyanU32 runs)
+{
+    ZYAN_CHECK(ZyanRoaringContainerAllocate(allocator, destination, ZYAN_ROARING_CONTAINER_RUN,
+        ZYAN_MAX(1, runs)));
+
+    ZyanRoaringRun* const out = ZYAN_ROARING_RUNS(destination);
+    ZyanU32 n = 0;
+    switch (source->type)
+    {
+    case ZYAN_ROARING_CONTAINER_ARRAY:
+    {
+        const ZyanU16* const values = ZYAN_ROARING_ARRAY(source);
+        for (ZyanU32 i = 0; i < source->count; ++i)
+        {
+            if (n && ((ZyanU32)out[n - 1].start + out[n - 1].length + 1 == values[i]))
+            {
+                ++out[n - 1].length;
+                continue;
+            }
+            out[n].start  = values[i];
+            out[n].length = 0;
+            ++n;
+        }
+        break;
+    }
+    case ZYAN_ROARING_CONTAINER_BITMAP:
+    {
+        const ZyanU64* const words = ZYAN_ROARING_WORDS(source);
+        ZyanU32 i = 0;
+        ZyanU64 word = words[0];
+        for (;;)
+        {
+            while (!word && (i + 1 < ZYAN_ROARING_BITMAP_WORDS))
+            {
+                word = words[++i];
+            }
+            if (!word)
+            {
+                break;
+            }
+            const ZyanU32 start = i * 64 + ZyanBitCountTrailingZeros64(word);
+
+            // Fill the trailing zeros and skip all words that are completely set
+            word |= word - 1;
+            while ((word == ~0ULL) && (i + 1 < ZYAN_ROARING_BITMAP_WORDS))
+            {
+                word = words[++i];
+            }
+            const ZyanU32 end = (word == ~0ULL)
+                ? ZYAN_ROARING_BITMAP_WORDS * 64
+                : i * 64 + ZyanBitCountTrailingZeros64(~word);
+
+            out[n].start  = (ZyanU16)start;
+            out[n].length = (ZyanU16)(end - start - 1);
+            ++n;
+
+            if (word == ~0ULL)
+            {
+                break;
+            }
+            // Clear the trailing ones
+            word &= word + 1;
+        }
+        break;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+    ZYAN_ASSERT(n == runs);
+
+    destination->key         = source->key;
+    destination->cardinality = source->cardinality;
+    destination->count       = n;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Replaces the given container with its smallest representation.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   container   A pointer to the `ZyanRoaringContainer` struct.
+ * @param   allow_runs  `ZYAN_TRUE` to consider run encoding or `ZYAN_FALSE` to only choose
+ *                      between array and bitmap containers.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRoaringContainerOptimize(ZyanAllocator* allocator,
+    ZyanRoaringContainer* container, ZyanBool allow_runs)
+{
+    ZYAN_ASSERT(container->cardinality);
+
+    ZyanU8 type = ZYAN_ROARING_CONTAINER_BITMAP;
+    ZyanU32 size = ZYAN_ROARING_BITMAP_WORDS * sizeof(ZyanU64);
+    if (container->cardinality <= ZYAN_ROARING_ARRAY_MAX)
+    {
+        type = ZYAN_ROARING_CONTAINER_ARRAY;
+        size = container->cardinality * sizeof(ZyanU16);
+    }
+    ZyanU32 runs = 0;
+    if (allow_runs)
+    {
+        runs = ZyanRoaringContainerCountRuns(container);
+        if (sizeof(ZyanU16) + runs * sizeof(ZyanRoaringRun) < size)
+        {
+            type = ZYAN_ROARING_CONTAINER_RUN;
+        }
+    }
+    if (type == container->type)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanRoaringContainer result;
+    switch (type)
+    {
+    case ZYAN_ROARING_CONTAINER_ARRAY:
+        ZYAN_CHECK(ZyanRoaringContainerToArray(allocator, container, &result));
+        break;
+    case ZYAN_ROARING_CONTAINER_BITMAP:
+        ZYAN_CHECK(ZyanRoaringContainerToBitmap(allocator, container, &result));
+        break;
+    case ZYAN_ROARING_CONTAINER_RUN:
+        ZYAN_CHECK(ZyanRoaringContainerToRun(allocator, container, &result, runs));
+        break;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+    ZyanRoaringContainerFree(allocator, container);
+    *container = result;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Container access                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Checks, if the given container contains `value`.
+ *
+ * @param   container   A pointer to the `ZyanRoaringContainer` struct.
+ * @param   value       The lower 16 bits of the value.
+ *
+ * @return  `ZYAN_TRUE`, if the value is present, `ZYAN_FALSE` if not.
+ */
+static ZyanBool ZyanRoaringContainerContains(const ZyanRoaringContainer* container,
+    ZyanU16 value)
+{
+    switch (container->type)
+    {
+    case ZYAN_ROARING_CONTAINER_ARRAY:
+    {
+        const ZyanU16* const values = ZYAN_ROARING_ARRAY(container);
+        const ZyanU32 i = ZyanRoaringArrayLowerBound(values, container->count, value);
+        return (i < container->count) && (values[i] == value);
+    }
+    case ZYAN_ROARING_CONTAINER_BITMAP:
+        return (ZYAN_ROARING_WORDS(container)[value / 64] >> (value % 64)) & 1;
+    case ZYAN_ROARING_CONTAINER_RUN:
+    {
+        const ZyanRoaringRun* const runs = ZYAN_ROARING_RUNS(container);
+        const ZyanU32 i = ZyanRoaringRunUpperBound(runs, container->count, value);
+        return i && (value <= (ZyanU32)runs[i - 1].start + runs[i - 1].length);
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * Adds `value` to the given container.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   container   A pointer to the `ZyanRoaringContainer` struct.
+ * @param   value       The lower 16 bits of the value.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the value was added, `ZYAN_STATUS_FALSE`, if it was already
+ *          present. Another zyan status code, if an error occurred.
+ */
+static ZyanStatus ZyanRoaringContainerAdd(ZyanAllocator* allocator,
+    ZyanRoaringContainer* container, ZyanU16 value)
+{
+    switch (container->type)
+    {
+    case ZYAN_ROARING_CONTAINER_ARRAY:
+    {
+        ZyanU16* values = ZYAN_ROARING_ARRAY(container);
+        const ZyanU32 i = ZyanRoaringArrayLowerBound(values, container->count, value);
+        if ((i < container->count) && (values[i] == value))
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+        if (container->count == ZYAN_ROARING_ARRAY_MAX)
+        {
+            ZyanRoaringContainer result;
+            ZYAN_CHECK(ZyanRoaringContainerToBitmap(allocator, container, &result));
+            ZyanRoaringContainerFree(allocator, container);
+            *container = result;
+            return ZyanRoaringContainerAdd(allocator, container, value);
+        }
+        ZYAN_CHECK(ZyanRoaringContainerGrow(allocator, container));
+        values = ZYAN_ROARING_ARRAY(container);
+        ZYAN_MEMMOVE(&values[i + 1], &values[i], (container->count - i) * sizeof(ZyanU16));
+        values[i] = value;
+        ++container->count;
+        ++container->cardinality;
+        return ZYAN_STATUS_TRUE;
+    }
+    case ZYAN_ROARING_CONTAINER_BITMAP:
+    {
+        ZyanU64* const word = &ZYAN_ROARING_WORDS(container)[value / 64];
+        const ZyanU64 mask = 1ULL << (value % 64);
+        if (*word & mask)
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+        *word |= mask;
+        ++container->cardinality;
+        return ZYAN_STATUS_TRUE;
+    }
+    case ZYAN_ROARING_CONTAINER_RUN:
+    {
+        ZyanRoaringRun* runs = ZYAN_ROARING_RUNS(container);
+        const ZyanU32 i = ZyanRoaringRunUpperBound(runs, container->count, value);
+        if (i && (value <= (ZyanU32)runs[i - 1].start + runs[i - 1].length))
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+
+        const ZyanBool extends_previous =
+            i && ((ZyanU32)runs[i - 1].start + runs[i - 1].length + 1 == value);
+        const ZyanBool extends_next =
+            (i < container->count) && (runs[i].start == (ZyanU32)value + 1);
+        if (extends_previous && extends_next)
+        {
+            runs[i - 1].length = (ZyanU16)(runs[i - 1].length + runs[i].length + 2);
+            ZYAN_MEMMOVE(&runs[i], &runs[i + 1],
+                (container->count - i - 1) * sizeof(ZyanRoaringRun));
+            --container->count;
+        } else if (extends_previous)
+        {
+            ++runs[i - 1].length;
+        } else if (extends_next)
+        {
+            --runs[i].start;
+            ++runs[i].length;
+        } else
+        {
+            ZYAN_CHECK(ZyanRoaringContainerGrow(allocator, container));
+            runs = ZYAN_ROARING_RUNS(container);
+            ZYAN_MEMMOVE(&runs[i + 1], &runs[i], (container->count - i) * sizeof(ZyanRoaringRun));
+            runs[i].start  = value;
+            runs[i].length = 0;
+            ++container->count;
+        }
+        ++container->cardinality;
+
+        ZYAN_CHECK(ZyanRoaringContainerOptimize(allocator, container, ZYAN_TRUE));
+        return ZYAN_STATUS_TRUE;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * Removes `value` from the given container.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   container   A pointer to the `ZyanRoaringContainer` struct.
+ * @param   value       The lower 16 bits of the value.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the value was removed, `ZYAN_STATUS_FALSE`, if it was not
+ *          present. Another zyan status code, if an error occurred.
+ *
+ * Containers that become empty are left as they are and have to be removed by the caller.
+ */
+static ZyanStatus ZyanRoaringContainerRemove(ZyanAllocator* allocator,
+    ZyanRoaringContainer* container, ZyanU16 value)
+{
+    switch (container->type)
+    {
+    case ZYAN_ROARING_CONTAINER_ARRAY:
+    {
+        ZyanU16* const values = ZYAN_ROARING_ARRAY(container);
+        const ZyanU32 i = ZyanRoaringArrayLowerBound(values, container->count, value);
+        if ((i == container->count) || (values[i] != value))
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+        ZYAN_MEMMOVE(&values[i], &values[i + 1], (container->count - i - 1) * sizeof(ZyanU16));
+        --container->count;
+        --container->cardinality;
+        return ZYAN_STATUS_TRUE;
+    }
+    case ZYAN_ROARING_CONTAINER_BITMAP:
+    {
+        ZyanU64* const word = &ZYAN_ROARING_WORDS(container)[value / 64];
+        const ZyanU64 mask = 1ULL << (value % 64);
+        if (!(*word & mask))
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+        *word &= ~mask;
+        if (--container->cardinality <= ZYAN_ROARING_ARRAY_MAX)
+        {
+            ZyanRoaringContainer result;
+            ZYAN_CHECK(ZyanRoaringContainerToArray(allocator, container, &result));
+            ZyanRoaringContainerFree(allocator, container);
+            *container = result;
+        }
+        return ZYAN_STATUS_TRUE;
+    }
+    case ZYAN_ROARING_CONTAINER_RUN:
+    {
+        ZyanRoaringRun* runs = ZYAN_ROARING_RUNS(container);
+        const ZyanU32 i = ZyanRoaringRunUpperBound(runs, container->count, value);
+        if (!i)
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+        const ZyanU32 start = runs[i - 1].start;
+        const ZyanU32 end = start + runs[i - 1].length;
+        if (value > end)
+        {
+            return ZYAN_STATUS_FALSE;
+        }
+
+        if (start == end)
+        {
+            ZYAN_MEMMOVE(&runs[i - 1], &runs[i], (container->count - i) * sizeof(ZyanRoaringRun));
+            --container->count;
+        } else if (value == start)
+        {
+            ++runs[i - 1].start;
+            --runs[i - 1].length;
+        } else if (value == end)
+        {
+            --runs[i - 1].length;
+        } else
+        {
+            // Split the run
+            ZYAN_CHECK(ZyanRoaringContainerGrow(allocator, container));
+            runs = ZYAN_ROARING_RUNS(container);
+            ZYAN_MEMMOVE(&runs[i + 1], &runs[i], (container->count - i) * sizeof(ZyanRoaringRun));
+            runs[i].start      = (ZyanU16)(value + 1);
+            runs[i].length     = (ZyanU16)(end - value - 1);
+            runs[i - 1].length = (ZyanU16)(value - start - 1);
+            ++container->count;
+        }
+
+        if (--container->cardinality)
+        {
+            ZYAN_CHECK(ZyanRoaringContainerOptimize(allocator, container, ZYAN_TRUE));
+        }
+        return ZYAN_STATUS_TRUE;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Container operations                                                                           */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Releases an empty container or converts it to the array or bitmap representation that matches
+ * its cardinality.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   container   A pointer to the `ZyanRoaringContainer` struct.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRoaringContainerNormalize(ZyanAllocator* allocator,
+    ZyanRoaringContainer* container)
+{
+    if (!container->cardinality)
+    {
+        ZyanRoaringContainerFree(allocator, container);
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    const ZyanStatus status = ZyanRoaringContainerOptimize(allocator, container, ZYAN_FALSE);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanRoaringContainerFree(allocator, container);
+    }
+    return status;
+}
+
+/**
+ * Combines two array containers.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   operation   The operation to perform.
+ * @param   a           A pointer to the first array container.
+ * @param   b           A pointer to the second array container.
+ * @param   result      Receives the result container. The `data` field is set to `ZYAN_NULL`,
+ *                      if the result is empty.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRoaringArrayOperation(ZyanAllocator* allocator,
+    ZyanRoaringOperation operation, const ZyanRoaringContainer* a, const ZyanRoaringContainer* b,
+    ZyanRoaringContainer* result)
+{
+    const ZyanBool keep_a = (operation != ZYAN_ROARING_OPERATION_AND);
+    const ZyanBool keep_b =
+        (operation == ZYAN_ROARING_OPERATION_OR) || (operation == ZYAN_ROARING_OPERATION_XOR);
+    const ZyanBool keep_both =
+        (operation == ZYAN_ROARING_OPERATION_AND) || (operation == ZYAN_ROARING_OPERATION_OR);
+
+    ZyanU32 capacity = a->count;
+    if (operation == ZYAN_ROARING_OPERATION_AND)
+    {
+        capacity = ZYAN_MIN(a->count, b->count);
+    } else if (keep_b)
+    {
+        capacity = a->count + b->count;
+    }
+    result->key  = a->key;
+    result->data = ZYAN_NULL;
+    if (!capacity)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_CHECK(ZyanRoaringContainerAllocate(allocator, result, ZYAN_ROARING_CONTAINER_ARRAY,
+        capacity));
+    const ZyanU16* const x = ZYAN_ROARING_ARRAY(a);
+    const ZyanU16* const y = ZYAN_ROARING_ARRAY(b);
+    ZyanU16* const out = ZYAN_ROARING_ARRAY(result);
+    ZyanU32 i = 0;
+    ZyanU32 j = 0;
+    ZyanU32 n = 0;
+    while ((i < a->count) && (j < b->count))
+    {
+        if (x[i] < y[j])
+        {
+            if (keep_a)
+            {
+                out[n++] = x[i];
+            }
+            ++i;
+        } else if (x[i] > y[j])
+        {
+            if (keep_b)
+            {
+                out[n++] = y[j];
+            }
+            ++j;
+        } else
+        {
+            if (keep_both)
+            {
+                out[n++] = x[i];
+            }
+            ++i;
+            ++j;
+        }
+    }
+    for (; keep_a && (i < a->count); ++i)
+    {
+        out[n++] = x[i];
+    }
+    for (; keep_b && (j < b->count); ++j)
+    {
+        out[n++] = y[j];
+    }
+    result->cardinality = n;
+    result->count       = n;
+
+    return ZyanRoaringContainerNormalize(allocator, result);
+}
+
+/**
+ * Filters an array container by the bits of a bitmap container.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   a           A pointer to the array container.
+ * @param   b           A pointer to the bitmap container.
+ * @param   keep_set    `ZYAN_TRUE` to keep the values that are set in `b` or `ZYAN_FALSE` to keep
+ *                      the values that are not set in `b`.
+ * @param   result      Receives the result container. The `data` field is set to `ZYAN_NULL`,
+ *                      if the result is empty.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRoaringArrayFilter(ZyanAllocator* allocator, const ZyanRoaringContainer* a,
+    const ZyanRoaringContainer* b, ZyanBool keep_set, ZyanRoaringContainer* result)
+{
+    ZYAN_CHECK(ZyanRoaringContainerAllocate(allocator, result, ZYAN_ROARING_CONTAINER_ARRAY,
+        ZYAN_MAX(1, a->count)));
+    result->key = a->key;
+
+    const ZyanU16* const values = ZYAN_ROARING_ARRAY(a);
+    const ZyanU64* const words = ZYAN_ROARING_WORDS(b);
+    ZyanU16* const out = ZYAN_ROARING_ARRAY(result);
+    ZyanU32 n = 0;
+    for (ZyanU32 i = 0; i < a->count; ++i)
+    {
+        // Branchless compaction: always store, only advance if the value is kept
+        out[n] = values[i];
+        n += (ZyanU32)(((words[values[i] / 64] >> (values[i] % 64)) & 1) == (ZyanU64)keep_set);
+    }
+    result->cardinality = n;
+    result->count       = n;
+
+    return ZyanRoaringContainerNormalize(allocator, result);
+}
+
+/**
+ * Combines two containers in array or bitmap representation.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   operation   The operation to perform.
+ * @param   a           A pointer to the first container.
+ * @param   b           A pointer to the second container.
+ * @param   result      Receives the result container. The `data` field is set to `ZYAN_NULL`,
+ *                      if the result is empty.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRoaringContainerOperationInternal(ZyanAllocator* allocator,
+    ZyanRoaringOperation operation, const ZyanRoaringContainer* a, const ZyanRoaringContainer* b,
+    ZyanRoaringContainer* result)
+{
+    const ZyanBool a_is_array = (a->type == ZYAN_ROARING_CONTAINER_ARRAY);
+    const ZyanBool b_is_array = (b->type == ZYAN_ROARING_CONTAINER_ARRAY);
+
+    if (a_is_array && b_is_array)
+    {
+        return ZyanRoaringArrayOperation(allocator, operation, a, b, result);
+    }
+    if (operation == ZYAN_ROARING_OPERATION_AND)
+    {
+        if (a_is_array)
+        {
+            return ZyanRoaringArrayFilter(allocator, a, b, ZYAN_TRUE, result);
+        }
+        if (b_is_array)
+        {
+            return ZyanRoaringArrayFilter(allocator, b, a, ZYAN_TRUE, result);
+        }
+    }
+    if ((operation == ZYAN_ROARING_OPERATION_ANDNOT) && a_is_array)
+    {
+        return ZyanRoaringArrayFilter(allocator, a, b, ZYAN_FALSE, result);
+    }
+
+    ZYAN_CHECK(ZyanRoaringContainerToBitmap(allocator, a, result));
+    ZyanU64* const words = ZYAN_ROARING_WORDS(result);
+    if (b_is_array)
+    {
+        const ZyanU16* const values = ZYAN_ROARING_ARRAY(b);
+        switch (operation)
+        {
+        case ZYAN_ROARING_OPERATION_OR:
+            for (ZyanU32 i = 0; i < b->count; ++i)
+            {
+                words[values[i] / 64] |= 1ULL << (values[i] % 64);
+            }
+            break;
+        case ZYAN_ROARING_OPERATION_XOR:
+            for (ZyanU32 i = 0; i < b->count; ++i)
+            {
+                words[values[i] / 64] ^= 1ULL << (values[i] % 64);
+            }
+            break;
+        case ZYAN_ROARING_OPERATION_ANDNOT:
+            for (ZyanU32 i = 0; i < b->count; ++i)
+            {
+                words[values[i] / 64] &= ~(1ULL << (values[i] % 64));
+            }
+            break;
+        default:
+            ZYAN_UNREACHABLE;
+        }
+    } else
+    {
+        const ZyanU64* const other = ZYAN_ROARING_WORDS(b);
+        switch (operation)
+        {
+        case ZYAN_ROARING_OPERATION_AND:
+            for (ZyanU32 i = 0; i < ZYAN_ROARING_BITMAP_WORDS; ++i)
+            {
+                words[i] &= other[i];
+            }
+            break;
+        case ZYAN_ROARING_OPERATION_OR:
+            for (ZyanU32 i = 0; i < ZYAN_ROARING_BITMAP_WORDS; ++i)
+            {
+                words[i] |= other[i];
+            }
+            break;
+        case ZYAN_ROARING_OPERATION_XOR:
+            for (ZyanU32 i = 0; i < ZYAN_ROARING_BITMAP_WORDS; ++i)
+            {
+                words[i] ^= other[i];
+            }
+            break;
+        case ZYAN_ROARING_OPERATION_ANDNOT:
+            for (ZyanU32 i = 0; i < ZYAN_ROARING_BITMAP_WORDS; ++i)
+            {
+                words[i] &= ~other[i];
+            }
+            break;
+        default:
+            ZYAN_UNREACHABLE;
+        }
+    }
+    result->cardinality = ZyanRoaringWordsCount(words);
+
+    return ZyanRoaringContainerNormalize(allocator, result);
+}
+
+/**
+ * Converts a run container to a temporary array or bitmap container.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   container   A pointer to the `ZyanRoaringContainer` struct.
+ * @param   temporary   Receives the converted container, if `container` is a run container.
+ * @param   view        Receives a pointer to `container` or `temporary`.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRoaringContainerMaterialize(ZyanAllocator* allocator,
+    const ZyanRoaringContainer* container, ZyanRoaringContainer* temporary,
+    const ZyanRoaringContainer** view)
+{
+    temporary->data = ZYAN_NULL;
+    *view = container;
+    if (container->type != ZYAN_ROARING_CONTAINER_RUN)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    if (container->cardinality <= ZYAN_ROARING_ARRAY_MAX)
+    {
+        ZYAN_CHECK(ZyanRoaringContainerToArray(allocator, container, temporary));
+    } else
+    {
+        ZYAN_CHECK(ZyanRoaringContainerToBitmap(allocator, container, temporary));
+    }
+    *view = temporary;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Combines two containers with the same key.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   operation   The operation to perform.
+ * @param   a           A pointer to the first container.
+ * @param   b           A pointer to the second container.
+ * @param   result      Receives the result container. The `data` field is set to `ZYAN_NULL`,
+ *                      if the result is empty.
+ *
+ * @return  A zyan status code.
+ *
+ * Run containers are converted to array or bitmap containers first. The result is never run
+ * encoded.
+ */
+static ZyanStatus ZyanRoaringContainerOperation(ZyanAllocator* allocator,
+    ZyanRoaringOperation operation, const ZyanRoaringContainer* a, const ZyanRoaringContainer* b,
+    ZyanRoaringContainer* result)
+{
+    ZyanRoaringContainer temporary_a;
+    ZyanRoaringContainer temporary_b;
+    const ZyanRoaringContainer* x;
+    const ZyanRoaringContainer* y;
+
+    ZYAN_CHECK(ZyanRoaringContainerMaterialize(allocator, a, &temporary_a, &x));
+    ZyanStatus status = ZyanRoaringContainerMaterialize(allocator, b, &temporary_b, &y);
+    if (ZYAN_SUCCESS(status))
+    {
+        status = ZyanRoaringContainerOperationInternal(allocator, operation, x, y, result);
+        ZyanRoaringContainerFree(allocator, &temporary_b);
+    }
+    ZyanRoaringContainerFree(allocator, &temporary_a);
+
+    return status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Bitmap helpers                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Inserts a container into the given container vector.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   containers  A pointer to the `ZyanVector` of containers.
+ * @param   index       The insertion index.
+ * @param   container   A pointer to the container. Its data is released, if the insertion fails.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRoaringInsertContainer(ZyanAllocator* allocator, ZyanVector* containers,
+    ZyanUSize index, ZyanRoaringContainer* container)
+{
+    const ZyanStatus status = ZyanVectorInsert(containers, index, container);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanRoaringContainerFree(allocator, container);
+    }
+    return status;
+}
+
+/**
+ * Releases all containers of `containers` that do not share their data with the container of the
+ * same key in `other` and destroys the vector.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   containers  A pointer to the `ZyanVector` of containers to release.
+ * @param   other       A pointer to the `ZyanVector` of containers that stays alive.
+ */
+static void ZyanRoaringReleaseUnshared(ZyanAllocator* allocator, ZyanVector* containers,
+    const ZyanVector* other)
+{
+    ZyanRoaringContainer* const data = (ZyanRoaringContainer*)containers->data;
+    for (ZyanUSize i = 0; i < containers->size; ++i)
+    {
+        ZyanUSize index;
+        if (ZyanRoaringFindContainer(other, data[i].key, &index) &&
+            (((const ZyanRoaringContainer*)other->data)[index].data == data[i].data))
+        {
+            continue;
+        }
+        ZyanRoaringContainerFree(allocator, &data[i]);
+    }
+    ZyanVectorDestroy(containers);
+}
+
+/**
+ * Performs a set operation and stores the result in `destination`.
+ *
+ * @param   destination A pointer to the `ZyanRoaringBitmap` instance that is used as the first
+ *                      input and as the destination.
+ * @param   source      A pointer to the `ZyanRoaringBitmap` instance that is used as the second
+ *                      input.
+ * @param   operation   The operation to perform.
+ *
+ * @return  A zyan status code.
+ *
+ * The result is built in a new container vector. Containers that only exist in `destination` are
+ * moved into the result without copying.
+ */
+static ZyanStatus ZyanRoaringBitmapOperation(ZyanRoaringBitmap* destination,
+    const ZyanRoaringBitmap* source, ZyanRoaringOperation operation)
+{
+    if (!destination || !source)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (destination == source)
+    {
+        if ((operation == ZYAN_ROARING_OPERATION_AND) || (operation == ZYAN_ROARING_OPERATION_OR))
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+        return ZyanRoaringBitmapClear(destination);
+    }
+
+    ZyanAllocator* const allocator = destination->allocator;
+    const ZyanUSize n = destination->containers.size;
+    const ZyanUSize m = source->containers.size;
+    ZyanUSize capacity = ZYAN_MIN(n, m);
+    if (operation == ZYAN_ROARING_OPERATION_ANDNOT)
+    {
+        capacity = n;
+    } else if (operation != ZYAN_ROARING_OPERATION_AND)
+    {
+        capacity = n + m;
+    }
+
+    ZyanVector result;
+    ZYAN_CHECK(ZyanVectorInitEx(&result, sizeof(ZyanRoaringContainer), capacity, ZYAN_NULL,
+        allocator, ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, 0));
+
+    const ZyanRoaringContainer* const a = ZYAN_ROARING_CONTAINERS(destination);
+    const ZyanRoaringContainer* const b = ZYAN_ROARING_CONTAINERS(source);
+    const ZyanBool keep_a = (operation != ZYAN_ROARING_OPERATION_AND);
+    const ZyanBool keep_b =
+        (operation == ZYAN_ROARING_OPERATION_OR) || (operation == ZYAN_ROARING_OPERATION_XOR);
+    ZyanStatus status = ZYAN_STATUS_SUCCESS;
+    ZyanUSize i = 0;
+    ZyanUSize j = 0;
+    while (ZYAN_SUCCESS(status) && ((i < n) || (j < m)))
+    {
+        ZyanRoaringContainer container;
+        if ((j == m) || ((i < n) && (a[i].key < b[j].key)))
+        {
+            if (keep_a)
+            {
+                status = ZyanVectorPushBack(&result, &a[i]);
+            }
+            ++i;
+            continue;
+        }
+        if ((i == n) || (a[i].key > b[j].key))
+        {
+            if (keep_b)
+            {
+                status = ZyanRoaringContainerClone(allocator, &b[j], &container);
+                if (ZYAN_SUCCESS(status))
+                {
+                    status = ZyanRoaringInsertContainer(allocator, &result, result.size,
+                        &container);
+                }
+            }
+            ++j;
+            continue;
+        }
+
+        status = ZyanRoaringContainerOperation(allocator, operation, &a[i], &b[j], &container);
+        if (ZYAN_SUCCESS(status) && container.data)
+        {
+            status = ZyanRoaringInsertContainer(allocator, &result, result.size, &container);
+        }
+        ++i;
+        ++j;
+    }
+
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanRoaringReleaseUnshared(allocator, &result, &destination->containers);
+        return status;
+    }
+
+    ZyanRoaringReleaseUnshared(allocator, &destination->containers, &result);
+    destination->containers = result;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Serialization                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Writes a little-endian 16-bit value.
+ *
+ * @param   p       A pointer to the destination.
+ * @param   value   The value.
+ */
+static void ZyanRoaringStoreU16(ZyanU8* p, ZyanU16 value)
+{
+    p[0] = (ZyanU8)(value);
+    p[1] = (ZyanU8)(value >> 8);
+}
+
+/**
+ * Writes a little-endian 32-bit value.
+ *
+ * @param   p       A pointer to the destination.
+ * @param   value   The value.
+ */
+static void ZyanRoaringStoreU32(ZyanU8* p, ZyanU32 value)
+{
+    ZyanRoaringStoreU16(p, (ZyanU16)value);
+    ZyanRoaringStoreU16(p + 2, (ZyanU16)(value >> 16));
+}
+
+/**
+ * Reads a little-endian 16-bit value.
+ *
+ * @param   p   A pointer to the source.
+ *
+ * @return  The value.
+ */
+static ZyanU16 ZyanRoaringLoadU16(const ZyanU8* p)
+{
+    return (ZyanU16)(p[0] | (p[1] << 8));
+}
+
+/**
+ * Reads a little-endian 32-bit value.
+ *
+ * @param   p   A pointer to the source.
+ *
+ * @return  The value.
+ */
+static ZyanU32 ZyanRoaringLoadU32(const ZyanU8* p)
+{
+    return ZyanRoaringLoadU16(p) | ((ZyanU32)ZyanRoaringLoadU16(p + 2) << 16);
+}
+
+/**
+ * Returns the number of bytes of the serialized container data.
+ *
+ * @param   container   A pointer to the `ZyanRoaringContainer` struct.
+ *
+ * @return  The number of bytes.
+ */
+static ZyanUSize ZyanRoaringContainerSerializedSize(const ZyanRoaringContainer* container)
+{
+    switch (container->type)
+    {
+    case ZYAN_ROARING_CONTAINER_ARRAY:
+        return container->count * sizeof(ZyanU16);
+    case ZYAN_ROARING_CONTAINER_BITMAP:
+        return ZYAN_ROARING_BITMAP_WORDS * sizeof(ZyanU64);
+    case ZYAN_ROARING_CONTAINER_RUN:
+        return sizeof(ZyanU16) + container->count * 2 * sizeof(ZyanU16);
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * Returns the size of the serialization header.
+ *
+ * @param   bitmap      A pointer to the `ZyanRoaringBitmap` instance.
+ * @param   has_runs    Receives `ZYAN_TRUE`, if the bitmap contains run containers.
+ *
+ * @return  The size of the serialization header in bytes.
+ */
+static ZyanUSize ZyanRoaringHeaderSize(const ZyanRoaringBitmap* bitmap, ZyanBool* has_runs)
+{
+    const ZyanRoaringContainer* const containers = ZYAN_ROARING_CONTAINERS(bitmap);
+    const ZyanUSize n = bitmap->containers.size;
+
+    *has_runs = ZYAN_FALSE;
+    for (ZyanUSize i = 0; i < n; ++i)
+    {
+        if (containers[i].type == ZYAN_ROARING_CONTAINER_RUN)
+        {
+            *has_runs = ZYAN_TRUE;
+            break;
+        }
+    }
+
+    if (*has_runs)
+    {
+        return 4 + (n + 7) / 8 + 4 * n + ((n >= ZYAN_ROARING_NO_OFFSET_THRESHOLD) ? 4 * n : 0);
+    }
+    return 8 + 8 * n;
+}
+
+/**
+ * Reads a serialized container.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   data        A pointer to the serialized container data.
+ * @param   size        The number of available bytes.
+ * @param   is_run      `ZYAN_TRUE`, if the container is run encoded.
+ * @param   container   Receives the container. The `key` and `cardinality` fields must be set
+ *                      by the caller.
+ * @param   read        Receives the number of bytes read.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRoaringContainerDeserialize(ZyanAllocator* allocator, const ZyanU8* data,
+    ZyanUSize size, ZyanBool is_run, ZyanRoaringContainer* container, ZyanUSize* read)
+{
+    const ZyanU32 cardinality = container->cardinality;
+    ZyanU32 actual = 0;
+
+    if (is_run)
+    {
+        if (size < sizeof(ZyanU16))
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        const ZyanU32 count = ZyanRoaringLoadU16(data);
+        *read = sizeof(ZyanU16) + count * 2 * sizeof(ZyanU16);
+        if (!count || (size < *read))
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        ZYAN_CHECK(ZyanRoaringContainerAllocate(allocator, container, ZYAN_ROARING_CONTAINER_RUN,
+            count));
+        ZyanRoaringRun* const runs = ZYAN_ROARING_RUNS(container);
+        ZyanU32 next = 0;
+        for (ZyanU32 i = 0; i < count; ++i)
+        {
+            runs[i].start  = ZyanRoaringLoadU16(data + 2 + 4 * i);
+            runs[i].length = ZyanRoaringLoadU16(data + 4 + 4 * i);
+            const ZyanU32 end = (ZyanU32)runs[i].start + runs[i].length;
+            if ((runs[i].start < next) || (end > 0xFFFF))
+            {
+                ZyanRoaringContainerFree(allocator, container);
+                return ZYAN_STATUS_INVALID_ARGUMENT;
+            }
+            actual += runs[i].length + 1U;
+            next = end + 1;
+        }
+        container->count = count;
+    } else if (cardinality <= ZYAN_ROARING_ARRAY_MAX)
+    {
+        *read = cardinality * sizeof(ZyanU16);
+        if (size < *read)
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        ZYAN_CHECK(ZyanRoaringContainerAllocate(allocator, container,
+            ZYAN_ROARING_CONTAINER_ARRAY, cardinality));
+        ZyanU16* const values = ZYAN_ROARING_ARRAY(container);
+        for (ZyanU32 i = 0; i < cardinality; ++i)
+        {
+            values[i] = ZyanRoaringLoadU16(data + 2 * i);
+            if (i && (values[i] <= values[i - 1]))
+            {
+                ZyanRoaringContainerFree(allocator, container);
+                return ZYAN_STATUS_INVALID_ARGUMENT;
+            }
+        }
+        actual = cardinality;
+        container->count = cardinality;
+    } else
+    {
+        *read = ZYAN_ROARING_BITMAP_WORDS * sizeof(ZyanU64);
+        if (size < *read)
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        ZYAN_CHECK(ZyanRoaringContainerAllocate(allocator, container,
+            ZYAN_ROARING_CONTAINER_BITMAP, ZYAN_ROARING_BITMAP_WORDS));
+        ZyanU64* const words = ZYAN_ROARING_WORDS(container);
+        for (ZyanU32 i = 0; i < ZYAN_ROARING_BITMAP_WORDS; ++i)
+        {
+            words[i] = ZyanRoaringLoadU32(data + 8 * i) |
+                ((ZyanU64)ZyanRoaringLoadU32(data + 8 * i + 4) << 32);
+        }
+        actual = ZyanRoaringWordsCount(words);
+        container->count = ZYAN_ROARING_BITMAP_WORDS;
+    }
+
+    // `ZyanRoaringContainerAllocate` resets the cardinality
+    container->cardinality = actual;
+    if (actual != cardinality)
+    {
+        ZyanRoaringContainerFree(allocator, container);
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Reads a serialized bitmap into the given (empty) bitmap.
+ *
+ * @param   bitmap  A pointer to the `ZyanRoaringBitmap` instance.
+ * @param   buffer  A pointer to the serialized data.
+ * @param   size    The size of the serialized data in bytes.
+ * @param   read    Receives the number of bytes consumed.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRoaringBitmapDeserializeInternal(ZyanRoaringBitmap* bitmap,
+    const ZyanU8* buffer, ZyanUSize size, ZyanUSize* read)
+{
+    if (size < 4)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU32 cookie = ZyanRoaringLoadU32(buffer);
+    const ZyanU8* run_flags = ZYAN_NULL;
+    ZyanUSize n;
+    ZyanUSize offset = 4;
+    if ((cookie & 0xFFFF) == ZYAN_ROARING_COOKIE_RUNS)
+    {
+        n = (cookie >> 16) + 1;
+        run_flags = buffer + offset;
+        offset += (n + 7) / 8;
+    } else if (cookie == ZYAN_ROARING_COOKIE_NO_RUNS)
+    {
+        if (size < 8)
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        n = ZyanRoaringLoadU32(buffer + 4);
+        offset += 4;
+        if (n > 0x10000)
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+    } else
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* const headers = buffer + offset;
+    offset += 4 * n;
+    if (!run_flags || (n >= ZYAN_ROARING_NO_OFFSET_THRESHOLD))
+    {
+        // The offset table is redundant for sequential reading
+        offset += 4 * n;
+    }
+    if (size < offset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanVectorReserve(&bitmap->containers, n));
+    for (ZyanUSize i = 0; i < n; ++i)
+    {
+        ZyanRoaringContainer container;
+        container.key = ZyanRoaringLoadU16(headers + 4 * i);
+        container.cardinality = ZyanRoaringLoadU16(headers + 4 * i + 2) + 1U;
+        if (i && (container.key <= ZYAN_ROARING_CONTAINERS(bitmap)[i - 1].key))
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+
+        const ZyanBool is_run = run_flags && ((run_flags[i / 8] >> (i % 8)) & 1);
+        ZyanUSize length;
+        ZYAN_CHECK(ZyanRoaringContainerDeserialize(bitmap->allocator, buffer + offset,
+            size - offset, is_run, &container, &length));
+        ZYAN_CHECK(ZyanRoaringInsertContainer(bitmap->allocator, &bitmap->containers, i,
+            &container));
+        offset += length;
+    }
+    *read = offset;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Invokes the given `callback` for every value of a container in ascending order.
+ *
+ * @param   container   A pointer to the `ZyanRoaringContainer` struct.
+ * @param   callback    The callback function.
+ * @param   user_data   A user defined pointer that is passed to the callback function.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if all values were visited, `ZYAN_STATUS_FALSE` if the callback
+ *          stopped the iteration or the error code returned by the callback.
+ */
+static ZyanStatus ZyanRoaringContainerForEach(const ZyanRoaringContainer* container,
+    ZyanRoaringBitmapCallback callback, void* user_data)
+{
+    const ZyanU32 base = (ZyanU32)container->key << 16;
+    ZyanStatus status;
+
+    switch (container->type)
+    {
+    case ZYAN_ROARING_CONTAINER_ARRAY:
+    {
+        const ZyanU16* const values = ZYAN_ROARING_ARRAY(container);
+        for (ZyanU32 i = 0; i < container->count; ++i)
+        {
+            if ((status = callback(base | values[i], user_data)) != ZYAN_STATUS_TRUE)
+            {
+                return status;
+            }
+        }
+        break;
+    }
+    case ZYAN_ROARING_CONTAINER_BITMAP:
+    {
+        const ZyanU64* const words = ZYAN_ROARING_WORDS(container);
+        for (ZyanU32 i = 0; i < ZYAN_ROARING_BITMAP_WORDS; ++i)
+        {
+            ZyanU64 word = words[i];
+            while (word)
+            {
+                const ZyanU32 value = base | (i * 64 + ZyanBitCountTrailingZeros64(word));
+                if ((status = callback(value, user_data)) != ZYAN_STATUS_TRUE)
+                {
+                    return status;
+                }
+                word &= word - 1;
+            }
+        }
+        break;
+    }
+    case ZYAN_ROARING_CONTAINER_RUN:
+    {
+        const ZyanRoaringRun* const runs = ZYAN_ROARING_RUNS(container);
+        for (ZyanU32 i = 0; i < container->count; ++i)
+        {
+            for (ZyanU32 j = 0; j <= runs[i].length; ++j)
+            {
+                if ((status = callback(base | (runs[i].start + j), user_data)) != ZYAN_STATUS_TRUE)
+                {
+                    return status;
+                }
+            }
+        }
+        break;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanRoaringBitmapInit(ZyanRoaringBitmap* bitmap)
+{
+    return ZyanRoaringBitmapInitEx(bitmap, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanRoaringBitmapInitEx(ZyanRoaringBitmap* bitmap, ZyanAllocator* allocator)
+{
+    if (!bitmap || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    bitmap->allocator = allocator;
+    return ZyanVectorInitEx(&bitmap->containers, sizeof(ZyanRoaringContainer), 0, ZYAN_NULL,
+        allocator, ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, 0);
+}
+
+ZyanStatus ZyanRoaringBitmapDestroy(ZyanRoaringBitmap* bitmap)
+{
+    if (!bitmap)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanRoaringBitmapClear(bitmap));
+    return ZyanVectorDestroy(&bitmap->containers);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion and deletion                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRoaringBitmapAdd(ZyanRoaringBitmap* bitmap, ZyanU32 value)
+{
+    if (!bitmap)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU16 key = (ZyanU16)(value >> 16);
+    ZyanUSize index;
+    if (!ZyanRoaringFindContainer(&bitmap->containers, key, &index))
+    {
+        ZyanRoaringContainer container;
+        ZYAN_CHECK(ZyanRoaringContainerAllocate(bitmap->allocator, &container,
+            ZYAN_ROARING_CONTAINER_ARRAY, 4));
+        container.key = key;
+        ZYAN_ROARING_ARRAY(&container)[0] = (ZyanU16)value;
+        container.cardinality = 1;
+        container.count = 1;
+        ZYAN_CHECK(ZyanRoaringInsertContainer(bitmap->allocator, &bitmap->containers, index,
+            &container));
+        return ZYAN_STATUS_TRUE;
+    }
+
+    return ZyanRoaringContainerAdd(bitmap->allocator, &ZYAN_ROARING_CONTAINERS(bitmap)[index],
+        (ZyanU16)value);
+}
+
+ZyanStatus ZyanRoaringBitmapAddRange(ZyanRoaringBitmap* bitmap, ZyanU32 first, ZyanU32 last)
+{
+    if (!bitmap || (first > last))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    for (ZyanU32 key = first >> 16; key <= (last >> 16); ++key)
+    {
+        const ZyanU32 lo = (key == (first >> 16)) ? (first & 0xFFFF) : 0;
+        const ZyanU32 hi = (key == (last >> 16)) ? (last & 0xFFFF) : 0xFFFF;
+
+        ZyanUSize index;
+        if (!ZyanRoaringFindContainer(&bitmap->containers, (ZyanU16)key, &index))
+        {
+            ZyanRoaringContainer container;
+            ZYAN_CHECK(ZyanRoaringContainerAllocate(bitmap->allocator, &container,
+                ZYAN_ROARING_CONTAINER_RUN, 1));
+            container.key = (ZyanU16)key;
+            ZYAN_ROARING_RUNS(&container)[0].start  = (ZyanU16)lo;
+            ZYAN_ROARING_RUNS(&container)[0].length = (ZyanU16)(hi - lo);
+            container.cardinality = hi - lo + 1;
+            container.count = 1;
+            ZYAN_CHECK(ZyanRoaringInsertContainer(bitmap->allocator, &bitmap->containers, index,
+                &container));
+            continue;
+        }
+
+        ZyanRoaringContainer* const container = &ZYAN_ROARING_CONTAINERS(bitmap)[index];
+        if (container->type != ZYAN_ROARING_CONTAINER_BITMAP)
+        {
+            ZyanRoaringContainer result;
+            ZYAN_CHECK(ZyanRoaringContainerToBitmap(bitmap->allocator, container, &result));
+            ZyanRoaringContainerFree(bitmap->allocator, container);
+            *container = result;
+        }
+        ZyanRoaringWordsSetRange(ZYAN_ROARING_WORDS(container), lo, hi);
+        container->cardinality = ZyanRoaringWordsCount(ZYAN_ROARING_WORDS(container));
+        ZYAN_CHECK(ZyanRoaringContainerOptimize(bitmap->allocator, container, ZYAN_TRUE));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRoaringBitmapRemove(ZyanRoaringBitmap* bitmap, ZyanU32 value)
+{
+    if (!bitmap)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize index;
+    if (!ZyanRoaringFindContainer(&bitmap->containers, (ZyanU16)(value >> 16), &index))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZyanRoaringContainer* const container = &ZYAN_ROARING_CONTAINERS(bitmap)[index];
+    const ZyanStatus status =
+        ZyanRoaringContainerRemove(bitmap->allocator, container, (ZyanU16)value);
+    if ((status == ZYAN_STATUS_TRUE) && !container->cardinality)
+    {
+        ZyanRoaringContainerFree(bitmap->allocator, container);
+        ZYAN_CHECK(ZyanVectorDelete(&bitmap->containers, index));
+    }
+
+    return status;
+}
+
+ZyanStatus ZyanRoaringBitmapClear(ZyanRoaringBitmap* bitmap)
+{
+    if (!bitmap)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanRoaringContainer* const containers = ZYAN_ROARING_CONTAINERS(bitmap);
+    for (ZyanUSize i = 0; i < bitmap->containers.size; ++i)
+    {
+        ZyanRoaringContainerFree(bitmap->allocator, &containers[i]);
+    }
+
+    return ZyanVectorClear(&bitmap->containers);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRoaringBitmapContains(const ZyanRoaringBitmap* bitmap, ZyanU32 value)
+{
+    if (!bitmap)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize index;
+    if (!ZyanRoaringFindContainer(&bitmap->containers, (ZyanU16)(value >> 16), &index))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    return ZyanRoaringContainerContains(&ZYAN_ROARING_CONTAINERS(bitmap)[index], (ZyanU16)value)
+        ? ZYAN_STATUS_TRUE
+        : ZYAN_STATUS_FALSE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Set operations                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRoaringBitmapAND(ZyanRoaringBitmap* destination, const ZyanRoaringBitmap* source)
+{
+    return ZyanRoaringBitmapOperation(destination, source, ZYAN_ROARING_OPERATION_AND);
+}
+
+ZyanStatus ZyanRoaringBitmapOR(ZyanRoaringBitmap* destination, const ZyanRoaringBitmap* source)
+{
+    return ZyanRoaringBitmapOperation(destination, source, ZYAN_ROARING_OPERATION_OR);
+}
+
+ZyanStatus ZyanRoaringBitmapXOR(ZyanRoaringBitmap* destination, const ZyanRoaringBitmap* source)
+{
+    return ZyanRoaringBitmapOperation(destination, source, ZYAN_ROARING_OPERATION_XOR);
+}
+
+ZyanStatus ZyanRoaringBitmapANDNOT(ZyanRoaringBitmap* destination,
+    const ZyanRoaringBitmap* source)
+{
+    return ZyanRoaringBitmapOperation(destination, source, ZYAN_ROARING_OPERATION_ANDNOT);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRoaringBitmapForEach(const ZyanRoaringBitmap* bitmap,
+    ZyanRoaringBitmapCallback callback, void* user_data)
+{
+    if (!bitmap || !callback)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanRoaringContainer* const containers = ZYAN_ROARING_CONTAINERS(bitmap);
+    for (ZyanUSize i = 0; i < bitmap->containers.size; ++i)
+    {
+        const ZyanStatus status = ZyanRoaringContainerForEach(&containers[i], callback, user_data);
+        if (status != ZYAN_STATUS_TRUE)
+        {
+            return status;
+        }
+    }
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanRoaringBitmapExportValues(const ZyanRoaringBitmap* bitmap, ZyanVector* values)
+{
+    if (!bitmap || !values || (values->element_size != sizeof(ZyanU32)))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU64 cardinality;
+    ZYAN_CHECK(ZyanRoaringBitmapGetCardinality(bitmap, &cardinality));
+    if (cardinality > (ZyanU64)(ZyanUSize)-1 - values->size)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+    const ZyanUSize size = values->size;
+    ZYAN_CHECK(ZyanVectorResize(values, size + (ZyanUSize)cardinality));
+
+    ZyanU32* out = (ZyanU32*)values->data + size;
+    const ZyanRoaringContainer* const containers = ZYAN_ROARING_CONTAINERS(bitmap);
+    for (ZyanUSize i = 0; i < bitmap->containers.size; ++i)
+    {
+        const ZyanRoaringContainer* const container = &containers[i];
+        const ZyanU32 base = (ZyanU32)container->key << 16;
+        switch (container->type)
+        {
+        case ZYAN_ROARING_CONTAINER_ARRAY:
+        {
+            const ZyanU16* const array = ZYAN_ROARING_ARRAY(container);
+            for (ZyanU32 j = 0; j < container->count; ++j)
+            {
+                *out++ = base | array[j];
+            }
+            break;
+        }
+        case ZYAN_ROARING_CONTAINER_BITMAP:
+        {
+            const ZyanU64* const words = ZYAN_ROARING_WORDS(container);
+            for (ZyanU32 j = 0; j < ZYAN_ROARING_BITMAP_WORDS; ++j)
+            {
+                ZyanU64 word = words[j];
+                while (word)
+                {
+                    *out++ = base | (j * 64 + ZyanBitCountTrailingZeros64(word));
+                    word &= word - 1;
+                }
+            }
+            break;
+        }
+        case ZYAN_ROARING_CONTAINER_RUN:
+        {
+            const ZyanRoaringRun* const runs = ZYAN_ROARING_RUNS(container);
+            for (ZyanU32 j = 0; j < container->count; ++j)
+            {
+                for (ZyanU32 k = 0; k <= runs[j].length; ++k)
+                {
+                    *out++ = base | (runs[j].start + k);
+                }
+            }
+            break;
+        }
+        default:
+            ZYAN_UNREACHABLE;
+        }
+    }
+    ZYAN_ASSERT(out == (ZyanU32*)values->data + values->size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Serialization                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRoaringBitmapGetSerializedSize(const ZyanRoaringBitmap* bitmap, ZyanUSize* size)
+{
+    if (!bitmap || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanBool has_runs;
+    ZyanUSize result = ZyanRoaringHeaderSize(bitmap, &has_runs);
+    const ZyanRoaringContainer* const containers = ZYAN_ROARING_CONTAINERS(bitmap);
+    for (ZyanUSize i = 0; i < bitmap->containers.size; ++i)
+    {
+        result += ZyanRoaringContainerSerializedSize(&containers[i]);
+    }
+    *size = result;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRoaringBitmapSerialize(const ZyanRoaringBitmap* bitmap, void* buffer,
+    ZyanUSize capacity, ZyanUSize* size)
+{
+    if (!bitmap || !buffer || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize required;
+    ZYAN_CHECK(ZyanRoaringBitmapGetSerializedSize(bitmap, &required));
+    if (capacity < required)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    const ZyanRoaringContainer* const containers = ZYAN_ROARING_CONTAINERS(bitmap);
+    const ZyanUSize n = bitmap->containers.size;
+    ZyanU8* const out = (ZyanU8*)buffer;
+    ZyanBool has_runs;
+    ZyanUSize offset = ZyanRoaringHeaderSize(bitmap, &has_runs);
+    ZyanU8* p = out;
+
+    // Cookie and run flags
+    if (has_runs)
+    {
+        ZyanRoaringStoreU32(p, ZYAN_ROARING_COOKIE_RUNS | (ZyanU32)((n - 1) << 16));
+        p += 4;
+        ZYAN_MEMSET(p, 0, (n + 7) / 8);
+        for (ZyanUSize i = 0; i < n; ++i)
+        {
+            if (containers[i].type == ZYAN_ROARING_CONTAINER_RUN)
+            {
+                p[i / 8] |= (ZyanU8)(1 << (i % 8));
+            }
+        }
+        p += (n + 7) / 8;
+    } else
+    {
+        ZyanRoaringStoreU32(p, ZYAN_ROARING_COOKIE_NO_RUNS);
+        ZyanRoaringStoreU32(p + 4, (ZyanU32)n);
+        p += 8;
+    }
+
+    // Keys and cardinalities
+    for (ZyanUSize i = 0; i < n; ++i)
+    {
+        ZyanRoaringStoreU16(p, containers[i].key);
+        ZyanRoaringStoreU16(p + 2, (ZyanU16)(containers[i].cardinality - 1));
+        p += 4;
+    }
+
+    // Offsets
+    if (!has_runs || (n >= ZYAN_ROARING_NO_OFFSET_THRESHOLD))
+    {
+        ZyanUSize container_offset = offset;
+        for (ZyanUSize i = 0; i < n; ++i)
+        {
+            ZyanRoaringStoreU32(p, (ZyanU32)container_offset);
+            container_offset += ZyanRoaringContainerSerializedSize(&containers[i]);
+            p += 4;
+        }
+    }
+    ZYAN_ASSERT(p == out + offset);
+
+    // Container data
+    for (ZyanUSize i = 0; i < n; ++i)
+    {
+        const ZyanRoaringContainer* const container = &containers[i];
+        switch (container->type)
+        {
+        case ZYAN_ROARING_CONTAINER_ARRAY:
+        {
+            ZYAN_ASSERT(container->cardinality <= ZYAN_ROARING_ARRAY_MAX);
+            const ZyanU16* const values = ZYAN_ROARING_ARRAY(container);
+            for (ZyanU32 j = 0; j < container->count; ++j)
+            {
+                ZyanRoaringStoreU16(p + 2 * j, values[j]);
+            }
+            break;
+        }
+        case ZYAN_ROARING_CONTAINER_BITMAP:
+        {
+            ZYAN_ASSERT(container->cardinality > ZYAN_ROARING_ARRAY_MAX);
+            const ZyanU64* const words = ZYAN_ROARING_WORDS(container);
+            for (ZyanU32 j = 0; j < ZYAN_ROARING_BITMAP_WORDS; ++j)
+            {
+                ZyanRoaringStoreU32(p + 8 * j, (ZyanU32)words[j]);
+                ZyanRoaringStoreU32(p + 8 * j + 4, (ZyanU32)(words[j] >> 32));
+            }
+            break;
+        }
+        case ZYAN_ROARING_CONTAINER_RUN:
+        {
+            const ZyanRoaringRun* const runs = ZYAN_ROARING_RUNS(container);
+            ZyanRoaringStoreU16(p, (ZyanU16)container->count);
+            for (ZyanU32 j = 0; j < container->count; ++j)
+            {
+                ZyanRoaringStoreU16(p + 2 + 4 * j, runs[j].start);
+                ZyanRoaringStoreU16(p + 4 + 4 * j, runs[j].length);
+            }
+            break;
+        }
+        default:
+            ZYAN_UNREACHABLE;
+        }
+        p += ZyanRoaringContainerSerializedSize(container);
+    }
+    ZYAN_ASSERT(p == out + required);
+    *size = required;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRoaringBitmapDeserialize(ZyanRoaringBitmap* bitmap, const void* buffer,
+    ZyanUSize size, ZyanUSize* read)
+{
+    if (!bitmap || !buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanRoaringBitmapClear(bitmap));
+
+    ZyanUSize consumed;
+    const ZyanStatus status =
+        ZyanRoaringBitmapDeserializeInternal(bitmap, (const ZyanU8*)buffer, size, &consumed);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZYAN_CHECK(ZyanRoaringBitmapClear(bitmap));
+        return status;
+    }
+    if (read)
+    {
+        *read = consumed;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRoaringBitmapRunOptimize(ZyanRoaringBitmap* bitmap)
+{
+    if (!bitmap)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanBool has_runs = ZYAN_FALSE;
+    ZyanRoaringContainer* const containers = ZYAN_ROARING_CONTAINERS(bitmap);
+    for (ZyanUSize i = 0; i < bitmap->containers.size; ++i)
+    {
+        ZYAN_CHECK(ZyanRoaringContainerOptimize(bitmap->allocator, &containers[i], ZYAN_TRUE));
+        has_runs |= (containers[i].type == ZYAN_ROARING_CONTAINER_RUN);
+    }
+
+    return has_runs ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRoaringBitmapGetCardinality(const ZyanRoaringBitmap* bitmap,
+    ZyanU64* cardinality)
+{
+    if (!bitmap || !cardinality)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU64 result = 0;
+    const ZyanRoaringContainer* const containers = ZYAN_ROARING_CONTAINERS(bitmap);
+    for (ZyanUSize i = 0; i < bitmap->containers.size; ++i)
+    {
+        result += containers[i].cardinality;
+    }
+    *cardinality = result;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRoaringBitmapGetSizeBytes(const ZyanRoaringBitmap* bitmap, ZyanUSize* size)
+{
+    if (!bitmap || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize result = bitmap->containers.capacity * sizeof(ZyanRoaringContainer);
+    const ZyanRoaringContainer* const containers = ZYAN_ROARING_CONTAINERS(bitmap);
+    for (ZyanUSize i = 0; i < bitmap->containers.size; ++i)
+    {
+        result += containers[i].capacity * ZyanRoaringElementSize(containers[i].type);
+    }
+    *size = result;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,833 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/SetOperations.h>
+
+#if !defined(ZYAN_KERNEL) && (defined(ZYAN_X64) || (defined(ZYAN_X86) && \
+    (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))))
+#   define ZYAN_SET_SSE2
+#   define ZYAN_SET_SIMD
+#   include <emmintrin.h>
+#elif !defined(ZYAN_KERNEL) && defined(ZYAN_AARCH64)
+#   define ZYAN_SET_NEON
+#   define ZYAN_SET_SIMD
+#   include <arm_neon.h>
+#endif
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * The size ratio of the input vectors above which galloping search is used instead of a linear
+ * merge.
+ */
+#define ZYAN_SET_GALLOP_RATIO   32
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Checks if the size ratio of two inputs is large enough to use galloping search.
+ *
+ * @param   small   The size of the smaller input.
+ * @param   large   The size of the larger input.
+ *
+ * @return  `ZYAN_TRUE`, if galloping search should be used or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanSetShouldGallop(ZyanUSize small, ZyanUSize large)
+{
+    return (small <= large / ZYAN_SET_GALLOP_RATIO);
+}
+
+/**
+ * Validates the arguments and prepares the `result` vector.
+ *
+ * @param   first       A pointer to the first `ZyanVector` instance.
+ * @param   second      A pointer to the second `ZyanVector` instance.
+ * @param   result      A pointer to the result `ZyanVector` instance.
+ * @param   capacity    The maximum number of elements written to the `result` vector.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanSetPrepare(const ZyanVector* first, const ZyanVector* second,
+    ZyanVector* result, ZyanUSize capacity)
+{
+    if (!first || !second || !result || (result == first) || (result == second))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (((first->element_size != 4) && (first->element_size != 8)) ||
+        (first->element_size != second->element_size) ||
+        (first->element_size != result->element_size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanVectorClear(result));
+    return ZyanVectorReserve(result, capacity);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* 32-bit kernels                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the index of the first element not less than `value` in the range `[begin, end)`
+ * using galloping search.
+ *
+ * @param   data    A pointer to the sorted data.
+ * @param   begin   The start index.
+ * @param   end     The end index.
+ * @param   value   The value to search for.
+ *
+ * @return  The index of the first element not less than `value` or `end`, if there is none.
+ */
+static ZyanUSize ZyanSetGallop32(const ZyanU32* data, ZyanUSize begin, ZyanUSize end,
+    ZyanU32 value)
+{
+    if ((begin >= end) || (data[begin] >= value))
+    {
+        return begin;
+    }
+
+    // Invariant: `data[lo] < value` and (`hi == end` or `data[hi] >= value`)
+    ZyanUSize lo = begin;
+    ZyanUSize step = 1;
+    ZyanUSize hi = begin + 1;
+    while ((hi < end) && (data[hi] < value))
+    {
+        lo = hi;
+        step <<= 1;
+        hi = (end - lo > step) ? lo + step : end;
+    }
+    while (lo + 1 < hi)
+    {
+        const ZyanUSize mid = lo + ((hi - lo) >> 1);
+        if (data[mid] < value)
+        {
+            lo = mid;
+        } else
+        {
+            hi = mid;
+        }
+    }
+
+    return hi;
+}
+
+#ifdef ZYAN_SET_SIMD
+
+/**
+ * Compares a block of 4 elements against another block of 4 elements.
+ *
+ * @param   a   A pointer to the first block.
+ * @param   b   A pointer to the second block.
+ *
+ * @return  A bitmask with bit `n` set, if `a[n]` is present in `b`.
+ */
+static ZyanU32 ZyanSetMatchBlock32(const ZyanU32* a, const ZyanU32* b)
+{
+#if defined(ZYAN_SET_SSE2)
+    const __m128i va = _mm_loadu_si128((const __m128i*)a);
+    const __m128i vb = _mm_loadu_si128((const __m128i*)b);
+    const __m128i eq0 = _mm_cmpeq_epi32(va, vb);
+    const __m128i eq1 = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1)));
+    const __m128i eq2 = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2)));
+    const __m128i eq3 = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3)));
+    const __m128i eq = _mm_or_si128(_mm_or_si128(eq0, eq1), _mm_or_si128(eq2, eq3));
+    return (ZyanU32)_mm_movemask_ps(_mm_castsi128_ps(eq));
+#elif defined(ZYAN_SET_NEON)
+    static const ZyanU32 bits[4] = { 1, 2, 4, 8 };
+    const uint32x4_t va = vld1q_u32(a);
+    const uint32x4_t vb = vld1q_u32(b);
+    const uint32x4_t eq0 = vceqq_u32(va, vb);
+    const uint32x4_t eq1 = vceqq_u32(va, vextq_u32(vb, vb, 1));
+    const uint32x4_t eq2 = vceqq_u32(va, vextq_u32(vb, vb, 2));
+    const uint32x4_t eq3 = vceqq_u32(va, vextq_u32(vb, vb, 3));
+    const uint32x4_t eq = vorrq_u32(vorrq_u32(eq0, eq1), vorrq_u32(eq2, eq3));
+    return vaddvq_u32(vandq_u32(eq, vld1q_u32(bits)));
+#endif
+}
+
+/**
+ * Writes the elements of a block of 4 elements selected by the given `mask` to `output`.
+ *
+ * @param   output      A pointer to the output buffer.
+ * @param   index       The current output index.
+ * @param   capacity    The capacity of the output buffer.
+ * @param   block       A pointer to the block.
+ * @param   mask        The selection bitmask.
+ *
+ * @return  The new output index.
+ */
+static ZyanUSize ZyanSetEmitBlock32(ZyanU32* output, ZyanUSize index, ZyanUSize capacity,
+    const ZyanU32* block, ZyanU32 mask)
+{
+    if (index + 4 <= capacity)
+    {
+        // Branchless: Always store, but only advance for selected elements
+        output[index] = block[0]; index += (mask >> 0) & 1;
+        output[index] = block[1]; index += (mask >> 1) & 1;
+        output[index] = block[2]; index += (mask >> 2) & 1;
+        output[index] = block[3]; index += (mask >> 3) & 1;
+        return index;
+    }
+
+    for (ZyanUSize i = 0; i < 4; ++i)
+    {
+        if (mask & (1u << i))
+        {
+            output[index++] = block[i];
+        }
+    }
+    return index;
+}
+
+#endif // ZYAN_SET_SIMD
+
+static ZyanUSize ZyanSetIntersection32(const ZyanU32* a, ZyanUSize na, const ZyanU32* b,
+    ZyanUSize nb, ZyanU32* output, ZyanUSize capacity)
+{
+    ZyanUSize i = 0;
+    ZyanUSize j = 0;
+    ZyanUSize k = 0;
+
+    if (na > nb)
+    {
+        const ZyanU32* const t = a; a = b; b = t;
+        const ZyanUSize n = na; na = nb; nb = n;
+    }
+
+    if (ZyanSetShouldGallop(na, nb))
+    {
+        for (; (i < na) && (j < nb); ++i)
+        {
+            j = ZyanSetGallop32(b, j, nb, a[i]);
+            if ((j < nb) && (b[j] == a[i]))
+            {
+                output[k++] = b[j++];
+            }
+        }
+        return k;
+    }
+
+#ifdef ZYAN_SET_SIMD
+    while ((i + 4 <= na) && (j + 4 <= nb))
+    {
+        k = ZyanSetEmitBlock32(output, k, capacity, &a[i], ZyanSetMatchBlock32(&a[i], &b[j]));
+        const ZyanU32 a_max = a[i + 3];
+        const ZyanU32 b_max = b[j + 3];
+        i += (a_max <= b_max) ? 4 : 0;
+        j += (b_max <= a_max) ? 4 : 0;
+    }
+#else
+    ZYAN_UNUSED(capacity);
+#endif
+
+    while ((i < na) && (j < nb))
+    {
+        const ZyanU32 x = a[i];
+        const ZyanU32 y = b[j];
+        output[k] = x;
+        k += (x == y);
+        i += (x <= y);
+        j += (y <= x);
+    }
+
+    return k;
+}
+
+static ZyanUSize ZyanSetDifference32(const ZyanU32* a, ZyanUSize na, const ZyanU32* b,
+    ZyanUSize nb, ZyanU32* output, ZyanUSize capacity)
+{
+    ZyanUSize i = 0;
+    ZyanUSize j = 0;
+    ZyanUSize k = 0;
+
+    if (ZyanSetShouldGallop(na, nb))
+    {
+        for (; (i < na) && (j < nb); ++i)
+        {
+            j = ZyanSetGallop32(b, j, nb, a[i]);
+            if ((j < nb) && (b[j] == a[i]))
+            {
+                ++j;
+                continue;
+            }
+            output[k++] = a[i];
+        }
+    } else if (ZyanSetShouldGallop(nb, na))
+    {
+        for (; (j < nb) && (i < na); ++j)
+        {
+            const ZyanUSize next = ZyanSetGallop32(a, i, na, b[j]);
+            ZYAN_MEMCPY(&output[k], &a[i], (next - i) * sizeof(ZyanU32));
+            k += next - i;
+            i = next;
+            if ((i < na) && (a[i] == b[j]))
+            {
+                ++i;
+            }
+        }
+    } else
+    {
+#ifdef ZYAN_SET_SIMD
+        // Bits of the current `a` block that already matched an element of a previous `b` block
+        ZyanU32 matched = 0;
+        while ((i + 4 <= na) && (j + 4 <= nb))
+        {
+            matched |= ZyanSetMatchBlock32(&a[i], &b[j]);
+            const ZyanU32 a_max = a[i + 3];
+            const ZyanU32 b_max = b[j + 3];
+            if (a_max <= b_max)
+            {
+                k = ZyanSetEmitBlock32(output, k, capacity, &a[i], ~matched & 0xF);
+                matched = 0;
+                i += 4;
+            }
+            if (b_max <= a_max)
+            {
+                j += 4;
+            }
+        }
+        if (i + 4 <= na)
+        {
+            // The `b` vector got exhausted while processing an `a` block. Elements that already
+            // matched must not be compared again, because their counterparts precede `b[j]`
+            for (const ZyanUSize end = i + 4; i < end; ++i, matched >>= 1)
+            {
+                if (matched & 1)
+                {
+                    continue;
+                }
+                while ((j < nb) && (b[j] < a[i]))
+                {
+                    ++j;
+                }
+                if ((j < nb) && (b[j] == a[i]))
+                {
+                    continue;
+                }
+                output[k++] = a[i];
+            }
+        }
+#else
+        ZYAN_UNUSED(capacity);
+#endif
+
+        while ((i < na) && (j < nb))
+        {
+            const ZyanU32 x = a[i];
+            const ZyanU32 y = b[j];
+            output[k] = x;
+            k += (x < y);
+            i += (x <= y);
+            j += (y <= x);
+        }
+    }
+
+    ZYAN_MEMCPY(&output[k], &a[i], (na - i) * sizeof(ZyanU32));
+    return k + (na - i);
+}
+
+static ZyanUSize ZyanSetUnion32(const ZyanU32* a, ZyanUSize na, const ZyanU32* b, ZyanUSize nb,
+    ZyanU32* output, ZyanBool unique)
+{
+    ZyanUSize i = 0;
+    ZyanUSize j = 0;
+    ZyanUSize k = 0;
+
+    if (na > nb)
+    {
+        const ZyanU32* const t = a; a = b; b = t;
+        const ZyanUSize n = na; na = nb; nb = n;
+    }
+
+    if (ZyanSetShouldGallop(na, nb))
+    {
+        for (; i < na; ++i)
+        {
+            const ZyanUSize next = ZyanSetGallop32(b, j, nb, a[i]);
+            ZYAN_MEMCPY(&output[k], &b[j], (next - j) * sizeof(ZyanU32));
+            k += next - j;
+            j = next;
+            if (unique && (j < nb) && (b[j] == a[i]))
+            {
+                ++j;
+            }
+            output[k++] = a[i];
+        }
+    } else if (unique)
+    {
+        while ((i < na) && (j < nb))
+        {
+            const ZyanU32 x = a[i];
+            const ZyanU32 y = b[j];
+            output[k++] = (x <= y) ? x : y;
+            i += (x <= y);
+            j += (y <= x);
+        }
+    } else
+    {
+        while ((i < na) && (j < nb))
+        {
+            const ZyanU32 x = a[i];
+            const ZyanU32 y = b[j];
+            const ZyanBool take_a = (x <= y);
+            output[k++] = take_a ? x : y;
+            i += take_a;
+            j += !take_a;
+        }
+    }
+
+    ZYAN_MEMCPY(&output[k], &a[i], (na - i) * sizeof(ZyanU32));
+    k += na - i;
+    ZYAN_MEMCPY(&output[k], &b[j], (nb - j) * sizeof(ZyanU32));
+    return k + (nb - j);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* 64-bit kernels                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the index of the first element not less than `value` in the range `[begin, end)`
+ * using galloping search.
+ *
+ * @param   data    A pointer to the sorted data.
+ * @param   begin   The start index.
+ * @param   end     The end index.
+ * @param   value   The value to search for.
+ *
+ * @return  The index of the first element not less than `value` or `end`, if there is none.
+ */
+static ZyanUSize ZyanSetGallop64(const ZyanU64* data, ZyanUSize begin, ZyanUSize end,
+    ZyanU64 value)
+{
+    if ((begin >= end) || (data[begin] >= value))
+    {
+        return begin;
+    }
+
+    // Invariant: `data[lo] < value` and (`hi == end` or `data[hi] >= value`)
+    ZyanUSize lo = begin;
+    ZyanUSize step = 1;
+    ZyanUSize hi = begin + 1;
+    while ((hi < end) && (data[hi] < value))
+    {
+        lo = hi;
+        step <<= 1;
+        hi = (end - lo > step) ? lo + step : end;
+    }
+    while (lo + 1 < hi)
+    {
+        const ZyanUSize mid = lo + ((hi - lo) >> 1);
+        if (data[mid] < value)
+        {
+            lo = mid;
+        } else
+        {
+            hi = mid;
+        }
+    }
+
+    return hi;
+}
+
+#ifdef ZYAN_SET_SIMD
+
+/**
+ * Compares a block of 2 elements against another block of 2 elements.
+ *
+ * @param   a   A pointer to the first block.
+ * @param   b   A pointer to the second block.
+ *
+ * @return  A bitmask with bit `n` set, if `a[n]` is present in `b`.
+ */
+static ZyanU32 ZyanSetMatchBlock64(const ZyanU64* a, const ZyanU64* b)
+{
+#if defined(ZYAN_SET_SSE2)
+    // SSE2 lacks a 64-bit equality comparison. Both 32-bit halves have to match
+    const __m128i va = _mm_loadu_si128((const __m128i*)a);
+    const __m128i vb = _mm_loadu_si128((const __m128i*)b);
+    const __m128i eq0 = _mm_cmpeq_epi32(va, vb);
+    const __m128i eq1 = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2)));
+    const __m128i eq = _mm_or_si128(
+        _mm_and_si128(eq0, _mm_shuffle_epi32(eq0, _MM_SHUFFLE(2, 3, 0, 1))),
+        _mm_and_si128(eq1, _mm_shuffle_epi32(eq1, _MM_SHUFFLE(2, 3, 0, 1))));
+    return (ZyanU32)_mm_movemask_pd(_mm_castsi128_pd(eq));
+#elif defined(ZYAN_SET_NEON)
+    const uint64x2_t va = vld1q_u64(a);
+    const uint64x2_t vb = vld1q_u64(b);
+    const uint64x2_t eq = vorrq_u64(vceqq_u64(va, vb), vceqq_u64(va, vextq_u64(vb, vb, 1)));
+    return (ZyanU32)((vgetq_lane_u64(eq, 0) & 1) | (vgetq_lane_u64(eq, 1) & 2));
+#endif
+}
+
+/**
+ * Writes the elements of a block of 2 elements selected by the given `mask` to `output`.
+ *
+ * @param   output      A pointer to the output buffer.
+ * @param   index       The current output index.
+ * @param   capacity    The capacity of the output buffer.
+ * @param   block       A pointer to the block.
+ * @param   mask        The selection bitmask.
+ *
+ * @return  The new output index.
+ */
+static ZyanUSize ZyanSetEmitBlock64(ZyanU64* output, ZyanUSize index, ZyanUSize capacity,
+    const ZyanU64* block, ZyanU32 mask)
+{
+    if (index + 2 <= capacity)
+    {
+        // Branchless: Always store, but only advance for selected elements
+        output[index] = block[0]; index += (mask >> 0) & 1;
+        output[index] = block[1]; index += (mask >> 1) & 1;
+        return index;
+    }
+
+    if (mask & 1)
+    {
+        output[index++] = block[0];
+    }
+    if (mask & 2)
+    {
+        output[index++] = block[1];
+    }
+    return index;
+}
+
+#endif // ZYAN_SET_SIMD
+
+static ZyanUSize ZyanSetIntersection64(const ZyanU64* a, ZyanUSize na, const ZyanU64* b,
+    ZyanUSize nb, ZyanU64* output, ZyanUSize capacity)
+{
+    ZyanUSize i = 0;
+    ZyanUSize j = 0;
+    ZyanUSize k = 0;
+
+    if (na > nb)
+    {
+        const ZyanU64* const t = a; a = b; b = t;
+        const ZyanUSize n = na; na = nb; nb = n;
+    }
+
+    if (ZyanSetShouldGallop(na, nb))
+    {
+        for (; (i < na) && (j < nb); ++i)
+        {
+            j = ZyanSetGallop64(b, j, nb, a[i]);
+            if ((j < nb) && (b[j] == a[i]))
+            {
+                output[k++] = b[j++];
+            }
+        }
+        return k;
+    }
+
+#ifdef ZYAN_SET_SIMD
+    while ((i + 2 <= na) && (j + 2 <= nb))
+    {
+        k = ZyanSetEmitBlock64(output, k, capacity, &a[i], ZyanSetMatchBlock64(&a[i], &b[j]));
+        const ZyanU64 a_max = a[i + 1];
+        const ZyanU64 b_max = b[j + 1];
+        i += (a_max <= b_max) ? 2 : 0;
+        j += (b_max <= a_max) ? 2 : 0;
+    }
+#else
+    ZYAN_UNUSED(capacity);
+#endif
+
+    while ((i < na) && (j < nb))
+    {
+        const ZyanU64 x = a[i];
+        const ZyanU64 y = b[j];
+        output[k] = x;
+        k += (x == y);
+        i += (x <= y);
+        j += (y <= x);
+    }
+
+    return k;
+}
+
+static ZyanUSize ZyanSetDifference64(const ZyanU64* a, ZyanUSize na, const ZyanU64* b,
+    ZyanUSize nb, ZyanU64* output, ZyanUSize capacity)
+{
+    ZyanUSize i = 0;
+    ZyanUSize j = 0;
+    ZyanUSize k = 0;
+
+    if (ZyanSetShouldGallop(na, nb))
+    {
+        for (; (i < na) && (j < nb); ++i)
+        {
+            j = ZyanSetGallop64(b, j, nb, a[i]);
+            if ((j < nb) && (b[j] == a[i]))
+            {
+                ++j;
+                continue;
+            }
+            output[k++] = a[i];
+        }
+    } else if (ZyanSetShouldGallop(nb, na))
+    {
+        for (; (j < nb) && (i < na); ++j)
+        {
+            const ZyanUSize next = ZyanSetGallop64(a, i, na, b[j]);
+            ZYAN_MEMCPY(&output[k], &a[i], (next - i) * sizeof(ZyanU64));
+            k += next - i;
+            i = next;
+            if ((i < na) && (a[i] == b[j]))
+            {
+                ++i;
+            }
+        }
+    } else
+    {
+#ifdef ZYAN_SET_SIMD
+        // Bits of the current `a` block that already matched an element of a previous `b` block
+        ZyanU32 matched = 0;
+        while ((i + 2 <= na) && (j + 2 <= nb))
+        {
+            matched |= ZyanSetMatchBlock64(&a[i], &b[j]);
+            const ZyanU64 a_max = a[i + 1];
+            const ZyanU64 b_max = b[j + 1];
+            if (a_max <= b_max)
+            {
+                k = ZyanSetEmitBlock64(output, k, capacity, &a[i], ~matched & 0x3);
+                matched = 0;
+                i += 2;
+            }
+            if (b_max <= a_max)
+            {
+                j += 2;
+            }
+        }
+        if (i + 2 <= na)
+        {
+            // The `b` vector got exhausted while processing an `a` block. Elements that already
+            // matched must not be compared again, because their counterparts precede `b[j]`
+            for (const ZyanUSize end = i + 2; i < end; ++i, matched >>= 1)
+            {
+                if (matched & 1)
+                {
+                    continue;
+                }
+                while ((j < nb) && (b[j] < a[i]))
+                {
+                    ++j;
+                }
+                if ((j < nb) && (b[j] == a[i]))
+                {
+                    continue;
+                }
+                output[k++] = a[i];
+            }
+        }
+#else
+        ZYAN_UNUSED(capacity);
+#endif
+
+        while ((i < na) && (j < nb))
+        {
+            const ZyanU64 x = a[i];
+            const ZyanU64 y = b[j];
+            output[k] = x;
+            k += (x < y);
+            i += (x <= y);
+            j += (y <= x);
+        }
+    }
+
+    ZYAN_MEMCPY(&output[k], &a[i], (na - i) * sizeof(ZyanU64));
+    return k + (na - i);
+}
+
+static ZyanUSize ZyanSetUnion64(const ZyanU64* a, ZyanUSize na, const ZyanU64* b, ZyanUSize nb,
+    ZyanU64* output, ZyanBool unique)
+{
+    ZyanUSize i = 0;
+    ZyanUSize j = 0;
+    ZyanUSize k = 0;
+
+    if (na > nb)
+    {
+        const ZyanU64* const t = a; a = b; b = t;
+        const ZyanUSize n = na; na = nb; nb = n;
+    }
+
+    if (ZyanSetShouldGallop(na, nb))
+    {
+        for (; i < na; ++i)
+        {
+            const ZyanUSize next = ZyanSetGallop64(b, j, nb, a[i]);
+            ZYAN_MEMCPY(&output[k], &b[j], (next - j) * sizeof(ZyanU64));
+            k += next - j;
+            j = next;
+            if (unique && (j < nb) && (b[j] == a[i]))
+            {
+                ++j;
+            }
+            output[k++] = a[i];
+        }
+    } else if (unique)
+    {
+        while ((i < na) && (j < nb))
+        {
+            const ZyanU64 x = a[i];
+            const ZyanU64 y = b[j];
+            output[k++] = (x <= y) ? x : y;
+            i += (x <= y);
+            j += (y <= x);
+        }
+    } else
+    {
+        while ((i < na) && (j < nb))
+        {
+            const ZyanU64 x = a[i];
+            const ZyanU64 y = b[j];
+            const ZyanBool take_a = (x <= y);
+            output[k++] = take_a ? x : y;
+            i += take_a;
+            j += !take_a;
+        }
+    }
+
+    ZYAN_MEMCPY(&output[k], &a[i], (na - i) * sizeof(ZyanU64));
+    k += na - i;
+    ZYAN_MEMCPY(&output[k], &b[j], (nb - j) * sizeof(ZyanU64));
+    return k + (nb - j);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+ZyanStatus ZyanSetIntersection(const ZyanVector* first, const ZyanVector* second,
+    ZyanVector* result)
+{
+    if (!first || !second)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanSetPrepare(first, second, result, ZYAN_MIN(first->size, second->size)));
+
+    if (first->element_size == 4)
+    {
+        result->size = ZyanSetIntersection32((const ZyanU32*)first->data, first->size,
+            (const ZyanU32*)second->data, second->size, (ZyanU32*)result->data,
+            result->capacity);
+    } else
+    {
+        result->size = ZyanSetIntersection64((const ZyanU64*)first->data, first->size,
+            (const ZyanU64*)second->data, second->size, (ZyanU64*)result->data,
+            result->capacity);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSetUnion(const ZyanVector* first, const ZyanVector* second, ZyanVector* result)
+{
+    if (!first || !second)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanSetPrepare(first, second, result, first->size + second->size));
+
+    if (first->element_size == 4)
+    {
+        result->size = ZyanSetUnion32((const ZyanU32*)first->data, first->size,
+            (const ZyanU32*)second->data, second->size, (ZyanU32*)result->data, ZYAN_TRUE);
+    } else
+    {
+        result->size = ZyanSetUnion64((const ZyanU64*)first->data, first->size,
+            (const ZyanU64*)second->data, second->size, (ZyanU64*)result->data, ZYAN_TRUE);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSetDifference(const ZyanVector* first, const ZyanVector* second,
+    ZyanVector* result)
+{
+    if (!first || !second)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanSetPrepare(first, second, result, first->size));
+
+    if (first->element_size == 4)
+    {
+        result->size = ZyanSetDifference32((const ZyanU32*)first->data, first->size,
+            (const ZyanU32*)second->data, second->size, (ZyanU32*)result->data,
+            result->capacity);
+    } else
+    {
+        result->size = ZyanSetDifference64((const ZyanU64*)first->data, first->size,
+            (const ZyanU64*)second->data, second->size, (ZyanU64*)result->data,
+            result->capacity);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSetMerge(const ZyanVector* first, const ZyanVector* second, ZyanVector* result)
+{
+    if (!first || !second)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanSetPrepare(first, second, result, first->size + second->size));
+
+    if (first->element_size == 4)
+    {
+        result->size = ZyanSetUnion32((const ZyanU32*)first->data, first->size,
+            (const ZyanU32*)second->data, second->size, (ZyanU32*)result->data, ZYAN_FALSE);
+    } else
+    {
+        result->size = ZyanSetUnion64((const ZyanU64*)first->data, first->size,
+            (const ZyanU64*)second->data, second->size, (ZyanU64*)result->data, ZYAN_FALSE);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,425 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/SlotMap.h>
+
+/* ============================================================================================== */
+/* Internal constants                                                                             */
+/* ============================================================================================== */
+
+/**
+ * Marks the end of the free slot list.
+ */
+#define ZYAN_SLOTMAP_INVALID    0xFFFFFFFFu
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanSlotMapSlot` struct.
+ *
+ * An odd generation marks an occupied slot and an even generation a free one.
+ */
+typedef struct ZyanSlotMapSlot_
+{
+    /**
+     * The position of the element in the dense array or the index of the next free slot.
+     */
+    ZyanU32 value;
+    /**
+     * The current generation of the slot.
+     */
+    ZyanU32 generation;
+} ZyanSlotMapSlot;
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+#define ZYAN_SLOTMAP_ELEMENT(map, index) \
+    ((ZyanU8*)(map)->elements.data + (ZyanUSize)(index) * (map)->element_size)
+
+#define ZYAN_SLOTMAP_OWNERS(map) \
+    ((ZyanU32*)(map)->owners.data)
+
+#define ZYAN_SLOTMAP_SLOTS(map) \
+    ((ZyanSlotMapSlot*)(map)->slots.data)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/**
+ * Returns the slot referred to by the given handle.
+ *
+ * @param   map     A pointer to the `ZyanSlotMap` instance.
+ * @param   handle  The handle.
+ *
+ * @return  A pointer to the slot or `ZYAN_NULL`, if the handle is stale.
+ */
+static ZyanSlotMapSlot* ZyanSlotMapResolve(const ZyanSlotMap* map, ZyanSlotMapHandle handle)
+{
+    if ((handle.index >= map->slots.size) || !(handle.generation & 1))
+    {
+        return ZYAN_NULL;
+    }
+
+    ZyanSlotMapSlot* const slot = &ZYAN_SLOTMAP_SLOTS(map)[handle.index];
+    return (slot->generation == handle.generation) ? slot : ZYAN_NULL;
+}
+
+/**
+ * Releases the given slot and puts it on the free list.
+ *
+ * @param   map     A pointer to the `ZyanSlotMap` instance.
+ * @param   index   The slot index.
+ *
+ * Slots whose generation counter would wrap around are retired instead of being reused, so that
+ * stale handles can never become valid again.
+ */
+static void ZyanSlotMapReleaseSlot(ZyanSlotMap* map, ZyanU32 index)
+{
+    ZyanSlotMapSlot* const slot = &ZYAN_SLOTMAP_SLOTS(map)[index];
+    if (++slot->generation == 0)
+    {
+        return;
+    }
+
+    slot->value = map->free;
+    map->free = index;
+}
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanSlotMapInit(ZyanSlotMap* map, ZyanUSize element_size,
+    ZyanMemberProcedure destructor)
+{
+    return ZyanSlotMapInitEx(map, element_size, 1, destructor, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanSlotMapInitEx(ZyanSlotMap* map, ZyanUSize element_size, ZyanUSize capacity,
+    ZyanMemberProcedure destructor, ZyanAllocator* allocator)
+{
+    if (!map || !element_size || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    map->element_size = element_size;
+    map->destructor   = destructor;
+    map->free         = ZYAN_SLOTMAP_INVALID;
+
+    // Dynamic shrinking is disabled, so that erasing elements never fails. The destructor is
+    // invoked by the slot map itself, since elements are moved around on erasure
+    ZYAN_CHECK(ZyanVectorInitEx(&map->elements, element_size, capacity, ZYAN_NULL, allocator,
+        ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, 0));
+    ZyanStatus status = ZyanVectorInitEx(&map->owners, sizeof(ZyanU32), capacity, ZYAN_NULL,
+        allocator, ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, 0);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanVectorDestroy(&map->elements);
+        return status;
+    }
+    status = ZyanVectorInitEx(&map->slots, sizeof(ZyanSlotMapSlot), capacity, ZYAN_NULL,
+        allocator, ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, 0);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanVectorDestroy(&map->owners);
+        ZyanVectorDestroy(&map->elements);
+        return status;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSlotMapDestroy(ZyanSlotMap* map)
+{
+    ZYAN_CHECK(ZyanSlotMapClear(map));
+
+    ZYAN_CHECK(ZyanVectorDestroy(&map->slots));
+    ZYAN_CHECK(ZyanVectorDestroy(&map->owners));
+
+    return ZyanVectorDestroy(&map->elements);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSlotMapInsert(ZyanSlotMap* map, const void* element, ZyanSlotMapHandle* handle)
+{
+    if (!element)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    void* destination;
+    ZYAN_CHECK(ZyanSlotMapEmplace(map, &destination, handle));
+    ZYAN_MEMCPY(destination, element, map->element_size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSlotMapEmplace(ZyanSlotMap* map, void** element, ZyanSlotMapHandle* handle)
+{
+    if (!map || !element || !handle)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize position = map->elements.size;
+    if (position >= ZYAN_SLOTMAP_INVALID)
+    {
+        return ZYAN_STATUS_OUT_OF_RESOURCES;
+    }
+
+    // Reuse a free slot or append a new one
+    ZYAN_CHECK(ZyanVectorEmplace(&map->elements, element, ZYAN_NULL));
+    const ZyanBool reuse = (map->free != ZYAN_SLOTMAP_INVALID);
+    ZyanU32 index = map->free;
+    ZyanStatus status = ZyanVectorPushBack(&map->owners, &index);
+    if (ZYAN_SUCCESS(status) && !reuse)
+    {
+        const ZyanSlotMapSlot slot = { 0, 0 };
+        status = (map->slots.size < ZYAN_SLOTMAP_INVALID) ?
+            ZyanVectorPushBack(&map->slots, &slot) : ZYAN_STATUS_OUT_OF_RESOURCES;
+        if (!ZYAN_SUCCESS(status))
+        {
+            ZyanVectorPopBack(&map->owners);
+        }
+        index = (ZyanU32)(map->slots.size - 1);
+    }
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanVectorPopBack(&map->elements);
+        return status;
+    }
+
+    ZyanSlotMapSlot* const slot = &ZYAN_SLOTMAP_SLOTS(map)[index];
+    if (reuse)
+    {
+        map->free = slot->value;
+    }
+    slot->value = (ZyanU32)position;
+    ++slot->generation;
+    ZYAN_SLOTMAP_OWNERS(map)[position] = index;
+
+    handle->index = index;
+    handle->generation = slot->generation;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSlotMapErase(ZyanSlotMap* map, ZyanSlotMapHandle handle)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanSlotMapSlot* const slot = ZyanSlotMapResolve(map, handle);
+    if (!slot)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    const ZyanU32 position = slot->value;
+    void* const element = ZYAN_SLOTMAP_ELEMENT(map, position);
+    if (map->destructor)
+    {
+        map->destructor(element);
+    }
+
+    // Move the last element into the gap
+    const ZyanU32 last = (ZyanU32)(map->elements.size - 1);
+    if (position != last)
+    {
+        ZYAN_MEMCPY(element, ZYAN_SLOTMAP_ELEMENT(map, last), map->element_size);
+        const ZyanU32 owner = ZYAN_SLOTMAP_OWNERS(map)[last];
+        ZYAN_SLOTMAP_OWNERS(map)[position] = owner;
+        ZYAN_SLOTMAP_SLOTS(map)[owner].value = position;
+    }
+    ZYAN_CHECK(ZyanVectorPopBack(&map->elements));
+    ZYAN_CHECK(ZyanVectorPopBack(&map->owners));
+
+    ZyanSlotMapReleaseSlot(map, handle.index);
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanSlotMapClear(ZyanSlotMap* map)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU32* const owners = ZYAN_SLOTMAP_OWNERS(map);
+    for (ZyanUSize i = 0; i < map->elements.size; ++i)
+    {
+        if (map->destructor)
+        {
+            map->destructor(ZYAN_SLOTMAP_ELEMENT(map, i));
+        }
+        ZyanSlotMapReleaseSlot(map, owners[i]);
+    }
+
+    ZYAN_CHECK(ZyanVectorResize(&map->elements, 0));
+
+    return ZyanVectorResize(&map->owners, 0);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSlotMapContains(const ZyanSlotMap* map, ZyanSlotMapHandle handle)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanSlotMapResolve(map, handle) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanSlotMapGet(const ZyanSlotMap* map, ZyanSlotMapHandle handle,
+    const void** element)
+{
+    return ZyanSlotMapGetMutable((ZyanSlotMap*)map, handle, (void**)element);
+}
+
+ZyanStatus ZyanSlotMapGetMutable(ZyanSlotMap* map, ZyanSlotMapHandle handle, void** element)
+{
+    if (!map || !element)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanSlotMapSlot* const slot = ZyanSlotMapResolve(map, handle);
+    if (!slot)
+    {
+        *element = ZYAN_NULL;
+        return ZYAN_STATUS_FALSE;
+    }
+
+    *element = ZYAN_SLOTMAP_ELEMENT(map, slot->value);
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSlotMapGetElements(const ZyanSlotMap* map, const void** elements)
+{
+    return ZyanSlotMapGetElementsMutable((ZyanSlotMap*)map, (void**)elements);
+}
+
+ZyanStatus ZyanSlotMapGetElementsMutable(ZyanSlotMap* map, void** elements)
+{
+    if (!map || !elements)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *elements = map->elements.size ? map->elements.data : ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSlotMapGetHandle(const ZyanSlotMap* map, ZyanUSize index,
+    ZyanSlotMapHandle* handle)
+{
+    if (!map || !handle)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= map->elements.size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    const ZyanU32 owner = ZYAN_SLOTMAP_OWNERS(map)[index];
+    handle->index = owner;
+    handle->generation = ZYAN_SLOTMAP_SLOTS(map)[owner].generation;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSlotMapReserve(ZyanSlotMap* map, ZyanUSize capacity)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanVectorReserve(&map->elements, capacity));
+    ZYAN_CHECK(ZyanVectorReserve(&map->owners, capacity));
+
+    return ZyanVectorReserve(&map->slots, capacity);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSlotMapGetSize(const ZyanSlotMap* map, ZyanUSize* size)
+{
+    if (!map || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = map->elements.size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,243 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/SparseSet.h>
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/**
+ * Checks, if the given element is present in the set.
+ *
+ * @param   set     A pointer to the `ZyanSparseSet` instance.
+ * @param   element The element (must be inside the universe).
+ *
+ * @return  `ZYAN_TRUE` if the element is present or `ZYAN_FALSE`, if not.
+ *
+ * The sparse entry of an absent element may contain an arbitrary stale position, which is why the
+ * dense array has to confirm the membership.
+ */
+static ZyanBool ZyanSparseSetIsPresent(const ZyanSparseSet* set, ZyanU32 element)
+{
+    const ZyanU32 position = set->sparse[element];
+    return (position < set->size) && (set->dense[position] == element);
+}
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanSparseSetInit(ZyanSparseSet* set, ZyanU32 universe)
+{
+    return ZyanSparseSetInitEx(set, universe, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanSparseSetInitEx(ZyanSparseSet* set, ZyanU32 universe, ZyanAllocator* allocator)
+{
+    if (!set || !universe || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if ((ZyanU64)universe * 2 * sizeof(ZyanU32) > (ZyanU64)(ZyanUSize)~(ZyanUSize)0)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    ZYAN_ASSERT(allocator->allocate);
+    ZYAN_ASSERT(allocator->deallocate);
+
+    // Both arrays share a single allocation
+    void* memory;
+    ZYAN_CHECK(allocator->allocate(allocator, &memory, sizeof(ZyanU32), (ZyanUSize)universe * 2));
+
+    set->allocator = allocator;
+    set->universe  = universe;
+    set->size      = 0;
+    set->sparse    = (ZyanU32*)memory;
+    set->dense     = set->sparse + universe;
+
+    // Clearing never touches the sparse array again, but initializing it once keeps the stale
+    // positions deterministic
+    ZYAN_MEMSET(set->sparse, 0, (ZyanUSize)universe * sizeof(ZyanU32));
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSparseSetDestroy(ZyanSparseSet* set)
+{
+    if (!set)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return set->allocator->deallocate(set->allocator, set->sparse, sizeof(ZyanU32),
+        (ZyanUSize)set->universe * 2);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion and deletion                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSparseSetInsert(ZyanSparseSet* set, ZyanU32 element)
+{
+    if (!set)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (element >= set->universe)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (ZyanSparseSetIsPresent(set, element))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    set->sparse[element] = set->size;
+    set->dense[set->size++] = element;
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanSparseSetRemove(ZyanSparseSet* set, ZyanU32 element)
+{
+    if (!set)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if ((element >= set->universe) || !ZyanSparseSetIsPresent(set, element))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    const ZyanU32 position = set->sparse[element];
+    const ZyanU32 last = set->dense[--set->size];
+    set->dense[position] = last;
+    set->sparse[last] = position;
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanSparseSetPop(ZyanSparseSet* set, ZyanU32* element)
+{
+    if (!set || !element)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (!set->size)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    *element = set->dense[--set->size];
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanSparseSetClear(ZyanSparseSet* set)
+{
+    if (!set)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    set->size = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSparseSetContains(const ZyanSparseSet* set, ZyanU32 element)
+{
+    if (!set)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ((element < set->universe) && ZyanSparseSetIsPresent(set, element)) ?
+        ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanSparseSetGetElements(const ZyanSparseSet* set, const ZyanU32** elements)
+{
+    if (!set || !elements)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *elements = set->dense;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSparseSetGetSize(const ZyanSparseSet* set, ZyanUSize* size)
+{
+    if (!set || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = set->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSparseSetGetUniverse(const ZyanSparseSet* set, ZyanU32* universe)
+{
+    if (!set || !universe)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *universe = set->universe;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,452 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Hash.h>
+#include <Zycore/LibC.h>
+#include <Zycore/StringInterner.h>
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanStringInternerBlock` struct.
+ *
+ * The header of a single storage block. The string data directly follows the header.
+ */
+typedef struct ZyanStringInternerBlock_
+{
+    /**
+     * The next block in the chain.
+     */
+    struct ZyanStringInternerBlock_* next;
+    /**
+     * The size of the data area in bytes.
+     */
+    ZyanUSize size;
+} ZyanStringInternerBlock;
+
+/**
+ * Defines the `ZyanStringInternerEntry` struct.
+ *
+ * Describes a single stored string.
+ */
+typedef struct ZyanStringInternerEntry_
+{
+    /**
+     * A pointer to the null-terminated string data.
+     */
+    const char* data;
+    /**
+     * The length of the string (excluding the terminating `\0` character).
+     */
+    ZyanUSize length;
+} ZyanStringInternerEntry;
+
+/**
+ * Defines the `ZyanStringInternerKey` struct.
+ *
+ * The key type of the lookup map. Caches the hash to avoid hashing the string data again when
+ * the map is rehashed.
+ */
+typedef struct ZyanStringInternerKey_
+{
+    /**
+     * The string.
+     */
+    ZyanStringInternerEntry entry;
+    /**
+     * The hash of the string.
+     */
+    ZyanU64 hash;
+} ZyanStringInternerKey;
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup map                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the cached hash of the given `ZyanStringInternerKey`.
+ *
+ * @param   key A pointer to the `ZyanStringInternerKey` instance.
+ *
+ * @return  The 64-bit hash.
+ */
+static ZyanU64 ZyanStringInternerHashKey(const void* key)
+{
+    return ((const ZyanStringInternerKey*)key)->hash;
+}
+
+/**
+ * Compares two `ZyanStringInternerKey` instances.
+ *
+ * @param   left    A pointer to the first `ZyanStringInternerKey` instance.
+ * @param   right   A pointer to the second `ZyanStringInternerKey` instance.
+ *
+ * @return  `ZYAN_TRUE`, if both strings are equal or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanStringInternerEqualsKey(const void* left, const void* right)
+{
+    const ZyanStringInternerKey* const a = (const ZyanStringInternerKey*)left;
+    const ZyanStringInternerKey* const b = (const ZyanStringInternerKey*)right;
+
+    return (a->hash == b->hash) && (a->entry.length == b->entry.length) &&
+        !ZYAN_MEMCMP(a->entry.data, b->entry.data, a->entry.length);
+}
+
+/**
+ * Initializes a lookup key for the given string.
+ *
+ * @param   key     A pointer to the `ZyanStringInternerKey` instance.
+ * @param   string  A pointer to the `ZyanStringView` instance.
+ */
+static void ZyanStringInternerMakeKey(ZyanStringInternerKey* key, const ZyanStringView* string)
+{
+    ZYAN_ASSERT(string->string.vector.size >= 1);
+
+    key->entry.data   = (const char*)string->string.vector.data;
+    key->entry.length = string->string.vector.size - 1;
+    key->hash         = ZyanHashStringView(string, 0);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Storage                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Allocates a new storage block.
+ *
+ * @param   interner    A pointer to the `ZyanStringInterner` instance.
+ * @param   size        The size of the data area in bytes.
+ * @param   block       Receives a pointer to the new block.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanStringInternerAllocateBlock(ZyanStringInterner* interner, ZyanUSize size,
+    ZyanStringInternerBlock** block)
+{
+    void* memory;
+    ZYAN_CHECK(interner->allocator->allocate(interner->allocator, &memory, 1,
+        sizeof(ZyanStringInternerBlock) + size));
+
+    *block = (ZyanStringInternerBlock*)memory;
+    (*block)->next = ZYAN_NULL;
+    (*block)->size = size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Frees all storage blocks of the given interner.
+ *
+ * @param   interner    A pointer to the `ZyanStringInterner` instance.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanStringInternerFreeBlocks(ZyanStringInterner* interner)
+{
+    ZyanStringInternerBlock* block = (ZyanStringInternerBlock*)interner->block;
+    while (block)
+    {
+        ZyanStringInternerBlock* const next = block->next;
+        ZYAN_CHECK(interner->allocator->deallocate(interner->allocator, block, 1,
+            sizeof(ZyanStringInternerBlock) + block->size));
+        block = next;
+    }
+
+    interner->block     = ZYAN_NULL;
+    interner->cursor    = ZYAN_NULL;
+    interner->remaining = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Copies the given string into the storage blocks.
+ *
+ * @param   interner    A pointer to the `ZyanStringInterner` instance.
+ * @param   data        A pointer to the string data.
+ * @param   length      The length of the string.
+ * @param   copy        Receives a pointer to the null-terminated copy.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanStringInternerStore(ZyanStringInterner* interner, const char* data,
+    ZyanUSize length, const char** copy)
+{
+    const ZyanUSize size = length + 1;
+
+    char* destination;
+    if (size <= interner->remaining)
+    {
+        destination = interner->cursor;
+        interner->cursor += size;
+        interner->remaining -= size;
+    } else if (size > interner->block_size / 2)
+    {
+        // Large strings get a dedicated block which is linked behind the current one, so the free
+        // space of the current block can still be used by subsequent strings
+        ZyanStringInternerBlock* block;
+        ZYAN_CHECK(ZyanStringInternerAllocateBlock(interner, size, &block));
+        ZyanStringInternerBlock* const head = (ZyanStringInternerBlock*)interner->block;
+        if (head)
+        {
+            block->next = head->next;
+            head->next = block;
+        } else
+        {
+            interner->block = block;
+        }
+        destination = (char*)(block + 1);
+    } else
+    {
+        ZyanStringInternerBlock* block;
+        ZYAN_CHECK(ZyanStringInternerAllocateBlock(interner, interner->block_size, &block));
+        block->next = (ZyanStringInternerBlock*)interner->block;
+        interner->block = block;
+        destination = (char*)(block + 1);
+        interner->cursor = destination + size;
+        interner->remaining = interner->block_size - size;
+    }
+
+    ZYAN_MEMCPY(destination, data, length);
+    destination[length] = '\0';
+    *copy = destination;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanStringInternerInit(ZyanStringInterner* interner)
+{
+    return ZyanStringInternerInitEx(interner, 0, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanStringInternerInitEx(ZyanStringInterner* interner, ZyanUSize block_size,
+    ZyanAllocator* allocator)
+{
+    if (!interner || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    interner->allocator  = allocator;
+    interner->block_size = block_size ? block_size : ZYAN_STRING_INTERNER_DEFAULT_BLOCK_SIZE;
+    interner->block      = ZYAN_NULL;
+    interner->cursor     = ZYAN_NULL;
+    interner->remaining  = 0;
+
+    ZYAN_CHECK(ZyanVectorInitEx(&interner->strings, sizeof(ZyanStringInternerEntry), 0,
+        ZYAN_NULL, allocator, ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR,
+        ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD));
+
+    const ZyanStatus status = ZyanHashMapInitEx(&interner->lookup, sizeof(ZyanStringInternerKey),
+        sizeof(ZyanU32), 0, &ZyanStringInternerHashKey, &ZyanStringInternerEqualsKey, allocator);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanVectorDestroy(&interner->strings);
+        return status;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanStringInternerDestroy(ZyanStringInterner* interner)
+{
+    if (!interner)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanHashMapDestroy(&interner->lookup));
+    ZYAN_CHECK(ZyanVectorDestroy(&interner->strings));
+
+    return ZyanStringInternerFreeBlocks(interner);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Interning                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanStringInternerIntern(ZyanStringInterner* interner, const ZyanStringView* string,
+    ZyanU32* id)
+{
+    if (!interner || !string || !id)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanStringInternerKey key;
+    ZyanStringInternerMakeKey(&key, string);
+
+    const void* value;
+    const ZyanStatus status = ZyanHashMapGet(&interner->lookup, &key, &value);
+    ZYAN_CHECK(status);
+    if (status == ZYAN_STATUS_TRUE)
+    {
+        *id = *(const ZyanU32*)value;
+        return ZYAN_STATUS_FALSE;
+    }
+
+    if (interner->strings.size >= ZYAN_UINT32_MAX)
+    {
+        return ZYAN_STATUS_OUT_OF_RESOURCES;
+    }
+    const ZyanU32 new_id = (ZyanU32)interner->strings.size;
+
+    ZYAN_CHECK(ZyanStringInternerStore(interner, key.entry.data, key.entry.length,
+        &key.entry.data));
+    ZYAN_CHECK(ZyanVectorPushBack(&interner->strings, &key.entry));
+    const ZyanStatus insert_status = ZyanHashMapInsert(&interner->lookup, &key, &new_id);
+    if (!ZYAN_SUCCESS(insert_status))
+    {
+        // The copied string data stays in the storage blocks until the interner is cleared
+        ZyanVectorPopBack(&interner->strings);
+        return insert_status;
+    }
+
+    *id = new_id;
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanStringInternerClear(ZyanStringInterner* interner)
+{
+    if (!interner)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanHashMapClear(&interner->lookup));
+    ZYAN_CHECK(ZyanVectorClear(&interner->strings));
+
+    return ZyanStringInternerFreeBlocks(interner);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanStringInternerFind(const ZyanStringInterner* interner,
+    const ZyanStringView* string, ZyanU32* id)
+{
+    if (!interner || !string)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanStringInternerKey key;
+    ZyanStringInternerMakeKey(&key, string);
+
+    const void* value;
+    const ZyanStatus status = ZyanHashMapGet(&interner->lookup, &key, &value);
+    if ((status == ZYAN_STATUS_TRUE) && id)
+    {
+        *id = *(const ZyanU32*)value;
+    }
+
+    return status;
+}
+
+ZyanStatus ZyanStringInternerGetView(const ZyanStringInterner* interner, ZyanU32 id,
+    ZyanStringView* view)
+{
+    if (!interner || !view)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (id >= interner->strings.size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    const ZyanStringInternerEntry* const entry =
+        (const ZyanStringInternerEntry*)interner->strings.data + id;
+    view->string.vector.data = (void*)entry->data;
+    view->string.vector.size = entry->length + 1;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanStringInternerGetString(const ZyanStringInterner* interner, ZyanU32 id,
+    const char** string, ZyanUSize* length)
+{
+    if (!interner || !string)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (id >= interner->strings.size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    const ZyanStringInternerEntry* const entry =
+        (const ZyanStringInternerEntry*)interner->strings.data + id;
+    *string = entry->data;
+    if (length)
+    {
+        *length = entry->length;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanStringInternerGetSize(const ZyanStringInterner* interner, ZyanUSize* size)
+{
+    if (!interner || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = interner->strings.size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
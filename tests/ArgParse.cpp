@@ -254,6 +254,75 @@ TEST(MixedArgs, MissingRequiredArg)
     ASSERT_STREQ(err_tok, "-n");
 }
 
+TEST(MixedArgs, MissingRequiredArgOrder)
+{
+    const char* argv[]
+    {
+        "./test", "-x"
+    };
+
+    ZyanArgParseDefinition args[]
+    {
+        {"--zeta", ZYAN_FALSE, ZYAN_TRUE},
+        {"-x", ZYAN_TRUE, ZYAN_FALSE},
+        {"--alpha", ZYAN_FALSE, ZYAN_TRUE},
+        {"-b", ZYAN_FALSE, ZYAN_TRUE},
+        {nullptr, ZYAN_FALSE, ZYAN_FALSE}
+    };
+
+    ZyanArgParseConfig cfg
+    {
+        argv, // argv
+        2,    // argc
+        0,    // min_unnamed_args
+        100,  // max_unnamed_args
+        args  // args
+    };
+
+    // The first missing required argument in definition order is reported
+    ZyanVector parsed;
+    ZYAN_MEMSET(&parsed, 0, sizeof(parsed));
+    const char* err_tok = nullptr;
+    auto status = ZyanArgParse(&cfg, &parsed, &err_tok);
+    ASSERT_EQ(status, ZYAN_STATUS_REQUIRED_ARG_MISSING);
+    ASSERT_STREQ(err_tok, "--zeta");
+
+    args[0].required = ZYAN_FALSE;
+    status = ZyanArgParse(&cfg, &parsed, &err_tok);
+    ASSERT_EQ(status, ZYAN_STATUS_REQUIRED_ARG_MISSING);
+    ASSERT_STREQ(err_tok, "--alpha");
+}
+
+TEST(MixedArgs, DuplicateDefinition)
+{
+    const char* argv[]
+    {
+        "./test", "-n", "5"
+    };
+
+    ZyanArgParseDefinition args[]
+    {
+        {"-n", ZYAN_FALSE, ZYAN_FALSE},
+        {"--feature-xyz", ZYAN_TRUE, ZYAN_FALSE},
+        {"-n", ZYAN_TRUE, ZYAN_FALSE},
+        {nullptr, ZYAN_FALSE, ZYAN_FALSE}
+    };
+
+    ZyanArgParseConfig cfg
+    {
+        argv, // argv
+        3,    // argc
+        0,    // min_unnamed_args
+        100,  // max_unnamed_args
+        args  // args
+    };
+
+    ZyanVector parsed;
+    ZYAN_MEMSET(&parsed, 0, sizeof(parsed));
+    auto status = ZyanArgParse(&cfg, &parsed, nullptr);
+    ASSERT_EQ(status, ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
 TEST(MixedArgs, Stuff)
 {
     const char* argv[]
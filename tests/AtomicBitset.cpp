@@ -0,0 +1,260 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanAtomicBitset` implementation.
+ */
+
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/AtomicBitset.h>
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns the number of set bits.
+ */
+static ZyanUSize Count(const ZyanAtomicBitset* bitset)
+{
+    ZyanUSize count;
+    EXPECT_EQ(ZyanAtomicBitsetCount(bitset, &count), ZYAN_STATUS_SUCCESS);
+    return count;
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(AtomicBitsetTest, SingleThreaded)
+{
+    ZyanAtomicBitset bitset;
+    ASSERT_EQ(ZyanAtomicBitsetInit(&bitset, 130), ZYAN_STATUS_SUCCESS);
+
+    ZyanUSize size;
+    ASSERT_EQ(ZyanAtomicBitsetGetSize(&bitset, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 130u);
+    EXPECT_EQ(Count(&bitset), 0u);
+
+    for (const ZyanUSize index : { 0, 63, 64, 129 })
+    {
+        EXPECT_EQ(ZyanAtomicBitsetTest(&bitset, index), ZYAN_STATUS_FALSE);
+        EXPECT_EQ(ZyanAtomicBitsetTestAndSet(&bitset, index), ZYAN_STATUS_FALSE);
+        EXPECT_EQ(ZyanAtomicBitsetTestAndSet(&bitset, index), ZYAN_STATUS_TRUE);
+        EXPECT_EQ(ZyanAtomicBitsetTest(&bitset, index), ZYAN_STATUS_TRUE);
+    }
+    EXPECT_EQ(Count(&bitset), 4u);
+    EXPECT_EQ(ZyanAtomicBitsetTest(&bitset, 1), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(ZyanAtomicBitsetTest(&bitset, 128), ZYAN_STATUS_FALSE);
+
+    EXPECT_EQ(ZyanAtomicBitsetTestAndReset(&bitset, 64), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(ZyanAtomicBitsetTestAndReset(&bitset, 64), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(ZyanAtomicBitsetTest(&bitset, 64), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(Count(&bitset), 3u);
+
+    EXPECT_EQ(ZyanAtomicBitsetTestAndSet(&bitset, 130), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanAtomicBitsetTestAndReset(&bitset, 130), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanAtomicBitsetTest(&bitset, 130), ZYAN_STATUS_OUT_OF_RANGE);
+
+    ASSERT_EQ(ZyanAtomicBitsetResetAll(&bitset), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(Count(&bitset), 0u);
+
+    EXPECT_EQ(ZyanAtomicBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanAtomicBitsetInit(&bitset, 0), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST(AtomicBitsetTest, WordOperations)
+{
+    ZyanAtomicBitset bitset;
+    ASSERT_EQ(ZyanAtomicBitsetInit(&bitset, 100), ZYAN_STATUS_SUCCESS);
+
+    ZyanU64 previous;
+    ASSERT_EQ(ZyanAtomicBitsetFetchOrWord(&bitset, 0, 0xF0F0F0F0F0F0F0F0, &previous),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(previous, 0u);
+    ASSERT_EQ(ZyanAtomicBitsetFetchOrWord(&bitset, 0, 0x0F, &previous), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(previous, 0xF0F0F0F0F0F0F0F0);
+    EXPECT_EQ(Count(&bitset), 36u);
+
+    // The last word only holds 36 valid bits, the bits past the end must stay cleared
+    ASSERT_EQ(ZyanAtomicBitsetFetchOrWord(&bitset, 1, ~0ULL, &previous), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(previous, 0u);
+    ASSERT_EQ(ZyanAtomicBitsetFetchOrWord(&bitset, 1, 0, &previous), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(previous, (1ULL << 36) - 1);
+    EXPECT_EQ(Count(&bitset), 72u);
+    EXPECT_EQ(ZyanAtomicBitsetTest(&bitset, 99), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(ZyanAtomicBitsetFetchOrWord(&bitset, 1, 1ULL << 63, nullptr),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(Count(&bitset), 72u);
+
+    ASSERT_EQ(ZyanAtomicBitsetFetchAndWord(&bitset, 1, 0xFF, &previous), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(previous, (1ULL << 36) - 1);
+    ASSERT_EQ(ZyanAtomicBitsetFetchAndWord(&bitset, 0, ~0xF0ULL, nullptr), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanAtomicBitsetTest(&bitset, 4), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(ZyanAtomicBitsetTest(&bitset, 3), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(Count(&bitset), 32u + 8u);
+
+    EXPECT_EQ(ZyanAtomicBitsetFetchOrWord(&bitset, 2, 1, &previous), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanAtomicBitsetFetchAndWord(&bitset, 2, 1, &previous), ZYAN_STATUS_OUT_OF_RANGE);
+
+    // Snapshots only contain the valid bits
+    ZyanBitset snapshot;
+    ASSERT_EQ(ZyanBitsetInit(&snapshot, 0), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanAtomicBitsetSnapshot(&bitset, &snapshot), ZYAN_STATUS_SUCCESS);
+    ZyanUSize size;
+    ASSERT_EQ(ZyanBitsetGetSize(&snapshot, &size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(size, 100u);
+    for (ZyanUSize i = 0; i < size; ++i)
+    {
+        EXPECT_EQ(ZyanBitsetTest(&snapshot, i), ZyanAtomicBitsetTest(&bitset, i)) << i;
+    }
+    EXPECT_EQ(ZyanBitsetDestroy(&snapshot), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanAtomicBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+
+    // A size that is a multiple of the word size leaves the last word unmasked
+    ASSERT_EQ(ZyanAtomicBitsetInit(&bitset, 128), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanAtomicBitsetFetchOrWord(&bitset, 1, ~0ULL, nullptr), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(Count(&bitset), 64u);
+    EXPECT_EQ(ZyanAtomicBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(AtomicBitsetTest, ConcurrentTestAndSet)
+{
+    constexpr ZyanUSize thread_count = 8;
+    constexpr ZyanUSize bit_count = 64 * 64 + 37;
+
+    ZyanAtomicBitset bitset;
+    ASSERT_EQ(ZyanAtomicBitsetInit(&bitset, bit_count), ZYAN_STATUS_SUCCESS);
+
+    // Every thread claims every bit, starting at a different position. Each bit must be won by
+    // exactly one thread, both when setting and when resetting
+    for (const bool set : { true, false })
+    {
+        std::vector<std::vector<ZyanUSize>> won(thread_count);
+        std::vector<std::thread> threads;
+        for (ZyanUSize t = 0; t < thread_count; ++t)
+        {
+            threads.emplace_back([&, t]()
+            {
+                for (ZyanUSize i = 0; i < bit_count; ++i)
+                {
+                    const ZyanUSize index = (i + t * bit_count / thread_count) % bit_count;
+                    const ZyanStatus status = set ?
+                        ZyanAtomicBitsetTestAndSet(&bitset, index) :
+                        ZyanAtomicBitsetTestAndReset(&bitset, index);
+                    if (status == (set ? ZYAN_STATUS_FALSE : ZYAN_STATUS_TRUE))
+                    {
+                        won[t].push_back(index);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        std::vector<ZyanU32> winners(bit_count, 0);
+        for (const auto& indices : won)
+        {
+            for (const ZyanUSize index : indices)
+            {
+                ++winners[index];
+            }
+        }
+        for (ZyanUSize i = 0; i < bit_count; ++i)
+        {
+            ASSERT_EQ(winners[i], 1u) << "bit " << i;
+        }
+        EXPECT_EQ(Count(&bitset), set ? bit_count : 0);
+    }
+
+    EXPECT_EQ(ZyanAtomicBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(AtomicBitsetTest, ConcurrentFetchOrWord)
+{
+    constexpr ZyanUSize thread_count = 8;
+    constexpr ZyanUSize bit_count = 64 * 16 + 5;
+
+    ZyanAtomicBitset bitset;
+    ASSERT_EQ(ZyanAtomicBitsetInit(&bitset, bit_count), ZYAN_STATUS_SUCCESS);
+
+    // Every thread sets its own bits of every word. The previous values must never contain
+    // bits past the end of the bitset
+    std::vector<std::thread> threads;
+    std::vector<char> masked(thread_count, 1);
+    for (ZyanUSize t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            const ZyanU64 mask = 0x0101010101010101ULL << t;
+            for (ZyanUSize i = 0; i < 1000; ++i)
+            {
+                for (ZyanUSize word = 0; word < 17; ++word)
+                {
+                    ZyanU64 previous;
+                    ZyanAtomicBitsetFetchOrWord(&bitset, word, mask, &previous);
+                    if ((word == 16) && (previous >> 5))
+                    {
+                        masked[t] = 0;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (ZyanUSize t = 0; t < thread_count; ++t)
+    {
+        EXPECT_TRUE(masked[t]);
+    }
+    EXPECT_EQ(Count(&bitset), bit_count);
+
+    EXPECT_EQ(ZyanAtomicBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,274 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanBTree` implementation.
+ */
+
+#include <map>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/BTree.h>
+#include <Zycore/Comparison.h>
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+static ZyanI32 CompareU32(const ZyanU32* left, const ZyanU32* right)
+{
+    return ZyanCompareNumeric32(left, right);
+}
+
+static ZyanComparison GetCompareU32()
+{
+    return reinterpret_cast<ZyanComparison>(&CompareU32);
+}
+
+/**
+ * @brief   Checks that the given tree exactly matches the given reference map, iterating the tree
+ *          in both directions.
+ */
+static void ExpectEqual(const ZyanBTree* tree, const std::map<ZyanU32, ZyanU64>& reference)
+{
+    ZyanUSize size;
+    ASSERT_EQ(ZyanBTreeGetSize(tree, &size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(size, reference.size());
+
+    ZyanBTreeCursor cursor;
+    ZyanStatus status = ZyanBTreeBegin(tree, &cursor);
+    for (const auto& item : reference)
+    {
+        ASSERT_EQ(status, ZYAN_STATUS_TRUE);
+        const void* key;
+        const void* value;
+        ASSERT_EQ(ZyanBTreeCursorGet(&cursor, &key, &value), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(*static_cast<const ZyanU32*>(key), item.first);
+        EXPECT_EQ(*static_cast<const ZyanU64*>(value), item.second);
+        status = ZyanBTreeCursorNext(&cursor);
+    }
+    EXPECT_EQ(status, ZYAN_STATUS_FALSE);
+
+    status = ZyanBTreeLast(tree, &cursor);
+    for (auto it = reference.rbegin(); it != reference.rend(); ++it)
+    {
+        ASSERT_EQ(status, ZYAN_STATUS_TRUE);
+        const void* key;
+        ASSERT_EQ(ZyanBTreeCursorGet(&cursor, &key, nullptr), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(*static_cast<const ZyanU32*>(key), it->first);
+        status = ZyanBTreeCursorPrev(&cursor);
+    }
+    EXPECT_EQ(status, ZYAN_STATUS_FALSE);
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(BTreeTest, InsertAndRemove)
+{
+    // Use small nodes to force deep trees
+    for (ZyanUSize node_size : { 0, 64, 128 })
+    {
+        ZyanBTree tree;
+        ASSERT_EQ(ZyanBTreeInitEx(&tree, sizeof(ZyanU32), sizeof(ZyanU64), GetCompareU32(),
+            node_size, ZyanAllocatorDefault()), ZYAN_STATUS_SUCCESS);
+
+        std::map<ZyanU32, ZyanU64> reference;
+        std::mt19937 rng(1337);
+        for (ZyanU64 i = 0; i < 20000; ++i)
+        {
+            const ZyanU32 key = rng() % 5000;
+            if (rng() % 3)
+            {
+                const ZyanStatus expected =
+                    reference.count(key) ? ZYAN_STATUS_FALSE : ZYAN_STATUS_TRUE;
+                ASSERT_EQ(ZyanBTreeInsert(&tree, &key, &i), expected);
+                reference[key] = i;
+            } else
+            {
+                const ZyanStatus expected =
+                    reference.erase(key) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+                ASSERT_EQ(ZyanBTreeRemove(&tree, &key), expected);
+            }
+        }
+        ExpectEqual(&tree, reference);
+
+        for (ZyanU32 key = 0; key < 5000; ++key)
+        {
+            const void* value;
+            const auto it = reference.find(key);
+            if (it == reference.end())
+            {
+                EXPECT_EQ(ZyanBTreeGet(&tree, &key, &value), ZYAN_STATUS_FALSE);
+                EXPECT_EQ(value, nullptr);
+                continue;
+            }
+            ASSERT_EQ(ZyanBTreeGet(&tree, &key, &value), ZYAN_STATUS_TRUE);
+            EXPECT_EQ(*static_cast<const ZyanU64*>(value), it->second);
+        }
+
+        // Remove everything in random order
+        std::vector<ZyanU32> keys;
+        for (const auto& item : reference)
+        {
+            keys.push_back(item.first);
+        }
+        std::shuffle(keys.begin(), keys.end(), rng);
+        for (ZyanUSize i = 0; i < keys.size(); ++i)
+        {
+            ASSERT_EQ(ZyanBTreeRemove(&tree, &keys[i]), ZYAN_STATUS_TRUE);
+            reference.erase(keys[i]);
+            if (i % 500 == 0)
+            {
+                ExpectEqual(&tree, reference);
+            }
+        }
+        ExpectEqual(&tree, reference);
+
+        EXPECT_EQ(ZyanBTreeDestroy(&tree), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(BTreeTest, Bounds)
+{
+    ZyanBTree set;
+    ASSERT_EQ(ZyanBTreeInitEx(&set, sizeof(ZyanU32), 0, GetCompareU32(), 64,
+        ZyanAllocatorDefault()), ZYAN_STATUS_SUCCESS);
+
+    for (ZyanU32 key = 0; key < 1000; key += 10)
+    {
+        ASSERT_EQ(ZyanBTreeInsert(&set, &key, nullptr), ZYAN_STATUS_TRUE);
+    }
+
+    ZyanBTreeCursor cursor;
+    const void* found;
+    ZyanU32 key = 20;
+    ASSERT_EQ(ZyanBTreeLowerBound(&set, &key, &cursor), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(ZyanBTreeCursorGet(&cursor, &found, nullptr), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(*static_cast<const ZyanU32*>(found), 20);
+    ASSERT_EQ(ZyanBTreeUpperBound(&set, &key, &cursor), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(ZyanBTreeCursorGet(&cursor, &found, nullptr), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(*static_cast<const ZyanU32*>(found), 30);
+
+    // Walk the range [255, 505)
+    key = 255;
+    ZyanU32 expected = 260;
+    ZyanStatus status = ZyanBTreeLowerBound(&set, &key, &cursor);
+    while (status == ZYAN_STATUS_TRUE)
+    {
+        ASSERT_EQ(ZyanBTreeCursorGet(&cursor, &found, nullptr), ZYAN_STATUS_SUCCESS);
+        if (*static_cast<const ZyanU32*>(found) >= 505)
+        {
+            break;
+        }
+        EXPECT_EQ(*static_cast<const ZyanU32*>(found), expected);
+        expected += 10;
+        status = ZyanBTreeCursorNext(&cursor);
+    }
+    EXPECT_EQ(expected, 510);
+
+    key = 990;
+    EXPECT_EQ(ZyanBTreeUpperBound(&set, &key, &cursor), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(ZyanBTreeCursorGet(&cursor, &found, nullptr), ZYAN_STATUS_OUT_OF_RANGE);
+    key = 995;
+    EXPECT_EQ(ZyanBTreeLowerBound(&set, &key, &cursor), ZYAN_STATUS_FALSE);
+
+    EXPECT_EQ(ZyanBTreeDestroy(&set), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(BTreeTest, BulkLoad)
+{
+    for (ZyanUSize count : { 0, 1, 5, 100, 12345 })
+    {
+        ZyanVector keys;
+        ZyanVector values;
+        ASSERT_EQ(ZyanVectorInit(&keys, sizeof(ZyanU32), count, nullptr), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanVectorInit(&values, sizeof(ZyanU64), count, nullptr),
+            ZYAN_STATUS_SUCCESS);
+
+        std::map<ZyanU32, ZyanU64> reference;
+        for (ZyanU32 i = 0; i < count; ++i)
+        {
+            const ZyanU32 key = i * 3;
+            const ZyanU64 value = i;
+            ASSERT_EQ(ZyanVectorPushBack(&keys, &key), ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(ZyanVectorPushBack(&values, &value), ZYAN_STATUS_SUCCESS);
+            reference[key] = value;
+        }
+
+        ZyanBTree tree;
+        ASSERT_EQ(ZyanBTreeInitEx(&tree, sizeof(ZyanU32), sizeof(ZyanU64), GetCompareU32(),
+            64, ZyanAllocatorDefault()), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanBTreeBulkLoad(&tree, &keys, &values), ZYAN_STATUS_SUCCESS);
+        ExpectEqual(&tree, reference);
+
+        // The tree must remain fully functional after bulk loading
+        for (ZyanU32 key = 1; key < 3 * count; key += 7)
+        {
+            const ZyanU64 value = key;
+            ASSERT_EQ(ZyanBTreeInsert(&tree, &key, &value),
+                reference.count(key) ? ZYAN_STATUS_FALSE : ZYAN_STATUS_TRUE);
+            reference[key] = value;
+        }
+        for (ZyanU32 key = 0; key < 3 * count; key += 2)
+        {
+            ASSERT_EQ(ZyanBTreeRemove(&tree, &key),
+                reference.erase(key) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+        }
+        ExpectEqual(&tree, reference);
+
+        // Keys must be strictly ascending
+        if (count > 1)
+        {
+            ZyanBTree other;
+            ASSERT_EQ(ZyanBTreeInit(&other, sizeof(ZyanU32), sizeof(ZyanU64), GetCompareU32()),
+                ZYAN_STATUS_SUCCESS);
+            const ZyanU32 duplicate = 3;
+            ASSERT_EQ(ZyanVectorSet(&keys, 0, &duplicate), ZYAN_STATUS_SUCCESS);
+            EXPECT_EQ(ZyanBTreeBulkLoad(&other, &keys, &values), ZYAN_STATUS_INVALID_ARGUMENT);
+            EXPECT_EQ(ZyanBTreeDestroy(&other), ZYAN_STATUS_SUCCESS);
+        }
+
+        EXPECT_EQ(ZyanBTreeDestroy(&tree), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanVectorDestroy(&values), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanVectorDestroy(&keys), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,811 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanBitset` implementation.
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/Bitset.h>
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Initializes the given bitset with the bits of the given reference vector.
+ */
+static void InitFrom(ZyanBitset* bitset, const std::vector<bool>& reference)
+{
+    ASSERT_EQ(ZyanBitsetInit(bitset, reference.size()), ZYAN_STATUS_SUCCESS);
+    for (std::size_t i = 0; i < reference.size(); ++i)
+    {
+        ASSERT_EQ(ZyanBitsetAssign(bitset, i, reference[i]), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+/**
+ * @brief   Checks that the given bitset exactly matches the given reference vector.
+ */
+static void ExpectEqual(ZyanBitset* bitset, const std::vector<bool>& reference)
+{
+    ZyanUSize size;
+    ASSERT_EQ(ZyanBitsetGetSize(bitset, &size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(size, reference.size());
+    ZyanUSize count = 0;
+    for (std::size_t i = 0; i < reference.size(); ++i)
+    {
+        ASSERT_EQ(ZyanBitsetTest(bitset, i), reference[i] ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE)
+            << "bit " << i;
+        count += reference[i];
+    }
+    ZyanUSize actual;
+    ASSERT_EQ(ZyanBitsetCount(bitset, &actual), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(actual, count);
+}
+
+static std::vector<bool> RandomBits(std::mt19937& random, std::size_t size)
+{
+    std::vector<bool> bits(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        bits[i] = random() & 1;
+    }
+    return bits;
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(BitsetTest, LogicalOperations)
+{
+    std::mt19937 random(41);
+    for (std::size_t size : { 1, 7, 8, 63, 64, 65, 200, 1003 })
+    {
+        const auto a = RandomBits(random, size);
+        const auto b = RandomBits(random, size);
+        const auto c = RandomBits(random, size);
+
+        ZyanBitset x, y, z;
+        InitFrom(&x, a);
+        InitFrom(&y, b);
+        InitFrom(&z, c);
+
+        std::vector<bool> expected(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            expected[i] = a[i] | (b[i] & !c[i]);
+        }
+        ZyanBitset result;
+        ASSERT_EQ(ZyanBitsetInit(&result, size), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanBitsetAssignORANDNOT(&result, &x, &y, &z), ZYAN_STATUS_SUCCESS);
+        ExpectEqual(&result, expected);
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            expected[i] = a[i] & !b[i];
+        }
+        ASSERT_EQ(ZyanBitsetAssignANDNOT(&result, &x, &y), ZYAN_STATUS_SUCCESS);
+        ExpectEqual(&result, expected);
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            expected[i] = a[i] ^ b[i];
+        }
+        ASSERT_EQ(ZyanBitsetAssignXOR(&result, &x, &y), ZYAN_STATUS_SUCCESS);
+        ExpectEqual(&result, expected);
+
+        // In-place operations, with the destination aliasing an input
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            expected[i] = (a[i] | b[i]) & c[i];
+        }
+        ASSERT_EQ(ZyanBitsetOR(&x, &y), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanBitsetAssignAND(&x, &x, &z), ZYAN_STATUS_SUCCESS);
+        ExpectEqual(&x, expected);
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            expected[i] = expected[i] && !b[i];
+        }
+        ASSERT_EQ(ZyanBitsetANDNOT(&x, &y), ZYAN_STATUS_SUCCESS);
+        ExpectEqual(&x, expected);
+
+        ZyanBitset other;
+        ASSERT_EQ(ZyanBitsetInit(&other, size + 1), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanBitsetAssignAND(&other, &x, &y), ZYAN_STATUS_INVALID_OPERATION);
+
+        EXPECT_EQ(ZyanBitsetDestroy(&other), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanBitsetDestroy(&result), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanBitsetDestroy(&z), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanBitsetDestroy(&y), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanBitsetDestroy(&x), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(BitsetTest, WholeBitsetQueries)
+{
+    for (std::size_t size : { 1, 5, 8, 13, 64, 100 })
+    {
+        ZyanBitset bitset;
+        ASSERT_EQ(ZyanBitsetInit(&bitset, size), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanBitsetNone(&bitset), ZYAN_STATUS_TRUE);
+        EXPECT_EQ(ZyanBitsetAny(&bitset), ZYAN_STATUS_FALSE);
+        EXPECT_EQ(ZyanBitsetAll(&bitset), ZYAN_STATUS_FALSE);
+
+        // Flipping must not set any bits past the end of the bitset
+        ASSERT_EQ(ZyanBitsetFlip(&bitset), ZYAN_STATUS_SUCCESS);
+        ExpectEqual(&bitset, std::vector<bool>(size, true));
+        EXPECT_EQ(ZyanBitsetAll(&bitset), ZYAN_STATUS_TRUE);
+
+        ASSERT_EQ(ZyanBitsetReset(&bitset, size - 1), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanBitsetAll(&bitset), ZYAN_STATUS_FALSE);
+        EXPECT_EQ(ZyanBitsetAny(&bitset), (size > 1) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+
+        ASSERT_EQ(ZyanBitsetResetAll(&bitset), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanBitsetSet(&bitset, size / 2), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanBitsetAny(&bitset), ZYAN_STATUS_TRUE);
+        EXPECT_EQ(ZyanBitsetNone(&bitset), ZYAN_STATUS_FALSE);
+
+        ASSERT_EQ(ZyanBitsetSetAll(&bitset), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanBitsetPop(&bitset), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanBitsetPush(&bitset, ZYAN_FALSE), ZYAN_STATUS_SUCCESS);
+        std::vector<bool> expected(size, true);
+        expected[size - 1] = false;
+        ExpectEqual(&bitset, expected);
+
+        EXPECT_EQ(ZyanBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(BitsetTest, FusedCount)
+{
+    std::mt19937 random(42);
+    // The larger sizes span several 512-byte blocks of the vectorized kernel plus a tail
+    for (std::size_t size : { 1, 63, 64, 1000, 4096, 4097, 12345, 40000 })
+    {
+        const auto a = RandomBits(random, size);
+        const auto b = RandomBits(random, size);
+
+        ZyanBitset x, y;
+        InitFrom(&x, a);
+        InitFrom(&y, b);
+
+        ZyanUSize expected_and = 0, expected_or = 0, expected_xor = 0, expected_andnot = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            expected_and    += a[i] & b[i];
+            expected_or     += a[i] | b[i];
+            expected_xor    += a[i] ^ b[i];
+            expected_andnot += a[i] & !b[i];
+        }
+
+        ZyanUSize count;
+        ASSERT_EQ(ZyanBitsetCountAND(&x, &y, &count), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(count, expected_and);
+        ASSERT_EQ(ZyanBitsetCountOR(&x, &y, &count), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(count, expected_or);
+        ASSERT_EQ(ZyanBitsetCountXOR(&x, &y, &count), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(count, expected_xor);
+        ASSERT_EQ(ZyanBitsetCountANDNOT(&x, &y, &count), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(count, expected_andnot);
+
+        // A completely set bitset saturates every carry-save adder level
+        ASSERT_EQ(ZyanBitsetSetAll(&x), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanBitsetCount(&x, &count), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(count, size);
+
+        ASSERT_EQ(ZyanBitsetPush(&y, ZYAN_TRUE), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanBitsetCountAND(&x, &y, &count), ZYAN_STATUS_INVALID_OPERATION);
+
+        EXPECT_EQ(ZyanBitsetDestroy(&x), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanBitsetDestroy(&y), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(BitsetTest, Iteration)
+{
+    std::mt19937 random(43);
+    for (std::size_t size : { 1, 8, 63, 64, 65, 130, 1000, 5000 })
+    {
+        // Mix dense and sparse regions
+        std::vector<bool> reference(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            reference[i] = (i < size / 2) ? (random() & 1) : ((random() % 97) == 0);
+        }
+        reference[size - 1] = (size % 2);
+
+        ZyanBitset bitset;
+        InitFrom(&bitset, reference);
+
+        std::vector<ZyanU32> expected_set, expected_clear;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            (reference[i] ? expected_set : expected_clear).push_back(static_cast<ZyanU32>(i));
+        }
+
+        std::vector<ZyanU32> actual;
+        ZyanUSize index;
+        ZyanStatus status = ZyanBitsetFindFirstSet(&bitset, &index);
+        while (status == ZYAN_STATUS_TRUE)
+        {
+            actual.push_back(static_cast<ZyanU32>(index));
+            status = ZyanBitsetFindNextSet(&bitset, index + 1, &index);
+        }
+        ASSERT_EQ(status, ZYAN_STATUS_FALSE);
+        EXPECT_EQ(actual, expected_set);
+
+        actual.clear();
+        status = ZyanBitsetFindNextClear(&bitset, 0, &index);
+        while (status == ZYAN_STATUS_TRUE)
+        {
+            actual.push_back(static_cast<ZyanU32>(index));
+            status = ZyanBitsetFindNextClear(&bitset, index + 1, &index);
+        }
+        ASSERT_EQ(status, ZYAN_STATUS_FALSE);
+        EXPECT_EQ(actual, expected_clear);
+
+        status = ZyanBitsetFindLastSet(&bitset, &index);
+        if (expected_set.empty())
+        {
+            EXPECT_EQ(status, ZYAN_STATUS_FALSE);
+        } else
+        {
+            ASSERT_EQ(status, ZYAN_STATUS_TRUE);
+            EXPECT_EQ(index, expected_set.back());
+        }
+        EXPECT_EQ(ZyanBitsetFindNextSet(&bitset, size + 1, &index), ZYAN_STATUS_OUT_OF_RANGE);
+
+        actual.clear();
+        EXPECT_EQ(ZyanBitsetForEachSet(&bitset, [](ZyanUSize i, void* user_data)
+        {
+            static_cast<std::vector<ZyanU32>*>(user_data)->push_back(static_cast<ZyanU32>(i));
+            return ZYAN_STATUS_TRUE;
+        }, &actual), ZYAN_STATUS_TRUE);
+        EXPECT_EQ(actual, expected_set);
+
+        if (expected_set.size() > 1)
+        {
+            ZyanUSize visited = 0;
+            EXPECT_EQ(ZyanBitsetForEachSet(&bitset, [](ZyanUSize, void* user_data)
+            {
+                return (++*static_cast<ZyanUSize*>(user_data) == 2) ?
+                    ZYAN_STATUS_FALSE : ZYAN_STATUS_TRUE;
+            }, &visited), ZYAN_STATUS_FALSE);
+            EXPECT_EQ(visited, 2);
+        }
+
+        // Indices are appended to the existing elements
+        ZyanVector indices;
+        ASSERT_EQ(ZyanVectorInit(&indices, sizeof(ZyanU32), 0, nullptr), ZYAN_STATUS_SUCCESS);
+        const ZyanU32 marker = 0xDEADBEEF;
+        ASSERT_EQ(ZyanVectorPushBack(&indices, &marker), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanBitsetExportIndices(&bitset, &indices), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(indices.size, expected_set.size() + 1);
+        const auto* data = static_cast<const ZyanU32*>(indices.data);
+        EXPECT_EQ(data[0], marker);
+        EXPECT_EQ(std::vector<ZyanU32>(data + 1, data + indices.size), expected_set);
+        EXPECT_EQ(ZyanVectorDestroy(&indices), ZYAN_STATUS_SUCCESS);
+
+        EXPECT_EQ(ZyanBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(BitsetTest, ExportIndicesExactCapacity)
+{
+    // A single set bit in the most significant position of a byte, followed by zero bytes. The
+    // output vector does not overallocate, so any write past the last index is detected by
+    // address sanitizers
+    for (std::size_t size : { 8, 64, 200 })
+    {
+        for (std::size_t index : { 0, 8, 56 })
+        {
+            if (index >= size)
+            {
+                continue;
+            }
+
+            ZyanBitset bitset;
+            ASSERT_EQ(ZyanBitsetInit(&bitset, size), ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(ZyanBitsetSet(&bitset, index), ZYAN_STATUS_SUCCESS);
+
+            ZyanVector indices;
+            ASSERT_EQ(ZyanVectorInitEx(&indices, sizeof(ZyanU32), 0, nullptr,
+                ZyanAllocatorDefault(), 1, 0), ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(ZyanBitsetExportIndices(&bitset, &indices), ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(indices.size, 1u);
+            EXPECT_EQ(static_cast<const ZyanU32*>(indices.data)[0], index);
+
+            EXPECT_EQ(ZyanVectorDestroy(&indices), ZYAN_STATUS_SUCCESS);
+            EXPECT_EQ(ZyanBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+        }
+    }
+}
+
+TEST(BitsetTest, ExportIndicesExactBuffer)
+{
+    // The indices are exported into a fixed buffer that holds exactly the number of set bits
+    std::mt19937 random(49);
+    for (std::size_t size : { 1, 8, 63, 64, 65, 200, 1031 })
+    {
+        for (const bool dense : { false, true })
+        {
+            auto reference = RandomBits(random, size);
+            if (!dense)
+            {
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    reference[i] = reference[i] && !(random() % 8);
+                }
+            }
+            reference[size - 1] = true;
+
+            ZyanBitset bitset;
+            InitFrom(&bitset, reference);
+            std::vector<ZyanU32> expected;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (reference[i])
+                {
+                    expected.push_back(static_cast<ZyanU32>(i));
+                }
+            }
+
+            std::vector<ZyanU32> buffer(expected.size());
+            ZyanVector indices;
+            ASSERT_EQ(ZyanVectorInitCustomBuffer(&indices, sizeof(ZyanU32), buffer.data(),
+                buffer.size(), nullptr), ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(ZyanBitsetExportIndices(&bitset, &indices), ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(indices.size, expected.size());
+            EXPECT_EQ(buffer, expected) << size;
+
+            EXPECT_EQ(ZyanVectorDestroy(&indices), ZYAN_STATUS_SUCCESS);
+            EXPECT_EQ(ZyanBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+        }
+    }
+}
+
+TEST(BitsetTest, RangeOperations)
+{
+    std::mt19937 random(44);
+    for (std::size_t size : { 1, 9, 64, 100, 777 })
+    {
+        auto reference = RandomBits(random, size);
+        ZyanBitset bitset;
+        InitFrom(&bitset, reference);
+
+        for (int round = 0; round < 50; ++round)
+        {
+            std::size_t begin = random() % (size + 1);
+            std::size_t end = random() % (size + 1);
+            if (begin > end)
+            {
+                std::swap(begin, end);
+            }
+
+            bool any = false, all = true;
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                any |= reference[i];
+                all &= reference[i];
+            }
+            EXPECT_EQ(ZyanBitsetAnyRange(&bitset, begin, end),
+                any ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+            EXPECT_EQ(ZyanBitsetAllRange(&bitset, begin, end),
+                all ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+
+            switch (round % 3)
+            {
+            case 0:
+                ASSERT_EQ(ZyanBitsetSetRange(&bitset, begin, end), ZYAN_STATUS_SUCCESS);
+                std::fill(reference.begin() + begin, reference.begin() + end, true);
+                break;
+            case 1:
+                ASSERT_EQ(ZyanBitsetResetRange(&bitset, begin, end), ZYAN_STATUS_SUCCESS);
+                std::fill(reference.begin() + begin, reference.begin() + end, false);
+                break;
+            default:
+                ASSERT_EQ(ZyanBitsetFlipRange(&bitset, begin, end), ZYAN_STATUS_SUCCESS);
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    reference[i] = !reference[i];
+                }
+                break;
+            }
+            ExpectEqual(&bitset, reference);
+        }
+
+        EXPECT_EQ(ZyanBitsetSetRange(&bitset, 0, size + 1), ZYAN_STATUS_OUT_OF_RANGE);
+        EXPECT_EQ(ZyanBitsetAnyRange(&bitset, 1, 0), ZYAN_STATUS_OUT_OF_RANGE);
+
+        EXPECT_EQ(ZyanBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(BitsetTest, Append)
+{
+    std::mt19937 random(45);
+    ZyanBitset bitset;
+    ASSERT_EQ(ZyanBitsetInit(&bitset, 0), ZYAN_STATUS_SUCCESS);
+    std::vector<bool> reference;
+
+    for (int round = 0; round < 200; ++round)
+    {
+        if (round % 2)
+        {
+            const ZyanU8 count = static_cast<ZyanU8>(random() % 65);
+            const ZyanU64 value = (static_cast<ZyanU64>(random()) << 32) | random();
+            ASSERT_EQ(ZyanBitsetAppendWord(&bitset, value, count), ZYAN_STATUS_SUCCESS);
+            for (ZyanU8 i = 0; i < count; ++i)
+            {
+                reference.push_back((value >> i) & 1);
+            }
+        } else
+        {
+            const std::size_t count = random() % 100;
+            const bool value = random() & 1;
+            ASSERT_EQ(ZyanBitsetAppend(&bitset, count, value), ZYAN_STATUS_SUCCESS);
+            reference.insert(reference.end(), count, value);
+        }
+    }
+    ExpectEqual(&bitset, reference);
+    EXPECT_EQ(ZyanBitsetAppendWord(&bitset, 0, 65), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    // Shrinking drops the trailing bits, growing again must yield cleared bits
+    const std::size_t size = reference.size();
+    ASSERT_EQ(ZyanBitsetResize(&bitset, size / 2 + 3), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanBitsetResize(&bitset, size), ZYAN_STATUS_SUCCESS);
+    std::fill(reference.begin() + size / 2 + 3, reference.end(), false);
+    ExpectEqual(&bitset, reference);
+
+    ASSERT_EQ(ZyanBitsetResize(&bitset, 1000000), ZYAN_STATUS_SUCCESS);
+    ZyanUSize count;
+    ASSERT_EQ(ZyanBitsetCount(&bitset, &count), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(count, static_cast<ZyanUSize>(std::count(reference.begin(), reference.end(), true)));
+
+    EXPECT_EQ(ZyanBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(BitsetTest, RankSelect)
+{
+    std::mt19937 random(47);
+    // Covers partial blocks, several superblocks and both very sparse and very dense bitsets
+    for (std::size_t size : { 0, 1, 64, 511, 512, 513, 70000, 200003 })
+    {
+        for (unsigned density : { 1, 50, 1000 })
+        {
+            std::vector<bool> reference(size);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                reference[i] = (random() % 1000) < density;
+            }
+
+            ZyanBitset bitset;
+            InitFrom(&bitset, reference);
+            ZyanBitsetRankSelect directory;
+            ASSERT_EQ(ZyanBitsetRankSelectInit(&directory, &bitset), ZYAN_STATUS_SUCCESS);
+
+            ZyanUSize rank = 0;
+            for (std::size_t i = 0; i <= size; ++i)
+            {
+                ZyanUSize actual;
+                ASSERT_EQ(ZyanBitsetRank(&directory, i, &actual), ZYAN_STATUS_SUCCESS);
+                ASSERT_EQ(actual, rank) << "index " << i;
+                if ((i < size) && reference[i])
+                {
+                    ZyanUSize index;
+                    ASSERT_EQ(ZyanBitsetSelect(&directory, rank, &index), ZYAN_STATUS_SUCCESS);
+                    ASSERT_EQ(index, i) << "rank " << rank;
+                    ++rank;
+                }
+            }
+            ZyanUSize index;
+            EXPECT_EQ(ZyanBitsetSelect(&directory, rank, &index), ZYAN_STATUS_OUT_OF_RANGE);
+            EXPECT_EQ(ZyanBitsetRank(&directory, size + 1, &index), ZYAN_STATUS_OUT_OF_RANGE);
+
+            EXPECT_EQ(ZyanBitsetRankSelectDestroy(&directory), ZYAN_STATUS_SUCCESS);
+            EXPECT_EQ(ZyanBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+        }
+    }
+}
+
+TEST(BitsetTest, Layout)
+{
+    std::mt19937 random(47);
+    for (std::size_t size : { 0, 1, 7, 8, 63, 64, 65, 1000, 4099 })
+    {
+        const auto reference = RandomBits(random, size);
+        ZyanBitset bitset;
+        InitFrom(&bitset, reference);
+        ASSERT_EQ(ZyanBitsetSetLayout(&bitset, ZYAN_BITSET_LAYOUT_LSB_FIRST), ZYAN_STATUS_SUCCESS);
+        ZyanBitsetLayout layout;
+        ASSERT_EQ(ZyanBitsetGetLayout(&bitset, &layout), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(layout, ZYAN_BITSET_LAYOUT_LSB_FIRST);
+        ExpectEqual(&bitset, reference);
+
+        // Bit `i` lives in bit `i % 8` of byte `i / 8`
+        const auto* data = static_cast<const ZyanU8*>(bitset.bits.data);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            ASSERT_EQ((data[i / 8] >> (i % 8)) & 1, reference[i]) << "bit " << i;
+        }
+
+        ZyanVector indices;
+        ASSERT_EQ(ZyanVectorInit(&indices, sizeof(ZyanU32), 0, nullptr), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanBitsetExportIndices(&bitset, &indices), ZYAN_STATUS_SUCCESS);
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (reference[i])
+            {
+                ASSERT_LT(n, indices.size);
+                ASSERT_EQ(static_cast<const ZyanU32*>(indices.data)[n++], i);
+            }
+        }
+        EXPECT_EQ(n, indices.size);
+        EXPECT_EQ(ZyanVectorDestroy(&indices), ZYAN_STATUS_SUCCESS);
+
+        // Range operations, word appends and the conversion back
+        auto expected = reference;
+        if (size > 10)
+        {
+            ASSERT_EQ(ZyanBitsetSetRange(&bitset, 3, size - 5), ZYAN_STATUS_SUCCESS);
+            std::fill(expected.begin() + 3, expected.end() - 5, true);
+            EXPECT_EQ(ZyanBitsetAllRange(&bitset, 3, size - 5), ZYAN_STATUS_TRUE);
+        }
+        const ZyanU64 value = (static_cast<ZyanU64>(random()) << 32) | random();
+        ASSERT_EQ(ZyanBitsetAppendWord(&bitset, value, 37), ZYAN_STATUS_SUCCESS);
+        for (ZyanU8 i = 0; i < 37; ++i)
+        {
+            expected.push_back((value >> i) & 1);
+        }
+        ExpectEqual(&bitset, expected);
+        ASSERT_EQ(ZyanBitsetSetLayout(&bitset, ZYAN_BITSET_LAYOUT_MSB_FIRST), ZYAN_STATUS_SUCCESS);
+        ExpectEqual(&bitset, expected);
+
+        EXPECT_EQ(ZyanBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(BitsetTest, ExternalBuffer)
+{
+    // Two little-endian 64-bit words, as produced by most other bitset implementations
+    const ZyanU64 words[2] = { 0x8000000000000005ULL, 0x0000000000000102ULL };
+    ZyanU8 bytes[16];
+    for (std::size_t i = 0; i < sizeof(bytes); ++i)
+    {
+        bytes[i] = static_cast<ZyanU8>(words[i / 8] >> (8 * (i % 8)));
+    }
+
+    ZyanBitset view;
+    ASSERT_EQ(ZyanBitsetInitReadOnly(&view, 77, ZYAN_BITSET_LAYOUT_LSB_FIRST, bytes),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(view.bits.data, static_cast<void*>(bytes));
+    std::vector<bool> reference(77);
+    reference[0] = reference[2] = reference[63] = reference[65] = reference[72] = true;
+    ExpectEqual(&view, reference);
+    ZyanUSize found;
+    ASSERT_EQ(ZyanBitsetFindLastSet(&view, &found), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(found, 72u);
+
+    // Read-only views reject all modifications
+    EXPECT_EQ(ZyanBitsetSet(&view, 1), ZYAN_STATUS_INVALID_OPERATION);
+    EXPECT_EQ(ZyanBitsetResetAll(&view), ZYAN_STATUS_INVALID_OPERATION);
+    EXPECT_EQ(ZyanBitsetFlipRange(&view, 0, 8), ZYAN_STATUS_INVALID_OPERATION);
+    EXPECT_EQ(ZyanBitsetPush(&view, ZYAN_TRUE), ZYAN_STATUS_INVALID_OPERATION);
+    EXPECT_EQ(ZyanBitsetAppendWord(&view, 1, 1), ZYAN_STATUS_INVALID_OPERATION);
+    EXPECT_EQ(ZyanBitsetSetLayout(&view, ZYAN_BITSET_LAYOUT_MSB_FIRST),
+        ZYAN_STATUS_INVALID_OPERATION);
+    ExpectEqual(&view, reference);
+
+    // Logical operations require matching layouts
+    ZyanBitset bitset;
+    ASSERT_EQ(ZyanBitsetInit(&bitset, 77), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanBitsetOR(&bitset, &view), ZYAN_STATUS_INVALID_OPERATION);
+    EXPECT_EQ(ZyanBitsetOR(&view, &bitset), ZYAN_STATUS_INVALID_OPERATION);
+    ASSERT_EQ(ZyanBitsetSetLayout(&bitset, ZYAN_BITSET_LAYOUT_LSB_FIRST), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanBitsetOR(&bitset, &view), ZYAN_STATUS_SUCCESS);
+    ExpectEqual(&bitset, reference);
+    EXPECT_EQ(ZyanBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanBitsetDestroy(&view), ZYAN_STATUS_SUCCESS);
+
+    // Set bits past the end of the view are rejected
+    EXPECT_EQ(ZyanBitsetInitReadOnly(&view, 72, ZYAN_BITSET_LAYOUT_LSB_FIRST, bytes),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanBitsetDestroy(&view), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanBitsetInitReadOnly(&view, 65, ZYAN_BITSET_LAYOUT_LSB_FIRST, bytes),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+
+    // Writable external buffers keep their content and grow up to their capacity. The bits of the
+    // last byte past the end are cleared
+    bytes[8] |= 0xC0;
+    ASSERT_EQ(ZyanBitsetInitExternal(&bitset, 70, ZYAN_BITSET_LAYOUT_LSB_FIRST, bytes,
+        sizeof(bytes)), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(bytes[8], 0x02);
+    reference.resize(70);
+    ExpectEqual(&bitset, reference);
+    ASSERT_EQ(ZyanBitsetSet(&bitset, 69), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(bytes[8], 0x22);
+    ASSERT_EQ(ZyanBitsetAppend(&bitset, 58, ZYAN_TRUE), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(bytes[15], 0xFF);
+    EXPECT_NE(ZyanBitsetPush(&bitset, ZYAN_TRUE), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(BitsetTest, ShiftRotate)
+{
+    std::mt19937 random(48);
+    for (auto layout : { ZYAN_BITSET_LAYOUT_MSB_FIRST, ZYAN_BITSET_LAYOUT_LSB_FIRST })
+    {
+        for (std::size_t size : { 0, 1, 13, 64, 65, 200, 1031 })
+        {
+            for (std::size_t count : { 0, 1, 7, 63, 64, 100, 500, 1031, 5000 })
+            {
+                const auto reference = RandomBits(random, size);
+                ZyanBitset source;
+                InitFrom(&source, reference);
+                ASSERT_EQ(ZyanBitsetSetLayout(&source, layout), ZYAN_STATUS_SUCCESS);
+                ZyanBitset destination;
+                ASSERT_EQ(ZyanBitsetInit(&destination, size), ZYAN_STATUS_SUCCESS);
+                ASSERT_EQ(ZyanBitsetSetLayout(&destination, layout), ZYAN_STATUS_SUCCESS);
+
+                std::vector<bool> left(size), right(size), rotated(size);
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    left[i] = (i >= count) && reference[i - count];
+                    right[i] = (count < size - i) && reference[i + count];
+                    rotated[(i + count) % size] = reference[i];
+                }
+
+                ASSERT_EQ(ZyanBitsetAssignShiftLeft(&destination, &source, count),
+                    ZYAN_STATUS_SUCCESS);
+                ExpectEqual(&destination, left);
+                ASSERT_EQ(ZyanBitsetAssignShiftRight(&destination, &source, count),
+                    ZYAN_STATUS_SUCCESS);
+                ExpectEqual(&destination, right);
+                ASSERT_EQ(ZyanBitsetAssignRotateLeft(&destination, &source, count),
+                    ZYAN_STATUS_SUCCESS);
+                ExpectEqual(&destination, rotated);
+                ASSERT_EQ(ZyanBitsetAssignRotateRight(&source, &destination, count),
+                    ZYAN_STATUS_SUCCESS);
+                ExpectEqual(&source, reference);
+
+                // In place
+                ASSERT_EQ(ZyanBitsetRotateRight(&destination, count), ZYAN_STATUS_SUCCESS);
+                ExpectEqual(&destination, reference);
+                ASSERT_EQ(ZyanBitsetRotateLeft(&source, count), ZYAN_STATUS_SUCCESS);
+                ExpectEqual(&source, rotated);
+                ASSERT_EQ(ZyanBitsetRotateRight(&source, count), ZYAN_STATUS_SUCCESS);
+                ExpectEqual(&source, reference);
+                ASSERT_EQ(ZyanBitsetShiftLeft(&source, count), ZYAN_STATUS_SUCCESS);
+                ExpectEqual(&source, left);
+                ASSERT_EQ(ZyanBitsetShiftRight(&destination, count), ZYAN_STATUS_SUCCESS);
+                ExpectEqual(&destination, right);
+
+                EXPECT_EQ(ZyanBitsetDestroy(&destination), ZYAN_STATUS_SUCCESS);
+                EXPECT_EQ(ZyanBitsetDestroy(&source), ZYAN_STATUS_SUCCESS);
+            }
+        }
+    }
+}
+
+TEST(BitsetTest, WordAccess)
+{
+    std::mt19937 random(49);
+    for (auto layout : { ZYAN_BITSET_LAYOUT_MSB_FIRST, ZYAN_BITSET_LAYOUT_LSB_FIRST })
+    {
+        auto reference = RandomBits(random, 777);
+        ZyanBitset bitset;
+        InitFrom(&bitset, reference);
+        ASSERT_EQ(ZyanBitsetSetLayout(&bitset, layout), ZYAN_STATUS_SUCCESS);
+
+        for (int round = 0; round < 2000; ++round)
+        {
+            const auto count = static_cast<ZyanU8>(random() % 65);
+            const std::size_t index = random() % (reference.size() - count + 1);
+            ZyanU64 value;
+            ASSERT_EQ(ZyanBitsetGetWord(&bitset, index, count, &value), ZYAN_STATUS_SUCCESS);
+            for (ZyanU8 i = 0; i < 64; ++i)
+            {
+                ASSERT_EQ((value >> i) & 1, (i < count) && reference[index + i])
+                    << "index " << index << ", bit " << +i;
+            }
+
+            value = (static_cast<ZyanU64>(random()) << 32) | random();
+            ASSERT_EQ(ZyanBitsetSetWord(&bitset, index, value, count), ZYAN_STATUS_SUCCESS);
+            for (ZyanU8 i = 0; i < count; ++i)
+            {
+                reference[index + i] = (value >> i) & 1;
+            }
+        }
+        ExpectEqual(&bitset, reference);
+
+        ZyanU64 value;
+        EXPECT_EQ(ZyanBitsetGetWord(&bitset, 714, 64, &value), ZYAN_STATUS_OUT_OF_RANGE);
+        EXPECT_EQ(ZyanBitsetSetWord(&bitset, 777, 0, 1), ZYAN_STATUS_OUT_OF_RANGE);
+        EXPECT_EQ(ZyanBitsetGetWord(&bitset, 0, 65, &value), ZYAN_STATUS_INVALID_ARGUMENT);
+
+        EXPECT_EQ(ZyanBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(BitsetTest, Add)
+{
+    std::mt19937 random(50);
+    for (auto layout : { ZYAN_BITSET_LAYOUT_MSB_FIRST, ZYAN_BITSET_LAYOUT_LSB_FIRST })
+    {
+        for (std::size_t size : { 1, 5, 64, 128, 130, 1000 })
+        {
+            for (int round = 0; round < 8; ++round)
+            {
+                const auto a = RandomBits(random, size);
+                // Long runs of set bits exercise the carry propagation across words
+                auto b = (round % 2) ? RandomBits(random, size) : std::vector<bool>(size, true);
+                bool carry_in = round % 3;
+
+                std::vector<bool> sum(size);
+                bool carry = carry_in;
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    const int total = a[i] + b[i] + carry;
+                    sum[i] = total & 1;
+                    carry = total >> 1;
+                }
+
+                ZyanBitset x, y;
+                InitFrom(&x, a);
+                InitFrom(&y, b);
+                ASSERT_EQ(ZyanBitsetSetLayout(&x, layout), ZYAN_STATUS_SUCCESS);
+                ASSERT_EQ(ZyanBitsetSetLayout(&y, layout), ZYAN_STATUS_SUCCESS);
+                ZyanBool flag = carry_in;
+                ASSERT_EQ(ZyanBitsetAdd(&x, &y, &flag), ZYAN_STATUS_SUCCESS);
+                ExpectEqual(&x, sum);
+                EXPECT_EQ(flag, carry);
+
+                EXPECT_EQ(ZyanBitsetDestroy(&y), ZYAN_STATUS_SUCCESS);
+                EXPECT_EQ(ZyanBitsetDestroy(&x), ZYAN_STATUS_SUCCESS);
+            }
+        }
+    }
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,180 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanBloomFilter` implementation.
+ */
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <Zycore/BloomFilter.h>
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Initializes a filter for `count` items at the given false positive rate and adds the
+ *          keys `0` to `count - 1` to it.
+ */
+static void InitFilled(ZyanBloomFilter* filter, ZyanBloomFilterType type, ZyanU64 count,
+    double rate)
+{
+    ZyanUSize bit_count;
+    ZyanU8 hash_count;
+    ASSERT_EQ(ZyanBloomFilterCalculateSize(type, count, rate, &bit_count, &hash_count),
+        ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanBloomFilterInit(filter, type, bit_count, hash_count), ZYAN_STATUS_SUCCESS);
+    for (ZyanU64 i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(ZyanBloomFilterAdd(filter, &i, sizeof(i)), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+/**
+ * @brief   Checks that all added keys are found and returns the measured false positive rate for
+ *          `count` keys that were never added.
+ */
+static double CheckFilter(const ZyanBloomFilter* filter, ZyanU64 count)
+{
+    for (ZyanU64 i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(ZyanBloomFilterContains(filter, &i, sizeof(i)), ZYAN_STATUS_TRUE);
+    }
+
+    ZyanU64 false_positives = 0;
+    for (ZyanU64 i = count; i < 2 * count; ++i)
+    {
+        const ZyanStatus status = ZyanBloomFilterContains(filter, &i, sizeof(i));
+        EXPECT_TRUE((status == ZYAN_STATUS_TRUE) || (status == ZYAN_STATUS_FALSE));
+        false_positives += (status == ZYAN_STATUS_TRUE);
+    }
+
+    return static_cast<double>(false_positives) / static_cast<double>(count);
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(BloomFilterTest, CalculateSize)
+{
+    ZyanUSize bit_count;
+    ZyanU8 hash_count;
+    ASSERT_EQ(ZyanBloomFilterCalculateSize(ZYAN_BLOOM_FILTER_STANDARD, 1000, 0.01, &bit_count,
+        &hash_count), ZYAN_STATUS_SUCCESS);
+    // `m = -n * ln(p) / ln(2)^2 ~ 9.585 * n`, `k = m / n * ln(2) ~ 6.64`
+    EXPECT_GE(bit_count, 9585u);
+    EXPECT_LE(bit_count, 9587u);
+    EXPECT_EQ(hash_count, 7);
+
+    ASSERT_EQ(ZyanBloomFilterCalculateSize(ZYAN_BLOOM_FILTER_BLOCKED, 1000, 0.01, &bit_count,
+        &hash_count), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(bit_count % ZYAN_BLOOM_FILTER_BLOCK_BITS, 0u);
+    EXPECT_GE(bit_count, 9585u);
+
+    EXPECT_EQ(ZyanBloomFilterCalculateSize(ZYAN_BLOOM_FILTER_STANDARD, 0, 0.01, &bit_count,
+        &hash_count), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanBloomFilterCalculateSize(ZYAN_BLOOM_FILTER_STANDARD, 1000, 0, &bit_count,
+        &hash_count), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanBloomFilterCalculateSize(ZYAN_BLOOM_FILTER_STANDARD, 1000, 1, &bit_count,
+        &hash_count), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST(BloomFilterTest, Standard)
+{
+    ZyanBloomFilter filter;
+    InitFilled(&filter, ZYAN_BLOOM_FILTER_STANDARD, 20000, 0.01);
+    const double rate = CheckFilter(&filter, 20000);
+    EXPECT_LT(rate, 0.015);
+
+    ASSERT_EQ(ZyanBloomFilterClear(&filter), ZYAN_STATUS_SUCCESS);
+    const ZyanU64 key = 0;
+    EXPECT_EQ(ZyanBloomFilterContains(&filter, &key, sizeof(key)), ZYAN_STATUS_FALSE);
+
+    EXPECT_EQ(ZyanBloomFilterDestroy(&filter), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(BloomFilterTest, Blocked)
+{
+    ZyanBloomFilter filter;
+    InitFilled(&filter, ZYAN_BLOOM_FILTER_BLOCKED, 20000, 0.01);
+
+    // Every block has to be contained in a single cache line
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(filter.bits.bits.data) %
+        (ZYAN_BLOOM_FILTER_BLOCK_BITS / 8), 0u);
+
+    // Blocked filters are expected to miss the target rate by a small margin
+    const double rate = CheckFilter(&filter, 20000);
+    EXPECT_LT(rate, 0.02);
+
+    EXPECT_EQ(ZyanBloomFilterDestroy(&filter), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(BloomFilterTest, Union)
+{
+    for (const auto type : { ZYAN_BLOOM_FILTER_STANDARD, ZYAN_BLOOM_FILTER_BLOCKED })
+    {
+        ZyanBloomFilter a;
+        ZyanBloomFilter b;
+        ASSERT_EQ(ZyanBloomFilterInit(&a, type, 4096, 4), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanBloomFilterInit(&b, type, 4096, 4), ZYAN_STATUS_SUCCESS);
+        for (ZyanU64 i = 0; i < 200; ++i)
+        {
+            ASSERT_EQ(ZyanBloomFilterAddHash((i & 1) ? &a : &b, i * 0x9E3779B97F4A7C15ULL),
+                ZYAN_STATUS_SUCCESS);
+        }
+        ASSERT_EQ(ZyanBloomFilterUnion(&a, &b), ZYAN_STATUS_SUCCESS);
+        for (ZyanU64 i = 0; i < 200; ++i)
+        {
+            EXPECT_EQ(ZyanBloomFilterContainsHash(&a, i * 0x9E3779B97F4A7C15ULL),
+                ZYAN_STATUS_TRUE);
+        }
+
+        ZyanBloomFilter c;
+        ASSERT_EQ(ZyanBloomFilterInit(&c, type, 4096, 5), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanBloomFilterUnion(&a, &c), ZYAN_STATUS_INVALID_OPERATION);
+
+        EXPECT_EQ(ZyanBloomFilterDestroy(&c), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanBloomFilterDestroy(&b), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanBloomFilterDestroy(&a), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,242 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanCache` implementation.
+ */
+
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/Cache.h>
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   A single invocation of the eviction callback (key, value, weight).
+ */
+using Eviction = std::tuple<ZyanU32, ZyanU32, ZyanUSize>;
+
+static void RecordEviction(const void* key, void* value, ZyanUSize weight, void* user_data)
+{
+    static_cast<std::vector<Eviction>*>(user_data)->emplace_back(
+        *static_cast<const ZyanU32*>(key), *static_cast<const ZyanU32*>(value), weight);
+}
+
+/**
+ * @brief   Inserts the given key with the value `key * 10`.
+ */
+static ZyanStatus Put(ZyanCache* cache, ZyanU32 key, ZyanUSize weight = 1)
+{
+    const ZyanU32 value = key * 10;
+    return ZyanCachePut(cache, &key, &value, weight);
+}
+
+/**
+ * @brief   Looks up the given key and checks the associated value.
+ */
+static ZyanBool Contains(ZyanCache* cache, ZyanU32 key)
+{
+    const void* value;
+    const ZyanStatus status = ZyanCacheGet(cache, &key, &value);
+    if (status != ZYAN_STATUS_TRUE)
+    {
+        EXPECT_EQ(status, ZYAN_STATUS_FALSE);
+        EXPECT_EQ(value, nullptr);
+        return ZYAN_FALSE;
+    }
+    EXPECT_EQ(*static_cast<const ZyanU32*>(value), key * 10);
+    return ZYAN_TRUE;
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(CacheTest, LruOrder)
+{
+    ZyanCache cache;
+    ASSERT_EQ(ZyanCacheInit(&cache, sizeof(ZyanU32), sizeof(ZyanU32), ZYAN_CACHE_POLICY_LRU, 3,
+        0, nullptr, nullptr), ZYAN_STATUS_SUCCESS);
+    std::vector<Eviction> evictions;
+    ASSERT_EQ(ZyanCacheSetEvictionCallback(&cache, &RecordEviction, &evictions),
+        ZYAN_STATUS_SUCCESS);
+
+    ASSERT_EQ(Put(&cache, 1), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(Put(&cache, 2), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(Put(&cache, 3), ZYAN_STATUS_TRUE);
+
+    // A hit moves `1` to the front, leaving `2` as the least recently used entry
+    EXPECT_TRUE(Contains(&cache, 1));
+    ASSERT_EQ(Put(&cache, 4), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(Put(&cache, 5), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(evictions, (std::vector<Eviction>{ { 2, 20, 1 }, { 3, 30, 1 } }));
+
+    // Replacing a value counts as a use as well
+    evictions.clear();
+    ASSERT_EQ(Put(&cache, 1), ZYAN_STATUS_FALSE);
+    ASSERT_EQ(Put(&cache, 6), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(evictions, (std::vector<Eviction>{ { 1, 10, 1 }, { 4, 40, 1 } }));
+
+    EXPECT_FALSE(Contains(&cache, 2));
+    EXPECT_FALSE(Contains(&cache, 3));
+    EXPECT_FALSE(Contains(&cache, 4));
+    EXPECT_TRUE(Contains(&cache, 1));
+    EXPECT_TRUE(Contains(&cache, 5));
+    EXPECT_TRUE(Contains(&cache, 6));
+
+    ZyanUSize size;
+    ASSERT_EQ(ZyanCacheGetSize(&cache, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 3u);
+
+    EXPECT_EQ(ZyanCacheDestroy(&cache), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(CacheTest, ClockSecondChance)
+{
+    ZyanCache cache;
+    ASSERT_EQ(ZyanCacheInit(&cache, sizeof(ZyanU32), sizeof(ZyanU32), ZYAN_CACHE_POLICY_CLOCK, 4,
+        0, nullptr, nullptr), ZYAN_STATUS_SUCCESS);
+    std::vector<Eviction> evictions;
+    ASSERT_EQ(ZyanCacheSetEvictionCallback(&cache, &RecordEviction, &evictions),
+        ZYAN_STATUS_SUCCESS);
+
+    for (ZyanU32 i = 0; i < 4; ++i)
+    {
+        ASSERT_EQ(Put(&cache, i), ZYAN_STATUS_TRUE);
+    }
+
+    // The clock hand skips (and clears) the referenced entries `0` and `2`
+    EXPECT_TRUE(Contains(&cache, 0));
+    EXPECT_TRUE(Contains(&cache, 2));
+    ASSERT_EQ(Put(&cache, 4), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(Put(&cache, 5), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(evictions, (std::vector<Eviction>{ { 1, 10, 1 }, { 3, 30, 1 } }));
+
+    // The second chance has been used up
+    ASSERT_EQ(Put(&cache, 6), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(evictions.back(), Eviction(0, 0, 1));
+
+    EXPECT_TRUE(Contains(&cache, 2));
+    EXPECT_TRUE(Contains(&cache, 4));
+    EXPECT_TRUE(Contains(&cache, 5));
+    EXPECT_TRUE(Contains(&cache, 6));
+
+    EXPECT_EQ(ZyanCacheDestroy(&cache), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(CacheTest, WeightedCapacity)
+{
+    ZyanCache cache;
+    ASSERT_EQ(ZyanCacheInit(&cache, sizeof(ZyanU32), sizeof(ZyanU32), ZYAN_CACHE_POLICY_LRU, 16,
+        10, nullptr, nullptr), ZYAN_STATUS_SUCCESS);
+    std::vector<Eviction> evictions;
+    ASSERT_EQ(ZyanCacheSetEvictionCallback(&cache, &RecordEviction, &evictions),
+        ZYAN_STATUS_SUCCESS);
+
+    ASSERT_EQ(Put(&cache, 1, 4), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(Put(&cache, 2, 4), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(Put(&cache, 3, 4), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(evictions, (std::vector<Eviction>{ { 1, 10, 4 } }));
+
+    // Growing an entry evicts others, but never the entry itself
+    evictions.clear();
+    ASSERT_EQ(Put(&cache, 2, 8), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(evictions, (std::vector<Eviction>{ { 2, 20, 4 }, { 3, 30, 4 } }));
+    ZyanUSize weight;
+    ASSERT_EQ(ZyanCacheGetWeight(&cache, &weight), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(weight, 8u);
+
+    evictions.clear();
+    ASSERT_EQ(Put(&cache, 4, 10), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(evictions, (std::vector<Eviction>{ { 2, 20, 8 } }));
+    ASSERT_EQ(ZyanCacheGetWeight(&cache, &weight), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(weight, 10u);
+
+    EXPECT_EQ(Put(&cache, 5, 11), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_TRUE(Contains(&cache, 4));
+
+    EXPECT_EQ(ZyanCacheDestroy(&cache), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(CacheTest, EvictionCallback)
+{
+    ZyanCache cache;
+    ASSERT_EQ(ZyanCacheInit(&cache, sizeof(ZyanU32), sizeof(ZyanU32), ZYAN_CACHE_POLICY_LRU, 8,
+        0, nullptr, nullptr), ZYAN_STATUS_SUCCESS);
+    std::vector<Eviction> evictions;
+    ASSERT_EQ(ZyanCacheSetEvictionCallback(&cache, &RecordEviction, &evictions),
+        ZYAN_STATUS_SUCCESS);
+
+    for (ZyanU32 i = 0; i < 4; ++i)
+    {
+        ASSERT_EQ(Put(&cache, i), ZYAN_STATUS_TRUE);
+    }
+    EXPECT_TRUE(evictions.empty());
+
+    // The replaced value is passed to the callback
+    const ZyanU32 key = 1;
+    const ZyanU32 value = 99;
+    ASSERT_EQ(ZyanCachePut(&cache, &key, &value, 2), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(evictions, (std::vector<Eviction>{ { 1, 10, 1 } }));
+    const void* current;
+    ASSERT_EQ(ZyanCacheGet(&cache, &key, &current), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(*static_cast<const ZyanU32*>(current), 99u);
+
+    evictions.clear();
+    ASSERT_EQ(ZyanCacheRemove(&cache, &key), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(ZyanCacheRemove(&cache, &key), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(evictions, (std::vector<Eviction>{ { 1, 99, 2 } }));
+
+    evictions.clear();
+    ASSERT_EQ(ZyanCacheClear(&cache), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(evictions.size(), 3u);
+    ZyanUSize size;
+    ASSERT_EQ(ZyanCacheGetSize(&cache, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 0u);
+
+    evictions.clear();
+    ASSERT_EQ(Put(&cache, 7), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(ZyanCacheDestroy(&cache), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(evictions, (std::vector<Eviction>{ { 7, 70, 1 } }));
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,231 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanConcurrentHashMap` implementation.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/ConcurrentHashMap.h>
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   A hash function that only produces 32-bit values, like most user supplied ones.
+ */
+static ZyanU64 HashIdentity(const void* key)
+{
+    return *static_cast<const ZyanU32*>(key);
+}
+
+static ZyanBool EqualsU32(const void* left, const void* right)
+{
+    return *static_cast<const ZyanU32*>(left) == *static_cast<const ZyanU32*>(right);
+}
+
+/**
+ * @brief   Returns a pointer to the shard at the given index.
+ */
+static const ZyanConcurrentHashMapShard* GetShard(const ZyanConcurrentHashMap* map, std::size_t i)
+{
+    return reinterpret_cast<const ZyanConcurrentHashMapShard*>(map->shards +
+        i * map->shard_stride);
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(ConcurrentHashMapTest, InsertGetRemove)
+{
+    ZyanConcurrentHashMap map;
+    ASSERT_EQ(ZyanConcurrentHashMapInit(&map, sizeof(ZyanU64), sizeof(ZyanU32), 16, nullptr,
+        nullptr), ZYAN_STATUS_SUCCESS);
+
+    for (ZyanU32 i = 0; i < 1000; ++i)
+    {
+        const ZyanU64 key = i * 7919ULL;
+        ASSERT_EQ(ZyanConcurrentHashMapInsert(&map, &key, &i), ZYAN_STATUS_TRUE);
+    }
+    ZyanUSize size;
+    ASSERT_EQ(ZyanConcurrentHashMapGetSize(&map, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 1000u);
+
+    // Replacing and conditional insertion
+    const ZyanU64 key = 7919;
+    const ZyanU32 replacement = 12345;
+    EXPECT_EQ(ZyanConcurrentHashMapInsert(&map, &key, &replacement), ZYAN_STATUS_FALSE);
+    ZyanU32 value = 0;
+    const ZyanU32 other = 1;
+    EXPECT_EQ(ZyanConcurrentHashMapTryInsert(&map, &key, &other, &value), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(value, replacement);
+    ASSERT_EQ(ZyanConcurrentHashMapGet(&map, &key, &value), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(value, replacement);
+
+    for (ZyanU32 i = 0; i < 1000; i += 2)
+    {
+        const ZyanU64 k = i * 7919ULL;
+        ASSERT_EQ(ZyanConcurrentHashMapRemove(&map, &k), ZYAN_STATUS_TRUE);
+        ASSERT_EQ(ZyanConcurrentHashMapRemove(&map, &k), ZYAN_STATUS_FALSE);
+    }
+    for (ZyanU32 i = 0; i < 1000; ++i)
+    {
+        const ZyanU64 k = i * 7919ULL;
+        ASSERT_EQ(ZyanConcurrentHashMapGet(&map, &k, &value),
+            (i % 2) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+        if ((i % 2) && (i != 1))
+        {
+            EXPECT_EQ(value, i);
+        }
+    }
+    ASSERT_EQ(ZyanConcurrentHashMapGetSize(&map, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 500u);
+
+    ASSERT_EQ(ZyanConcurrentHashMapClear(&map), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanConcurrentHashMapGetSize(&map, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 0u);
+    EXPECT_EQ(ZyanConcurrentHashMapGet(&map, &key, nullptr), ZYAN_STATUS_FALSE);
+
+    EXPECT_EQ(ZyanConcurrentHashMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(ConcurrentHashMapTest, ShardDistribution)
+{
+    ZyanConcurrentHashMap map;
+    ASSERT_EQ(ZyanConcurrentHashMapInit(&map, sizeof(ZyanU32), 0, 64, HashIdentity, EqualsU32),
+        ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(map.shard_count, 64u);
+
+    // The shards are placed on separate cache lines
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(map.shards) % 64, 0u);
+    EXPECT_EQ(map.shard_stride % 64, 0u);
+
+    // Small 32-bit hash values must still be spread across all shards
+    for (ZyanU32 i = 0; i < 64 * 64; ++i)
+    {
+        ASSERT_EQ(ZyanConcurrentHashMapInsert(&map, &i, nullptr), ZYAN_STATUS_TRUE);
+    }
+    for (std::size_t i = 0; i < map.shard_count; ++i)
+    {
+        ZyanUSize size;
+        ASSERT_EQ(ZyanHashMapGetSize(&GetShard(&map, i)->map, &size), ZYAN_STATUS_SUCCESS);
+        EXPECT_GT(size, 16u) << "shard " << i;
+        EXPECT_LT(size, 128u) << "shard " << i;
+    }
+
+    EXPECT_EQ(ZyanConcurrentHashMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(ConcurrentHashMapTest, MultiThreaded)
+{
+    constexpr ZyanU32 thread_count = 8;
+    constexpr ZyanU32 keys_per_thread = 20000;
+
+    ZyanConcurrentHashMap map;
+    ASSERT_EQ(ZyanConcurrentHashMapInit(&map, sizeof(ZyanU32), sizeof(ZyanU32), 0, HashIdentity,
+        EqualsU32), ZYAN_STATUS_SUCCESS);
+
+    // Every thread inserts its own keys, looks up the keys of all threads and races for a set of
+    // shared keys, of which every one must be won by exactly one thread
+    std::atomic<ZyanU32> errors{ 0 };
+    std::vector<std::atomic<ZyanU32>> wins(1000);
+    std::vector<std::thread> threads;
+    for (ZyanU32 t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (ZyanU32 i = 0; i < keys_per_thread; ++i)
+            {
+                const ZyanU32 key = 1000 + t * keys_per_thread + i;
+                const ZyanU32 value = key * 3;
+                if (ZyanConcurrentHashMapInsert(&map, &key, &value) != ZYAN_STATUS_TRUE)
+                {
+                    ++errors;
+                }
+
+                const ZyanU32 other = 1000 + ((t + 1) % thread_count) * keys_per_thread + i;
+                ZyanU32 found;
+                const ZyanStatus status = ZyanConcurrentHashMapGet(&map, &other, &found);
+                if ((status == ZYAN_STATUS_TRUE) ? (found != other * 3) :
+                    (status != ZYAN_STATUS_FALSE))
+                {
+                    ++errors;
+                }
+
+                const ZyanU32 shared = i % 1000;
+                const ZyanStatus race = ZyanConcurrentHashMapTryInsert(&map, &shared, &t, nullptr);
+                if (race == ZYAN_STATUS_TRUE)
+                {
+                    ++wins[shared];
+                } else if (race != ZYAN_STATUS_FALSE)
+                {
+                    ++errors;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(errors.load(), 0u);
+    for (std::size_t i = 0; i < wins.size(); ++i)
+    {
+        EXPECT_EQ(wins[i].load(), 1u) << "key " << i;
+    }
+
+    ZyanUSize size;
+    ASSERT_EQ(ZyanConcurrentHashMapGetSize(&map, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, thread_count * keys_per_thread + 1000);
+    for (ZyanU32 key = 1000; key < 1000 + thread_count * keys_per_thread; ++key)
+    {
+        ZyanU32 value;
+        ASSERT_EQ(ZyanConcurrentHashMapGet(&map, &key, &value), ZYAN_STATUS_TRUE);
+        ASSERT_EQ(value, key * 3);
+    }
+
+    EXPECT_EQ(ZyanConcurrentHashMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,200 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanFlatMap` implementation.
+ */
+
+#include <map>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/Comparison.h>
+#include <Zycore/FlatMap.h>
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+static ZyanI32 CompareU32(const ZyanU32* left, const ZyanU32* right)
+{
+    return ZyanCompareNumeric32(left, right);
+}
+
+static ZyanComparison GetCompareU32()
+{
+    return reinterpret_cast<ZyanComparison>(&CompareU32);
+}
+
+/**
+ * @brief   Checks that the given map exactly matches the given reference map.
+ */
+static void ExpectEqual(const ZyanFlatMap* map, const std::map<ZyanU32, ZyanU64>& reference)
+{
+    ZyanUSize size;
+    ASSERT_EQ(ZyanFlatMapGetSize(map, &size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(size, reference.size());
+
+    ZyanUSize index = 0;
+    for (const auto& item : reference)
+    {
+        const void* key;
+        const void* value;
+        ASSERT_EQ(ZyanFlatMapGetEntry(map, index++, &key, &value), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(*static_cast<const ZyanU32*>(key), item.first);
+        EXPECT_EQ(*static_cast<const ZyanU64*>(value), item.second);
+    }
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(FlatMapTest, InsertAndGet)
+{
+    ZyanFlatMap map;
+    ASSERT_EQ(ZyanFlatMapInit(&map, sizeof(ZyanU32), sizeof(ZyanU64), GetCompareU32(), 0),
+        ZYAN_STATUS_SUCCESS);
+
+    std::map<ZyanU32, ZyanU64> reference;
+    std::mt19937 rng(1337);
+    for (ZyanU64 i = 0; i < 1000; ++i)
+    {
+        const ZyanU32 key = rng() % 500;
+        const ZyanStatus expected = reference.count(key) ? ZYAN_STATUS_FALSE : ZYAN_STATUS_TRUE;
+        ASSERT_EQ(ZyanFlatMapInsert(&map, &key, &i), expected);
+        reference[key] = i;
+    }
+    ExpectEqual(&map, reference);
+
+    for (ZyanU32 key = 0; key < 500; ++key)
+    {
+        const void* value;
+        const auto it = reference.find(key);
+        if (it == reference.end())
+        {
+            EXPECT_EQ(ZyanFlatMapGet(&map, &key, &value), ZYAN_STATUS_FALSE);
+            EXPECT_EQ(value, nullptr);
+            continue;
+        }
+        ASSERT_EQ(ZyanFlatMapGet(&map, &key, &value), ZYAN_STATUS_TRUE);
+        EXPECT_EQ(*static_cast<const ZyanU64*>(value), it->second);
+    }
+
+    EXPECT_EQ(ZyanFlatMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(FlatMapTest, InsertBulk)
+{
+    ZyanFlatMap map;
+    ASSERT_EQ(ZyanFlatMapInit(&map, sizeof(ZyanU32), sizeof(ZyanU64), GetCompareU32(), 0),
+        ZYAN_STATUS_SUCCESS);
+
+    std::map<ZyanU32, ZyanU64> reference;
+    std::mt19937 rng(42);
+    ZyanU64 counter = 0;
+    for (ZyanUSize batch_size : { 1, 7, 16, 17, 100, 1000, 0, 3000 })
+    {
+        std::vector<ZyanU32> keys;
+        std::vector<ZyanU64> values;
+        for (ZyanUSize i = 0; i < batch_size; ++i)
+        {
+            keys.push_back(rng() % 4000);
+            values.push_back(counter++);
+            reference[keys.back()] = values.back();
+        }
+        ASSERT_EQ(ZyanFlatMapInsertBulk(&map, keys.data(), values.data(), batch_size),
+            ZYAN_STATUS_SUCCESS);
+        ExpectEqual(&map, reference);
+    }
+
+    EXPECT_EQ(ZyanFlatMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(FlatMapTest, Bounds)
+{
+    ZyanFlatMap set;
+    ASSERT_EQ(ZyanFlatMapInit(&set, sizeof(ZyanU32), 0, GetCompareU32(), 0),
+        ZYAN_STATUS_SUCCESS);
+
+    const ZyanU32 keys[] = { 50, 10, 40, 20, 30, 20 };
+    ASSERT_EQ(ZyanFlatMapInsertBulk(&set, keys, nullptr, ZYAN_ARRAY_LENGTH(keys)),
+        ZYAN_STATUS_SUCCESS);
+
+    ZyanUSize size;
+    ASSERT_EQ(ZyanFlatMapGetSize(&set, &size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(size, 5);
+
+    ZyanUSize lower, upper;
+    ZyanU32 key = 20;
+    ASSERT_EQ(ZyanFlatMapLowerBound(&set, &key, &lower), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanFlatMapUpperBound(&set, &key, &upper), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(lower, 1);
+    EXPECT_EQ(upper, 2);
+
+    key = 25;
+    ASSERT_EQ(ZyanFlatMapLowerBound(&set, &key, &lower), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanFlatMapUpperBound(&set, &key, &upper), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(lower, 2);
+    EXPECT_EQ(upper, 2);
+
+    key = 60;
+    ASSERT_EQ(ZyanFlatMapLowerBound(&set, &key, &lower), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(lower, 5);
+
+    // Remove [20, 40]
+    ZyanU32 from = 20;
+    ZyanU32 to = 40;
+    ASSERT_EQ(ZyanFlatMapLowerBound(&set, &from, &lower), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanFlatMapUpperBound(&set, &to, &upper), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanFlatMapRemoveRange(&set, lower, upper - lower), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanFlatMapGetSize(&set, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 2);
+
+    key = 10;
+    EXPECT_EQ(ZyanFlatMapRemove(&set, &key), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(ZyanFlatMapRemove(&set, &key), ZYAN_STATUS_FALSE);
+
+    ZyanUSize index;
+    key = 50;
+    EXPECT_EQ(ZyanFlatMapFind(&set, &key, &index), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(index, 0);
+
+    EXPECT_EQ(ZyanFlatMapDestroy(&set), ZYAN_STATUS_SUCCESS);
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,208 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the hash functions and checksums.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/Hash.h>
+#include "Helpers.h"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns `size` bytes of deterministic pseudo-random data.
+ */
+static std::vector<ZyanU8> MakeData(std::size_t size)
+{
+    std::vector<ZyanU8> data(size);
+    ZyanU64 state = 0x0123456789ABCDEFULL;
+    for (auto& byte : data)
+    {
+        byte = static_cast<ZyanU8>(NextRandom(state) >> 56);
+    }
+    return data;
+}
+
+/**
+ * @brief   A bitwise CRC-32C reference implementation.
+ */
+static ZyanU32 Crc32cReference(const ZyanU8* data, std::size_t size)
+{
+    ZyanU32 crc = 0xFFFFFFFF;
+    while (size--)
+    {
+        crc ^= *data++;
+        for (int i = 0; i < 8; ++i)
+        {
+            crc = (crc >> 1) ^ (0x82F63B78 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+/**
+ * @brief   Checks `ZyanCrc32c` against the reference implementation for all sizes up to `260`
+ *          bytes, all start alignments and chained calls.
+ */
+static void CheckCrc32c()
+{
+    const auto data = MakeData(300);
+    for (std::size_t offset = 0; offset < 8; ++offset)
+    {
+        for (std::size_t size = 0; size <= 260; ++size)
+        {
+            const ZyanU8* const p = data.data() + offset;
+            const ZyanU32 expected = Crc32cReference(p, size);
+            ASSERT_EQ(ZyanCrc32c(0, p, size), expected) << offset << ", " << size;
+
+            const std::size_t split = size / 3;
+            ASSERT_EQ(ZyanCrc32c(ZyanCrc32c(0, p, split), p + split, size - split), expected)
+                << offset << ", " << size;
+        }
+    }
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(HashTest, Crc32cKnownAnswers)
+{
+    EXPECT_EQ(ZyanCrc32c(0, nullptr, 0), 0x00000000u);
+    EXPECT_EQ(ZyanCrc32c(0, "123456789", 9), 0xE3069283u);
+
+    // RFC 3720, B.4
+    ZyanU8 buffer[32];
+    std::memset(buffer, 0x00, sizeof(buffer));
+    EXPECT_EQ(ZyanCrc32c(0, buffer, sizeof(buffer)), 0x8A9136AAu);
+    std::memset(buffer, 0xFF, sizeof(buffer));
+    EXPECT_EQ(ZyanCrc32c(0, buffer, sizeof(buffer)), 0x62A8AB43u);
+    for (ZyanU8 i = 0; i < 32; ++i)
+    {
+        buffer[i] = i;
+    }
+    EXPECT_EQ(ZyanCrc32c(0, buffer, sizeof(buffer)), 0x46DD794Eu);
+    for (ZyanU8 i = 0; i < 32; ++i)
+    {
+        buffer[i] = 31 - i;
+    }
+    EXPECT_EQ(ZyanCrc32c(0, buffer, sizeof(buffer)), 0x113FDB5Cu);
+}
+
+TEST(HashTest, Crc32cReference)
+{
+    CheckCrc32c();
+}
+
+TEST(HashTest, StreamingMatchesOneShot)
+{
+    const auto data = MakeData(300);
+    for (std::size_t size : { 0, 1, 31, 32, 33, 63, 64, 65, 96, 100, 257, 300 })
+    {
+        const ZyanU64 expected = ZyanHash64(data.data(), size, 42);
+
+        for (std::size_t chunk : { 1, 7, 31, 32, 33, 64 })
+        {
+            ZyanHashState state;
+            ASSERT_EQ(ZyanHash64Init(&state, 42), ZYAN_STATUS_SUCCESS);
+            for (std::size_t i = 0; i < size; i += chunk)
+            {
+                ASSERT_EQ(ZyanHash64Update(&state, data.data() + i, std::min(chunk, size - i)),
+                    ZYAN_STATUS_SUCCESS);
+            }
+            ZyanU64 hash;
+            ASSERT_EQ(ZyanHash64Final(&state, &hash), ZYAN_STATUS_SUCCESS);
+            EXPECT_EQ(hash, expected) << size << ", " << chunk;
+        }
+
+        // Splitting the input right before and after a stripe boundary
+        for (std::size_t split : { 0, 1, 31, 32, 33 })
+        {
+            if (split > size)
+            {
+                continue;
+            }
+            ZyanHashState state;
+            ASSERT_EQ(ZyanHash64Init(&state, 42), ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(ZyanHash64Update(&state, data.data(), split), ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(ZyanHash64Update(&state, nullptr, 0), ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(ZyanHash64Update(&state, data.data() + split, size - split),
+                ZYAN_STATUS_SUCCESS);
+            ZyanU64 hash;
+            ASSERT_EQ(ZyanHash64Final(&state, &hash), ZYAN_STATUS_SUCCESS);
+            EXPECT_EQ(hash, expected) << size << ", " << split;
+        }
+    }
+}
+
+TEST(HashTest, Hash64)
+{
+    const auto data = MakeData(64);
+
+    // The seed, the length and every single byte have to affect the result
+    const ZyanU64 reference = ZyanHash64(data.data(), data.size(), 0);
+    EXPECT_NE(ZyanHash64(data.data(), data.size(), 1), reference);
+    EXPECT_NE(ZyanHash64(data.data(), data.size() - 1, 0), reference);
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        auto copy = data;
+        copy[i] ^= 1;
+        EXPECT_NE(ZyanHash64(copy.data(), copy.size(), 0), reference) << i;
+    }
+
+    // Trailing zero bytes must not collide with shorter inputs
+    const ZyanU8 zeros[2] = { 0, 0 };
+    EXPECT_NE(ZyanHash64(zeros, 0, 0), ZyanHash64(zeros, 1, 0));
+    EXPECT_NE(ZyanHash64(zeros, 1, 0), ZyanHash64(zeros, 2, 0));
+
+    EXPECT_EQ(ZyanHash64Init(nullptr, 0), ZYAN_STATUS_INVALID_ARGUMENT);
+    ZyanHashState state;
+    ASSERT_EQ(ZyanHash64Init(&state, 0), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanHash64Update(&state, nullptr, 1), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanHash64Final(&state, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,181 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanHashMap` implementation.
+ */
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/HashMap.h>
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(HashMapTest, InsertGetRemove)
+{
+    ZyanHashMap map;
+    ASSERT_EQ(ZyanHashMapInit(&map, sizeof(ZyanU64), sizeof(ZyanU32), 0, nullptr, nullptr),
+        ZYAN_STATUS_SUCCESS);
+
+    std::unordered_map<ZyanU64, ZyanU32> reference;
+    std::mt19937_64 rng(1337);
+    for (ZyanU32 i = 0; i < 100000; ++i)
+    {
+        const ZyanU64 key = rng() % 5000;
+        if (rng() % 3 == 0)
+        {
+            const ZyanStatus expected = reference.erase(key) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+            ASSERT_EQ(ZyanHashMapRemove(&map, &key), expected);
+            continue;
+        }
+
+        const ZyanStatus expected = reference.count(key) ? ZYAN_STATUS_FALSE : ZYAN_STATUS_TRUE;
+        ASSERT_EQ(ZyanHashMapInsert(&map, &key, &i), expected);
+        reference[key] = i;
+    }
+
+    ZyanUSize size;
+    ASSERT_EQ(ZyanHashMapGetSize(&map, &size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(size, reference.size());
+
+    for (ZyanU64 key = 0; key < 5000; ++key)
+    {
+        const void* value;
+        const auto it = reference.find(key);
+        if (it == reference.end())
+        {
+            EXPECT_EQ(ZyanHashMapGet(&map, &key, &value), ZYAN_STATUS_FALSE);
+            EXPECT_EQ(value, nullptr);
+            continue;
+        }
+        ASSERT_EQ(ZyanHashMapGet(&map, &key, &value), ZYAN_STATUS_TRUE);
+        EXPECT_EQ(*static_cast<const ZyanU32*>(value), it->second);
+    }
+
+    ZyanUSize iterator = 0;
+    ZyanUSize count = 0;
+    const void* key;
+    const void* value;
+    while (ZyanHashMapIterate(&map, &iterator, &key, &value) == ZYAN_STATUS_TRUE)
+    {
+        const auto it = reference.find(*static_cast<const ZyanU64*>(key));
+        ASSERT_NE(it, reference.end());
+        EXPECT_EQ(*static_cast<const ZyanU32*>(value), it->second);
+        ++count;
+    }
+    EXPECT_EQ(count, reference.size());
+
+    ASSERT_EQ(ZyanHashMapRehash(&map, 0), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanHashMapGetSize(&map, &size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(size, reference.size());
+
+    ASSERT_EQ(ZyanHashMapClear(&map), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanHashMapGetSize(&map, &size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(size, 0);
+    const ZyanU64 first = reference.begin()->first;
+    EXPECT_EQ(ZyanHashMapGet(&map, &first, nullptr), ZYAN_STATUS_FALSE);
+
+    EXPECT_EQ(ZyanHashMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(HashMapTest, StringViewKeys)
+{
+    ZyanHashMap map;
+    ASSERT_EQ(ZyanHashMapInitStringView(&map, sizeof(ZyanUSize), 0), ZYAN_STATUS_SUCCESS);
+
+    std::vector<std::string> strings;
+    for (ZyanUSize i = 0; i < 1000; ++i)
+    {
+        strings.push_back("key_" + std::to_string(i));
+    }
+
+    for (ZyanUSize i = 0; i < strings.size(); ++i)
+    {
+        ZyanStringView view;
+        ASSERT_EQ(ZyanStringViewInsideBufferEx(&view, strings[i].data(), strings[i].size()),
+            ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanHashMapInsert(&map, &view, &i), ZYAN_STATUS_TRUE);
+    }
+
+    // Look up using views into different buffers with the same content
+    for (ZyanUSize i = 0; i < strings.size(); ++i)
+    {
+        const std::string copy = strings[i] + "_suffix";
+        ZyanStringView view;
+        ASSERT_EQ(ZyanStringViewInsideBufferEx(&view, copy.data(), strings[i].size()),
+            ZYAN_STATUS_SUCCESS);
+
+        const void* value;
+        ASSERT_EQ(ZyanHashMapGet(&map, &view, &value), ZYAN_STATUS_TRUE);
+        EXPECT_EQ(*static_cast<const ZyanUSize*>(value), i);
+
+        ASSERT_EQ(ZyanStringViewInsideBufferEx(&view, copy.data(), copy.size()),
+            ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanHashMapGet(&map, &view, &value), ZYAN_STATUS_FALSE);
+    }
+
+    EXPECT_EQ(ZyanHashMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(HashMapTest, Reserve)
+{
+    ZyanHashMap set;
+    ASSERT_EQ(ZyanHashMapInit(&set, sizeof(ZyanU32), 0, 0, nullptr, nullptr),
+        ZYAN_STATUS_SUCCESS);
+
+    ASSERT_EQ(ZyanHashMapReserve(&set, 1000), ZYAN_STATUS_SUCCESS);
+    ZyanUSize capacity;
+    ASSERT_EQ(ZyanHashMapGetCapacity(&set, &capacity), ZYAN_STATUS_SUCCESS);
+
+    for (ZyanU32 i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(ZyanHashMapInsert(&set, &i, nullptr), ZYAN_STATUS_TRUE);
+    }
+
+    ZyanUSize new_capacity;
+    ASSERT_EQ(ZyanHashMapGetCapacity(&set, &new_capacity), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(capacity, new_capacity);
+
+    EXPECT_EQ(ZyanHashMapDestroy(&set), ZYAN_STATUS_SUCCESS);
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
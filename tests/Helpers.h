@@ -0,0 +1,83 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Helper functions shared by the tests.
+ */
+
+#ifndef ZYCORE_TESTS_HELPERS_H
+#define ZYCORE_TESTS_HELPERS_H
+
+#include <string>
+#include <gtest/gtest.h>
+#include <Zycore/String.h>
+#include <Zycore/Types.h>
+
+/* ============================================================================================== */
+/* Random numbers                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * @brief   Advances the state of a deterministic pseudo-random sequence and returns the next
+ *          value.
+ *
+ * @param   state   The state (any seed value).
+ *
+ * @return  The next value.
+ *
+ * The sequence is a 64-bit LCG. Its low bits have short periods, so the high bits are folded into
+ * the result.
+ */
+static inline ZyanU64 NextRandom(ZyanU64& state)
+{
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return state ^ (state >> 29);
+}
+
+/* ============================================================================================== */
+/* String views                                                                                   */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns a string view for the given string (including embedded `\0` characters).
+ *
+ * @param   string  The string. It has to outlive the returned view.
+ *
+ * @return  The string view.
+ */
+static inline ZyanStringView MakeView(const std::string& string)
+{
+    ZyanStringView view;
+    // `ZyanStringViewInsideBufferEx` does not accept empty strings
+    EXPECT_EQ(string.empty() ? ZyanStringViewInsideBuffer(&view, string.c_str()) :
+        ZyanStringViewInsideBufferEx(&view, string.data(), string.size()), ZYAN_STATUS_SUCCESS);
+    return view;
+}
+
+/* ============================================================================================== */
+
+#endif /* ZYCORE_TESTS_HELPERS_H */
@@ -0,0 +1,282 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanHierarchicalBitset` implementation.
+ */
+
+#include <set>
+#include <gtest/gtest.h>
+#include <Zycore/HierarchicalBitset.h>
+#include "Helpers.h"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns the given word of the given level.
+ */
+static ZyanU64 GetWord(const ZyanHierarchicalBitset* bitset, ZyanU8 level, ZyanUSize index)
+{
+    EXPECT_LT(level, bitset->level_count);
+    EXPECT_LT(bitset->level_offsets[level] + index, bitset->level_offsets[level + 1]);
+    return bitset->words[bitset->level_offsets[level] + index];
+}
+
+/**
+ * @brief   Checks that every summary bit is set if and only if the word below is not empty.
+ */
+static void ExpectSummaryConsistent(const ZyanHierarchicalBitset* bitset)
+{
+    for (ZyanU8 level = 1; level < bitset->level_count; ++level)
+    {
+        const ZyanUSize below = bitset->level_offsets[level] - bitset->level_offsets[level - 1];
+        for (ZyanUSize i = 0; i < below; ++i)
+        {
+            const bool summary = (GetWord(bitset, level, i / 64) >> (i % 64)) & 1;
+            ASSERT_EQ(summary, GetWord(bitset, level - 1, i) != 0)
+                << "level " << static_cast<int>(level) << ", word " << i;
+        }
+    }
+}
+
+/**
+ * @brief   Returns the result of `ZyanHierarchicalBitsetFindNextSet` or `size`, if no set bit
+ *          was found.
+ */
+static ZyanUSize FindNext(const ZyanHierarchicalBitset* bitset, ZyanUSize index)
+{
+    ZyanUSize found;
+    const ZyanStatus status = ZyanHierarchicalBitsetFindNextSet(bitset, index, &found);
+    if (status == ZYAN_STATUS_FALSE)
+    {
+        return bitset->size;
+    }
+    EXPECT_EQ(status, ZYAN_STATUS_TRUE);
+    return found;
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(HierarchicalBitsetTest, LevelCounts)
+{
+    const std::pair<ZyanUSize, ZyanU8> sizes[] =
+    {
+        { 1, 1 }, { 63, 1 }, { 64, 1 }, { 65, 2 }, { 4096, 2 }, { 4097, 3 }, { 262144, 3 },
+        { 262145, 4 }
+    };
+    for (const auto& entry : sizes)
+    {
+        const ZyanUSize size = entry.first;
+        ZyanHierarchicalBitset bitset;
+        ASSERT_EQ(ZyanHierarchicalBitsetInit(&bitset, size), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(bitset.level_count, entry.second) << "size " << size;
+        EXPECT_EQ(bitset.level_offsets[bitset.level_count] -
+            bitset.level_offsets[bitset.level_count - 1], 1u);
+
+        ZyanUSize found;
+        EXPECT_EQ(ZyanHierarchicalBitsetFindFirstSet(&bitset, &found), ZYAN_STATUS_FALSE);
+        EXPECT_EQ(ZyanHierarchicalBitsetNone(&bitset), ZYAN_STATUS_TRUE);
+
+        // The first and last bit are reachable from the bottom and from the top
+        for (const ZyanUSize index : { size - 1, ZyanUSize{ 0 } })
+        {
+            ASSERT_EQ(ZyanHierarchicalBitsetSet(&bitset, index), ZYAN_STATUS_SUCCESS);
+            EXPECT_EQ(ZyanHierarchicalBitsetTest(&bitset, index), ZYAN_STATUS_TRUE);
+            EXPECT_EQ(FindNext(&bitset, 0), index);
+            EXPECT_EQ(FindNext(&bitset, index), index);
+        }
+        EXPECT_EQ(FindNext(&bitset, 1), (size > 1) ? size - 1 : size);
+        ExpectSummaryConsistent(&bitset);
+
+        EXPECT_EQ(ZyanHierarchicalBitsetSet(&bitset, size), ZYAN_STATUS_OUT_OF_RANGE);
+        EXPECT_EQ(ZyanHierarchicalBitsetReset(&bitset, size), ZYAN_STATUS_OUT_OF_RANGE);
+        EXPECT_EQ(ZyanHierarchicalBitsetTest(&bitset, size), ZYAN_STATUS_OUT_OF_RANGE);
+
+        EXPECT_EQ(ZyanHierarchicalBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+    }
+
+    ZyanHierarchicalBitset bitset;
+    EXPECT_EQ(ZyanHierarchicalBitsetInit(&bitset, 0), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST(HierarchicalBitsetTest, FindNextSetAtEnd)
+{
+    for (const ZyanUSize size : { 64, 100, 4096, 5000, 262144 })
+    {
+        ZyanHierarchicalBitset bitset;
+        ASSERT_EQ(ZyanHierarchicalBitsetInit(&bitset, size), ZYAN_STATUS_SUCCESS);
+
+        ZyanUSize found;
+        EXPECT_EQ(ZyanHierarchicalBitsetFindNextSet(&bitset, size, &found), ZYAN_STATUS_FALSE);
+        ASSERT_EQ(ZyanHierarchicalBitsetSet(&bitset, size - 1), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanHierarchicalBitsetFindNextSet(&bitset, size - 1, &found),
+            ZYAN_STATUS_TRUE);
+        EXPECT_EQ(found, size - 1);
+        EXPECT_EQ(ZyanHierarchicalBitsetFindNextSet(&bitset, size, &found), ZYAN_STATUS_FALSE);
+        EXPECT_EQ(ZyanHierarchicalBitsetFindNextSet(&bitset, size + 1, &found),
+            ZYAN_STATUS_OUT_OF_RANGE);
+
+        EXPECT_EQ(ZyanHierarchicalBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(HierarchicalBitsetTest, FindNextSetAcrossEmptyWords)
+{
+    ZyanHierarchicalBitset bitset;
+    ASSERT_EQ(ZyanHierarchicalBitsetInit(&bitset, 262144), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(bitset.level_count, 3);
+
+    // The bits are separated by empty level 0 and level 1 words
+    const ZyanUSize indices[] = { 3, 64 * 64 - 1, 64 * 64 * 7 + 64 * 5, 262144 - 64 * 64 - 1 };
+    for (const ZyanUSize index : indices)
+    {
+        ASSERT_EQ(ZyanHierarchicalBitsetSet(&bitset, index), ZYAN_STATUS_SUCCESS);
+    }
+    ExpectSummaryConsistent(&bitset);
+
+    ZyanUSize index = 0;
+    for (const ZyanUSize expected : indices)
+    {
+        index = FindNext(&bitset, index);
+        EXPECT_EQ(index, expected);
+        ++index;
+    }
+    EXPECT_EQ(FindNext(&bitset, index), bitset.size);
+
+    // Starting inside an empty word and at the last bit of a word
+    EXPECT_EQ(FindNext(&bitset, 64 * 64 * 2 + 17), indices[2]);
+    EXPECT_EQ(FindNext(&bitset, 64 * 64 * 7 + 64 * 5 - 1), indices[2]);
+    EXPECT_EQ(FindNext(&bitset, 64 * 64 * 7 + 64 * 5 + 1), indices[3]);
+
+    EXPECT_EQ(ZyanHierarchicalBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(HierarchicalBitsetTest, SummaryBitsAfterReset)
+{
+    ZyanHierarchicalBitset bitset;
+    ASSERT_EQ(ZyanHierarchicalBitsetInit(&bitset, 262144), ZYAN_STATUS_SUCCESS);
+
+    // Two bits in the same level 0 word and a third one in another word of the same level 1 word
+    const ZyanUSize a = 64 * 64 * 9 + 64 * 2 + 5;
+    const ZyanUSize b = a + 10;
+    const ZyanUSize c = 64 * 64 * 9 + 64 * 40;
+    for (const ZyanUSize index : { a, b, c })
+    {
+        ASSERT_EQ(ZyanHierarchicalBitsetSet(&bitset, index), ZYAN_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(GetWord(&bitset, 1, 9), (1ULL << 2) | (1ULL << 40));
+    EXPECT_EQ(GetWord(&bitset, 2, 0), 1ULL << 9);
+
+    ASSERT_EQ(ZyanHierarchicalBitsetReset(&bitset, a), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetWord(&bitset, 1, 9), (1ULL << 2) | (1ULL << 40));
+
+    // Resetting the last bit of a word clears its summary bit, but not the ones above
+    ASSERT_EQ(ZyanHierarchicalBitsetReset(&bitset, b), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetWord(&bitset, 1, 9), 1ULL << 40);
+    EXPECT_EQ(GetWord(&bitset, 2, 0), 1ULL << 9);
+    EXPECT_EQ(FindNext(&bitset, 0), c);
+    ExpectSummaryConsistent(&bitset);
+
+    // Resetting the last bit of all words clears the summary bits of every level
+    ASSERT_EQ(ZyanHierarchicalBitsetReset(&bitset, c), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetWord(&bitset, 1, 9), 0u);
+    EXPECT_EQ(GetWord(&bitset, 2, 0), 0u);
+    EXPECT_EQ(FindNext(&bitset, 0), bitset.size);
+    EXPECT_EQ(ZyanHierarchicalBitsetNone(&bitset), ZYAN_STATUS_TRUE);
+
+    // Resetting a cleared bit has no effect
+    ASSERT_EQ(ZyanHierarchicalBitsetReset(&bitset, c), ZYAN_STATUS_SUCCESS);
+    ZyanUSize count;
+    ASSERT_EQ(ZyanHierarchicalBitsetCount(&bitset, &count), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(count, 0u);
+
+    EXPECT_EQ(ZyanHierarchicalBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(HierarchicalBitsetTest, Randomized)
+{
+    constexpr ZyanUSize size = 64 * 64 * 3 + 100;
+
+    ZyanHierarchicalBitset bitset;
+    ASSERT_EQ(ZyanHierarchicalBitsetInit(&bitset, size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(bitset.level_count, 3);
+    std::set<ZyanUSize> reference;
+
+    ZyanU64 state = 11;
+    for (int i = 0; i < 50000; ++i)
+    {
+        const ZyanU64 random = NextRandom(state);
+        // Cluster the bits, so that words become empty regularly
+        const ZyanUSize index = ((random >> 40) % 8) * (size / 8) + (random >> 20) % 96;
+        const bool value = (random >> 60) & 1;
+        ASSERT_EQ(ZyanHierarchicalBitsetAssign(&bitset, index, value), ZYAN_STATUS_SUCCESS);
+        if (value)
+        {
+            reference.insert(index);
+        } else
+        {
+            reference.erase(index);
+        }
+
+        const ZyanUSize start = (random >> 8) % (size + 1);
+        const auto it = reference.lower_bound(start);
+        ASSERT_EQ(FindNext(&bitset, start), (it == reference.end()) ? size : *it);
+        if (i % 1000 == 0)
+        {
+            ExpectSummaryConsistent(&bitset);
+        }
+    }
+
+    ZyanUSize count;
+    ASSERT_EQ(ZyanHierarchicalBitsetCount(&bitset, &count), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(count, reference.size());
+    ExpectSummaryConsistent(&bitset);
+
+    ASSERT_EQ(ZyanHierarchicalBitsetResetAll(&bitset), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanHierarchicalBitsetAny(&bitset), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(FindNext(&bitset, 0), size);
+
+    EXPECT_EQ(ZyanHierarchicalBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
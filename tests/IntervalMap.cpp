@@ -0,0 +1,329 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanIntervalMap` implementation.
+ */
+
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/IntervalMap.h>
+#include "Helpers.h"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   A single range (start, end, value).
+ */
+using Range = std::tuple<ZyanU64, ZyanU64, ZyanU32>;
+
+static ZyanStatus Insert(ZyanIntervalMap* map, ZyanU64 start, ZyanU64 end, ZyanU32 value)
+{
+    return ZyanIntervalMapInsert(map, start, end, &value);
+}
+
+/**
+ * @brief   Returns all ranges of the map in order.
+ */
+static std::vector<Range> GetRanges(const ZyanIntervalMap* map)
+{
+    ZyanUSize size;
+    EXPECT_EQ(ZyanIntervalMapGetSize(map, &size), ZYAN_STATUS_SUCCESS);
+    std::vector<Range> ranges;
+    for (ZyanUSize i = 0; i < size; ++i)
+    {
+        ZyanU64 start;
+        ZyanU64 end;
+        const void* value;
+        EXPECT_EQ(ZyanIntervalMapGetEntry(map, i, &start, &end, &value), ZYAN_STATUS_SUCCESS);
+        ranges.emplace_back(start, end, *static_cast<const ZyanU32*>(value));
+    }
+    return ranges;
+}
+
+/**
+ * @brief   Returns the value at the given address or `~0`, if no range contains the address.
+ */
+static ZyanU32 GetValue(const ZyanIntervalMap* map, ZyanU64 address)
+{
+    const void* value;
+    const ZyanStatus status = ZyanIntervalMapGet(map, address, &value);
+    if (status != ZYAN_STATUS_TRUE)
+    {
+        EXPECT_EQ(status, ZYAN_STATUS_FALSE);
+        EXPECT_EQ(value, nullptr);
+        return ~0u;
+    }
+    return *static_cast<const ZyanU32*>(value);
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(IntervalMapTest, PartialOverlaps)
+{
+    ZyanIntervalMap map;
+    ASSERT_EQ(ZyanIntervalMapInit(&map, sizeof(ZyanU32), nullptr), ZYAN_STATUS_SUCCESS);
+
+    ASSERT_EQ(Insert(&map, 10, 20, 1), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(Insert(&map, 30, 40, 2), ZYAN_STATUS_SUCCESS);
+
+    // Truncates both neighbors
+    ASSERT_EQ(Insert(&map, 15, 35, 3), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetRanges(&map), (std::vector<Range>{ { 10, 15, 1 }, { 15, 35, 3 },
+        { 35, 40, 2 } }));
+
+    // Covers a range completely and truncates the next one
+    ASSERT_EQ(Insert(&map, 5, 36, 4), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetRanges(&map), (std::vector<Range>{ { 5, 36, 4 }, { 36, 40, 2 } }));
+
+    // Splits a range
+    ASSERT_EQ(Insert(&map, 20, 25, 5), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetRanges(&map), (std::vector<Range>{ { 5, 20, 4 }, { 20, 25, 5 }, { 25, 36, 4 },
+        { 36, 40, 2 } }));
+
+    // Exactly replaces a range
+    ASSERT_EQ(Insert(&map, 20, 25, 6), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetRanges(&map), (std::vector<Range>{ { 5, 20, 4 }, { 20, 25, 6 }, { 25, 36, 4 },
+        { 36, 40, 2 } }));
+
+    EXPECT_EQ(Insert(&map, 10, 10, 1), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(Insert(&map, 10, 9, 1), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    EXPECT_EQ(ZyanIntervalMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(IntervalMapTest, Coalescing)
+{
+    ZyanIntervalMap map;
+    ASSERT_EQ(ZyanIntervalMapInit(&map, sizeof(ZyanU32), nullptr), ZYAN_STATUS_SUCCESS);
+
+    ASSERT_EQ(Insert(&map, 0, 10, 1), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(Insert(&map, 10, 20, 1), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetRanges(&map), (std::vector<Range>{ { 0, 20, 1 } }));
+
+    ASSERT_EQ(Insert(&map, 30, 40, 1), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(Insert(&map, 20, 30, 2), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetRanges(&map), (std::vector<Range>{ { 0, 20, 1 }, { 20, 30, 2 },
+        { 30, 40, 1 } }));
+
+    // Bridging the gap merges all three ranges
+    ASSERT_EQ(Insert(&map, 20, 30, 1), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetRanges(&map), (std::vector<Range>{ { 0, 40, 1 } }));
+
+    // Inserting an equal value inside an existing range is a no-op
+    ASSERT_EQ(Insert(&map, 5, 8, 1), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetRanges(&map), (std::vector<Range>{ { 0, 40, 1 } }));
+
+    // Merges with the truncated remainder of an overlapping range
+    ASSERT_EQ(Insert(&map, 50, 60, 3), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(Insert(&map, 35, 55, 3), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetRanges(&map), (std::vector<Range>{ { 0, 35, 1 }, { 35, 60, 3 } }));
+
+    // Ranges that are not adjacent are never merged
+    ASSERT_EQ(Insert(&map, 61, 70, 3), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetRanges(&map), (std::vector<Range>{ { 0, 35, 1 }, { 35, 60, 3 },
+        { 61, 70, 3 } }));
+
+    EXPECT_EQ(ZyanIntervalMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(IntervalMapTest, RemoveSplits)
+{
+    ZyanIntervalMap map;
+    ASSERT_EQ(ZyanIntervalMapInit(&map, sizeof(ZyanU32), nullptr), ZYAN_STATUS_SUCCESS);
+
+    ASSERT_EQ(Insert(&map, 0, 100, 1), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanIntervalMapRemove(&map, 40, 60), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(GetRanges(&map), (std::vector<Range>{ { 0, 40, 1 }, { 60, 100, 1 } }));
+    EXPECT_EQ(ZyanIntervalMapRemove(&map, 40, 60), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(ZyanIntervalMapRemove(&map, 100, 200), ZYAN_STATUS_FALSE);
+
+    // Truncates both sides and removes everything in between
+    ASSERT_EQ(Insert(&map, 45, 50, 2), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanIntervalMapRemove(&map, 30, 70), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(GetRanges(&map), (std::vector<Range>{ { 0, 30, 1 }, { 70, 100, 1 } }));
+
+    ASSERT_EQ(ZyanIntervalMapRemove(&map, 0, 1), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(ZyanIntervalMapRemove(&map, 99, 100), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(GetRanges(&map), (std::vector<Range>{ { 1, 30, 1 }, { 70, 99, 1 } }));
+
+    EXPECT_EQ(ZyanIntervalMapRemove(&map, 5, 5), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    ASSERT_EQ(ZyanIntervalMapRemove(&map, 0, ~0ULL), ZYAN_STATUS_TRUE);
+    EXPECT_TRUE(GetRanges(&map).empty());
+
+    EXPECT_EQ(ZyanIntervalMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(IntervalMapTest, PointQueries)
+{
+    ZyanIntervalMap map;
+    ASSERT_EQ(ZyanIntervalMapInit(&map, sizeof(ZyanU32), nullptr), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(GetValue(&map, 0), ~0u);
+
+    ASSERT_EQ(Insert(&map, 0, 1, 1), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(Insert(&map, 10, 20, 2), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(Insert(&map, 20, 30, 3), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(Insert(&map, ~0ULL - 1, ~0ULL, 4), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(GetValue(&map, 0), 1u);
+    EXPECT_EQ(GetValue(&map, 1), ~0u);
+    EXPECT_EQ(GetValue(&map, 9), ~0u);
+    EXPECT_EQ(GetValue(&map, 10), 2u);
+    EXPECT_EQ(GetValue(&map, 19), 2u);
+    EXPECT_EQ(GetValue(&map, 20), 3u);
+    EXPECT_EQ(GetValue(&map, 29), 3u);
+    EXPECT_EQ(GetValue(&map, 30), ~0u);
+    EXPECT_EQ(GetValue(&map, ~0ULL - 2), ~0u);
+    EXPECT_EQ(GetValue(&map, ~0ULL - 1), 4u);
+    EXPECT_EQ(GetValue(&map, ~0ULL), ~0u);
+
+    ZyanUSize index;
+    ASSERT_EQ(ZyanIntervalMapFind(&map, 20, &index), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(index, 2u);
+    EXPECT_EQ(ZyanIntervalMapFind(&map, 5, &index), ZYAN_STATUS_FALSE);
+
+    ZyanUSize count;
+    ASSERT_EQ(ZyanIntervalMapFindOverlapping(&map, 1, 11, &index, &count), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(index, 1u);
+    EXPECT_EQ(count, 1u);
+    ASSERT_EQ(ZyanIntervalMapFindOverlapping(&map, 0, 21, &index, &count), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(index, 0u);
+    EXPECT_EQ(count, 3u);
+    EXPECT_EQ(ZyanIntervalMapFindOverlapping(&map, 1, 10, &index, &count), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(ZyanIntervalMapFindOverlapping(&map, 30, 100, &index, &count), ZYAN_STATUS_FALSE);
+
+    EXPECT_EQ(ZyanIntervalMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(IntervalMapTest, Randomized)
+{
+    ZyanIntervalMap map;
+    ASSERT_EQ(ZyanIntervalMapInit(&map, sizeof(ZyanU32), nullptr), ZYAN_STATUS_SUCCESS);
+
+    // Reference model with one (optional) value per address
+    constexpr ZyanU64 SIZE = 256;
+    std::vector<ZyanU32> model(SIZE + 32, ~0u);
+
+    ZyanU64 state = 7;
+    for (int i = 0; i < 2000; ++i)
+    {
+        const ZyanU64 random = NextRandom(state);
+        const ZyanU64 start = (random >> 24) % SIZE;
+        const ZyanU64 end = start + 1 + (random >> 40) % 32;
+        const ZyanU32 value = static_cast<ZyanU32>((random >> 56) % 3);
+        if ((random >> 20) & 3)
+        {
+            ASSERT_EQ(Insert(&map, start, end, value), ZYAN_STATUS_SUCCESS);
+            for (ZyanU64 a = start; a < end; ++a)
+            {
+                model[a] = value;
+            }
+        } else
+        {
+            ZyanBool removed = ZYAN_FALSE;
+            for (ZyanU64 a = start; a < end; ++a)
+            {
+                removed |= (model[a] != ~0u);
+                model[a] = ~0u;
+            }
+            ASSERT_EQ(ZyanIntervalMapRemove(&map, start, end),
+                removed ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+        }
+
+        // The map has to hold the canonical (fully coalesced) representation of the model
+        std::vector<Range> expected;
+        for (ZyanU64 a = 0; a < model.size(); ++a)
+        {
+            const ZyanU32 v = model[a];
+            ASSERT_EQ(GetValue(&map, a), v);
+            if (v == ~0u)
+            {
+                continue;
+            }
+            if (!expected.empty() && (std::get<1>(expected.back()) == a) &&
+                (std::get<2>(expected.back()) == v))
+            {
+                ++std::get<1>(expected.back());
+            } else
+            {
+                expected.emplace_back(a, a + 1, v);
+            }
+        }
+        ASSERT_EQ(GetRanges(&map), expected);
+    }
+
+    ASSERT_EQ(ZyanIntervalMapClear(&map), ZYAN_STATUS_SUCCESS);
+    EXPECT_TRUE(GetRanges(&map).empty());
+
+    EXPECT_EQ(ZyanIntervalMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(IntervalMapTest, Set)
+{
+    ZyanIntervalMap set;
+    ASSERT_EQ(ZyanIntervalMapInit(&set, 0, nullptr), ZYAN_STATUS_SUCCESS);
+
+    ASSERT_EQ(ZyanIntervalMapInsert(&set, 0, 10, nullptr), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanIntervalMapInsert(&set, 10, 20, nullptr), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanIntervalMapInsert(&set, 30, 40, nullptr), ZYAN_STATUS_SUCCESS);
+    ZyanUSize size;
+    ASSERT_EQ(ZyanIntervalMapGetSize(&set, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 2u);
+
+    ASSERT_EQ(ZyanIntervalMapRemove(&set, 5, 6), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(ZyanIntervalMapGetSize(&set, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 3u);
+
+    ZyanU64 start;
+    ZyanU64 end;
+    ASSERT_EQ(ZyanIntervalMapGetEntry(&set, 1, &start, &end, nullptr), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(start, 6u);
+    EXPECT_EQ(end, 20u);
+
+    EXPECT_EQ(ZyanIntervalMapDestroy(&set), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,243 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanPackedVector` implementation.
+ */
+
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/PackedVector.h>
+#include "Helpers.h"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns the mask of a `width` bit element.
+ */
+static ZyanU64 Mask(ZyanU8 width)
+{
+    return (width == 64) ? ~0ULL : ((1ULL << width) - 1);
+}
+
+/**
+ * @brief   Compares the contents of the packed vector to the reference values.
+ */
+static void ExpectEqual(const ZyanPackedVector* vector, const std::vector<ZyanU64>& reference)
+{
+    ZyanUSize size;
+    ASSERT_EQ(ZyanPackedVectorGetSize(vector, &size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(size, reference.size());
+    for (ZyanUSize i = 0; i < size; ++i)
+    {
+        ZyanU64 value;
+        ASSERT_EQ(ZyanPackedVectorGet(vector, i, &value), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(value, reference[i]) << "index " << i;
+    }
+    ZyanU64 value;
+    EXPECT_EQ(ZyanPackedVectorGet(vector, size, &value), ZYAN_STATUS_OUT_OF_RANGE);
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+class PackedVectorWidthTest : public ::testing::TestWithParam<ZyanU8>
+{
+};
+
+TEST_P(PackedVectorWidthTest, RoundTrip)
+{
+    const ZyanU8 width = GetParam();
+    ZyanPackedVector vector;
+    ASSERT_EQ(ZyanPackedVectorInit(&vector, width), ZYAN_STATUS_SUCCESS);
+
+    // 200 elements cover every possible bit offset inside a word for all tested widths
+    std::vector<ZyanU64> reference;
+    ZyanU64 state = width;
+    for (ZyanUSize i = 0; i < 200; ++i)
+    {
+        reference.push_back(NextRandom(state) & Mask(width));
+        ASSERT_EQ(ZyanPackedVectorPushBack(&vector, reference.back()), ZYAN_STATUS_SUCCESS);
+    }
+    ExpectEqual(&vector, reference);
+
+    // Writing all-ones and all-zeros must not leak into the neighbouring elements
+    for (ZyanUSize i = 0; i < reference.size(); i += 3)
+    {
+        reference[i] = (i % 2) ? Mask(width) : 0;
+        ASSERT_EQ(ZyanPackedVectorSet(&vector, i, reference[i]), ZYAN_STATUS_SUCCESS);
+    }
+    for (ZyanUSize i = 0; i < 1000; ++i)
+    {
+        const ZyanUSize index = NextRandom(state) % reference.size();
+        reference[index] = NextRandom(state) & Mask(width);
+        ASSERT_EQ(ZyanPackedVectorSet(&vector, index, reference[index]), ZYAN_STATUS_SUCCESS);
+    }
+    ExpectEqual(&vector, reference);
+    EXPECT_EQ(ZyanPackedVectorSet(&vector, reference.size(), 0), ZYAN_STATUS_OUT_OF_RANGE);
+
+    ZyanU8 current;
+    ASSERT_EQ(ZyanPackedVectorGetWidth(&vector, &current), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(current, width);
+
+    // Bulk unpacking from every start offset of the first word
+    for (ZyanUSize index = 0; index < 70; ++index)
+    {
+        const ZyanUSize count = reference.size() - index;
+        std::vector<ZyanU64> buffer(count);
+        ASSERT_EQ(ZyanPackedVectorUnpack(&vector, index, count, buffer.data()),
+            ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(buffer, std::vector<ZyanU64>(reference.begin() + index, reference.end()));
+
+        std::vector<ZyanU32> buffer32(count);
+        const ZyanStatus status =
+            ZyanPackedVectorUnpack32(&vector, index, count, buffer32.data());
+        if (width > 32)
+        {
+            EXPECT_EQ(status, ZYAN_STATUS_INVALID_OPERATION);
+            continue;
+        }
+        ASSERT_EQ(status, ZYAN_STATUS_SUCCESS);
+        for (ZyanUSize i = 0; i < count; ++i)
+        {
+            ASSERT_EQ(buffer32[i], reference[index + i]);
+        }
+    }
+    ZyanU64 dummy;
+    EXPECT_EQ(ZyanPackedVectorUnpack(&vector, 1, reference.size(), &dummy),
+        ZYAN_STATUS_OUT_OF_RANGE);
+
+    EXPECT_EQ(ZyanPackedVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST_P(PackedVectorWidthTest, Resize)
+{
+    const ZyanU8 width = GetParam();
+    ZyanPackedVector vector;
+    ASSERT_EQ(ZyanPackedVectorInit(&vector, width), ZYAN_STATUS_SUCCESS);
+
+    // Growing initializes the new elements with `0`
+    std::vector<ZyanU64> reference(67, 0);
+    ASSERT_EQ(ZyanPackedVectorResize(&vector, reference.size()), ZYAN_STATUS_SUCCESS);
+    ExpectEqual(&vector, reference);
+    for (ZyanUSize i = 0; i < reference.size(); ++i)
+    {
+        reference[i] = Mask(width) - (i & 1);
+        ASSERT_EQ(ZyanPackedVectorSet(&vector, i, reference[i]), ZYAN_STATUS_SUCCESS);
+    }
+    ExpectEqual(&vector, reference);
+
+    // Shrinking to every size and growing again must expose cleared elements only, including
+    // elements that used to straddle a word boundary
+    ZyanU64 state = width;
+    for (ZyanUSize size = reference.size(); size-- > 0; )
+    {
+        ASSERT_EQ(ZyanPackedVectorResize(&vector, size), ZYAN_STATUS_SUCCESS);
+        reference.resize(size);
+        ExpectEqual(&vector, reference);
+
+        const ZyanUSize grown = size + 1 + NextRandom(state) % 5;
+        ASSERT_EQ(ZyanPackedVectorResize(&vector, grown), ZYAN_STATUS_SUCCESS);
+        reference.resize(grown, 0);
+        ExpectEqual(&vector, reference);
+
+        ASSERT_EQ(ZyanPackedVectorResize(&vector, size), ZYAN_STATUS_SUCCESS);
+        reference.resize(size);
+    }
+
+    ASSERT_EQ(ZyanPackedVectorPushBack(&vector, Mask(width)), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanPackedVectorPopBack(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanPackedVectorPopBack(&vector), ZYAN_STATUS_OUT_OF_RANGE);
+    ASSERT_EQ(ZyanPackedVectorResize(&vector, 3), ZYAN_STATUS_SUCCESS);
+    ExpectEqual(&vector, { 0, 0, 0 });
+    ASSERT_EQ(ZyanPackedVectorClear(&vector), ZYAN_STATUS_SUCCESS);
+    ExpectEqual(&vector, { });
+
+    EXPECT_EQ(ZyanPackedVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(Widths, PackedVectorWidthTest,
+    ::testing::Values<ZyanU8>(1, 7, 8, 13, 16, 31, 32, 33, 63, 64));
+
+TEST(PackedVectorTest, Widen)
+{
+    ZyanPackedVector vector;
+    ASSERT_EQ(ZyanPackedVectorInit(&vector, 7), ZYAN_STATUS_SUCCESS);
+
+    std::vector<ZyanU64> reference;
+    for (ZyanU64 i = 0; i < 100; ++i)
+    {
+        reference.push_back((i * 37) & 0x7F);
+        ASSERT_EQ(ZyanPackedVectorPushBack(&vector, reference.back()), ZYAN_STATUS_SUCCESS);
+    }
+
+    // Values that do not fit the current width repack all elements
+    const std::pair<ZyanU64, ZyanU8> steps[] =
+    {
+        { 0x1FFF, 13 }, { 0x1000, 13 }, { 0x4000000000000000, 63 }, { ~0ULL, 64 }
+    };
+    ZyanUSize index = 0;
+    for (const auto& step : steps)
+    {
+        reference[index] = step.first;
+        ASSERT_EQ(ZyanPackedVectorSet(&vector, index, step.first), ZYAN_STATUS_SUCCESS);
+        ZyanU8 width;
+        ASSERT_EQ(ZyanPackedVectorGetWidth(&vector, &width), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(width, step.second);
+        ExpectEqual(&vector, reference);
+        index += 33;
+    }
+
+    // Narrower widths are ignored
+    ASSERT_EQ(ZyanPackedVectorWiden(&vector, 13), ZYAN_STATUS_SUCCESS);
+    ZyanU8 width;
+    ASSERT_EQ(ZyanPackedVectorGetWidth(&vector, &width), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(width, 64);
+    EXPECT_EQ(ZyanPackedVectorWiden(&vector, 65), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    EXPECT_EQ(ZyanPackedVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanPackedVectorInit(&vector, 0), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanPackedVectorInit(&vector, 65), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
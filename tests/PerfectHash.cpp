@@ -0,0 +1,234 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanPerfectHash` implementation.
+ */
+
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/Hash.h>
+#include <Zycore/LibC.h>
+#include <Zycore/PerfectHash.h>
+#include "Helpers.h"
+
+/* ============================================================================================== */
+/* Generated code                                                                                 */
+/* ============================================================================================== */
+
+// Emitted by `ZyanPerfectHashEmit` for `KEYS` with the name `CKeywordLookup`
+#include "PerfectHashEmitted.inc"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   The key set of `PerfectHashEmitted.inc`.
+ */
+static const std::vector<std::string> KEYS =
+{
+    "auto", "break", "case", "char", "const", "continue", "default", "do", "double", "else",
+    "enum", "extern", "float", "for", "goto", "if", "inline", "int", "long", "register",
+    "restrict", "return", "short", "signed", "sizeof", "static", "struct", "switch", "typedef",
+    "union", "unsigned", "void", "volatile", "while", "_Alignas", "_Alignof", "_Atomic", "_Bool",
+    "_Complex", "_Generic", "_Imaginary", "_Noreturn", "_Static_assert", "_Thread_local",
+    "", "\"quoted\"", "back\\slash", "?\?=trigraph", "line\nbreak", "\x7F\xFF"
+};
+
+/**
+ * @brief   Strings that are not part of `KEYS`.
+ */
+static const std::vector<std::string> NON_KEYS =
+{
+    "Auto", "autox", "aut", "_bool", "while ", " while", "\"quoted", "line\rbreak", "x",
+    std::string("do\0", 3), std::string(1, '\0')
+};
+
+/**
+ * @brief   Returns string views for the given strings.
+ */
+static std::vector<ZyanStringView> MakeViews(const std::vector<std::string>& strings)
+{
+    std::vector<ZyanStringView> views;
+    for (const auto& string : strings)
+    {
+        views.push_back(MakeView(string));
+    }
+    return views;
+}
+
+/**
+ * @brief   Checks that the table maps every key to its own index and that every slot holds
+ *          exactly one key.
+ */
+static void CheckBijection(const ZyanPerfectHash* table, const std::vector<std::string>& keys)
+{
+    const auto views = MakeViews(keys);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        ZyanUSize index = ~static_cast<ZyanUSize>(0);
+        ASSERT_EQ(ZyanPerfectHashLookup(table, &views[i], &index), ZYAN_STATUS_TRUE) << i;
+        ASSERT_EQ(index, i);
+    }
+
+    ASSERT_EQ(table->key_count, keys.size());
+    std::set<ZyanU32> indices;
+    for (ZyanU32 i = 0; i < table->key_count; ++i)
+    {
+        const ZyanPerfectHashSlot* const slot = &table->slots[i];
+        ASSERT_LT(slot->index, keys.size());
+        EXPECT_EQ(std::string(table->strings + slot->offset, slot->length), keys[slot->index]);
+        EXPECT_TRUE(indices.insert(slot->index).second);
+    }
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(PerfectHashTest, Bijection)
+{
+    ZyanPerfectHash table;
+    const auto views = MakeViews(KEYS);
+    ASSERT_EQ(ZyanPerfectHashInit(&table, views.data(), views.size()), ZYAN_STATUS_SUCCESS);
+    CheckBijection(&table, KEYS);
+
+    for (const auto& view : MakeViews(NON_KEYS))
+    {
+        EXPECT_EQ(ZyanPerfectHashLookup(&table, &view, nullptr), ZYAN_STATUS_FALSE);
+    }
+
+    EXPECT_EQ(ZyanPerfectHashDestroy(&table), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(PerfectHashTest, LargeKeySet)
+{
+    std::vector<std::string> keys;
+    for (std::size_t i = 0; i < 10000; ++i)
+    {
+        keys.push_back("key_" + std::to_string(i * 7919));
+    }
+
+    ZyanPerfectHash table;
+    const auto views = MakeViews(keys);
+    ASSERT_EQ(ZyanPerfectHashInit(&table, views.data(), views.size()), ZYAN_STATUS_SUCCESS);
+    CheckBijection(&table, keys);
+
+    ZyanStringView view;
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&view, "key_1"), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanPerfectHashLookup(&table, &view, nullptr), ZYAN_STATUS_FALSE);
+
+    EXPECT_EQ(ZyanPerfectHashDestroy(&table), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(PerfectHashTest, DuplicateKeys)
+{
+    ZyanPerfectHash table;
+
+    const std::vector<std::string> pair = { "same", "same" };
+    auto views = MakeViews(pair);
+    EXPECT_EQ(ZyanPerfectHashInit(&table, views.data(), views.size()),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+
+    // A duplicate hidden in a larger set
+    std::vector<std::string> keys;
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        keys.push_back(std::to_string(i));
+    }
+    keys.push_back("500");
+    views = MakeViews(keys);
+    EXPECT_EQ(ZyanPerfectHashInit(&table, views.data(), views.size()),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+
+    EXPECT_EQ(ZyanPerfectHashInit(&table, views.data(), 0), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST(PerfectHashTest, EmittedCode)
+{
+    ZyanPerfectHash table;
+    const auto views = MakeViews(KEYS);
+    ASSERT_EQ(ZyanPerfectHashInit(&table, views.data(), views.size()), ZYAN_STATUS_SUCCESS);
+
+    // The compiled code has to behave exactly like the runtime lookup
+    for (const auto* set : { &KEYS, &NON_KEYS })
+    {
+        for (const auto& key : *set)
+        {
+            const ZyanStringView view = MakeView(key);
+            ZyanUSize expected = 0;
+            const ZyanStatus status = ZyanPerfectHashLookup(&table, &view, &expected);
+            ZyanU32 index = 0;
+            ASSERT_EQ(CKeywordLookup(key.data(), key.size(), &index),
+                status == ZYAN_STATUS_TRUE);
+            if (status == ZYAN_STATUS_TRUE)
+            {
+                EXPECT_EQ(index, expected);
+            }
+        }
+    }
+
+    // The compiled code must be identical to the current output of the generator
+    ZyanString output;
+    ASSERT_EQ(ZyanStringInit(&output, 0), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanPerfectHashEmit(&table, &output, "CKeywordLookup"), ZYAN_STATUS_SUCCESS);
+    const char* code;
+    ASSERT_EQ(ZyanStringGetData(&output, &code), ZYAN_STATUS_SUCCESS);
+    const std::string emitted = code;
+    EXPECT_EQ(ZyanStringDestroy(&output), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanPerfectHashDestroy(&table), ZYAN_STATUS_SUCCESS);
+
+    std::string path = __FILE__;
+    path = path.substr(0, path.find_last_of("/\\") + 1) + "PerfectHashEmitted.inc";
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        GTEST_SKIP() << "Could not open " << path;
+    }
+    std::stringstream expected;
+    expected << file.rdbuf();
+    EXPECT_EQ(emitted, expected.str()) << "PerfectHashEmitted.inc is outdated";
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
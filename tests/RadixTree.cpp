@@ -0,0 +1,349 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanRadixTree` implementation.
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/RadixTree.h>
+#include "Helpers.h"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Mirrors the internal node types, which are stored in the first byte of every node.
+ */
+enum NodeType : ZyanU8
+{
+    NODE_LEAF,
+    NODE_4,
+    NODE_16,
+    NODE_48,
+    NODE_256
+};
+
+static NodeType GetRootType(const ZyanRadixTree* tree)
+{
+    return static_cast<NodeType>(*static_cast<const ZyanU8*>(tree->root));
+}
+
+static ZyanStatus Insert(ZyanRadixTree* tree, const std::string& key, ZyanU32 value)
+{
+    const ZyanStringView view = MakeView(key);
+    return ZyanRadixTreeInsert(tree, &view, &value);
+}
+
+static ZyanStatus Remove(ZyanRadixTree* tree, const std::string& key)
+{
+    const ZyanStringView view = MakeView(key);
+    return ZyanRadixTreeRemove(tree, &view);
+}
+
+/**
+ * @brief   Returns the value of the given key or `~0`, if the key does not exist.
+ */
+static ZyanU32 Get(const ZyanRadixTree* tree, const std::string& key)
+{
+    const ZyanStringView view = MakeView(key);
+    const void* value;
+    const ZyanStatus status = ZyanRadixTreeGet(tree, &view, &value);
+    if (status != ZYAN_STATUS_TRUE)
+    {
+        EXPECT_EQ(status, ZYAN_STATUS_FALSE);
+        return ~0u;
+    }
+    return *static_cast<const ZyanU32*>(value);
+}
+
+static ZyanStatus CollectEntry(const char* key, ZyanUSize length, void* value, void* user_data)
+{
+    static_cast<std::vector<std::pair<std::string, ZyanU32>>*>(user_data)->emplace_back(
+        std::string(key, length), *static_cast<const ZyanU32*>(value));
+    return ZYAN_STATUS_TRUE;
+}
+
+/**
+ * @brief   Returns all entries that start with the given prefix in iteration order.
+ */
+static std::vector<std::pair<std::string, ZyanU32>> Collect(const ZyanRadixTree* tree,
+    const std::string& prefix = "")
+{
+    std::vector<std::pair<std::string, ZyanU32>> entries;
+    const ZyanStringView view = MakeView(prefix);
+    EXPECT_EQ(ZyanRadixTreeForEachPrefix(tree, &view, &CollectEntry, &entries),
+        ZYAN_STATUS_TRUE);
+    return entries;
+}
+
+/**
+ * @brief   Checks that the tree contains exactly the entries of the given map, in order.
+ */
+static void ExpectEntries(const ZyanRadixTree* tree, const std::map<std::string, ZyanU32>& map)
+{
+    ZyanUSize size;
+    ASSERT_EQ(ZyanRadixTreeGetSize(tree, &size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(size, map.size());
+    for (const auto& entry : map)
+    {
+        ASSERT_EQ(Get(tree, entry.first), entry.second);
+    }
+    EXPECT_EQ(Collect(tree), (std::vector<std::pair<std::string, ZyanU32>>(map.begin(),
+        map.end())));
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(RadixTreeTest, NodeTransitions)
+{
+    ZyanRadixTree tree;
+    ASSERT_EQ(ZyanRadixTreeInit(&tree, sizeof(ZyanU32)), ZYAN_STATUS_SUCCESS);
+
+    // All keys branch at the same node, including the `\0` byte
+    const std::string prefix = "common";
+    std::map<std::string, ZyanU32> map;
+    for (ZyanU32 i = 0; i < 256; ++i)
+    {
+        const std::string key = prefix + static_cast<char>((i * 37) & 0xFF);
+        ASSERT_EQ(Insert(&tree, key, i), ZYAN_STATUS_TRUE);
+        map[key] = i;
+
+        const ZyanUSize count = i + 1;
+        EXPECT_EQ(GetRootType(&tree), (count == 1) ? NODE_LEAF : (count <= 4) ? NODE_4 :
+            (count <= 16) ? NODE_16 : (count <= 48) ? NODE_48 : NODE_256) << count;
+        if ((count <= 5) || (count == 16) || (count == 17) || (count == 48) || (count == 49))
+        {
+            ExpectEntries(&tree, map);
+        }
+    }
+    ExpectEntries(&tree, map);
+
+    // Nodes shrink with some hysteresis
+    for (ZyanU32 i = 0; i < 256; ++i)
+    {
+        const std::string key = prefix + static_cast<char>((i * 37) & 0xFF);
+        ASSERT_EQ(Remove(&tree, key), ZYAN_STATUS_TRUE);
+        ASSERT_EQ(Remove(&tree, key), ZYAN_STATUS_FALSE);
+        map.erase(key);
+
+        const ZyanUSize count = 255 - i;
+        if (!count)
+        {
+            EXPECT_EQ(tree.root, nullptr);
+            break;
+        }
+        EXPECT_EQ(GetRootType(&tree), (count == 1) ? NODE_LEAF : (count <= 3) ? NODE_4 :
+            (count <= 12) ? NODE_16 : (count <= 37) ? NODE_48 : NODE_256) << count;
+        if ((count <= 4) || (count == 12) || (count == 13) || (count == 37) || (count == 38))
+        {
+            ExpectEntries(&tree, map);
+        }
+    }
+    ExpectEntries(&tree, map);
+
+    EXPECT_EQ(ZyanRadixTreeDestroy(&tree), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(RadixTreeTest, LongPrefixes)
+{
+    ZyanRadixTree tree;
+    ASSERT_EQ(ZyanRadixTreeInit(&tree, sizeof(ZyanU32)), ZYAN_STATUS_SUCCESS);
+    std::map<std::string, ZyanU32> map;
+
+    // The compressed prefix (20 bytes) exceeds the bytes stored inside the node
+    const std::string base(20, 'x');
+    for (const auto& key : { base + "1", base + "2", base + "3" })
+    {
+        ASSERT_EQ(Insert(&tree, key, static_cast<ZyanU32>(map.size())), ZYAN_STATUS_TRUE);
+        map[key] = static_cast<ZyanU32>(map.size());
+    }
+    ASSERT_EQ(GetRootType(&tree), NODE_4);
+    ExpectEntries(&tree, map);
+
+    // Mismatches before, at and after the stored part of the prefix
+    for (std::size_t split : { 3u, 8u, 12u, 19u })
+    {
+        std::string key = base.substr(0, split) + "y" + base.substr(split);
+        ASSERT_EQ(Insert(&tree, key, 100 + static_cast<ZyanU32>(split)), ZYAN_STATUS_TRUE);
+        map[key] = 100 + static_cast<ZyanU32>(split);
+        ExpectEntries(&tree, map);
+        EXPECT_EQ(Get(&tree, base.substr(0, split) + "z" + base.substr(split)), ~0u);
+    }
+    EXPECT_EQ(Get(&tree, base), ~0u);
+    EXPECT_EQ(Get(&tree, base + "4"), ~0u);
+    EXPECT_EQ(Get(&tree, std::string(19, 'x') + "y1"), ~0u);
+
+    // Removing the branches merges the prefixes again
+    for (std::size_t split : { 12u, 3u, 19u, 8u })
+    {
+        const std::string key = base.substr(0, split) + "y" + base.substr(split);
+        ASSERT_EQ(Remove(&tree, key), ZYAN_STATUS_TRUE);
+        map.erase(key);
+        ExpectEntries(&tree, map);
+    }
+    ASSERT_EQ(Insert(&tree, base.substr(0, 10) + "y", 7), ZYAN_STATUS_TRUE);
+    map[base.substr(0, 10) + "y"] = 7;
+    ExpectEntries(&tree, map);
+
+    EXPECT_EQ(ZyanRadixTreeDestroy(&tree), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(RadixTreeTest, PrefixKeys)
+{
+    ZyanRadixTree tree;
+    ASSERT_EQ(ZyanRadixTreeInit(&tree, sizeof(ZyanU32)), ZYAN_STATUS_SUCCESS);
+    std::map<std::string, ZyanU32> map;
+
+    const std::vector<std::string> keys = { "abcdefghijklmnop", "abc", "", "ab", "abcdefghijk",
+        "a", "b" };
+    for (ZyanU32 i = 0; i < keys.size(); ++i)
+    {
+        ASSERT_EQ(Insert(&tree, keys[i], i), ZYAN_STATUS_TRUE);
+        map[keys[i]] = i;
+        ExpectEntries(&tree, map);
+    }
+    ASSERT_EQ(Insert(&tree, "", 42), ZYAN_STATUS_FALSE);
+    map[""] = 42;
+    ExpectEntries(&tree, map);
+
+    const auto find = [&](const std::string& string) -> std::string
+    {
+        const ZyanStringView view = MakeView(string);
+        ZyanUSize length;
+        const void* value;
+        EXPECT_EQ(ZyanRadixTreeFindLongestPrefix(&tree, &view, &length, &value),
+            ZYAN_STATUS_TRUE);
+        const std::string key = string.substr(0, length);
+        EXPECT_EQ(*static_cast<const ZyanU32*>(value), map[key]);
+        return key;
+    };
+    EXPECT_EQ(find("abcdX"), "abc");
+    EXPECT_EQ(find("abcdefghijkl"), "abcdefghijk");
+    EXPECT_EQ(find("abcdefghijklmnopq"), "abcdefghijklmnop");
+    EXPECT_EQ(find("ax"), "a");
+    EXPECT_EQ(find("c"), "");
+    EXPECT_EQ(find(""), "");
+
+    EXPECT_EQ(Collect(&tree, "abc"), (std::vector<std::pair<std::string, ZyanU32>>{
+        { "abc", 1 }, { "abcdefghijk", 4 }, { "abcdefghijklmnop", 0 } }));
+    EXPECT_EQ(Collect(&tree, "abcdefghijkl"), (std::vector<std::pair<std::string, ZyanU32>>{
+        { "abcdefghijklmnop", 0 } }));
+    EXPECT_TRUE(Collect(&tree, "abd").empty());
+
+    // Removing inner keys must keep the longer keys reachable
+    for (const auto& key : { "ab", "", "abcdefghijk", "abc" })
+    {
+        ASSERT_EQ(Remove(&tree, key), ZYAN_STATUS_TRUE);
+        map.erase(key);
+        ExpectEntries(&tree, map);
+    }
+    const std::string string = "abx";
+    const ZyanStringView view = MakeView(string);
+    ZyanUSize length;
+    ASSERT_EQ(ZyanRadixTreeFindLongestPrefix(&tree, &view, &length, nullptr), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(length, 1u);
+    const std::string other_string = "c";
+    const ZyanStringView other = MakeView(other_string);
+    EXPECT_EQ(ZyanRadixTreeFindLongestPrefix(&tree, &other, &length, nullptr), ZYAN_STATUS_FALSE);
+
+    EXPECT_EQ(ZyanRadixTreeDestroy(&tree), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(RadixTreeTest, OrderedIteration)
+{
+    ZyanRadixTree tree;
+    ASSERT_EQ(ZyanRadixTreeInit(&tree, sizeof(ZyanU32)), ZYAN_STATUS_SUCCESS);
+    std::map<std::string, ZyanU32> map;
+
+    // Bytes above `0x7F` must be ordered as unsigned values
+    ZyanU64 state = 1;
+    for (ZyanU32 i = 0; i < 5000; ++i)
+    {
+        const ZyanU64 random = NextRandom(state);
+        std::string key;
+        for (ZyanU64 length = (random >> 60) + 1, bits = random; length; --length, bits >>= 7)
+        {
+            key += "\0\x01" "ab\x7F\x80\xFF"[bits % 7];
+        }
+        const auto inserted = map.emplace(key, i).second;
+        ASSERT_EQ(Insert(&tree, key, i), inserted ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+        map[key] = i;
+    }
+    ExpectEntries(&tree, map);
+
+    // Random removals
+    for (auto it = map.begin(); it != map.end();)
+    {
+        if (std::hash<std::string>()(it->first) & 1)
+        {
+            ASSERT_EQ(Remove(&tree, it->first), ZYAN_STATUS_TRUE);
+            it = map.erase(it);
+        } else
+        {
+            ++it;
+        }
+    }
+    ExpectEntries(&tree, map);
+
+    // The callback can stop the iteration
+    ZyanUSize visited = 0;
+    const std::string empty_string;
+    const ZyanStringView empty = MakeView(empty_string);
+    EXPECT_EQ(ZyanRadixTreeForEachPrefix(&tree, &empty,
+        [](const char*, ZyanUSize, void*, void* user_data) -> ZyanStatus
+        {
+            return (++*static_cast<ZyanUSize*>(user_data) < 10) ? ZYAN_STATUS_TRUE :
+                ZYAN_STATUS_FALSE;
+        }, &visited), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(visited, 10u);
+
+    ASSERT_EQ(ZyanRadixTreeClear(&tree), ZYAN_STATUS_SUCCESS);
+    ExpectEntries(&tree, {});
+
+    EXPECT_EQ(ZyanRadixTreeDestroy(&tree), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,310 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanRoaringBitmap` implementation.
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/RoaringBitmap.h>
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Checks that the given bitmap exactly matches the given reference set.
+ */
+static void ExpectEqual(const ZyanRoaringBitmap* bitmap, const std::set<ZyanU32>& reference)
+{
+    ZyanU64 cardinality;
+    ASSERT_EQ(ZyanRoaringBitmapGetCardinality(bitmap, &cardinality), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(cardinality, reference.size());
+
+    ZyanVector values;
+    ASSERT_EQ(ZyanVectorInit(&values, sizeof(ZyanU32), 0, nullptr), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanRoaringBitmapExportValues(bitmap, &values), ZYAN_STATUS_SUCCESS);
+    const auto* data = static_cast<const ZyanU32*>(values.data);
+    EXPECT_TRUE(std::equal(reference.begin(), reference.end(), data, data + values.size));
+    EXPECT_EQ(ZyanVectorDestroy(&values), ZYAN_STATUS_SUCCESS);
+
+    for (ZyanU32 value : reference)
+    {
+        ASSERT_EQ(ZyanRoaringBitmapContains(bitmap, value), ZYAN_STATUS_TRUE) << value;
+    }
+}
+
+/**
+ * @brief   Generates values that are dense in some chunks and sparse in others.
+ */
+static std::set<ZyanU32> RandomValues(std::mt19937& random)
+{
+    std::set<ZyanU32> values;
+    for (ZyanU32 chunk = 0; chunk < 8; ++chunk)
+    {
+        const ZyanU32 base = (random() % 8) * 0x10000 + ((chunk & 1) ? 0xFFF00000 : 0);
+        const ZyanU32 count = (random() % 3 == 0) ? 20000 : (random() % 100);
+        for (ZyanU32 i = 0; i < count; ++i)
+        {
+            values.insert(base + (random() & 0xFFFF));
+        }
+        if (random() & 1)
+        {
+            const ZyanU32 first = base + (random() & 0x7FFF);
+            for (ZyanU32 i = 0; i < 3000; ++i)
+            {
+                values.insert(first + i);
+            }
+        }
+    }
+    return values;
+}
+
+/**
+ * @brief   Initializes the given bitmap with the values of the given reference set.
+ */
+static void InitFrom(ZyanRoaringBitmap* bitmap, const std::set<ZyanU32>& reference)
+{
+    ASSERT_EQ(ZyanRoaringBitmapInit(bitmap), ZYAN_STATUS_SUCCESS);
+    for (ZyanU32 value : reference)
+    {
+        ASSERT_EQ(ZyanRoaringBitmapAdd(bitmap, value), ZYAN_STATUS_TRUE);
+    }
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(RoaringBitmapTest, InsertRemove)
+{
+    std::mt19937 random(46);
+    ZyanRoaringBitmap bitmap;
+    ASSERT_EQ(ZyanRoaringBitmapInit(&bitmap), ZYAN_STATUS_SUCCESS);
+
+    // Crosses the array/bitmap threshold of a single chunk in both directions
+    std::set<ZyanU32> reference;
+    for (ZyanU32 i = 0; i < 20000; ++i)
+    {
+        const ZyanU32 value = 0x30000 + (random() % 10000);
+        EXPECT_EQ(ZyanRoaringBitmapAdd(&bitmap, value),
+            reference.insert(value).second ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+    }
+    ExpectEqual(&bitmap, reference);
+    for (ZyanU32 i = 0; i < 20000; ++i)
+    {
+        const ZyanU32 value = 0x30000 + (random() % 10000);
+        EXPECT_EQ(ZyanRoaringBitmapRemove(&bitmap, value),
+            reference.erase(value) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+    }
+    ExpectEqual(&bitmap, reference);
+    EXPECT_EQ(ZyanRoaringBitmapContains(&bitmap, 0xFFFFFFFF), ZYAN_STATUS_FALSE);
+
+    // Removing every value releases all containers
+    for (ZyanU32 value : reference)
+    {
+        ASSERT_EQ(ZyanRoaringBitmapRemove(&bitmap, value), ZYAN_STATUS_TRUE);
+    }
+    ExpectEqual(&bitmap, {});
+
+    EXPECT_EQ(ZyanRoaringBitmapDestroy(&bitmap), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(RoaringBitmapTest, Runs)
+{
+    ZyanRoaringBitmap bitmap;
+    ASSERT_EQ(ZyanRoaringBitmapInit(&bitmap), ZYAN_STATUS_SUCCESS);
+
+    std::set<ZyanU32> reference;
+    ASSERT_EQ(ZyanRoaringBitmapAddRange(&bitmap, 0xFFF0, 0x2FFFF), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanRoaringBitmapAddRange(&bitmap, 0xFFFFFF00, 0xFFFFFFFF), ZYAN_STATUS_SUCCESS);
+    for (ZyanU32 i = 0xFFF0; i <= 0x2FFFF; ++i)
+    {
+        reference.insert(i);
+    }
+    for (ZyanU32 i = 0xFFFFFF00; i != 0; ++i)
+    {
+        reference.insert(i);
+    }
+    ExpectEqual(&bitmap, reference);
+
+    // Two full chunks stored as runs take far less than two bitmaps
+    ZyanUSize size;
+    ASSERT_EQ(ZyanRoaringBitmapGetSizeBytes(&bitmap, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_LT(size, 1024u);
+
+    // Splitting, merging and shrinking runs
+    for (ZyanU32 value : { 0x10005u, 0x10006u, 0xFFF0u, 0x2FFFFu, 0x1FFFFu })
+    {
+        ASSERT_EQ(ZyanRoaringBitmapRemove(&bitmap, value), ZYAN_STATUS_TRUE);
+        reference.erase(value);
+    }
+    for (ZyanU32 value : { 0x10006u, 0x10005u, 0x1FFFFu, 0x5u })
+    {
+        ASSERT_EQ(ZyanRoaringBitmapAdd(&bitmap, value), ZYAN_STATUS_TRUE);
+        reference.insert(value);
+    }
+    EXPECT_EQ(ZyanRoaringBitmapAdd(&bitmap, 0x10006), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(ZyanRoaringBitmapRemove(&bitmap, 0xFFF0), ZYAN_STATUS_FALSE);
+    ExpectEqual(&bitmap, reference);
+
+    ASSERT_EQ(ZyanRoaringBitmapAddRange(&bitmap, 0x10, 0x20), ZYAN_STATUS_SUCCESS);
+    for (ZyanU32 i = 0x10; i <= 0x20; ++i)
+    {
+        reference.insert(i);
+    }
+    EXPECT_EQ(ZyanRoaringBitmapRunOptimize(&bitmap), ZYAN_STATUS_TRUE);
+    ExpectEqual(&bitmap, reference);
+
+    EXPECT_EQ(ZyanRoaringBitmapDestroy(&bitmap), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(RoaringBitmapTest, SetOperations)
+{
+    std::mt19937 random(47);
+    for (int iteration = 0; iteration < 4; ++iteration)
+    {
+        const auto a = RandomValues(random);
+        const auto b = RandomValues(random);
+
+        for (int operation = 0; operation < 4; ++operation)
+        {
+            ZyanRoaringBitmap x, y;
+            InitFrom(&x, a);
+            InitFrom(&y, b);
+            if (iteration & 1)
+            {
+                ZyanRoaringBitmapRunOptimize(&x);
+                ZyanRoaringBitmapRunOptimize(&y);
+            }
+
+            std::set<ZyanU32> expected;
+            auto out = std::inserter(expected, expected.begin());
+            switch (operation)
+            {
+            case 0:
+                ASSERT_EQ(ZyanRoaringBitmapAND(&x, &y), ZYAN_STATUS_SUCCESS);
+                std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), out);
+                break;
+            case 1:
+                ASSERT_EQ(ZyanRoaringBitmapOR(&x, &y), ZYAN_STATUS_SUCCESS);
+                std::set_union(a.begin(), a.end(), b.begin(), b.end(), out);
+                break;
+            case 2:
+                ASSERT_EQ(ZyanRoaringBitmapXOR(&x, &y), ZYAN_STATUS_SUCCESS);
+                std::set_symmetric_difference(a.begin(), a.end(), b.begin(), b.end(), out);
+                break;
+            case 3:
+                ASSERT_EQ(ZyanRoaringBitmapANDNOT(&x, &y), ZYAN_STATUS_SUCCESS);
+                std::set_difference(a.begin(), a.end(), b.begin(), b.end(), out);
+                break;
+            }
+            ExpectEqual(&x, expected);
+            ExpectEqual(&y, b);
+
+            EXPECT_EQ(ZyanRoaringBitmapDestroy(&y), ZYAN_STATUS_SUCCESS);
+            EXPECT_EQ(ZyanRoaringBitmapDestroy(&x), ZYAN_STATUS_SUCCESS);
+        }
+    }
+}
+
+TEST(RoaringBitmapTest, Serialization)
+{
+    std::mt19937 random(48);
+    for (int iteration = 0; iteration < 6; ++iteration)
+    {
+        const auto reference = RandomValues(random);
+        ZyanRoaringBitmap bitmap;
+        InitFrom(&bitmap, reference);
+        if (iteration & 1)
+        {
+            ZyanRoaringBitmapRunOptimize(&bitmap);
+        }
+
+        ZyanUSize size;
+        ASSERT_EQ(ZyanRoaringBitmapGetSerializedSize(&bitmap, &size), ZYAN_STATUS_SUCCESS);
+        std::vector<ZyanU8> buffer(size);
+        ZyanUSize written;
+        EXPECT_EQ(ZyanRoaringBitmapSerialize(&bitmap, buffer.data(), size - 1, &written),
+            ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+        ASSERT_EQ(ZyanRoaringBitmapSerialize(&bitmap, buffer.data(), size, &written),
+            ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(written, size);
+
+        ZyanRoaringBitmap copy;
+        ASSERT_EQ(ZyanRoaringBitmapInit(&copy), ZYAN_STATUS_SUCCESS);
+        ZyanUSize read;
+        ASSERT_EQ(ZyanRoaringBitmapDeserialize(&copy, buffer.data(), size, &read),
+            ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(read, size);
+        ExpectEqual(&copy, reference);
+
+        // Truncated data is rejected and leaves the bitmap empty
+        EXPECT_EQ(ZyanRoaringBitmapDeserialize(&copy, buffer.data(), size - 1, nullptr),
+            ZYAN_STATUS_INVALID_ARGUMENT);
+        ExpectEqual(&copy, {});
+
+        EXPECT_EQ(ZyanRoaringBitmapDestroy(&copy), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanRoaringBitmapDestroy(&bitmap), ZYAN_STATUS_SUCCESS);
+    }
+
+    // Reference data in the portable format: {1, 2, 3, 1000} in a single array container
+    const ZyanU8 serialized[] =
+    {
+        0x3A, 0x30, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+        0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0xE8, 0x03
+    };
+    ZyanRoaringBitmap bitmap;
+    ASSERT_EQ(ZyanRoaringBitmapInit(&bitmap), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanRoaringBitmapDeserialize(&bitmap, serialized, sizeof(serialized), nullptr),
+        ZYAN_STATUS_SUCCESS);
+    ExpectEqual(&bitmap, { 1, 2, 3, 1000 });
+    ZyanU8 buffer[sizeof(serialized)];
+    ZyanUSize written;
+    ASSERT_EQ(ZyanRoaringBitmapSerialize(&bitmap, buffer, sizeof(buffer), &written),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(written, sizeof(serialized));
+    EXPECT_TRUE(std::equal(buffer, buffer + sizeof(buffer), serialized));
+    EXPECT_EQ(ZyanRoaringBitmapDestroy(&bitmap), ZYAN_STATUS_SUCCESS);
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,232 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the set operations on sorted vectors.
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/SetOperations.h>
+#include "Helpers.h"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns `count` unique sorted elements.
+ *
+ * The elements are drawn from `[0, range)` and, if `high` is set, moved to the upper half of the
+ * value range to catch signed comparisons.
+ */
+template <typename T>
+static std::vector<T> MakeSet(std::size_t count, ZyanU64 range, ZyanU64 seed, bool high = false)
+{
+    std::set<T> set;
+    ZyanU64 state = seed;
+    while (set.size() < count)
+    {
+        T value = static_cast<T>(NextRandom(state) % range);
+        if (high)
+        {
+            value |= static_cast<T>(T(1) << (sizeof(T) * 8 - 1));
+        }
+        set.insert(value);
+    }
+    return std::vector<T>(set.begin(), set.end());
+}
+
+/**
+ * @brief   Wraps the given elements in a `ZyanVector` that references the data.
+ */
+template <typename T>
+static ZyanVector MakeVector(std::vector<T>& data)
+{
+    ZyanVector vector;
+    static T dummy;
+    EXPECT_EQ(ZyanVectorInitCustomBuffer(&vector, sizeof(T), data.empty() ? &dummy : data.data(),
+        std::max<std::size_t>(data.size(), 1), nullptr), ZYAN_STATUS_SUCCESS);
+    vector.size = data.size();
+    return vector;
+}
+
+template <typename T>
+static std::vector<T> GetElements(const ZyanVector* vector)
+{
+    const T* const data = static_cast<const T*>(vector->data);
+    return std::vector<T>(data, data + vector->size);
+}
+
+/**
+ * @brief   Compares all set operations on the given inputs with the standard library.
+ */
+template <typename T>
+static void CheckOperations(std::vector<T> a, std::vector<T> b)
+{
+    ZyanVector first = MakeVector(a);
+    ZyanVector second = MakeVector(b);
+    ZyanVector result;
+    ASSERT_EQ(ZyanVectorInit(&result, sizeof(T), 0, nullptr), ZYAN_STATUS_SUCCESS);
+
+    std::vector<T> expected;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    ASSERT_EQ(ZyanSetIntersection(&first, &second, &result), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetElements<T>(&result), expected) << a.size() << ", " << b.size();
+    ASSERT_EQ(ZyanSetIntersection(&second, &first, &result), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetElements<T>(&result), expected) << a.size() << ", " << b.size();
+
+    expected.clear();
+    std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    ASSERT_EQ(ZyanSetUnion(&first, &second, &result), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetElements<T>(&result), expected) << a.size() << ", " << b.size();
+    ASSERT_EQ(ZyanSetUnion(&second, &first, &result), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetElements<T>(&result), expected) << a.size() << ", " << b.size();
+
+    expected.clear();
+    std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    ASSERT_EQ(ZyanSetDifference(&first, &second, &result), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetElements<T>(&result), expected) << a.size() << ", " << b.size();
+    expected.clear();
+    std::set_difference(b.begin(), b.end(), a.begin(), a.end(), std::back_inserter(expected));
+    ASSERT_EQ(ZyanSetDifference(&second, &first, &result), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetElements<T>(&result), expected) << a.size() << ", " << b.size();
+
+    expected.clear();
+    std::merge(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    ASSERT_EQ(ZyanSetMerge(&first, &second, &result), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetElements<T>(&result), expected) << a.size() << ", " << b.size();
+
+    EXPECT_EQ(ZyanVectorDestroy(&result), ZYAN_STATUS_SUCCESS);
+}
+
+/**
+ * @brief   Runs `CheckOperations` for a range of sizes, densities and value ranges.
+ */
+template <typename T>
+static void CheckAll()
+{
+    const std::size_t sizes[] = { 0, 1, 3, 4, 5, 8, 15, 16, 17, 100, 1000, 5000 };
+    ZyanU64 seed = 1;
+    for (const std::size_t a : sizes)
+    {
+        for (const std::size_t b : sizes)
+        {
+            // Dense inputs overlap a lot, sparse inputs barely
+            for (const ZyanU64 range : { ZyanU64(2 * (a + b) + 1), ZyanU64(1000000) })
+            {
+                for (const bool high : { false, true })
+                {
+                    const auto first = MakeSet<T>(a, range, ++seed, high);
+                    const auto second = MakeSet<T>(b, range, ++seed, high);
+                    CheckOperations(first, second);
+                }
+            }
+        }
+    }
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(SetOperationsTest, Elements32)
+{
+    CheckAll<ZyanU32>();
+}
+
+TEST(SetOperationsTest, Elements64)
+{
+    CheckAll<ZyanU64>();
+}
+
+TEST(SetOperationsTest, Skewed)
+{
+    // Size ratios above the galloping threshold, with matches at both ends
+    auto large = MakeSet<ZyanU32>(100000, 10000000, 1);
+    std::vector<ZyanU32> small = { large.front(), large[500], large[500] + 1, large[77777],
+        large.back() };
+    std::sort(small.begin(), small.end());
+    small.erase(std::unique(small.begin(), small.end()), small.end());
+    CheckOperations(small, large);
+    CheckOperations(std::vector<ZyanU32>{ large.back() + 1 }, large);
+    CheckOperations(std::vector<ZyanU32>{ 0 }, large);
+
+    auto large64 = MakeSet<ZyanU64>(100000, ~0ULL >> 16, 2, true);
+    CheckOperations(std::vector<ZyanU64>{ large64[1], large64[99998] }, large64);
+}
+
+TEST(SetOperationsTest, Equal)
+{
+    const auto set = MakeSet<ZyanU32>(1000, 5000, 3);
+    CheckOperations(set, set);
+    const auto set64 = MakeSet<ZyanU64>(1000, 5000, 4, true);
+    CheckOperations(set64, set64);
+}
+
+TEST(SetOperationsTest, InvalidArguments)
+{
+    std::vector<ZyanU32> a = { 1, 2, 3 };
+    std::vector<ZyanU64> b = { 1, 2, 3 };
+    ZyanVector first = MakeVector(a);
+    ZyanVector second = MakeVector(b);
+    ZyanVector result;
+    ASSERT_EQ(ZyanVectorInit(&result, sizeof(ZyanU32), 0, nullptr), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanSetUnion(&first, &second, &result), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanSetUnion(&first, &first, &first), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanSetIntersection(&first, nullptr, &result), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanSetDifference(&first, &first, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    std::vector<ZyanU16> c = { 1, 2, 3 };
+    ZyanVector third = MakeVector(c);
+    EXPECT_EQ(ZyanSetMerge(&third, &third, &result), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    // The previous content of the result vector is discarded
+    ASSERT_EQ(ZyanSetUnion(&first, &first, &result), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanSetUnion(&first, &first, &result), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(GetElements<ZyanU32>(&result), a);
+
+    EXPECT_EQ(ZyanVectorDestroy(&result), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,244 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanSlotMap` implementation.
+ */
+
+#include <iterator>
+#include <map>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/SlotMap.h>
+#include "Helpers.h"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Mirrors the internal slot layout (`value`, `generation`).
+ */
+struct Slot
+{
+    ZyanU32 value;
+    ZyanU32 generation;
+};
+
+static ZyanSlotMapHandle Insert(ZyanSlotMap* map, ZyanU64 value)
+{
+    ZyanSlotMapHandle handle;
+    EXPECT_EQ(ZyanSlotMapInsert(map, &value, &handle), ZYAN_STATUS_SUCCESS);
+    return handle;
+}
+
+/**
+ * @brief   Returns the value referred to by the given handle or `~0`, if the handle is stale.
+ */
+static ZyanU64 Get(const ZyanSlotMap* map, ZyanSlotMapHandle handle)
+{
+    const void* element;
+    const ZyanStatus status = ZyanSlotMapGet(map, handle, &element);
+    EXPECT_EQ(ZyanSlotMapContains(map, handle), status);
+    if (status != ZYAN_STATUS_TRUE)
+    {
+        EXPECT_EQ(status, ZYAN_STATUS_FALSE);
+        EXPECT_EQ(element, nullptr);
+        return ~0ULL;
+    }
+    return *static_cast<const ZyanU64*>(element);
+}
+
+static std::size_t destructor_calls = 0;
+
+static void CountDestructorCall(void*)
+{
+    ++destructor_calls;
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(SlotMapTest, StaleHandles)
+{
+    ZyanSlotMap map;
+    ASSERT_EQ(ZyanSlotMapInit(&map, sizeof(ZyanU64), nullptr), ZYAN_STATUS_SUCCESS);
+
+    // A zero-initialized handle never refers to an element
+    const ZyanSlotMapHandle null_handle = { 0, 0 };
+    EXPECT_EQ(Get(&map, null_handle), ~0ULL);
+
+    const ZyanSlotMapHandle a = Insert(&map, 1);
+    const ZyanSlotMapHandle b = Insert(&map, 2);
+    EXPECT_EQ(Get(&map, null_handle), ~0ULL);
+    EXPECT_EQ(Get(&map, a), 1u);
+
+    // The slot of `a` is reused, but the old handle stays stale
+    ASSERT_EQ(ZyanSlotMapErase(&map, a), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(ZyanSlotMapErase(&map, a), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(Get(&map, a), ~0ULL);
+    const ZyanSlotMapHandle c = Insert(&map, 3);
+    EXPECT_EQ(c.index, a.index);
+    EXPECT_NE(c.generation, a.generation);
+    EXPECT_EQ(Get(&map, a), ~0ULL);
+    EXPECT_EQ(ZyanSlotMapErase(&map, a), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(Get(&map, c), 3u);
+    EXPECT_EQ(Get(&map, b), 2u);
+
+    // Handles with made up generations or out of range indices
+    EXPECT_EQ(Get(&map, ZyanSlotMapHandle{ c.index, c.generation + 1 }), ~0ULL);
+    EXPECT_EQ(Get(&map, ZyanSlotMapHandle{ c.index, c.generation + 2 }), ~0ULL);
+    EXPECT_EQ(Get(&map, ZyanSlotMapHandle{ 2, 1 }), ~0ULL);
+
+    // Clearing invalidates all handles
+    ASSERT_EQ(ZyanSlotMapClear(&map), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(Get(&map, b), ~0ULL);
+    EXPECT_EQ(Get(&map, c), ~0ULL);
+    const ZyanSlotMapHandle d = Insert(&map, 4);
+    EXPECT_EQ(Get(&map, b), ~0ULL);
+    EXPECT_EQ(Get(&map, c), ~0ULL);
+    EXPECT_EQ(Get(&map, d), 4u);
+
+    EXPECT_EQ(ZyanSlotMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(SlotMapTest, GenerationWrapAround)
+{
+    ZyanSlotMap map;
+    ASSERT_EQ(ZyanSlotMapInit(&map, sizeof(ZyanU64), nullptr), ZYAN_STATUS_SUCCESS);
+
+    // Fast-forward the slot to its last generation
+    ZyanSlotMapHandle a = Insert(&map, 1);
+    ASSERT_EQ(map.slots.element_size, sizeof(Slot));
+    static_cast<Slot*>(map.slots.data)[a.index].generation = 0xFFFFFFFF;
+    a.generation = 0xFFFFFFFF;
+    EXPECT_EQ(Get(&map, a), 1u);
+
+    // The slot is retired instead of wrapping around to generation `0`
+    ASSERT_EQ(ZyanSlotMapErase(&map, a), ZYAN_STATUS_TRUE);
+    const ZyanSlotMapHandle b = Insert(&map, 2);
+    EXPECT_NE(b.index, a.index);
+    EXPECT_EQ(Get(&map, a), ~0ULL);
+    EXPECT_EQ(Get(&map, ZyanSlotMapHandle{ a.index, 0 }), ~0ULL);
+    EXPECT_EQ(Get(&map, ZyanSlotMapHandle{ a.index, 1 }), ~0ULL);
+    EXPECT_EQ(Get(&map, b), 2u);
+
+    EXPECT_EQ(ZyanSlotMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(SlotMapTest, FreeListOrder)
+{
+    ZyanSlotMap map;
+    ASSERT_EQ(ZyanSlotMapInit(&map, sizeof(ZyanU64), nullptr), ZYAN_STATUS_SUCCESS);
+
+    std::vector<ZyanSlotMapHandle> handles;
+    for (ZyanU64 i = 0; i < 8; ++i)
+    {
+        handles.push_back(Insert(&map, i));
+        EXPECT_EQ(handles.back().index, i);
+    }
+
+    // Freed slots are reused in LIFO order, before any new slot is appended
+    for (const ZyanU32 index : { 2u, 5u, 0u })
+    {
+        ASSERT_EQ(ZyanSlotMapErase(&map, handles[index]), ZYAN_STATUS_TRUE);
+    }
+    for (const ZyanU32 index : { 0u, 5u, 2u, 8u, 9u })
+    {
+        EXPECT_EQ(Insert(&map, 100 + index).index, index);
+    }
+
+    EXPECT_EQ(ZyanSlotMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(SlotMapTest, DenseStorage)
+{
+    ZyanSlotMap map;
+    ASSERT_EQ(ZyanSlotMapInit(&map, sizeof(ZyanU64), &CountDestructorCall), ZYAN_STATUS_SUCCESS);
+    destructor_calls = 0;
+
+    // Random inserts and erasures compared with a reference map
+    std::map<ZyanU64, ZyanSlotMapHandle> reference;
+    std::size_t inserted = 0;
+    ZyanU64 state = 3;
+    for (ZyanU64 i = 0; i < 3000; ++i)
+    {
+        const ZyanU64 random = NextRandom(state);
+        if (reference.empty() || ((random >> 33) % 3))
+        {
+            reference[i] = Insert(&map, i);
+            ++inserted;
+        } else
+        {
+            auto it = reference.begin();
+            std::advance(it, (random >> 40) % reference.size());
+            ASSERT_EQ(ZyanSlotMapErase(&map, it->second), ZYAN_STATUS_TRUE);
+            reference.erase(it);
+        }
+    }
+    const std::size_t erased = destructor_calls;
+
+    ZyanUSize size;
+    ASSERT_EQ(ZyanSlotMapGetSize(&map, &size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(size, reference.size());
+    EXPECT_EQ(erased, inserted - size);
+    for (const auto& entry : reference)
+    {
+        EXPECT_EQ(Get(&map, entry.second), entry.first);
+    }
+
+    // Every element of the dense array maps back to its own handle
+    const void* elements;
+    ASSERT_EQ(ZyanSlotMapGetElements(&map, &elements), ZYAN_STATUS_SUCCESS);
+    for (ZyanUSize i = 0; i < size; ++i)
+    {
+        const ZyanU64 value = static_cast<const ZyanU64*>(elements)[i];
+        ZyanSlotMapHandle handle;
+        ASSERT_EQ(ZyanSlotMapGetHandle(&map, i, &handle), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(reference.count(value), 1u);
+        EXPECT_EQ(handle.index, reference[value].index);
+        EXPECT_EQ(handle.generation, reference[value].generation);
+    }
+
+    EXPECT_EQ(ZyanSlotMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(destructor_calls, inserted);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
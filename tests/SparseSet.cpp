@@ -0,0 +1,235 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanSparseSet` implementation.
+ */
+
+#include <algorithm>
+#include <set>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/SparseSet.h>
+#include "Helpers.h"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns the dense array of the set.
+ */
+static std::vector<ZyanU32> GetElements(const ZyanSparseSet* set)
+{
+    const ZyanU32* elements;
+    EXPECT_EQ(ZyanSparseSetGetElements(set, &elements), ZYAN_STATUS_SUCCESS);
+    ZyanUSize size;
+    EXPECT_EQ(ZyanSparseSetGetSize(set, &size), ZYAN_STATUS_SUCCESS);
+    return std::vector<ZyanU32>(elements, elements + size);
+}
+
+/**
+ * @brief   Checks that the sparse array maps every present element to its dense position.
+ */
+static void ExpectConsistent(const ZyanSparseSet* set)
+{
+    const auto elements = GetElements(set);
+    for (ZyanU32 i = 0; i < elements.size(); ++i)
+    {
+        ASSERT_LT(elements[i], set->universe);
+        EXPECT_EQ(set->sparse[elements[i]], i);
+        EXPECT_EQ(ZyanSparseSetContains(set, elements[i]), ZYAN_STATUS_TRUE);
+    }
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(SparseSetTest, SwapWithLast)
+{
+    ZyanSparseSet set;
+    ASSERT_EQ(ZyanSparseSetInit(&set, 16), ZYAN_STATUS_SUCCESS);
+
+    for (const ZyanU32 element : { 5u, 3u, 9u, 1u, 15u })
+    {
+        ASSERT_EQ(ZyanSparseSetInsert(&set, element), ZYAN_STATUS_TRUE);
+    }
+    EXPECT_EQ(ZyanSparseSetInsert(&set, 9), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(GetElements(&set), (std::vector<ZyanU32>{ 5, 3, 9, 1, 15 }));
+    ExpectConsistent(&set);
+
+    // The last element fills the gap
+    ASSERT_EQ(ZyanSparseSetRemove(&set, 3), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(GetElements(&set), (std::vector<ZyanU32>{ 5, 15, 9, 1 }));
+    ExpectConsistent(&set);
+    EXPECT_EQ(ZyanSparseSetContains(&set, 3), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(ZyanSparseSetRemove(&set, 3), ZYAN_STATUS_FALSE);
+
+    // Removing the last element itself
+    ASSERT_EQ(ZyanSparseSetRemove(&set, 1), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(GetElements(&set), (std::vector<ZyanU32>{ 5, 15, 9 }));
+    ExpectConsistent(&set);
+
+    ASSERT_EQ(ZyanSparseSetRemove(&set, 5), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(GetElements(&set), (std::vector<ZyanU32>{ 9, 15 }));
+    ExpectConsistent(&set);
+
+    ZyanU32 element;
+    ASSERT_EQ(ZyanSparseSetPop(&set, &element), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(element, 15u);
+    ASSERT_EQ(ZyanSparseSetPop(&set, &element), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(element, 9u);
+    EXPECT_EQ(ZyanSparseSetPop(&set, &element), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(ZyanSparseSetContains(&set, 9), ZYAN_STATUS_FALSE);
+
+    EXPECT_EQ(ZyanSparseSetDestroy(&set), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(SparseSetTest, ClearWithStaleEntries)
+{
+    ZyanSparseSet set;
+    ASSERT_EQ(ZyanSparseSetInit(&set, 8), ZYAN_STATUS_SUCCESS);
+
+    for (ZyanU32 element = 0; element < 8; ++element)
+    {
+        ASSERT_EQ(ZyanSparseSetInsert(&set, element), ZYAN_STATUS_TRUE);
+    }
+    ASSERT_EQ(ZyanSparseSetClear(&set), ZYAN_STATUS_SUCCESS);
+    EXPECT_TRUE(GetElements(&set).empty());
+    for (ZyanU32 element = 0; element < 8; ++element)
+    {
+        EXPECT_EQ(ZyanSparseSetContains(&set, element), ZYAN_STATUS_FALSE);
+        EXPECT_EQ(ZyanSparseSetRemove(&set, element), ZYAN_STATUS_FALSE);
+    }
+
+    // The sparse entries of `0` and `1` still point to positions inside the new dense range, but
+    // the dense array holds different elements there
+    ASSERT_EQ(ZyanSparseSetInsert(&set, 7), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(ZyanSparseSetInsert(&set, 6), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(ZyanSparseSetContains(&set, 0), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(ZyanSparseSetContains(&set, 1), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(ZyanSparseSetRemove(&set, 0), ZYAN_STATUS_FALSE);
+    ASSERT_EQ(ZyanSparseSetInsert(&set, 1), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(ZyanSparseSetInsert(&set, 0), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(ZyanSparseSetInsert(&set, 0), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(GetElements(&set), (std::vector<ZyanU32>{ 7, 6, 1, 0 }));
+    ExpectConsistent(&set);
+
+    // A stale entry that points to its own old position
+    ASSERT_EQ(ZyanSparseSetClear(&set), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanSparseSetInsert(&set, 7), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(ZyanSparseSetContains(&set, 6), ZYAN_STATUS_FALSE);
+    ASSERT_EQ(ZyanSparseSetInsert(&set, 6), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(GetElements(&set), (std::vector<ZyanU32>{ 7, 6 }));
+    ExpectConsistent(&set);
+
+    EXPECT_EQ(ZyanSparseSetDestroy(&set), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(SparseSetTest, OutOfUniverse)
+{
+    ZyanSparseSet set;
+    ASSERT_EQ(ZyanSparseSetInit(&set, 100), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanSparseSetInsert(&set, 99), ZYAN_STATUS_TRUE);
+    for (const ZyanU32 element : { 100u, 101u, 0x80000000u, 0xFFFFFFFFu })
+    {
+        EXPECT_EQ(ZyanSparseSetInsert(&set, element), ZYAN_STATUS_OUT_OF_RANGE);
+        EXPECT_EQ(ZyanSparseSetRemove(&set, element), ZYAN_STATUS_FALSE);
+        EXPECT_EQ(ZyanSparseSetContains(&set, element), ZYAN_STATUS_FALSE);
+    }
+    EXPECT_EQ(GetElements(&set), (std::vector<ZyanU32>{ 99 }));
+
+    ZyanU32 universe;
+    ASSERT_EQ(ZyanSparseSetGetUniverse(&set, &universe), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(universe, 100u);
+
+    EXPECT_EQ(ZyanSparseSetDestroy(&set), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanSparseSetInit(&set, 0), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST(SparseSetTest, Randomized)
+{
+    ZyanSparseSet set;
+    ASSERT_EQ(ZyanSparseSetInit(&set, 1000), ZYAN_STATUS_SUCCESS);
+    std::set<ZyanU32> reference;
+
+    ZyanU64 state = 5;
+    for (int i = 0; i < 20000; ++i)
+    {
+        const ZyanU64 random = NextRandom(state);
+        const ZyanU32 element = static_cast<ZyanU32>((random >> 33) % 1000);
+        switch ((random >> 20) % 16)
+        {
+        case 0:
+            if (i % 64 == 0)
+            {
+                ASSERT_EQ(ZyanSparseSetClear(&set), ZYAN_STATUS_SUCCESS);
+                reference.clear();
+            }
+            break;
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+            ASSERT_EQ(ZyanSparseSetRemove(&set, element),
+                reference.erase(element) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+            break;
+        default:
+            ASSERT_EQ(ZyanSparseSetInsert(&set, element),
+                reference.insert(element).second ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+            break;
+        }
+        ASSERT_EQ(ZyanSparseSetContains(&set, element),
+            reference.count(element) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+    }
+
+    auto elements = GetElements(&set);
+    ExpectConsistent(&set);
+    std::sort(elements.begin(), elements.end());
+    EXPECT_EQ(elements, std::vector<ZyanU32>(reference.begin(), reference.end()));
+
+    EXPECT_EQ(ZyanSparseSetDestroy(&set), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,204 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanStringInterner` implementation.
+ */
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/StringInterner.h>
+#include "Helpers.h"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+static ZyanStatus Intern(ZyanStringInterner* interner, const std::string& string, ZyanU32* id)
+{
+    const ZyanStringView view = MakeView(string);
+    return ZyanStringInternerIntern(interner, &view, id);
+}
+
+static ZyanStatus Find(const ZyanStringInterner* interner, const std::string& string,
+    ZyanU32* id)
+{
+    const ZyanStringView view = MakeView(string);
+    return ZyanStringInternerFind(interner, &view, id);
+}
+
+/**
+ * @brief   Returns the string with the given id.
+ */
+static std::string GetString(const ZyanStringInterner* interner, ZyanU32 id)
+{
+    const char* data;
+    ZyanUSize length;
+    EXPECT_EQ(ZyanStringInternerGetString(interner, id, &data, &length), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(data[length], '\0');
+    return std::string(data, length);
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(StringInternerTest, SameStringSameId)
+{
+    ZyanStringInterner interner;
+    ASSERT_EQ(ZyanStringInternerInit(&interner), ZYAN_STATUS_SUCCESS);
+
+    ZyanU32 first;
+    ZyanU32 second;
+    ASSERT_EQ(Intern(&interner, "hello", &first), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(first, 0u);
+
+    // A different buffer with the same content
+    const std::string copy = std::string("hel") + "lo";
+    ASSERT_EQ(Intern(&interner, copy, &second), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(second, first);
+    ASSERT_EQ(Find(&interner, copy, &second), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(second, first);
+
+    // The data is returned from the interner storage
+    const char* data;
+    ASSERT_EQ(ZyanStringInternerGetString(&interner, first, &data, nullptr), ZYAN_STATUS_SUCCESS);
+    EXPECT_NE(data, copy.c_str());
+    EXPECT_STREQ(data, "hello");
+    ZyanStringView view;
+    ASSERT_EQ(ZyanStringInternerGetView(&interner, first, &view), ZYAN_STATUS_SUCCESS);
+    const char* view_data;
+    ASSERT_EQ(ZyanStringViewGetData(&view, &view_data), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(view_data, data);
+
+    ZyanUSize size;
+    ASSERT_EQ(ZyanStringInternerGetSize(&interner, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 1u);
+
+    EXPECT_EQ(ZyanStringInternerDestroy(&interner), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(StringInternerTest, DistinctStringsDistinctIds)
+{
+    ZyanStringInterner interner;
+    ASSERT_EQ(ZyanStringInternerInit(&interner), ZYAN_STATUS_SUCCESS);
+
+    // Prefixes, different case, the empty string and embedded `\0` characters
+    const std::vector<std::string> strings = { "a", "ab", "abc", "A", "", std::string("a\0b", 3),
+        std::string("a\0c", 3), std::string(1, '\0'), "abc " };
+    for (ZyanU32 i = 0; i < strings.size(); ++i)
+    {
+        ZyanU32 id;
+        ASSERT_EQ(Intern(&interner, strings[i], &id), ZYAN_STATUS_TRUE) << i;
+        EXPECT_EQ(id, i);
+    }
+    for (ZyanU32 i = 0; i < strings.size(); ++i)
+    {
+        ZyanU32 id;
+        ASSERT_EQ(Intern(&interner, strings[i], &id), ZYAN_STATUS_FALSE) << i;
+        EXPECT_EQ(id, i);
+        EXPECT_EQ(GetString(&interner, i), strings[i]);
+    }
+
+    ZyanU32 id = 12345;
+    EXPECT_EQ(Find(&interner, "abcd", &id), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(Find(&interner, "abcd", nullptr), ZYAN_STATUS_FALSE);
+
+    const char* data;
+    EXPECT_EQ(ZyanStringInternerGetString(&interner, static_cast<ZyanU32>(strings.size()), &data,
+        nullptr), ZYAN_STATUS_OUT_OF_RANGE);
+
+    EXPECT_EQ(ZyanStringInternerDestroy(&interner), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(StringInternerTest, ArenaGrowth)
+{
+    ZyanStringInterner interner;
+    ASSERT_EQ(ZyanStringInternerInitEx(&interner, 64, ZyanAllocatorDefault()),
+        ZYAN_STATUS_SUCCESS);
+
+    // Many small strings span a lot of blocks, some strings need a dedicated block
+    std::vector<std::string> strings;
+    std::vector<const char*> pointers;
+    for (ZyanU32 i = 0; i < 5000; ++i)
+    {
+        std::string string = "string_" + std::to_string(i);
+        if (i % 500 == 0)
+        {
+            string += std::string(200, static_cast<char>('a' + i % 26));
+        }
+
+        ZyanU32 id;
+        ASSERT_EQ(Intern(&interner, string, &id), ZYAN_STATUS_TRUE);
+        ASSERT_EQ(id, i);
+        const char* data;
+        ASSERT_EQ(ZyanStringInternerGetString(&interner, id, &data, nullptr),
+            ZYAN_STATUS_SUCCESS);
+        strings.push_back(std::move(string));
+        pointers.push_back(data);
+    }
+
+    // Earlier strings are neither moved nor lost while the storage and the index grow
+    for (ZyanU32 i = 0; i < strings.size(); ++i)
+    {
+        ZyanU32 id;
+        ASSERT_EQ(Find(&interner, strings[i], &id), ZYAN_STATUS_TRUE);
+        EXPECT_EQ(id, i);
+        const char* data;
+        ASSERT_EQ(ZyanStringInternerGetString(&interner, i, &data, nullptr), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(data, pointers[i]);
+        EXPECT_EQ(std::string(data), strings[i]);
+    }
+
+    // Clearing restarts the ids
+    ASSERT_EQ(ZyanStringInternerClear(&interner), ZYAN_STATUS_SUCCESS);
+    ZyanUSize size;
+    ASSERT_EQ(ZyanStringInternerGetSize(&interner, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 0u);
+    EXPECT_EQ(Find(&interner, strings[0], nullptr), ZYAN_STATUS_FALSE);
+    ZyanU32 id;
+    ASSERT_EQ(Intern(&interner, strings[1], &id), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(id, 0u);
+    EXPECT_EQ(GetString(&interner, 0), strings[1]);
+
+    EXPECT_EQ(ZyanStringInternerDestroy(&interner), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */